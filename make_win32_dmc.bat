@@ -5,8 +5,10 @@
 
 @REM ------ Generate fileliest
 @move src\tools\txt2c.c src\tools\txt2c.c.temp > nul
+@move src\tools\bench_lookup.c src\tools\bench_lookup.c.temp > nul
 @dir /s /b src\*.c > files
 @move src\tools\txt2c.c.temp src\tools\txt2c.c > nul
+@move src\tools\bench_lookup.c.temp src\tools\bench_lookup.c > nul
 
 @dmc -Isrc/lua @files -o bam.exe
 
@@ -0,0 +1,249 @@
+#!/usr/bin/env python
+
+# Synthetic benchmarks for bam. Each benchmark generates a project in a
+# temporary directory, runs bam on it with an event log and reports the
+# timing of the interesting phases.
+#
+# Run:
+# benchmark.py [-b path/to/bam] [-j threads] [-r runs] [benchmark ...] [-- bam flags]
+#
+# Without any benchmark names all of them are run. Everything after --
+# is passed on to bam.
+
+from __future__ import print_function
+import os, sys, shutil, subprocess, tempfile, time
+
+bam = os.path.abspath("bam")
+if os.name == 'nt':
+	bam = os.path.abspath("bam.exe")
+threads = 0
+runs = 3
+extra_flags = []
+
+def write_file(path, content):
+	f = open(path, "w")
+	f.write(content)
+	f.close()
+
+def parse_eventlog(path):
+	""" returns a dictionary with the duration of each event on thread 0 """
+	begins = {}
+	durations = {}
+	for line in open(path):
+		parts = line.split(" ", 4)
+		if len(parts) < 4 or parts[0] != "0":
+			continue
+		t = float(parts[1])
+		name = parts[3].rstrip(":\n")
+		if parts[2] == "begin":
+			begins[name] = t
+		elif parts[2] == "end" and name in begins:
+			durations[name] = durations.get(name, 0.0) + t - begins.pop(name)
+	return durations
+
+def run_bam(path, flags):
+	""" runs bam in path and returns (wallclock, eventlog durations) """
+	eventlog = os.path.join(path, "eventlog.txt")
+	cmdline = [bam, "--debug-eventlog", eventlog] + flags + extra_flags
+	if threads:
+		cmdline += ["-j", str(threads)]
+	start = time.time()
+	p = subprocess.Popen(cmdline, cwd=path, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, universal_newlines=True)
+	output = p.communicate()[0]
+	wallclock = time.time() - start
+	if p.returncode != 0:
+		print(output)
+		raise Exception("bam returned %d" % p.returncode)
+	return (wallclock, parse_eventlog(eventlog))
+
+def report(name, results, extra=""):
+	results.sort()
+	print("%-30s best %8.3fs  median %8.3fs %s" % (name, results[0], results[len(results)//2], extra))
+
+# layered graph of jobs where every job depends on two jobs in the layer below
+def write_layered_jobs(path, width, depth, command):
+	write_file(os.path.join(path, "bam.lua"), """
+local width = %d
+local depth = %d
+local last = {}
+for l = 0, depth-1 do
+	local layer = {}
+	for w = 0, width-1 do
+		local name = string.format("out/layer%%03d/job%%05d", l, w)
+		AddJob(name, name, "%s")
+		SkipOutputVerification(name)
+		if l > 0 then
+			AddDependency(name, last[(w*7) %% width + 1], last[(w*13+5) %% width + 1])
+		end
+		layer[w+1] = name
+	end
+	last = layer
+end
+DefaultTarget(PseudoTarget("all_jobs", last))
+""" % (width, depth, command))
+
+def build_layered_jobs(path, name, width, depth):
+	builds = []
+	for i in range(runs):
+		wallclock, events = run_bam(path, ["-f", "-r", ""])
+		builds += [events.get("build", wallclock)]
+	num_jobs = width*depth
+	report("%s (%d jobs)" % (name, num_jobs), builds, "(%.0f jobs/s)" % (num_jobs / min(builds)))
+
+# jobs: no-op jobs, measures the scheduler and job launching
+def bench_jobs(path, width=200, depth=100):
+	write_layered_jobs(path, width, depth, ":")
+	build_layered_jobs(path, "jobs", width, depth)
+
+# waitjobs: jobs that sleeps, measures how fast idle threads picks up new jobs
+def bench_waitjobs(path, width=32, depth=25):
+	write_layered_jobs(path, width, depth, "sleep 0.02")
+	build_layered_jobs(path, "waitjobs", width, depth)
+
+# widejobs: few but wide layers, lots of jobs waiting to be scheduled at once
+def bench_widejobs(path, width=5000, depth=4):
+	write_layered_jobs(path, width, depth, ":")
+	build_layered_jobs(path, "widejobs", width, depth)
+
+# noopjobs: jobs that runs an executable without any shell syntax, measures process launching
+def bench_noopjobs(path, width=500, depth=20):
+	write_layered_jobs(path, width, depth, "true")
+	build_layered_jobs(path, "noopjobs", width, depth)
+
+# prepare: a large graph of jobs that haven't been built, measures the walk
+# that checks which nodes that are dirty
+def bench_prepare(path, width=10000, depth=100):
+	write_layered_jobs(path, width, depth, ":")
+	run_bam(path, ["--dry", "-r", ""])
+	prepares = []
+	for i in range(runs):
+		wallclock, events = run_bam(path, ["--dry", "-r", ""])
+		prepares += [events.get("prepare", wallclock)]
+	num_nodes = width*depth
+	report("prepare (%d nodes)" % num_nodes, prepares, "(%.0f nodes/s)" % (num_nodes / min(prepares)))
+
+# find: looks up every node from the script in graphs of different sizes,
+# measures the node index. the script is also run without the lookups and
+# the difference is the time they took
+def bench_find(path, sizes=[10000, 100000, 1000000], lookups=2000000):
+	write_file(os.path.join(path, "bam.lua"), """
+local num = tonumber(ScriptArgs.nodes)
+local rounds = tonumber(ScriptArgs.rounds)
+local names = {}
+for i = 1, num do
+	names[i] = string.format("out/dir%03d/node%07d", i % 1000, i)
+	AddJob(names[i], names[i], ":")
+end
+for r = 1, rounds do
+	for i = 1, num do
+		NodeExist(names[i])
+	end
+end
+DefaultTarget(PseudoTarget("all", names[1]))
+""")
+	for num in sizes:
+		rounds = max(lookups // num, 1)
+		finds = []
+		for i in range(runs):
+			wallclock, without = run_bam(path, ["--dry", "-r", "", "nodes=%d" % num, "rounds=0"])
+			wallclock, events = run_bam(path, ["--dry", "-r", "", "nodes=%d" % num, "rounds=%d" % rounds])
+			finds += [max(events.get("script", 0) - without.get("script", 0), 0.000001)]
+		report("find (%d nodes)" % num, finds, "(%.0f lookups/s)" % (num * rounds / min(finds)))
+
+# cppscan: cold header scanning of a tree of sources and headers, measures the deferred cpp pass
+def bench_cppscan(path, num_sources=2000, num_headers=4000, filler=200):
+	os.mkdir(os.path.join(path, "src"))
+	body = "".join(["int filler_%d_%%d(int a) { return a * %d; }\n" % (i, i) for i in range(filler)])
+	for i in range(num_headers):
+		includes = ""
+		if i > 0:
+			includes += "#include \"h%05d.h\"\n" % (i // 2)
+		if i > 2:
+			includes += "#include \"h%05d.h\"\n" % (i // 3)
+		write_file(os.path.join(path, "src", "h%05d.h" % i), includes + "#include <stddef.h>\n" + body.replace("%d", "h%d" % i))
+	for i in range(num_sources):
+		includes = "#include \"h%05d.h\"\n#include \"h%05d.h\"\n" % (num_headers-1-i, (i*37) % num_headers)
+		write_file(os.path.join(path, "src", "s%05d.c" % i), includes + body.replace("%d", "s%d" % i))
+	write_file(os.path.join(path, "bam.lua"), """
+local s = NewSettings()
+DefaultTarget(PseudoTarget("all", Compile(s, Collect("src/*.c"))))
+""")
+	scans = []
+	for i in range(runs):
+		wallclock, events = run_bam(path, ["-n", "--dry"])
+		scans += [events.get("deferred cpp dependencies", wallclock) + events.get("deferred cpp dependencies 2", 0)]
+	report("cppscan (%d files)" % (num_sources + num_headers), scans, "(%.0f files/s)" % ((num_sources + num_headers) / min(scans)))
+
+# scan: few but large sources and headers, measures the #include scanner itself
+def bench_scan(path, num_files=100, lines=8000):
+	os.mkdir(os.path.join(path, "src"))
+	filler = [
+		"static int function_%d(int argument) { return argument * 2; } /* comment # */\n",
+		"#define MACRO_%d(x) ((x) + 1)\n",
+		"\tint variable_%d = MACRO(1) + sizeof(struct thing);\n",
+		"#if defined(FEATURE_%d)\n#endif\n",
+	]
+	total = 0
+	for i in range(num_files):
+		for kind, name in [("h", "h%05d.h" % i), ("c", "s%05d.c" % i)]:
+			content = ["#include <stddef.h>\n"]
+			if kind == "c":
+				content += ["#include \"h%05d.h\"\n" % i]
+			for l in range(lines):
+				content += [filler[l % len(filler)] % l]
+			content = "".join(content)
+			total += len(content)
+			write_file(os.path.join(path, "src", name), content)
+	write_file(os.path.join(path, "bam.lua"), """
+local s = NewSettings()
+DefaultTarget(PseudoTarget("all", Compile(s, Collect("src/*.c"))))
+""")
+	scans = []
+	for i in range(runs):
+		wallclock, events = run_bam(path, ["-n", "--dry", "-j", "1"])
+		scans += [events.get("deferred cpp dependencies", wallclock) + events.get("deferred cpp dependencies 2", 0)]
+	report("scan (%.1f MB)" % (total / 1e6), scans, "(%.0f MB/s)" % (total / 1e6 / min(scans)))
+
+benchmarks = [
+	("jobs", bench_jobs),
+	("widejobs", bench_widejobs),
+	("noopjobs", bench_noopjobs),
+	("waitjobs", bench_waitjobs),
+	("cppscan", bench_cppscan),
+	("scan", bench_scan),
+	("prepare", bench_prepare),
+	("find", bench_find),
+]
+
+def main(args):
+	global bam, threads, runs, extra_flags
+	selected = []
+	i = 0
+	while i < len(args):
+		if args[i] == "--":
+			extra_flags = args[i+1:]
+			break
+		elif args[i] == "-b":
+			bam = os.path.abspath(args[i+1])
+			i += 1
+		elif args[i] == "-j":
+			threads = int(args[i+1])
+			i += 1
+		elif args[i] == "-r":
+			runs = int(args[i+1])
+			i += 1
+		else:
+			selected += [args[i]]
+		i += 1
+
+	for name, func in benchmarks:
+		if len(selected) and not name in selected:
+			continue
+		path = tempfile.mkdtemp(prefix="bam_bench_")
+		try:
+			func(path)
+		finally:
+			shutil.rmtree(path, True)
+
+if __name__ == "__main__":
+	main(sys.argv[1:])
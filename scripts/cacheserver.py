@@ -0,0 +1,137 @@
+#!/usr/bin/env python3
+
+# Reference server for bam's --artifact-cache. Entries are kept as files
+# in a directory and are fetched with GET, checked for with HEAD and added
+# with PUT at /<path>/<key>. The server doesn't look inside the entries.
+#
+# usage: cacheserver.py directory [port | unix:/path/to/socket] [size in mb]
+#
+# The least recently used entries are removed when the directory grows
+# larger than the size limit (default 1024 mb).
+
+import os, sys, threading, socketserver
+from http.server import BaseHTTPRequestHandler, HTTPServer
+
+lock = threading.Lock()
+
+class Handler(BaseHTTPRequestHandler):
+	protocol_version = "HTTP/1.1"
+
+	# the headers and the body are sent separately, don't wait with the body
+	def setup(self):
+		self.disable_nagle_algorithm = isinstance(self.server, TCPServer)
+		BaseHTTPRequestHandler.setup(self)
+
+	def entry_path(self):
+		key = self.path.rstrip("/").split("/")[-1]
+		if len(key) != 16 or not all(c in "0123456789abcdef" for c in key):
+			return None
+		return os.path.join(self.server.directory, key)
+
+	def reply(self, status, length = 0):
+		self.send_response(status)
+		self.send_header("Content-Length", str(length))
+		self.end_headers()
+
+	def do_HEAD(self):
+		path = self.entry_path()
+		if path and os.path.isfile(path):
+			self.reply(200, os.path.getsize(path))
+		else:
+			self.reply(404)
+
+	def do_GET(self):
+		path = self.entry_path()
+		try:
+			f = open(path, "rb")
+		except (TypeError, IOError):
+			self.reply(404)
+			return
+
+		# bump the entry so it's kept
+		with f:
+			data = f.read()
+		try:
+			os.utime(path, None)
+		except OSError:
+			pass
+		self.reply(200, len(data))
+		self.wfile.write(data)
+
+	def do_PUT(self):
+		path = self.entry_path()
+		length = int(self.headers.get("Content-Length", 0))
+		data = self.rfile.read(length)
+		if not path or len(data) != length:
+			self.close_connection = True
+			self.reply(400)
+			return
+
+		# write it next to the entry and rename it so no one sees half of it
+		tmp = "%s.%d.tmp" % (path, threading.get_ident())
+		with open(tmp, "wb") as f:
+			f.write(data)
+		os.replace(tmp, path)
+		self.reply(201)
+		self.server.trim()
+
+	# unix sockets doesn't have a client address to log
+	def log_message(self, format, *args):
+		pass
+
+class Server:
+	daemon_threads = True
+
+	def trim(self):
+		with lock:
+			entries = []
+			for name in os.listdir(self.directory):
+				if name.endswith(".tmp"):
+					continue
+				try:
+					st = os.stat(os.path.join(self.directory, name))
+				except OSError:
+					continue
+				entries += [(st.st_mtime, st.st_size, name)]
+			size = sum(e[1] for e in entries)
+			for used, entrysize, name in sorted(entries):
+				if size <= self.maxsize:
+					break
+				os.remove(os.path.join(self.directory, name))
+				size -= entrysize
+
+class TCPServer(Server, socketserver.ThreadingMixIn, HTTPServer):
+	pass
+
+class UnixServer(Server, socketserver.ThreadingMixIn, socketserver.UnixStreamServer):
+	pass
+
+def main(args):
+	if len(args) < 1:
+		print("usage: cacheserver.py directory [port | unix:/path/to/socket] [size in mb]")
+		return 1
+
+	directory = args[0]
+	address = args[1] if len(args) > 1 else "8080"
+	maxsize = int(args[2] if len(args) > 2 else 1024) * 1024 * 1024
+
+	if not os.path.isdir(directory):
+		os.makedirs(directory)
+
+	if address.startswith("unix:"):
+		if os.path.exists(address[5:]):
+			os.remove(address[5:])
+		server = UnixServer(address[5:], Handler)
+	else:
+		server = TCPServer(("", int(address)), Handler)
+
+	server.directory = directory
+	server.maxsize = maxsize
+	try:
+		server.serve_forever()
+	except KeyboardInterrupt:
+		pass
+	return 0
+
+if __name__ == "__main__":
+	sys.exit(main(sys.argv[1:]))
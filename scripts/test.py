@@ -1,7 +1,7 @@
 #!/usr/bin/env python
 
 from __future__ import print_function
-import os, sys, shutil, subprocess
+import os, sys, shutil, signal, subprocess, time
 
 extra_bam_flags = ""
 src_path = "tests"
@@ -119,6 +119,166 @@ def difftest(name, flags1, flags2):
 	else:
 		print("ok")
 
+def digesttest(name, flags, steps):
+	global failed_tests
+	if len(tests) and not name in tests:
+		return
+	testname = "digesttest: %s '%s': "%(name, flags)
+	print(testname, end=" ")
+	inputfile = os.path.join(output_path, name, "input.txt")
+	original = open(inputfile).read()
+
+	# each step changes the input and lists the labels of the jobs that should
+	# run, jobs that are restored from the artifact cache doesn't count
+	all_labels = []
+	for (change, labels) in steps:
+		all_labels += labels
+
+	failed = False
+	for (change, labels) in steps:
+		if change == "touch":
+			time.sleep(1.1)
+			os.utime(inputfile, None)
+		elif change == "change":
+			time.sleep(1.1)
+			f = open(inputfile, "a")
+			f.write("changed\n")
+			f.close()
+		elif change == "revert":
+			time.sleep(1.1)
+			f = open(inputfile, "w")
+			f.write(original)
+			f.close()
+		elif change == "remove":
+			os.remove(os.path.join(output_path, name, "output.txt"))
+
+		ret, report = run_bam(name, flags + " -r s -v")
+		ran = []
+		for l in report:
+			for label in all_labels:
+				if l.rstrip().endswith("] " + label) and not label in ran:
+					ran += [label]
+		for l in report:
+			for label in all_labels:
+				if l.rstrip().endswith("'%s' restored from the artifact cache" % label) and label in ran:
+					ran.remove(label)
+		if ret or sorted(ran) != sorted(labels):
+			print("FAILED! %s: %s ran, expected %s" % (change, str(ran), str(labels)))
+			for l in report:
+				print("\t", l.rstrip())
+			failed = True
+			break
+
+	if failed:
+		failed_tests += [testname]
+	else:
+		print("ok")
+
+# runs a digesttest with the artifact cache on scripts/cacheserver.py
+def cacheservertest(name, src, steps):
+	if os.name == 'nt' or (len(tests) and not name in tests):
+		return
+	socket = os.path.abspath(os.path.join(output_path, name + ".sock"))
+	copytree(os.path.join(src_path, src), os.path.join(output_path, name))
+	server = subprocess.Popen([sys.executable, "scripts/cacheserver.py", os.path.join(output_path, name + "_cache"), "unix:" + socket])
+	for i in range(0, 100):
+		if os.path.exists(socket):
+			break
+		time.sleep(0.1)
+	digesttest(name, "--artifact-cache unix:" + socket, steps)
+	server.terminate()
+	server.wait()
+
+# runs a digesttest with the builds done by bam --server
+def buildservertest(name, src, steps):
+	if os.name == 'nt' or (len(tests) and not name in tests):
+		return
+	copytree(os.path.join(src_path, src), os.path.join(output_path, name))
+	socket = os.path.join(output_path, name, ".bam", "server")
+	devnull = open(os.devnull, "w")
+	server = subprocess.Popen([os.path.abspath(os.path.join(output_path, name, bam)), "--server"], cwd=os.path.join(output_path, name), stdout=devnull)
+	for i in range(0, 100):
+		if os.path.exists(socket):
+			break
+		time.sleep(0.1)
+	digesttest(name, "--client", steps)
+	server.terminate()
+	server.wait()
+	devnull.close()
+
+# adds and removes files in the search paths and checks which ones that
+# were found. the searched directories are listed in the cache before each
+# change so the listings has to be found out of date
+def searchtest(name, steps):
+	global failed_tests
+	if len(tests) and not name in tests:
+		return
+	testname = "searchtest: %s: " % name
+	print(testname, end=" ")
+	failed = False
+	for (change, found) in steps:
+		time.sleep(1.1)
+		run_bam(name, "")
+		time.sleep(1.1)
+		if change.startswith("add "):
+			open(os.path.join(output_path, name, change[4:]), "w").close()
+		elif change.startswith("remove "):
+			os.remove(os.path.join(output_path, name, change[7:]))
+
+		ret, report = run_bam(name, "--debug-nodes")
+		deps = sorted(set([l.split()[-1] for l in report if l.split()[1:3] == ["------", "DEPEND"] and l.split()[-1] != "output.txt"]))
+		if ret or deps != sorted(found):
+			print("FAILED! %s: found %s, expected %s" % (change, str(deps), str(found)))
+			failed = True
+			break
+
+	if failed:
+		failed_tests += [testname]
+	else:
+		print("ok")
+
+# runs bam --watch, changes the input and checks that the job runs again
+# without the script running again or the build starting over
+def watchtest(name, src, label, input="input.txt"):
+	global failed_tests
+	if not sys.platform.startswith("linux") or (len(tests) and not name in tests):
+		return
+	testname = "watchtest: %s: " % name
+	print(testname, end=" ")
+	copytree(os.path.join(src_path, src), os.path.join(output_path, name))
+	path = os.path.join(output_path, name)
+	p = subprocess.Popen([os.path.abspath(os.path.join(path, bam)), "--watch", "-v", "-r", "s"], cwd=path, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, universal_newlines=True)
+
+	# the job runs once, and again when the input has changed
+	report = []
+	waits = 0
+	while waits < 2:
+		line = p.stdout.readline()
+		if not line:
+			break
+		report += [line]
+		if "waiting for changes" in line:
+			waits += 1
+			if waits == 1:
+				time.sleep(1.1)
+				f = open(os.path.join(path, input), "a")
+				f.write("changed\n")
+				f.close()
+	p.send_signal(signal.SIGINT)
+	report += p.stdout.readlines()
+	p.wait()
+
+	ran = [l for l in report if l.rstrip().endswith("] " + label)]
+	setups = [l for l in report if "setup started" in l]
+	restarts = [l for l in report if "starting over" in l]
+	if waits != 2 or len(ran) != 2 or len(setups) != 1 or len(restarts) != 0:
+		print("FAILED! '%s' ran %d times, the script %d times and the build started over %d times" % (label, len(ran), len(setups), len(restarts)))
+		for l in report:
+			print("\t", l.rstrip())
+		failed_tests += [testname]
+	else:
+		print("ok")
+
 def unittests():
 	global failed_tests
 	class Test:
@@ -249,6 +409,42 @@ test("import")
 test("multipleoutput")
 test("multipleoutput_deps")
 test("missingoutput", "", 1)
+difftest("ordered_output", "--ordered-output -r \"\" -j 1", "--ordered-output -r \"\" -j 8")
+digesttest("digest", "--digest", [
+	("build", ["generate mid.txt", "copy mid.txt"]),
+	("touch", []),
+	("change", ["generate mid.txt"])])
+digesttest("artifact", "--artifact-cache cache", [
+	("build", ["copy input.txt"]),
+	("remove", []),
+	("change", ["copy input.txt"]),
+	("revert", [])])
+cacheservertest("artifact_server", "artifact", [
+	("build", ["copy input.txt"]),
+	("remove", []),
+	("change", ["copy input.txt"]),
+	("revert", [])])
+buildservertest("buildserver", "artifact", [
+	("build", ["copy input.txt"]),
+	("build", []),
+	("touch", ["copy input.txt"]),
+	("remove", ["copy input.txt"]),
+	("change", ["copy input.txt"])])
+watchtest("watch", "artifact", "copy input.txt")
+watchtest("watchcollect", "watch_collect", "copy src/a.txt", "src/a.txt")
+searchtest("dependency_search", [
+	("build", ["p1/liba.a"]),
+	("add p3/libc.a", ["p1/liba.a", "p3/libc.a"]),
+	("add libb.a", ["p1/liba.a", "libb.a", "p3/libc.a"]),
+	("remove p3/libc.a", ["p1/liba.a", "libb.a"])])
+
+# same tests but with jobs started from a single thread
+test("retval", "--async -j 4", 1)
+test("deadlock", "--async -j 4")
+test("sharedlib", "--async -j 4 -c")
+test("sharedlib", "--async -j 4")
+test("missingoutput", "--async -j 4", 1)
+difftest("ordered_output", "--ordered-output -r \"\" -j 1", "--ordered-output -r \"\" --async -j 8")
 
 if len(failed_tests):
 	print("FAILED TESTS:")
@@ -0,0 +1,1081 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <errno.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#include "platform.h"
+
+#ifdef BAM_FAMILY_WINDOWS
+	#include <windows.h>
+#else
+	#include <fcntl.h>
+	#include <unistd.h>
+	#include <netdb.h>
+	#include <netinet/in.h>
+	#include <netinet/tcp.h>
+	#include <sys/socket.h>
+	#include <sys/un.h>
+	#ifdef BAM_PLATFORM_LINUX
+		#include <sys/ioctl.h>
+		#include <linux/fs.h> /* FICLONE */
+	#endif
+#endif
+
+#include "artifact.h"
+#include "hashtable.h"
+#include "node.h"
+#include "session.h"
+#include "support.h"
+
+#define ARTIFACT_UNKNOWN 2 /* lookup result for keys that couldn't be looked up */
+
+struct CONNECTION;
+
+/* where the entries are kept, a local directory or a server */
+struct ARTIFACTBACKEND
+{
+	/* sets found[i] to 1 or 0 for the keys that it could look up */
+	void (*lookup)(struct ARTIFACTCACHE *cache, const hash_t *keys, unsigned char *found, unsigned num);
+	int (*restore)(struct ARTIFACTCACHE *cache, hash_t key, struct JOB *job);
+	void (*store)(struct ARTIFACTCACHE *cache, hash_t key, struct JOB *job);
+	void (*destroy)(struct ARTIFACTCACHE *cache);
+};
+
+struct ARTIFACTCACHE
+{
+	const struct ARTIFACTBACKEND *backend;
+
+	/* keys from artifactcache_lookup, the value is 1 if the key was found */
+	struct HASHTABLE known;
+
+	/* local directory */
+	char path[512];
+	int64 maxsize;
+	volatile unsigned num_tmp; /* counter for unique names in the tmp directory */
+	volatile unsigned num_stored; /* number of entries added during this build */
+
+	/* server */
+	char host[256];
+	char port[16];
+	char socketpath[256]; /* set when connecting to a unix socket */
+	char prefix[256]; /* path of the entries on the server, starts and ends with a slash */
+	struct LOCK *poollock;
+	struct CONNECTION *pool; /* idle connections */
+	volatile unsigned num_unreachable; /* number of times a connection failed */
+};
+
+/* ******** local directory ******** */
+
+#ifdef BAM_FAMILY_WINDOWS
+	/* the copy gets the timestamp of the source, verify_outputs touches it */
+	static int copy_file(const char *src, const char *dst)
+	{
+		return CopyFileA(src, dst, FALSE) ? 0 : -1;
+	}
+
+	static int remove_directory(const char *path)
+	{
+		return RemoveDirectoryA(path) ? 0 : -1;
+	}
+
+	static unsigned process_id()
+	{
+		return (unsigned)GetCurrentProcessId();
+	}
+#else
+	/* the destination is removed first so anything that links to the old
+		file keeps it. the data is cloned where the file system can do it */
+	static int copy_file(const char *src, const char *dst)
+	{
+		char buffer[16*1024];
+		struct stat info;
+		ssize_t bytes = 0;
+		int error = 0;
+		int in, out;
+
+		in = open(src, O_RDONLY);
+		if(in < 0)
+			return -1;
+
+		if(fstat(in, &info) != 0)
+		{
+			close(in);
+			return -1;
+		}
+
+		remove(dst);
+		out = open(dst, O_WRONLY|O_CREAT|O_TRUNC, info.st_mode&0777);
+		if(out < 0)
+		{
+			close(in);
+			return -1;
+		}
+
+#ifdef FICLONE
+		if(ioctl(out, FICLONE, in) != 0)
+#endif
+		{
+			while((bytes = read(in, buffer, sizeof(buffer))) > 0)
+			{
+				if(write(out, buffer, bytes) != bytes)
+				{
+					error = 1;
+					break;
+				}
+			}
+			if(bytes < 0)
+				error = 1;
+		}
+
+		close(in);
+		if(close(out) != 0)
+			error = 1;
+
+		if(error)
+		{
+			remove(dst);
+			return -1;
+		}
+		return 0;
+	}
+
+	static int remove_directory(const char *path)
+	{
+		return rmdir(path);
+	}
+
+	static unsigned process_id()
+	{
+		return (unsigned)getpid();
+	}
+#endif
+
+static void entry_path(struct ARTIFACTCACHE *cache, hash_t key, char *output)
+{
+	char keystr[32];
+	string_hash_tostr(key, keystr);
+	sprintf(output, "%s/%c%c/%s", cache->path, keystr[0], keystr[1], keystr);
+}
+
+static void remove_callback(const char *fullpath, const char *filename, int dir, void *user)
+{
+	if(!dir)
+		remove(fullpath);
+}
+
+/* removes an entry and the files in it */
+static void remove_entry(const char *path)
+{
+	file_listdirectory(path, remove_callback, NULL);
+	remove_directory(path);
+}
+
+static void local_lookup(struct ARTIFACTCACHE *cache, const hash_t *keys, unsigned char *found, unsigned num)
+{
+	char entry[600];
+	unsigned i;
+
+	for(i = 0; i < num; i++)
+	{
+		entry_path(cache, keys[i], entry);
+		found[i] = file_isdir(entry) ? 1 : 0;
+	}
+}
+
+static int local_restore(struct ARTIFACTCACHE *cache, hash_t key, struct JOB *job)
+{
+	struct NODELINK *link;
+	char entry[600];
+	char path[640];
+	unsigned i;
+
+	entry_path(cache, key, entry);
+	if(!file_isdir(entry))
+		return 0;
+
+	for(link = job->firstoutput, i = 0; link; link = link->next, i++)
+	{
+		sprintf(path, "%s/%u", entry, i);
+		if(copy_file(path, link->node->filename) != 0)
+			return 0;
+	}
+
+	/* mark the entry as recently used */
+	sprintf(path, "%s/0", entry);
+	file_touch(path);
+	return 1;
+}
+
+static void local_store(struct ARTIFACTCACHE *cache, hash_t key, struct JOB *job)
+{
+	struct NODELINK *link;
+	char keystr[32];
+	char tmp[640];
+	char entry[600];
+	char path[680];
+	unsigned i;
+
+	string_hash_tostr(key, keystr);
+	sprintf(tmp, "%s/tmp/%s_%u_%u", cache->path, keystr, process_id(), atomic_inc(&cache->num_tmp));
+	if(file_createdir(tmp) != 0)
+		return;
+
+	for(link = job->firstoutput, i = 0; link; link = link->next, i++)
+	{
+		sprintf(path, "%s/%u", tmp, i);
+		if(copy_file(link->node->filename, path) != 0)
+		{
+			remove_entry(tmp);
+			return;
+		}
+	}
+
+	/* another build might have added the same entry, the first one is kept */
+	entry_path(cache, key, entry);
+	sprintf(path, "%s/", entry);
+	if(file_createpath(path) != 0 || rename(tmp, entry) != 0)
+	{
+		remove_entry(tmp);
+		return;
+	}
+
+	atomic_inc(&cache->num_stored);
+}
+
+/* an entry in the cache when trimming it */
+struct TRIMENTRY
+{
+	char *path;
+	time_t used;
+	int64 size;
+};
+
+struct TRIMLIST
+{
+	struct TRIMENTRY *entries;
+	unsigned num;
+	unsigned capacity;
+};
+
+static void trim_file(const char *fullpath, const char *filename, int dir, void *user)
+{
+	struct TRIMENTRY *entry = (struct TRIMENTRY *)user;
+	struct stat info;
+
+	if(dir || stat(fullpath, &info) != 0)
+		return;
+
+	entry->size += info.st_size;
+	if(strcmp(filename, "0") == 0)
+		entry->used = info.st_mtime;
+}
+
+static void trim_entry(const char *fullpath, const char *filename, int dir, void *user)
+{
+	struct TRIMLIST *list = (struct TRIMLIST *)user;
+	struct TRIMENTRY *entry;
+
+	if(!dir || filename[0] == '.')
+		return;
+
+	if(list->num == list->capacity)
+	{
+		list->capacity = list->capacity ? list->capacity*2 : 1024;
+		list->entries = (struct TRIMENTRY *)realloc(list->entries, list->capacity * sizeof(struct TRIMENTRY));
+	}
+
+	entry = &list->entries[list->num++];
+	entry->path = (char *)malloc(strlen(fullpath) + 1);
+	strcpy(entry->path, fullpath);
+	entry->used = 0;
+	entry->size = 0;
+	file_listdirectory(fullpath, trim_file, entry);
+}
+
+/* the entries are in directories named after the first two digits of the keys */
+static void trim_bucket(const char *fullpath, const char *filename, int dir, void *user)
+{
+	if(dir && filename[0] != '.' && strlen(filename) == 2)
+		file_listdirectory(fullpath, trim_entry, user);
+}
+
+static int trimentry_compare(const void *a, const void *b)
+{
+	const struct TRIMENTRY *entry_a = (const struct TRIMENTRY *)a;
+	const struct TRIMENTRY *entry_b = (const struct TRIMENTRY *)b;
+	if(entry_a->used < entry_b->used) return -1;
+	if(entry_a->used > entry_b->used) return 1;
+	return 0;
+}
+
+/* removes the least recently used entries until the cache fits */
+static void local_trim(struct ARTIFACTCACHE *cache)
+{
+	struct TRIMLIST list = {NULL, 0, 0};
+	int64 size = 0;
+	unsigned i;
+
+	file_listdirectory(cache->path, trim_bucket, &list);
+
+	for(i = 0; i < list.num; i++)
+		size += list.entries[i].size;
+
+	qsort(list.entries, list.num, sizeof(struct TRIMENTRY), trimentry_compare);
+	for(i = 0; i < list.num && size > cache->maxsize; i++)
+	{
+		remove_entry(list.entries[i].path);
+		size -= list.entries[i].size;
+	}
+
+	for(i = 0; i < list.num; i++)
+		free(list.entries[i].path);
+	free(list.entries);
+}
+
+static void local_destroy(struct ARTIFACTCACHE *cache)
+{
+	if(cache->num_stored)
+		local_trim(cache);
+}
+
+static const struct ARTIFACTBACKEND local_backend = {
+	local_lookup, local_restore, local_store, local_destroy
+};
+
+static int local_setup(struct ARTIFACTCACHE *cache, const char *path, int64 maxsize)
+{
+	char tmppath[600];
+
+	if(strlen(path) >= sizeof(cache->path))
+	{
+		printf("%s: artifact cache path is too long\n", session.name);
+		return -1;
+	}
+
+	sprintf(tmppath, "%s/tmp/", path);
+	if(file_createpath(tmppath) != 0)
+	{
+		printf("%s: couldn't create artifact cache directory '%s'\n", session.name, path);
+		return -1;
+	}
+
+	strcpy(cache->path, path);
+	cache->maxsize = maxsize;
+	cache->backend = &local_backend;
+	return 0;
+}
+
+/* ******** server ******** */
+
+#ifdef BAM_FAMILY_WINDOWS
+	static int server_setup(struct ARTIFACTCACHE *cache, const char *address)
+	{
+		printf("%s: artifact cache servers are not supported on this platform\n", session.name);
+		return -1;
+	}
+#else
+
+/*
+	The server is talked to with HTTP/1.1 over TCP or a unix socket. An
+	entry is at <prefix><key> and is fetched with GET, checked for with
+	HEAD and added with PUT. The body of an entry is a header followed by
+	the outputs, each with a header of its own:
+
+		entry:  magic (4 bytes), number of outputs (4 bytes)
+		output: file mode (4 bytes), unused (4 bytes), size (8 bytes), data
+
+	All the numbers are little endian. The server doesn't have to look at
+	the body, see scripts/cacheserver.py.
+*/
+
+#define ENTRY_MAGIC 0x414d4142 /* BAMA */
+#define LOOKUP_BATCH 64 /* requests that are sent before reading the responses */
+
+#ifdef MSG_NOSIGNAL
+	#define SEND_FLAGS MSG_NOSIGNAL
+#else
+	#define SEND_FLAGS 0
+#endif
+
+struct CONNECTION
+{
+	struct CONNECTION *next;
+	int fd;
+	unsigned pos; /* read position in the buffer */
+	unsigned len; /* number of bytes in the buffer */
+	char buffer[16*1024];
+};
+
+static void put32(unsigned char *p, unsigned v)
+{
+	p[0] = v; p[1] = v>>8; p[2] = v>>16; p[3] = v>>24;
+}
+
+static unsigned get32(const unsigned char *p)
+{
+	return p[0] | (p[1]<<8) | (p[2]<<16) | ((unsigned)p[3]<<24);
+}
+
+static int64 get64(const unsigned char *p)
+{
+	return (int64)get32(p) | ((int64)get32(p+4) << 32);
+}
+
+static int connect_socket(struct ARTIFACTCACHE *cache)
+{
+	struct addrinfo hints;
+	struct addrinfo *result;
+	struct addrinfo *info;
+	struct sockaddr_un addr;
+	int one = 1;
+	int fd = -1;
+
+	if(cache->socketpath[0])
+	{
+		memset(&addr, 0, sizeof(addr));
+		addr.sun_family = AF_UNIX;
+		strcpy(addr.sun_path, cache->socketpath);
+		fd = socket(AF_UNIX, SOCK_STREAM, 0);
+		if(fd >= 0 && connect(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0)
+		{
+			close(fd);
+			fd = -1;
+		}
+	}
+	else
+	{
+		memset(&hints, 0, sizeof(hints));
+		hints.ai_family = AF_UNSPEC;
+		hints.ai_socktype = SOCK_STREAM;
+		if(getaddrinfo(cache->host, cache->port, &hints, &result) != 0)
+			return -1;
+
+		for(info = result; info && fd < 0; info = info->ai_next)
+		{
+			fd = socket(info->ai_family, info->ai_socktype, info->ai_protocol);
+			if(fd >= 0 && connect(fd, info->ai_addr, info->ai_addrlen) != 0)
+			{
+				close(fd);
+				fd = -1;
+			}
+		}
+		freeaddrinfo(result);
+
+		/* the requests are small, send them right away */
+		if(fd >= 0)
+			setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+	}
+
+#ifdef SO_NOSIGPIPE
+	if(fd >= 0)
+		setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &one, sizeof(one));
+#endif
+	return fd;
+}
+
+/* takes an idle connection or opens a new one, returns NULL if the server
+	can't be reached */
+static struct CONNECTION *connection_open(struct ARTIFACTCACHE *cache)
+{
+	struct CONNECTION *conn;
+	int fd;
+
+	lock_enter(cache->poollock);
+	conn = cache->pool;
+	if(conn)
+		cache->pool = conn->next;
+	lock_leave(cache->poollock);
+
+	if(conn)
+		return conn;
+
+	/* don't keep trying for every job */
+	if(cache->num_unreachable)
+		return NULL;
+
+	fd = connect_socket(cache);
+	if(fd < 0)
+	{
+		if(atomic_inc(&cache->num_unreachable) == 1)
+		{
+			output_enter();
+			printf("%s: couldn't connect to the artifact cache, jobs are run as usual\n", session.name);
+			output_leave();
+		}
+		return NULL;
+	}
+
+	conn = (struct CONNECTION *)malloc(sizeof(struct CONNECTION));
+	conn->next = NULL;
+	conn->fd = fd;
+	conn->pos = 0;
+	conn->len = 0;
+	return conn;
+}
+
+/* puts the connection back into the pool, it's closed if it's not known
+	to be at the start of a response */
+static void connection_release(struct ARTIFACTCACHE *cache, struct CONNECTION *conn, int reuse)
+{
+	if(!reuse)
+	{
+		close(conn->fd);
+		free(conn);
+		return;
+	}
+
+	lock_enter(cache->poollock);
+	conn->next = cache->pool;
+	cache->pool = conn;
+	lock_leave(cache->poollock);
+}
+
+static int connection_write(struct CONNECTION *conn, const void *data, size_t size)
+{
+	const char *p = (const char *)data;
+	ssize_t bytes;
+
+	while(size)
+	{
+		bytes = send(conn->fd, p, size, SEND_FLAGS);
+		if(bytes < 0 && errno == EINTR)
+			continue;
+		if(bytes <= 0)
+			return -1;
+		p += bytes;
+		size -= bytes;
+	}
+	return 0;
+}
+
+static int connection_read(struct CONNECTION *conn, void *data, size_t size)
+{
+	char *p = (char *)data;
+	ssize_t bytes;
+	size_t n;
+
+	while(size)
+	{
+		if(conn->pos == conn->len)
+		{
+			do
+				bytes = recv(conn->fd, conn->buffer, sizeof(conn->buffer), 0);
+			while(bytes < 0 && errno == EINTR);
+			if(bytes <= 0)
+				return -1;
+			conn->pos = 0;
+			conn->len = bytes;
+		}
+
+		n = conn->len - conn->pos;
+		if(n > size)
+			n = size;
+		memcpy(p, conn->buffer + conn->pos, n);
+		conn->pos += n;
+		p += n;
+		size -= n;
+	}
+	return 0;
+}
+
+static int connection_skip(struct CONNECTION *conn, int64 size)
+{
+	char buffer[1024];
+	size_t n;
+
+	while(size > 0)
+	{
+		n = size > (int64)sizeof(buffer) ? sizeof(buffer) : (size_t)size;
+		if(connection_read(conn, buffer, n) != 0)
+			return -1;
+		size -= n;
+	}
+	return 0;
+}
+
+/* reads a line without the line ending, long lines are cut */
+static int connection_readline(struct CONNECTION *conn, char *line, size_t size)
+{
+	size_t len = 0;
+	char c;
+
+	while(1)
+	{
+		if(connection_read(conn, &c, 1) != 0)
+			return -1;
+		if(c == '\n')
+			break;
+		if(c != '\r' && len < size-1)
+			line[len++] = c;
+	}
+
+	line[len] = 0;
+	return 0;
+}
+
+/* returns the value if the line is the header, name must be lower case */
+static const char *header_value(const char *line, const char *name)
+{
+	for(; *name; line++, name++)
+	{
+		if(tolower((unsigned char)*line) != *name)
+			return NULL;
+	}
+
+	if(*line != ':')
+		return NULL;
+	for(line++; *line == ' '; line++)
+		;
+	return line;
+}
+
+/* reads the status line and the headers of a response. returns the status
+	code or -1 on error. length is set to the size of the body and keepalive
+	to 0 if the server closes the connection after the response */
+static int connection_response(struct CONNECTION *conn, int64 *length, int *keepalive)
+{
+	char line[1024];
+	const char *value;
+	long long contentlength;
+	int status;
+
+	*length = 0;
+	*keepalive = 1;
+
+	if(connection_readline(conn, line, sizeof(line)) != 0)
+		return -1;
+	if(sscanf(line, "HTTP/%*d.%*d %d", &status) != 1)
+		return -1;
+	if(strncmp(line, "HTTP/1.0", 8) == 0)
+		*keepalive = 0;
+
+	while(1)
+	{
+		if(connection_readline(conn, line, sizeof(line)) != 0)
+			return -1;
+		if(line[0] == 0)
+			break;
+
+		if((value = header_value(line, "content-length")) != NULL)
+		{
+			if(sscanf(value, "%lld", &contentlength) != 1 || contentlength < 0)
+				return -1;
+			*length = contentlength;
+		}
+		else if((value = header_value(line, "connection")) != NULL)
+			*keepalive = string_compare_case_insensitive(value, "close") != 0;
+	}
+
+	return status;
+}
+
+/* writes the request line and headers to the buffer, returns the length */
+static int request_header(struct ARTIFACTCACHE *cache, char *buffer, const char *method, hash_t key, int64 length)
+{
+	char keystr[32];
+	string_hash_tostr(key, keystr);
+	return sprintf(buffer, "%s %s%s HTTP/1.1\r\nHost: %s\r\nContent-Length: %lld\r\n\r\n",
+		method, cache->prefix, keystr, cache->host, (long long)length);
+}
+
+/* the lookups are sent in batches without waiting for the responses in
+	between, the server answers them in order */
+static void server_lookup(struct ARTIFACTCACHE *cache, const hash_t *keys, unsigned char *found, unsigned num)
+{
+	struct CONNECTION *conn;
+	char *requests;
+	int64 length;
+	int keepalive;
+	int status;
+	size_t size;
+	unsigned first;
+	unsigned count;
+	unsigned i;
+
+	requests = (char *)malloc(LOOKUP_BATCH * 640);
+	for(first = 0; first < num; first += count)
+	{
+		count = num - first;
+		if(count > LOOKUP_BATCH)
+			count = LOOKUP_BATCH;
+
+		conn = connection_open(cache);
+		if(!conn)
+			break;
+
+		size = 0;
+		for(i = 0; i < count; i++)
+			size += request_header(cache, requests + size, "HEAD", keys[first + i], 0);
+
+		if(connection_write(conn, requests, size) != 0)
+		{
+			connection_release(cache, conn, 0);
+			break;
+		}
+
+		/* responses to HEAD doesn't have a body */
+		keepalive = 1;
+		for(i = 0; i < count && keepalive; i++)
+		{
+			status = connection_response(conn, &length, &keepalive);
+			if(status < 0)
+				break;
+			found[first + i] = status == 200;
+		}
+
+		connection_release(cache, conn, i == count && keepalive);
+		if(i != count)
+			break;
+	}
+
+	free(requests);
+}
+
+/* writes a file with the data from the connection */
+static int receive_file(struct CONNECTION *conn, const char *filename, unsigned mode, int64 size)
+{
+	char buffer[16*1024];
+	size_t n;
+	int error = 0;
+	int out;
+
+	remove(filename);
+	out = open(filename, O_WRONLY|O_CREAT|O_TRUNC, mode&0777);
+	if(out < 0)
+		return -1;
+
+	while(size > 0)
+	{
+		n = size > (int64)sizeof(buffer) ? sizeof(buffer) : (size_t)size;
+		if(connection_read(conn, buffer, n) != 0 || write(out, buffer, n) != (ssize_t)n)
+		{
+			error = 1;
+			break;
+		}
+		size -= n;
+	}
+
+	if(close(out) != 0)
+		error = 1;
+
+	if(error)
+	{
+		remove(filename);
+		return -1;
+	}
+	return 0;
+}
+
+/* writes the outputs of the job from an entry with the given length */
+static int receive_entry(struct CONNECTION *conn, struct JOB *job, int64 length)
+{
+	unsigned char header[16];
+	struct NODELINK *link;
+	unsigned num = 0;
+	int64 size;
+
+	for(link = job->firstoutput; link; link = link->next)
+		num++;
+
+	if(length < 8 || connection_read(conn, header, 8) != 0)
+		return 0;
+	if(get32(header) != ENTRY_MAGIC || get32(header+4) != num)
+		return 0;
+	length -= 8;
+
+	for(link = job->firstoutput; link; link = link->next)
+	{
+		if(length < 16 || connection_read(conn, header, 16) != 0)
+			return 0;
+		size = get64(header+8);
+		length -= 16 + size;
+		if(size < 0 || length < 0)
+			return 0;
+		if(receive_file(conn, link->node->filename, get32(header), size) != 0)
+			return 0;
+	}
+
+	return length == 0;
+}
+
+static int server_restore(struct ARTIFACTCACHE *cache, hash_t key, struct JOB *job)
+{
+	struct CONNECTION *conn;
+	char request[640];
+	int64 length;
+	int keepalive;
+	int status;
+	int restored;
+
+	conn = connection_open(cache);
+	if(!conn)
+		return 0;
+
+	if(connection_write(conn, request, request_header(cache, request, "GET", key, 0)) != 0 ||
+		(status = connection_response(conn, &length, &keepalive)) < 0)
+	{
+		connection_release(cache, conn, 0);
+		return 0;
+	}
+
+	if(status != 200)
+	{
+		connection_release(cache, conn, keepalive && connection_skip(conn, length) == 0);
+		return 0;
+	}
+
+	/* a broken entry leaves the rest of the body unread */
+	restored = receive_entry(conn, job, length);
+	connection_release(cache, conn, restored && keepalive);
+	return restored;
+}
+
+/* sends a file, it must still have the size that it had when the length
+	of the request was calculated */
+static int send_file(struct CONNECTION *conn, const char *filename, int64 size)
+{
+	unsigned char header[16];
+	char buffer[16*1024];
+	struct stat info;
+	ssize_t bytes = 0;
+	int error = 0;
+	int in;
+
+	in = open(filename, O_RDONLY);
+	if(in < 0)
+		return -1;
+
+	if(fstat(in, &info) != 0 || info.st_size != size)
+	{
+		close(in);
+		return -1;
+	}
+
+	put32(header, info.st_mode&0777);
+	put32(header+4, 0);
+	put32(header+8, (unsigned)size);
+	put32(header+12, (unsigned)(size>>32));
+	if(connection_write(conn, header, 16) != 0)
+		error = 1;
+
+	while(!error && size > 0 && (bytes = read(in, buffer, sizeof(buffer))) > 0)
+	{
+		if(bytes > size || connection_write(conn, buffer, bytes) != 0)
+			error = 1;
+		size -= bytes;
+	}
+
+	close(in);
+	return (error || size != 0) ? -1 : 0;
+}
+
+static void server_store(struct ARTIFACTCACHE *cache, hash_t key, struct JOB *job)
+{
+	struct CONNECTION *conn;
+	struct NODELINK *link;
+	struct stat info;
+	char request[640];
+	int64 *sizes;
+	int64 length = 8;
+	unsigned num = 0;
+	unsigned i;
+	size_t size;
+	int keepalive;
+	int status;
+	int error = 0;
+
+	for(link = job->firstoutput; link; link = link->next)
+		num++;
+
+	sizes = (int64 *)malloc(num * sizeof(int64));
+	for(link = job->firstoutput, i = 0; link; link = link->next, i++)
+	{
+		if(stat(link->node->filename, &info) != 0 || !S_ISREG(info.st_mode))
+		{
+			free(sizes);
+			return;
+		}
+		sizes[i] = info.st_size;
+		length += 16 + info.st_size;
+	}
+
+	conn = connection_open(cache);
+	if(!conn)
+	{
+		free(sizes);
+		return;
+	}
+
+	size = request_header(cache, request, "PUT", key, length);
+	put32((unsigned char *)request + size, ENTRY_MAGIC);
+	put32((unsigned char *)request + size + 4, num);
+	error = connection_write(conn, request, size + 8) != 0;
+
+	for(link = job->firstoutput, i = 0; link && !error; link = link->next, i++)
+		error = send_file(conn, link->node->filename, sizes[i]) != 0;
+	free(sizes);
+
+	/* the server notices that the body was cut short */
+	if(error || (status = connection_response(conn, &length, &keepalive)) < 0)
+	{
+		connection_release(cache, conn, 0);
+		return;
+	}
+
+	connection_release(cache, conn, keepalive && connection_skip(conn, length) == 0);
+}
+
+static void server_destroy(struct ARTIFACTCACHE *cache)
+{
+	struct CONNECTION *conn;
+
+	while((conn = cache->pool) != NULL)
+	{
+		cache->pool = conn->next;
+		connection_release(cache, conn, 0);
+	}
+	lock_destroy(cache->poollock);
+}
+
+static const struct ARTIFACTBACKEND server_backend = {
+	server_lookup, server_restore, server_store, server_destroy
+};
+
+/* address is http://host[:port][/path] or unix:/path/to/socket */
+static int server_setup(struct ARTIFACTCACHE *cache, const char *address)
+{
+	const char *host;
+	const char *path = "";
+	size_t len;
+
+	if(strncmp(address, "unix:", 5) == 0)
+	{
+		if(strlen(address+5) >= sizeof(cache->socketpath) || strlen(address+5) >= sizeof(((struct sockaddr_un *)0)->sun_path))
+		{
+			printf("%s: artifact cache socket path is too long\n", session.name);
+			return -1;
+		}
+		strcpy(cache->socketpath, address+5);
+		strcpy(cache->host, "localhost");
+	}
+	else
+	{
+		host = address + 7;
+		len = strcspn(host, ":/");
+		if(len == 0 || len >= sizeof(cache->host))
+		{
+			printf("%s: invalid artifact cache address '%s'\n", session.name, address);
+			return -1;
+		}
+		memcpy(cache->host, host, len);
+		cache->host[len] = 0;
+
+		strcpy(cache->port, "80");
+		if(host[len] == ':')
+		{
+			path = host + len + 1;
+			len = strcspn(path, "/");
+			if(len == 0 || len >= sizeof(cache->port))
+			{
+				printf("%s: invalid artifact cache address '%s'\n", session.name, address);
+				return -1;
+			}
+			memcpy(cache->port, path, len);
+			cache->port[len] = 0;
+			path += len;
+		}
+		else
+			path = host + len;
+	}
+
+	/* the prefix always starts and ends with a slash */
+	if(strlen(path) + 3 >= sizeof(cache->prefix))
+	{
+		printf("%s: artifact cache path is too long\n", session.name);
+		return -1;
+	}
+	if(path[0] != '/')
+		strcat(cache->prefix, "/");
+	strcat(cache->prefix, path);
+	if(cache->prefix[strlen(cache->prefix)-1] != '/')
+		strcat(cache->prefix, "/");
+
+	cache->poollock = lock_create();
+	cache->backend = &server_backend;
+	return 0;
+}
+
+#endif
+
+/* ******** */
+
+struct ARTIFACTCACHE *artifactcache_create(const char *address, int64 maxsize)
+{
+	struct ARTIFACTCACHE *cache;
+	int error;
+
+	cache = (struct ARTIFACTCACHE *)malloc(sizeof(struct ARTIFACTCACHE));
+	memset(cache, 0, sizeof(struct ARTIFACTCACHE));
+
+	if(strncmp(address, "http://", 7) == 0 || strncmp(address, "unix:", 5) == 0)
+		error = server_setup(cache, address);
+	else
+		error = local_setup(cache, address, maxsize);
+
+	if(error)
+	{
+		free(cache);
+		return NULL;
+	}
+	return cache;
+}
+
+void artifactcache_destroy(struct ARTIFACTCACHE *cache)
+{
+	if(!cache)
+		return;
+
+	cache->backend->destroy(cache);
+	if(cache->known.keys)
+		hashtable_destroy(&cache->known);
+	free(cache);
+}
+
+void artifactcache_lookup(struct ARTIFACTCACHE *cache, const hash_t *keys, unsigned num)
+{
+	unsigned char *found;
+	unsigned i;
+
+	found = (unsigned char *)malloc(num + 1);
+	memset(found, ARTIFACT_UNKNOWN, num);
+	cache->backend->lookup(cache, keys, found, num);
+
+	if(cache->known.keys)
+		hashtable_destroy(&cache->known);
+	hashtable_create(&cache->known, num);
+	for(i = 0; i < num; i++)
+	{
+		if(found[i] != ARTIFACT_UNKNOWN)
+			hashtable_insert(&cache->known, keys[i], found[i]);
+	}
+
+	free(found);
+}
+
+int artifactcache_restore(struct ARTIFACTCACHE *cache, hash_t key, struct JOB *job)
+{
+	/* keys that are known to be missing doesn't have to be asked for again */
+	if(cache->known.keys && hashtable_find(&cache->known, key) == 0)
+		return 0;
+	return cache->backend->restore(cache, key, job);
+}
+
+void artifactcache_store(struct ARTIFACTCACHE *cache, hash_t key, struct JOB *job)
+{
+	if(!job->firstoutput)
+		return;
+	cache->backend->store(cache, key, job);
+}
@@ -0,0 +1,51 @@
+#ifndef FILE_ARTIFACT_H
+#define FILE_ARTIFACT_H
+
+#include "support.h"
+
+struct JOB;
+struct ARTIFACTCACHE;
+
+/*
+	Artifact cache
+	A directory that can be shared between builds where the outputs of
+	jobs are kept, keyed on the command line and the content of the inputs.
+	A job that is found in the cache gets its outputs copied from there
+	instead of running. The copies share the data with the cache on file
+	systems that support it.
+
+	Every entry is a directory, <path>/<first two digits of the key>/<key>,
+	with one file per output named after the index of the output. Entries
+	are written to <path>/tmp and renamed into place so a half written
+	entry is never seen, even when several builds use the same cache. The
+	timestamp of the first file of an entry is bumped when the entry is
+	used, the least recently used entries are removed when the cache grows
+	larger than its size limit.
+
+	The cache can also be on a server, see the server part of artifact.c
+	and scripts/cacheserver.py. The server takes care of its own size.
+*/
+
+/* address is a directory, http://host[:port][/path] or unix:/path/to/socket.
+	returns NULL if the directory couldn't be created or the address is
+	invalid, an error has been printed */
+struct ARTIFACTCACHE *artifactcache_create(const char *address, int64 maxsize);
+
+/* removes the least recently used entries if anything was added to the
+	cache, and frees it */
+void artifactcache_destroy(struct ARTIFACTCACHE *cache);
+
+/* checks which of the keys that are in the cache, with as few round trips
+	to a server as possible. restoring a key that was found to be missing
+	returns directly afterwards */
+void artifactcache_lookup(struct ARTIFACTCACHE *cache, const hash_t *keys, unsigned num);
+
+/* copies the outputs of the job from the entry of the key, returns 1 if
+	all of them were restored */
+int artifactcache_restore(struct ARTIFACTCACHE *cache, hash_t key, struct JOB *job);
+
+/* adds the outputs of the job to the cache, nothing is added if one of
+	them can't be read */
+void artifactcache_store(struct ARTIFACTCACHE *cache, hash_t key, struct JOB *job);
+
+#endif
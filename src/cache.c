@@ -6,9 +6,12 @@
 
 #include "cache.h"
 #include "context.h"
+#include "hashtable.h"
 #include "node.h"
+#include "path.h"
 #include "platform.h"
 #include "session.h"
+#include "statcache.h"
 #include "support.h"
 
 #include "version.h"
@@ -19,7 +22,7 @@
 #define WRITE_BUFFERDEPS (WRITE_BUFFERSIZE/sizeof(unsigned))
 
 /* increase this by one if changes to the cache format have been done */
-#define CACHE_VERSION	2
+#define CACHE_VERSION	5
 
 /* header info */
 static char bamheader[24] = {
@@ -62,6 +65,7 @@ static void cache_setup_header(const char type[4])
 #ifdef USE_UNIX_IO
 	#include <sys/types.h>
 	#include <sys/stat.h>
+	#include <sys/mman.h>
 	#include <unistd.h>
 
 	#define IO_HANDLE int
@@ -140,7 +144,6 @@ static int io_read_cachefile(const char *filename, const char *type, void **buff
 
 struct SCANCACHEINFO
 {
-	RB_ENTRY(SCANCACHEINFO) rbentry;
 	hash_t hashid;
 	time_t timestamp;
 	
@@ -152,21 +155,10 @@ struct SCANCACHEINFO
 	unsigned num_refs;
 };
 
-static int scancacheinfo_cmp(struct SCANCACHEINFO *a, struct SCANCACHEINFO *b)
-{
-	if(a->hashid > b->hashid) return 1;
-	if(a->hashid < b->hashid) return -1;
-	return 0;
-}
-
-
-RB_HEAD(SCANCACHEINFO_RB, SCANCACHEINFO);
-RB_GENERATE_INTERNAL(SCANCACHEINFO_RB, SCANCACHEINFO, rbentry, scancacheinfo_cmp, static)
-
 struct SCANCACHE
 {
 	char header[sizeof(bamheader)];
-	struct SCANCACHEINFO_RB infotree;
+	struct HASHTABLE index; /* hashid to index in infos, built when loaded */
 	unsigned num_infos;
 	unsigned num_refs;
 	
@@ -175,12 +167,6 @@ struct SCANCACHE
 	char * strings;
 };
 
-void SCANCACHEINFO_FUNCTIONREMOVER() /* this is just to get it not to complain about unused static functions */
-{
-	(void)SCANCACHEINFO_RB_RB_REMOVE; (void)SCANCACHEINFO_RB_RB_NFIND; (void)SCANCACHEINFO_RB_RB_MINMAX;
-	(void)SCANCACHEINFO_RB_RB_NEXT; (void)SCANCACHEINFO_RB_RB_PREV;
-}
-
 /* buffer sizes */
 #define WRITE_BUFFERSIZE (32*1024)
 #define WRITE_BUFFERINFOS (WRITE_BUFFERSIZE/sizeof(struct SCANCACHEINFO))
@@ -407,12 +393,13 @@ struct SCANCACHE *scancache_load(const char *filename)
 
 	struct CHEADERREF * curref = scancache->refs;
 
-	/* build node tree and patch pointers */
+	/* build the index and patch pointers */
+	hashtable_create(&scancache->index, scancache->num_infos);
 	for(i = 0; i < scancache->num_infos; i++)
 	{
 		struct SCANCACHEINFO *info = &scancache->infos[i];
 		info->filename = scancache->strings + (ptrdiff_t)info->filename;
-		RB_INSERT(SCANCACHEINFO_RB, &scancache->infotree, info);
+		hashtable_insert(&scancache->index, info->hashid, i);
 
 		if(info->num_refs)
 		{
@@ -436,51 +423,831 @@ struct SCANCACHE *scancache_load(const char *filename)
 
 void scancache_free(struct SCANCACHE *scancache)
 {
+	if(!scancache)
+		return;
+	hashtable_destroy(&scancache->index);
 	free(scancache);
 }
 
 int scancache_find(struct SCANCACHE *scancache, struct NODE * node, struct CHEADERREF **result)
 {
-	struct SCANCACHEINFO tempinfo;
 	struct SCANCACHEINFO *info;
+	unsigned index;
 	*result = NULL;
 	if(!scancache)
 		return 1;
-	tempinfo.hashid = node->hashid;
-	info = RB_FIND(SCANCACHEINFO_RB, &scancache->infotree, &tempinfo);
-	if(!info || !info->headerscanned || info->timestamp != node->timestamp_raw)
+	index = hashtable_find(&scancache->index, node->hashid);
+	if(index == HASHTABLE_NOTFOUND)
+		return 1;
+	info = &scancache->infos[index];
+	if(!info->headerscanned || info->timestamp != node->timestamp_raw)
 		return 1;
 	*result = info->refs;
 	return 0;
 }
 
 
-static int cacheinfo_deps_cmp(struct CACHEINFO_DEPS *a, struct CACHEINFO_DEPS *b)
+/*
+	the resolve cache file is laid out as follows
+
+		RESOLVECACHE_HEADER
+		RESOLVECACHE_ENTRY entries[num_entries]
+		RESOLVECACHE_DIR dirs[num_dirs]
+		unsigned dirlist[num_dirlist]	(index in dirs)
+		char strings[strings_size]	(directory names)
+
+	a directory that many includes are searched for in is only stored
+	once. when loaded the arrays are copied so new entries can be added.
+*/
+struct RESOLVECACHE_HEADER
+{
+	char header[sizeof(bamheader)];
+	unsigned num_entries;
+	unsigned num_dirs;
+	unsigned num_dirlist;
+	unsigned strings_size;
+};
+
+struct RESOLVECACHE_ENTRY
+{
+	hash_t key;
+	int found;			/* index of the candidate that exists, -1 if none of them does */
+	unsigned first_dir;	/* index in dirlist */
+	unsigned num_dirs;
+	unsigned used;		/* set if used or made during this run, only those are saved */
+};
+
+struct RESOLVECACHE_DIR
+{
+	hash_t hashid;
+	time_t timestamp;	/* 0 if the directory didn't exist */
+	unsigned name;		/* offset in strings */
+	unsigned newindex;	/* used when saving */
+};
+
+struct RESOLVECACHE
+{
+	struct RESOLVECACHE_ENTRY *entries;
+	struct RESOLVECACHE_DIR *dirs;
+	unsigned *dirlist;
+	char *strings;
+
+	unsigned num_entries, max_entries;
+	unsigned num_dirs, max_dirs;
+	unsigned num_dirlist, max_dirlist;
+	unsigned strings_size, max_strings;
+
+	struct HASHTABLE index;		/* key to index in entries */
+	struct HASHTABLE dirindex;	/* directory hash to index in dirs */
+
+	unsigned num_loaded;		/* number of entries from the file */
+	unsigned num_loaded_used;	/* how many of them that have been used */
+	int changed;				/* set if entries have been added */
+
+	time_t now;					/* when the cache was loaded */
+
+	/* entry that is being made */
+	hash_t current_key;
+	unsigned current_first;
+	int current_untrusted;
+};
+
+static void *resolvecache_grow(void *data, unsigned *max, unsigned needed, unsigned elementsize)
+{
+	if(needed <= *max)
+		return data;
+	while(*max < needed)
+		*max = *max ? *max * 2 : 256;
+	return realloc(data, *max * elementsize);
+}
+
+/* makes sure that the table has room for num entries, entries that are
+	added later replaces earlier ones with the same key */
+static void resolvecache_reindex(struct HASHTABLE *table, unsigned num, void *data, unsigned elementsize)
+{
+	unsigned i;
+	if(table->keys && num*2 <= table->mask+1)
+		return;
+
+	hashtable_destroy(table);
+	hashtable_create(table, num*2);
+	for(i = 0; i+1 < num; i++)
+		hashtable_insert(table, *(hash_t *)((char *)data + i*elementsize), i);
+}
+
+static unsigned resolvecache_add_dir(struct RESOLVECACHE *cache, const char *path, hash_t hashid, time_t timestamp)
+{
+	struct RESOLVECACHE_DIR *dir;
+	unsigned len = strlen(path)+1;
+
+	cache->dirs = (struct RESOLVECACHE_DIR *)resolvecache_grow(cache->dirs, &cache->max_dirs, cache->num_dirs+1, sizeof(struct RESOLVECACHE_DIR));
+	cache->strings = (char *)resolvecache_grow(cache->strings, &cache->max_strings, cache->strings_size+len, 1);
+
+	dir = &cache->dirs[cache->num_dirs++];
+	dir->hashid = hashid;
+	dir->timestamp = timestamp;
+	dir->name = cache->strings_size;
+	memcpy(cache->strings + cache->strings_size, path, len);
+	cache->strings_size += len;
+
+	resolvecache_reindex(&cache->dirindex, cache->num_dirs, cache->dirs, sizeof(struct RESOLVECACHE_DIR));
+	hashtable_insert(&cache->dirindex, hashid, cache->num_dirs-1);
+	return cache->num_dirs-1;
+}
+
+/* reads the entries from the file, leaves the cache empty if it can't */
+static void resolvecache_read(struct RESOLVECACHE *cache, const char *filename)
+{
+	struct RESOLVECACHE_HEADER *header;
+	unsigned long filesize;
+	void *buffer;
+	char *data;
+	unsigned i;
+
+	if(!io_read_cachefile(filename, "RES", &buffer, &filesize))
+		return;
+
+	/* verify the sizes */
+	header = (struct RESOLVECACHE_HEADER *)buffer;
+	if(	filesize < sizeof(struct RESOLVECACHE_HEADER) ||
+		filesize != sizeof(struct RESOLVECACHE_HEADER) +
+			header->num_entries*(unsigned long)sizeof(struct RESOLVECACHE_ENTRY) +
+			header->num_dirs*(unsigned long)sizeof(struct RESOLVECACHE_DIR) +
+			header->num_dirlist*(unsigned long)sizeof(unsigned) +
+			header->strings_size)
+	{
+		free(buffer);
+		return;
+	}
+
+	/* copy the arrays */
+	data = (char *)(header + 1);
+	cache->entries = (struct RESOLVECACHE_ENTRY *)resolvecache_grow(NULL, &cache->max_entries, header->num_entries, sizeof(struct RESOLVECACHE_ENTRY));
+	cache->num_entries = header->num_entries;
+	memcpy(cache->entries, data, cache->num_entries*sizeof(struct RESOLVECACHE_ENTRY));
+	data += cache->num_entries*sizeof(struct RESOLVECACHE_ENTRY);
+
+	cache->dirs = (struct RESOLVECACHE_DIR *)resolvecache_grow(NULL, &cache->max_dirs, header->num_dirs, sizeof(struct RESOLVECACHE_DIR));
+	cache->num_dirs = header->num_dirs;
+	memcpy(cache->dirs, data, cache->num_dirs*sizeof(struct RESOLVECACHE_DIR));
+	data += cache->num_dirs*sizeof(struct RESOLVECACHE_DIR);
+
+	cache->dirlist = (unsigned *)resolvecache_grow(NULL, &cache->max_dirlist, header->num_dirlist, sizeof(unsigned));
+	cache->num_dirlist = header->num_dirlist;
+	memcpy(cache->dirlist, data, cache->num_dirlist*sizeof(unsigned));
+	data += cache->num_dirlist*sizeof(unsigned);
+
+	cache->strings = (char *)resolvecache_grow(NULL, &cache->max_strings, header->strings_size, 1);
+	cache->strings_size = header->strings_size;
+	memcpy(cache->strings, data, cache->strings_size);
+
+	free(buffer);
+
+	/* drop everything if the file doesn't make sense */
+	for(i = 0; i < cache->num_dirlist; i++)
+		if(cache->dirlist[i] >= cache->num_dirs)
+			cache->num_entries = 0;
+	for(i = 0; i < cache->num_dirs; i++)
+		if(cache->dirs[i].name >= cache->strings_size)
+			cache->num_entries = 0;
+	for(i = 0; i < cache->num_entries; i++)
+		if(cache->entries[i].first_dir + cache->entries[i].num_dirs > cache->num_dirlist)
+			cache->num_entries = 0;
+	if(cache->strings_size && cache->strings[cache->strings_size-1] != 0)
+		cache->num_entries = 0;
+	if(cache->num_entries == 0)
+	{
+		cache->num_dirs = 0;
+		cache->num_dirlist = 0;
+		cache->strings_size = 0;
+	}
+
+	for(i = 0; i < cache->num_entries; i++)
+		cache->entries[i].used = 0;
+}
+
+struct RESOLVECACHE *resolvecache_load(const char *filename)
+{
+	struct RESOLVECACHE *cache = (struct RESOLVECACHE *)malloc(sizeof(struct RESOLVECACHE));
+	memset(cache, 0, sizeof(struct RESOLVECACHE));
+	cache->now = time(NULL);
+
+	resolvecache_read(cache, filename);
+
+	/* build the indices */
+	cache->num_loaded = cache->num_entries;
+	resolvecache_reindex(&cache->index, cache->num_entries+1, cache->entries, sizeof(struct RESOLVECACHE_ENTRY));
+	resolvecache_reindex(&cache->dirindex, cache->num_dirs+1, cache->dirs, sizeof(struct RESOLVECACHE_DIR));
+	return cache;
+}
+
+int resolvecache_save(const char *filename, struct RESOLVECACHE *cache)
 {
-	if(a->hashid > b->hashid) return 1;
-	if(a->hashid < b->hashid) return -1;
+	struct RESOLVECACHE_HEADER header;
+	struct RESOLVECACHE_ENTRY *entries;
+	struct RESOLVECACHE_DIR *dirs;
+	unsigned *dirlist;
+	char *strings;
+	char *buffer;
+	unsigned long size;
+	unsigned i, k;
+	char tmpfilename[1024];
+	IO_HANDLE fp;
+
+	/* nothing to do if every entry from the file was used and nothing new was added */
+	if(!cache || (!cache->changed && cache->num_loaded_used == cache->num_loaded))
+		return 0;
+
+	/* count what is used and give the directories new indices */
+	memset(&header, 0, sizeof(header));
+	cache_setup_header("RES");
+	memcpy(header.header, bamheader, sizeof(header.header));
+	for(i = 0; i < cache->num_dirs; i++)
+		cache->dirs[i].newindex = ~0u;
+	for(i = 0; i < cache->num_entries; i++)
+	{
+		struct RESOLVECACHE_ENTRY *entry = &cache->entries[i];
+		if(!entry->used)
+			continue;
+		header.num_entries++;
+		header.num_dirlist += entry->num_dirs;
+		for(k = 0; k < entry->num_dirs; k++)
+		{
+			struct RESOLVECACHE_DIR *dir = &cache->dirs[cache->dirlist[entry->first_dir+k]];
+			if(dir->newindex == ~0u)
+			{
+				dir->newindex = header.num_dirs++;
+				header.strings_size += strlen(cache->strings + dir->name)+1;
+			}
+		}
+	}
+
+	/* lay out the file in memory */
+	size = sizeof(header) +
+		header.num_entries*(unsigned long)sizeof(struct RESOLVECACHE_ENTRY) +
+		header.num_dirs*(unsigned long)sizeof(struct RESOLVECACHE_DIR) +
+		header.num_dirlist*(unsigned long)sizeof(unsigned) +
+		header.strings_size;
+	buffer = (char *)malloc(size);
+	memset(buffer, 0, size);
+	memcpy(buffer, &header, sizeof(header));
+	entries = (struct RESOLVECACHE_ENTRY *)(buffer + sizeof(header));
+	dirs = (struct RESOLVECACHE_DIR *)(entries + header.num_entries);
+	dirlist = (unsigned *)(dirs + header.num_dirs);
+	strings = (char *)(dirlist + header.num_dirlist);
+
+	header.num_entries = 0;
+	header.num_dirlist = 0;
+	header.strings_size = 0;
+	for(i = 0; i < cache->num_dirs; i++)
+	{
+		struct RESOLVECACHE_DIR *dir = &cache->dirs[i];
+		const char *name = cache->strings + dir->name;
+		unsigned len = strlen(name)+1;
+		if(dir->newindex == ~0u)
+			continue;
+		dirs[dir->newindex].hashid = dir->hashid;
+		dirs[dir->newindex].timestamp = dir->timestamp;
+		dirs[dir->newindex].name = header.strings_size;
+		memcpy(strings + header.strings_size, name, len);
+		header.strings_size += len;
+	}
+
+	for(i = 0; i < cache->num_entries; i++)
+	{
+		struct RESOLVECACHE_ENTRY *entry = &cache->entries[i];
+		if(!entry->used)
+			continue;
+		entries[header.num_entries].key = entry->key;
+		entries[header.num_entries].found = entry->found;
+		entries[header.num_entries].first_dir = header.num_dirlist;
+		entries[header.num_entries].num_dirs = entry->num_dirs;
+		header.num_entries++;
+		for(k = 0; k < entry->num_dirs; k++)
+			dirlist[header.num_dirlist++] = cache->dirs[cache->dirlist[entry->first_dir+k]].newindex;
+	}
+
+	/* write it */
+	snprintf(tmpfilename, sizeof(tmpfilename), "%s_tmp", filename);
+	fp = io_open_write(tmpfilename);
+	if(!io_valid(fp))
+	{
+		printf( "%s: warning: error writing cache file '%s'\n", session.name, tmpfilename );
+		free(buffer);
+		return -1;
+	}
+
+	if((unsigned long)io_write(fp, buffer, size) != size)
+	{
+		printf("%s: warning: error saving resolve cache file '%s'\n", session.name, filename);
+		io_close(fp);
+
+		/* the old cache is kept */
+		remove(tmpfilename);
+		free(buffer);
+		return -1;
+	}
+
+	io_close(fp);
+	free(buffer);
+
+	/* place the file where it should be now that everything was written correctly */
+#ifdef BAM_FAMILY_WINDOWS
+	remove(filename);
+#endif
+	if(rename(tmpfilename, filename) != 0)
+	{
+		printf( "%s: warning: error writing resolve cache file '%s': %s\n", session.name, filename, strerror(errno) );
+		return -1;
+	}
+
 	return 0;
 }
 
-RB_HEAD(CACHEINFO_DEPS_RB, CACHEINFO_DEPS);
-RB_GENERATE_INTERNAL(CACHEINFO_DEPS_RB, CACHEINFO_DEPS, rbentry, cacheinfo_deps_cmp, static)
+void resolvecache_free(struct RESOLVECACHE *cache)
+{
+	if(!cache)
+		return;
+	hashtable_destroy(&cache->index);
+	hashtable_destroy(&cache->dirindex);
+	free(cache->entries);
+	free(cache->dirs);
+	free(cache->dirlist);
+	free(cache->strings);
+	free(cache);
+}
 
-void CACHEINFO_DEPS_FUNCTIONREMOVER() /* this is just to get it not to complain about unused static functions */
+int resolvecache_find(struct RESOLVECACHE *cache, struct STATCACHE *statcache, hash_t key, int *found)
 {
-	(void)CACHEINFO_DEPS_RB_RB_REMOVE; (void)CACHEINFO_DEPS_RB_RB_NFIND; (void)CACHEINFO_DEPS_RB_RB_MINMAX;
-	(void)CACHEINFO_DEPS_RB_RB_NEXT; (void)CACHEINFO_DEPS_RB_RB_PREV;
+	struct RESOLVECACHE_ENTRY *entry;
+	unsigned index;
+	unsigned i;
+
+	if(!cache)
+		return 0;
+	index = hashtable_find(&cache->index, key);
+	if(index == HASHTABLE_NOTFOUND)
+		return 0;
+
+	/* the entry is good as long as none of the directories have changed */
+	entry = &cache->entries[index];
+	for(i = 0; i < entry->num_dirs; i++)
+	{
+		struct RESOLVECACHE_DIR *dir = &cache->dirs[cache->dirlist[entry->first_dir+i]];
+		if(statcache_timestamp(statcache, cache->strings + dir->name) != dir->timestamp)
+			return 0;
+	}
+
+	if(!entry->used && index < cache->num_loaded)
+		cache->num_loaded_used++;
+	entry->used = 1;
+	*found = entry->found;
+	return 1;
 }
 
-struct DEPCACHE
+void resolvecache_begin(struct RESOLVECACHE *cache, hash_t key)
+{
+	if(!cache)
+		return;
+	cache->current_key = key;
+	cache->current_first = cache->num_dirlist;
+	cache->current_untrusted = 0;
+}
+
+void resolvecache_add_searched(struct RESOLVECACHE *cache, struct STATCACHE *statcache, const char *filename)
+{
+	char path[MAX_PATH_LENGTH];
+	hash_t hashid;
+	time_t timestamp;
+	unsigned index;
+	unsigned i;
+
+	if(!cache)
+		return;
+
+	/* adding or removing the file changes the timestamp of the directory */
+	if(path_directory(filename, path, sizeof(path)) != 0)
+	{
+		cache->current_untrusted = 1;
+		return;
+	}
+	if(path[0] == 0)
+		strcpy(path, path_isabs(filename) ? "/" : ".");
+
+	hashid = string_hash_path(path);
+	timestamp = statcache_timestamp(statcache, path);
+
+	/* a directory that changed during this second can change again
+		without getting a new timestamp so it can't be trusted */
+	if(timestamp >= cache->now)
+		cache->current_untrusted = 1;
+
+	/* directories are never changed, entries made earlier can still
+		depend on the old timestamp */
+	index = hashtable_find(&cache->dirindex, hashid);
+	if(index == HASHTABLE_NOTFOUND || cache->dirs[index].timestamp != timestamp || strcmp(cache->strings + cache->dirs[index].name, path) != 0)
+		index = resolvecache_add_dir(cache, path, hashid, timestamp);
+
+	for(i = cache->current_first; i < cache->num_dirlist; i++)
+		if(cache->dirlist[i] == index)
+			return;
+
+	cache->dirlist = (unsigned *)resolvecache_grow(cache->dirlist, &cache->max_dirlist, cache->num_dirlist+1, sizeof(unsigned));
+	cache->dirlist[cache->num_dirlist++] = index;
+}
+
+void resolvecache_end(struct RESOLVECACHE *cache, int found)
+{
+	struct RESOLVECACHE_ENTRY *entry;
+	unsigned index;
+
+	if(!cache)
+		return;
+
+	if(cache->current_untrusted)
+	{
+		cache->num_dirlist = cache->current_first;
+		return;
+	}
+
+	/* replace the old entry */
+	index = hashtable_find(&cache->index, cache->current_key);
+	if(index != HASHTABLE_NOTFOUND && cache->entries[index].used)
+	{
+		if(index < cache->num_loaded)
+			cache->num_loaded_used--;
+		cache->entries[index].used = 0;
+	}
+
+	cache->entries = (struct RESOLVECACHE_ENTRY *)resolvecache_grow(cache->entries, &cache->max_entries, cache->num_entries+1, sizeof(struct RESOLVECACHE_ENTRY));
+	entry = &cache->entries[cache->num_entries++];
+	entry->key = cache->current_key;
+	entry->found = found;
+	entry->first_dir = cache->current_first;
+	entry->num_dirs = cache->num_dirlist - cache->current_first;
+	entry->used = 1;
+	cache->changed = 1;
+
+	resolvecache_reindex(&cache->index, cache->num_entries, cache->entries, sizeof(struct RESOLVECACHE_ENTRY));
+	hashtable_insert(&cache->index, entry->key, cache->num_entries-1);
+}
+
+
+/*
+	the directory cache file is laid out as follows
+
+		DIRCACHE_HEADER
+		DIRCACHE_DIR dirs[num_dirs]
+		hash_t names[num_names]	(sorted for each directory)
+
+	when loaded the arrays are copied so new listings can be added.
+*/
+struct DIRCACHE_HEADER
+{
+	char header[sizeof(bamheader)];
+	unsigned num_dirs;
+	unsigned num_names;
+};
+
+/* states of a directory during a run */
+enum
+{
+	DIRCACHE_UNCHECKED = 0,	/* loaded, the timestamp hasn't been checked */
+	DIRCACHE_LISTED,		/* the names can be used */
+	DIRCACHE_UNLISTED		/* no usable listing, files are stated */
+};
+
+struct DIRCACHE_DIR
+{
+	hash_t hashid;
+	time_t timestamp;	/* timestamp of the directory when it was listed */
+	time_t listed;		/* when it was listed */
+	unsigned first_name;	/* index in names */
+	unsigned num_names;
+	unsigned state;		/* DIRCACHE_*, only valid during the run */
+	unsigned lookups;	/* files looked for in it while unlisted */
+};
+
+struct DIRCACHE
+{
+	struct DIRCACHE_DIR *dirs;
+	hash_t *names;
+	unsigned num_dirs, max_dirs;
+	unsigned num_names, max_names;
+
+	struct HASHTABLE index;	/* directory hash to index in dirs */
+	int changed;			/* set if a directory has been listed */
+};
+
+/* reads the directories from the file, leaves the cache empty if it can't */
+static void dircache_read(struct DIRCACHE *cache, const char *filename)
+{
+	struct DIRCACHE_HEADER *header;
+	unsigned long filesize;
+	void *buffer;
+	char *data;
+	unsigned i;
+
+	if(!io_read_cachefile(filename, "DIR", &buffer, &filesize))
+		return;
+
+	header = (struct DIRCACHE_HEADER *)buffer;
+	if(	filesize < sizeof(struct DIRCACHE_HEADER) ||
+		filesize != sizeof(struct DIRCACHE_HEADER) +
+			header->num_dirs*(unsigned long)sizeof(struct DIRCACHE_DIR) +
+			header->num_names*(unsigned long)sizeof(hash_t))
+	{
+		free(buffer);
+		return;
+	}
+
+	data = (char *)(header + 1);
+	cache->dirs = (struct DIRCACHE_DIR *)resolvecache_grow(NULL, &cache->max_dirs, header->num_dirs, sizeof(struct DIRCACHE_DIR));
+	cache->num_dirs = header->num_dirs;
+	memcpy(cache->dirs, data, cache->num_dirs*sizeof(struct DIRCACHE_DIR));
+	data += cache->num_dirs*sizeof(struct DIRCACHE_DIR);
+
+	cache->names = (hash_t *)resolvecache_grow(NULL, &cache->max_names, header->num_names, sizeof(hash_t));
+	cache->num_names = header->num_names;
+	memcpy(cache->names, data, cache->num_names*sizeof(hash_t));
+
+	free(buffer);
+
+	/* drop everything if the file doesn't make sense */
+	for(i = 0; i < cache->num_dirs; i++)
+	{
+		struct DIRCACHE_DIR *dir = &cache->dirs[i];
+		if(dir->first_name > cache->num_names || dir->num_names > cache->num_names - dir->first_name)
+		{
+			cache->num_dirs = 0;
+			cache->num_names = 0;
+			break;
+		}
+		dir->state = DIRCACHE_UNCHECKED;
+		dir->lookups = 0;
+	}
+}
+
+struct DIRCACHE *dircache_load(const char *filename)
+{
+	struct DIRCACHE *cache = (struct DIRCACHE *)malloc(sizeof(struct DIRCACHE));
+	memset(cache, 0, sizeof(struct DIRCACHE));
+
+	dircache_read(cache, filename);
+	resolvecache_reindex(&cache->index, cache->num_dirs+1, cache->dirs, sizeof(struct DIRCACHE_DIR));
+	return cache;
+}
+
+int dircache_save(const char *filename, struct DIRCACHE *cache)
+{
+	struct DIRCACHE_HEADER header;
+	struct DIRCACHE_DIR *dirs;
+	hash_t *names;
+	char *buffer;
+	unsigned long size;
+	unsigned i;
+	char tmpfilename[1024];
+	IO_HANDLE fp;
+
+	if(!cache || !cache->changed)
+		return 0;
+
+	/* only listings that were made after the last change of the directory
+		can be trusted, a change during the same second doesn't show */
+	memset(&header, 0, sizeof(header));
+	cache_setup_header("DIR");
+	memcpy(header.header, bamheader, sizeof(header.header));
+	for(i = 0; i < cache->num_dirs; i++)
+	{
+		struct DIRCACHE_DIR *dir = &cache->dirs[i];
+		if(dir->state == DIRCACHE_LISTED && dir->listed > dir->timestamp)
+		{
+			header.num_dirs++;
+			header.num_names += dir->num_names;
+		}
+	}
+
+	size = sizeof(header) +
+		header.num_dirs*(unsigned long)sizeof(struct DIRCACHE_DIR) +
+		header.num_names*(unsigned long)sizeof(hash_t);
+	buffer = (char *)malloc(size);
+	memset(buffer, 0, size);
+	memcpy(buffer, &header, sizeof(header));
+	dirs = (struct DIRCACHE_DIR *)(buffer + sizeof(header));
+	names = (hash_t *)(dirs + header.num_dirs);
+
+	header.num_dirs = 0;
+	header.num_names = 0;
+	for(i = 0; i < cache->num_dirs; i++)
+	{
+		struct DIRCACHE_DIR *dir = &cache->dirs[i];
+		if(dir->state != DIRCACHE_LISTED || dir->listed <= dir->timestamp)
+			continue;
+		dirs[header.num_dirs].hashid = dir->hashid;
+		dirs[header.num_dirs].timestamp = dir->timestamp;
+		dirs[header.num_dirs].listed = dir->listed;
+		dirs[header.num_dirs].first_name = header.num_names;
+		dirs[header.num_dirs].num_names = dir->num_names;
+		memcpy(names + header.num_names, cache->names + dir->first_name, dir->num_names*sizeof(hash_t));
+		header.num_dirs++;
+		header.num_names += dir->num_names;
+	}
+
+	snprintf(tmpfilename, sizeof(tmpfilename), "%s_tmp", filename);
+	fp = io_open_write(tmpfilename);
+	if(!io_valid(fp))
+	{
+		printf( "%s: warning: error writing cache file '%s'\n", session.name, tmpfilename );
+		free(buffer);
+		return -1;
+	}
+
+	if((unsigned long)io_write(fp, buffer, size) != size)
+	{
+		printf("%s: warning: error saving directory cache file '%s'\n", session.name, filename);
+		io_close(fp);
+
+		/* the old cache is kept */
+		remove(tmpfilename);
+		free(buffer);
+		return -1;
+	}
+
+	io_close(fp);
+	free(buffer);
+
+#ifdef BAM_FAMILY_WINDOWS
+	remove(filename);
+#endif
+	if(rename(tmpfilename, filename) != 0)
+	{
+		printf( "%s: warning: error writing directory cache file '%s': %s\n", session.name, filename, strerror(errno) );
+		return -1;
+	}
+
+	return 0;
+}
+
+void dircache_free(struct DIRCACHE *cache)
+{
+	if(!cache)
+		return;
+	hashtable_destroy(&cache->index);
+	free(cache->dirs);
+	free(cache->names);
+	free(cache);
+}
+
+static void dircache_list_callback(const char *fullpath, const char *filename, int dir, void *user)
+{
+	struct DIRCACHE *cache = (struct DIRCACHE *)user;
+	cache->names = (hash_t *)resolvecache_grow(cache->names, &cache->max_names, cache->num_names+1, sizeof(hash_t));
+	cache->names[cache->num_names++] = string_hash_path(filename);
+}
+
+static int hash_compare(const void *a, const void *b)
+{
+	hash_t ha = *(const hash_t *)a;
+	hash_t hb = *(const hash_t *)b;
+	if(ha < hb)
+		return -1;
+	return ha > hb;
+}
+
+/* lists the directory into a new entry that replaces the old one */
+static struct DIRCACHE_DIR *dircache_list(struct DIRCACHE *cache, struct DIRCACHE_DIR *dir, const char *path, time_t timestamp)
+{
+	unsigned first = cache->num_names;
+	hash_t hashid = dir->hashid;
+
+	file_listdirectory(path, dircache_list_callback, cache);
+	qsort(cache->names + first, cache->num_names - first, sizeof(hash_t), hash_compare);
+
+	dir->state = DIRCACHE_UNLISTED;
+	cache->dirs = (struct DIRCACHE_DIR *)resolvecache_grow(cache->dirs, &cache->max_dirs, cache->num_dirs+1, sizeof(struct DIRCACHE_DIR));
+	dir = &cache->dirs[cache->num_dirs++];
+	memset(dir, 0, sizeof(struct DIRCACHE_DIR));
+	dir->hashid = hashid;
+	dir->timestamp = timestamp;
+	dir->listed = time(NULL);
+	dir->first_name = first;
+	dir->num_names = cache->num_names - first;
+	dir->state = DIRCACHE_LISTED;
+	cache->changed = 1;
+
+	resolvecache_reindex(&cache->index, cache->num_dirs, cache->dirs, sizeof(struct DIRCACHE_DIR));
+	hashtable_insert(&cache->index, hashid, cache->num_dirs-1);
+	return dir;
+}
+
+int dircache_missing(struct DIRCACHE *cache, struct STATCACHE *statcache, const char *filename)
+{
+	char path[MAX_PATH_LENGTH];
+	struct DIRCACHE_DIR *dir;
+	hash_t hashid;
+	hash_t namehash;
+	time_t timestamp;
+	unsigned index;
+	unsigned low, high;
+
+	/* the names are compared by hash, that doesn't work out on case
+		insensitive filesystems other than the ones on windows */
+#ifdef BAM_PLATFORM_MACOSX
+	return 0;
+#endif
+
+	if(!cache)
+		return 0;
+
+	if(path_directory(filename, path, sizeof(path)) != 0)
+		return 0;
+	if(path[0] == 0 && path_isabs(filename))
+		return 0;
+
+	hashid = string_hash_path(path);
+	index = hashtable_find(&cache->index, hashid);
+	if(index == HASHTABLE_NOTFOUND)
+	{
+		cache->dirs = (struct DIRCACHE_DIR *)resolvecache_grow(cache->dirs, &cache->max_dirs, cache->num_dirs+1, sizeof(struct DIRCACHE_DIR));
+		dir = &cache->dirs[cache->num_dirs++];
+		memset(dir, 0, sizeof(struct DIRCACHE_DIR));
+		dir->hashid = hashid;
+		resolvecache_reindex(&cache->index, cache->num_dirs, cache->dirs, sizeof(struct DIRCACHE_DIR));
+		hashtable_insert(&cache->index, hashid, cache->num_dirs-1);
+	}
+	else
+		dir = &cache->dirs[index];
+
+	/* one stat of the directory tells if the listing is still good */
+	if(dir->state == DIRCACHE_UNCHECKED)
+	{
+		timestamp = statcache_timestamp(statcache, path[0] ? path : ".");
+		if(dir->listed && timestamp && timestamp == dir->timestamp)
+			dir->state = DIRCACHE_LISTED;
+		else
+		{
+			dir->state = DIRCACHE_UNLISTED;
+			dir->timestamp = timestamp;
+		}
+	}
+
+	/* listing a directory costs more than a stat, so it's only done for
+		directories that more than one file is looked for in */
+	if(dir->state == DIRCACHE_UNLISTED)
+	{
+		if(dir->timestamp == 0 || ++dir->lookups < 2)
+			return 0;
+		dir = dircache_list(cache, dir, path, dir->timestamp);
+	}
+
+	namehash = string_hash_path(path_filename(filename));
+	low = 0;
+	high = dir->num_names;
+	while(low < high)
+	{
+		unsigned mid = low + (high - low) / 2;
+		hash_t h = cache->names[dir->first_name + mid];
+		if(h == namehash)
+			return 0;
+		if(h < namehash)
+			low = mid + 1;
+		else
+			high = mid;
+	}
+	return 1;
+}
+
+/*
+	the dependency cache file is laid out as follows, every part is
+	aligned so the file can be used directly from memory.
+
+		DEPCACHE_HEADER
+		CACHEINFO_DEPS nodes[num_nodes]
+		hash_t index_keys[index_size]	(see hashtable.h)
+		unsigned index_values[index_size]	(index in nodes)
+		unsigned deps[num_deps]
+		char strings[]
+*/
+struct DEPCACHE_HEADER
 {
 	char header[sizeof(bamheader)];
-	
 	unsigned num_nodes;
 	unsigned num_deps;
-	
-	struct CACHEINFO_DEPS_RB nodetree;
-	
+	unsigned index_size; /* power of two */
+	unsigned index_zero;
+	unsigned strings_size;
+	unsigned padding; /* keeps the index keys aligned */
+};
+
+struct DEPCACHE
+{
+	void *data;
+	size_t size;
+	int mapped;
+
+	struct DEPCACHE_HEADER *header;
 	struct CACHEINFO_DEPS *nodes;
+	struct HASHTABLE index;
 	unsigned *deps;
 	char *strings;
 };
@@ -501,15 +1268,20 @@ struct WRITEINFO
 	unsigned index;
 };
 
-static int write_header(struct WRITEINFO *info)
+static int write_header(struct WRITEINFO *info, struct HASHTABLE *index)
 {
 	/* setup the cache */
-	struct DEPCACHE depcache;
-	memset(&depcache, 0, sizeof(struct DEPCACHE));
-	memcpy(depcache.header, bamheader, sizeof(depcache.header));
-	depcache.num_nodes = info->graph->num_nodes;
-	depcache.num_deps = info->graph->num_deps;
-	if(io_write(info->fp, &depcache, sizeof(depcache)) != sizeof(depcache))
+	struct DEPCACHE_HEADER header;
+	struct NODE *node;
+	memset(&header, 0, sizeof(header));
+	memcpy(header.header, bamheader, sizeof(header.header));
+	header.num_nodes = info->graph->num_nodes;
+	header.num_deps = info->graph->num_deps;
+	header.index_size = index->mask + 1;
+	header.index_zero = index->zero;
+	for(node = info->graph->first; node; node = node->next)
+		header.strings_size += node->filename_len;
+	if(io_write(info->fp, &header, sizeof(header)) != sizeof(header))
 		return -1;
 	return 0;
 }
@@ -523,7 +1295,17 @@ static int write_flush(struct WRITEINFO *info, int elementsize)
 	return 0;
 }
 
-static int write_nodes(struct WRITEINFO *info)
+static int write_index(struct WRITEINFO *info, struct HASHTABLE *index)
+{
+	unsigned size = index->mask + 1;
+	if(io_write(info->fp, index->keys, size*sizeof(hash_t)) != size*sizeof(hash_t))
+		return -1;
+	if(io_write(info->fp, index->values, size*sizeof(unsigned)) != size*sizeof(unsigned))
+		return -1;
+	return 0;
+}
+
+static int write_nodes(struct WRITEINFO *info, struct HASHTABLE *index)
 {
 	unsigned dep_index;
 	unsigned string_index;
@@ -551,8 +1333,8 @@ static int write_nodes(struct WRITEINFO *info)
 		cacheinfo->hashid = node->hashid;
 		cacheinfo->cached = node->cached;
 		cacheinfo->timestamp_raw = node->timestamp_raw;
-		cacheinfo->deps = (unsigned*)((ptrdiff_t)dep_index);
-		cacheinfo->filename = (char*)((ptrdiff_t)string_index);
+		cacheinfo->deps = dep_index;
+		cacheinfo->filename = string_index;
 		
 		string_index += node->filename_len;
 		dep_index += cacheinfo->deps_num;
@@ -565,6 +1347,10 @@ static int write_nodes(struct WRITEINFO *info)
 	if(info->index && write_flush(info, sizeof(struct CACHEINFO_DEPS)))
 		return -1;
 
+	/* write the hash index */
+	if(write_index(info, index))
+		return -1;
+
 	/* write the cache nodes deps */
 	for(node = graph->first; node; node = node->next)
 	{
@@ -603,6 +1389,8 @@ static int write_nodes(struct WRITEINFO *info)
 int depcache_save(const char *filename, struct GRAPH *graph)
 {
 	struct WRITEINFO info;
+	struct HASHTABLE index;
+	struct NODE *node;
 	char tmpfilename[1024];
 	info.index = 0;
 	info.graph = graph;
@@ -617,20 +1405,30 @@ int depcache_save(const char *filename, struct GRAPH *graph)
 	}
 	
 	cache_setup_header("DEP");
+
+	/* the nodes are written in graph order so the index is the node id */
+	hashtable_create(&index, graph->num_nodes);
+	for(node = graph->first; node; node = node->next)
+		hashtable_insert(&index, node->hashid, node->id);
 	
-	if(write_header(&info) || write_nodes(&info))
+	if(write_header(&info, &index) || write_nodes(&info, &index))
 	{
 		/* error occured */
 		printf("%s: warning: error saving cache file '%s'\n", session.name, filename);
+		hashtable_destroy(&index);
 		io_close(info.fp);
-		io_close(io_open_write(filename));
+
+		/* the old file is left alone, it can be mapped by another process */
+		remove(tmpfilename);
 		return -1;
 	}
 
 	/* close up and return */
+	hashtable_destroy(&index);
 	io_close(info.fp);
 
-	/* place the file where it should be now that everything was written correctly */
+	/* place the file where it should be now that everything was written correctly.
+		a loaded cache that is mapped keeps the old file alive until it's freed */
 #ifdef BAM_FAMILY_WINDOWS
 	remove(filename);
 #endif
@@ -644,60 +1442,138 @@ int depcache_save(const char *filename, struct GRAPH *graph)
 	return 0;
 }
 
+/* maps the file into memory, falls back on reading it if mapping isn't available */
+static int depcache_map(struct DEPCACHE *depcache, const char *filename)
+{
+	IO_HANDLE fp;
+	
+	fp = io_open_read(filename);
+	if(!io_valid(fp))
+		return 0;
+	depcache->size = io_size(fp);
+
+#ifdef USE_UNIX_IO
+	if(depcache->size > 0)
+	{
+		depcache->data = mmap(NULL, depcache->size, PROT_READ, MAP_PRIVATE, fp, 0);
+		if(depcache->data != MAP_FAILED)
+		{
+			depcache->mapped = 1;
+			io_close(fp);
+			return 1;
+		}
+	}
+#endif
+
+	depcache->data = malloc(depcache->size);
+	if(io_read(fp, depcache->data, depcache->size) != depcache->size)
+	{
+		io_close(fp);
+		return 0;
+	}
+
+	io_close(fp);
+	return 1;
+}
+
 struct DEPCACHE *depcache_load(const char *filename)
 {
-	unsigned long filesize;
-	void *buffer;
 	struct DEPCACHE *depcache;
-	unsigned i;
+	struct DEPCACHE_HEADER *header;
+	hash_t *keys;
+	unsigned *values;
+	unsigned long long size;
 
-	if(!io_read_cachefile(filename, "DEP", &buffer, &filesize))
+	depcache = (struct DEPCACHE *)calloc(1, sizeof(struct DEPCACHE));
+	if(!depcache_map(depcache, filename))
+	{
+		depcache_free(depcache);
 		return NULL;
+	}
 	
-	/* verify read and headers */
-	depcache = (struct DEPCACHE *)buffer;
-	
-	if(	filesize < sizeof(struct DEPCACHE) ||
-		filesize < sizeof(struct DEPCACHE)+depcache->num_nodes*sizeof(struct CACHEINFO_DEPS))
+	/* verify headers and that everything lines up */
+	cache_setup_header("DEP");
+	header = (struct DEPCACHE_HEADER *)depcache->data;
+	if(depcache->size < sizeof(struct DEPCACHE_HEADER) ||
+		memcmp(header->header, bamheader, sizeof(bamheader)) != 0)
 	{
-		free(buffer);
+		printf("%s: warning: cache file '%s' is invalid, generating new one\n", session.name, filename);
+		depcache_free(depcache);
 		return NULL;
 	}
-	
-	/* setup pointers */
-	depcache->nodes = (struct CACHEINFO_DEPS *)(depcache+1);
-	depcache->deps = (unsigned *)(depcache->nodes+depcache->num_nodes);
-	depcache->strings = (char *)(depcache->deps+depcache->num_deps);
-	
-	/* build node tree and patch pointers */
-	for(i = 0; i < depcache->num_nodes; i++)
+
+	/* the index has to have free slots or a lookup of a hash that isn't
+		there never ends, it's written at most half full. the records are
+		checked when they are used, see depcache_find_byindex */
+	size = sizeof(struct DEPCACHE_HEADER);
+	size += (unsigned long long)header->num_nodes*sizeof(struct CACHEINFO_DEPS);
+	size += (unsigned long long)header->index_size*(sizeof(hash_t)+sizeof(unsigned));
+	size += (unsigned long long)header->num_deps*sizeof(unsigned);
+	size += header->strings_size;
+	if(size != depcache->size || header->index_size == 0 || (header->index_size & (header->index_size-1)) ||
+		header->index_size < 2*(unsigned long long)header->num_nodes ||
+		(header->strings_size && ((char *)depcache->data)[depcache->size-1] != 0))
 	{
-		depcache->nodes[i].filename = depcache->strings + (ptrdiff_t)depcache->nodes[i].filename;
-		depcache->nodes[i].deps = depcache->deps + (ptrdiff_t)depcache->nodes[i].deps;
-		RB_INSERT(CACHEINFO_DEPS_RB, &depcache->nodetree, &depcache->nodes[i]);
+		printf("%s: warning: cache file '%s' is invalid, generating new one\n", session.name, filename);
+		depcache_free(depcache);
+		return NULL;
 	}
 	
+	/* setup pointers, nothing is touched so only the pages that are used are loaded */
+	depcache->header = header;
+	depcache->nodes = (struct CACHEINFO_DEPS *)(header+1);
+	keys = (hash_t *)(depcache->nodes+header->num_nodes);
+	values = (unsigned *)(keys+header->index_size);
+	hashtable_init(&depcache->index, keys, values, header->index_size, header->index_zero);
+	depcache->deps = values+header->index_size;
+	depcache->strings = (char *)(depcache->deps+header->num_deps);
+	
 	/* done */
 	return depcache;
 }
 
 void depcache_free(struct DEPCACHE *depcache)
 {
+	if(!depcache)
+		return;
+
+#ifdef USE_UNIX_IO
+	if(depcache->mapped)
+		munmap(depcache->data, depcache->size);
+	else
+#endif
+		free(depcache->data);
 	free(depcache);
 }
 
+/* the records are checked here instead of when the file is loaded so
+	only the pages that are used are read. a record that points outside of
+	the file is treated as missing */
 struct CACHEINFO_DEPS *depcache_find_byindex(struct DEPCACHE *depcache, unsigned index)
 {
-	return &depcache->nodes[index];
+	struct DEPCACHE_HEADER *header = depcache->header;
+	struct CACHEINFO_DEPS *cacheinfo;
+
+	if(index >= header->num_nodes)
+		return NULL;
+
+	cacheinfo = &depcache->nodes[index];
+	if(cacheinfo->filename >= header->strings_size ||
+		cacheinfo->deps > header->num_deps || cacheinfo->deps_num > header->num_deps - cacheinfo->deps)
+		return NULL;
+	return cacheinfo;
 }
 
 struct CACHEINFO_DEPS *depcache_find_byhash(struct DEPCACHE *depcache, hash_t hashid)
 {
-	struct CACHEINFO_DEPS tempinfo;
 	if(!depcache)
 		return NULL;
-	tempinfo.hashid = hashid;
-	return RB_FIND(CACHEINFO_DEPS_RB, &depcache->nodetree, &tempinfo);
+	return depcache_find_byindex(depcache, hashtable_find(&depcache->index, hashid));
+}
+
+const char *depcache_node_filename(struct DEPCACHE *depcache, struct CACHEINFO_DEPS *cacheinfo)
+{
+	return depcache->strings + cacheinfo->filename;
 }
 
 int depcache_do_dependency(
@@ -708,6 +1584,7 @@ int depcache_do_dependency(
 {
 	struct CACHEINFO_DEPS *cacheinfo;
 	struct CACHEINFO_DEPS *depcacheinfo;
+	unsigned *deps;
 	int i;
 	
 	/* search the cache */
@@ -720,10 +1597,11 @@ int depcache_do_dependency(
 		node->depchecked = 1;
 		
 		/* use cached version */
+		deps = context->depcache->deps + cacheinfo->deps;
 		for(i = cacheinfo->deps_num-1; i >= 0; i--)
 		{
-			depcacheinfo = depcache_find_byindex(context->depcache, cacheinfo->deps[i]);
-			if(depcacheinfo->cached)
+			depcacheinfo = depcache_find_byindex(context->depcache, deps[i]);
+			if(depcacheinfo && depcacheinfo->cached)
 				callback(node, depcacheinfo, user);
 		}
 		
@@ -735,8 +1613,9 @@ int depcache_do_dependency(
 
 struct OUTPUTCACHE
 {
-	struct CACHEINFO_OUTPUT *info;
+	struct CACHEINFO_OUTPUT *info; /* sorted by hashid so it can be merged when saved */
 	unsigned count;
+	struct HASHTABLE index; /* hashid to index in info */
 };
 
 static int output_hash_compare(const void * a, const void * b)
@@ -816,6 +1695,7 @@ int outputcache_save(const char *filename, struct OUTPUTCACHE *oldcache, struct
 	unsigned index;
 	size_t output_size;
 	struct JOB * job;
+	struct NODE * node;
 	struct NODELINK * link;
 	struct CACHEINFO_OUTPUT * output;
 
@@ -843,12 +1723,15 @@ int outputcache_save(const char *filename, struct OUTPUTCACHE *oldcache, struct
 		return -1;
 	}
 
-	/* count outputs */
+	/* count outputs, and the inputs that has a digest */
 	num_outputs = 0;
 	for(job = graph->firstjob; job; job = job->next)
 		for(link = job->firstoutput; link; link = link->next)
 			if(link->node->timestamp_raw)
 				num_outputs++;
+	for(node = graph->first; node; node = node->next)
+		if(!node->job->cmdline && node->digest && !node->digestuntrusted && node->timestamp_raw)
+			num_outputs++;
 
 	output_size = sizeof(struct CACHEINFO_OUTPUT) * num_outputs;
 	output = malloc(output_size);
@@ -864,12 +1747,25 @@ int outputcache_save(const char *filename, struct OUTPUTCACHE *oldcache, struct
 				output[index].hashid = link->node->hashid;
 				output[index].cmdhash = link->node->job->cachehash;
 				output[index].timestamp = link->node->timestamp_raw;
+				output[index].digest = link->node->digestuntrusted ? 0 : link->node->digest;
+				output[index].depdigest = link->node->depdigest;
 
 				index++;
 			}
 		}
 	}
 
+	for(node = graph->first; node; node = node->next)
+	{
+		if(!node->job->cmdline && node->digest && !node->digestuntrusted && node->timestamp_raw)
+		{
+			output[index].hashid = node->hashid;
+			output[index].timestamp = node->timestamp_raw;
+			output[index].digest = node->digest;
+			index++;
+		}
+	}
+
 	/* sort the nodes */
 	qsort(output, num_outputs, sizeof(struct CACHEINFO_OUTPUT), output_hash_compare);
 
@@ -919,6 +1815,7 @@ struct OUTPUTCACHE *outputcache_load(const char *filename, time_t *cache_timesta
 	unsigned long payloadsize;
 	void *buffer;
 	struct OUTPUTCACHE *cache;
+	unsigned i;
 
 	if(cache_timestamp)
 		*cache_timestamp = file_timestamp(filename);
@@ -944,44 +1841,37 @@ struct OUTPUTCACHE *outputcache_load(const char *filename, time_t *cache_timesta
 	if(validate_outputcache(cache->info, cache->count))
 	{
 		printf("%s: warning: cache file '%s' is invalid, generating new one\n", session.name, filename);
+		free(cache);
 		free(buffer);
 		return NULL;
 	}
 
+	/* build the index */
+	hashtable_create(&cache->index, cache->count);
+	for(i = 0; i < cache->count; i++)
+		hashtable_insert(&cache->index, cache->info[i].hashid, i);
+
 	/* done */
 	return cache;
 }
 
+void outputcache_free(struct OUTPUTCACHE *outputcache)
+{
+	if(!outputcache)
+		return;
+	hashtable_destroy(&outputcache->index);
+	free((char *)outputcache->info - sizeof(bamheader));
+	free(outputcache);
+}
+
 
 struct CACHEINFO_OUTPUT *outputcache_find_byhash(struct OUTPUTCACHE *outputcache, hash_t hashid)
 {
-	/* do a binary search for the hashid */
-	unsigned low = 0;
-	unsigned high = outputcache->count;
 	unsigned index;
-
-	if(!outputcache || outputcache->count == 0)
+	if(!outputcache)
 		return NULL;
-
-	while(low < high)
-	{
-		index = low + (high - low) / 2;
-		if(hashid < outputcache->info[index].hashid)
-		{
-			if(index == 0)
-				break;
-			else
-				high = index - 1;
-		}
-		else if(hashid > outputcache->info[index].hashid)
-			low = index + 1;
-		else
-			return &outputcache->info[index];
-	}
-
-	if(low < outputcache->count && hashid == outputcache->info[low].hashid)
-		return &outputcache->info[low];
-
-	return NULL;
+	index = hashtable_find(&outputcache->index, hashid);
+	if(index == HASHTABLE_NOTFOUND)
+		return NULL;
+	return &outputcache->info[index];
 }
-
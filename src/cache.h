@@ -5,18 +5,24 @@ struct DEPCACHE;
 struct SCANCACHE;
 struct CHEADERREF;
 struct OUTPUTCACHE; /* bad name */
+struct RESOLVECACHE;
+struct DIRCACHE;
+struct STATCACHE;
 struct CONTEXT;
 struct NODE;
 
 /*
 	Dependecy cache
-	The dependecy cache keeps a list of dependencies for every node.
+	The dependecy cache keeps a list of dependencies for every node. The
+	file is mapped into memory as is and has a hash index so loading it
+	doesn't depend on the number of nodes in it.
 */
 int depcache_save(const char *filename, struct GRAPH *graph);
 struct DEPCACHE *depcache_load(const char *filename);
 void depcache_free(struct DEPCACHE *depcache);
 struct CACHEINFO_DEPS *depcache_find_byhash(struct DEPCACHE *cache, hash_t hashid);
 struct CACHEINFO_DEPS *depcache_find_byindex(struct DEPCACHE *cache, unsigned index);
+const char *depcache_node_filename(struct DEPCACHE *cache, struct CACHEINFO_DEPS *cacheinfo);
 int depcache_do_dependency(
 	struct CONTEXT *context,
 	struct NODE *node,
@@ -32,9 +38,44 @@ struct SCANCACHE *scancache_load(const char *filename);
 int scancache_find(struct SCANCACHE *scancache, struct NODE * node, struct CHEADERREF** result);
 void scancache_free(struct SCANCACHE *scancache);
 
+/*
+	Resolve cache
+	Remembers which of the places an include can be found in that had the
+	file, or that none of them had it, together with the timestamps of the
+	directories that were searched. The answer is good as long as none of
+	those directories have changed. resolvecache_load always returns a
+	cache, empty if there wasn't a valid file.
+*/
+struct RESOLVECACHE *resolvecache_load(const char *filename);
+int resolvecache_save(const char *filename, struct RESOLVECACHE *cache);
+void resolvecache_free(struct RESOLVECACHE *cache);
+/* returns 1 and sets found to the index of the candidate, -1 for none, if
+	there is a valid entry for the key */
+int resolvecache_find(struct RESOLVECACHE *cache, struct STATCACHE *statcache, hash_t key, int *found);
+/* makes a new entry, add every file that was looked for between begin and end */
+void resolvecache_begin(struct RESOLVECACHE *cache, hash_t key);
+void resolvecache_add_searched(struct RESOLVECACHE *cache, struct STATCACHE *statcache, const char *filename);
+void resolvecache_end(struct RESOLVECACHE *cache, int found);
+
+/*
+	Directory cache
+	Keeps the names in the directories that files have been looked for in
+	together with the timestamp of the directory when it was listed. One
+	stat of the directory tells if the listing is still good and then the
+	files that aren't in it are known to be missing without a stat of
+	their own. dircache_load always returns a cache, empty if there wasn't
+	a valid file.
+*/
+struct DIRCACHE *dircache_load(const char *filename);
+int dircache_save(const char *filename, struct DIRCACHE *cache);
+void dircache_free(struct DIRCACHE *cache);
+/* returns 1 if the file is known to not exist, 0 if it has to be stated */
+int dircache_missing(struct DIRCACHE *cache, struct STATCACHE *statcache, const char *filename);
+
 /*
 	Output cache
 	Keeps the latest commandline and timestamp that was used to build that output.
+	With --digest it also keeps the content digest of the outputs and inputs.
 */
 
 int outputcache_save(const char *filename, struct OUTPUTCACHE *oldcache, struct GRAPH *graph, time_t cache_timestamp);
@@ -2,12 +2,15 @@
 #include <stdlib.h> /* system() */
 #include <string.h> /* strerror() */
 #include <errno.h> /* errno */
+#include <stdarg.h> /* va_list */
 
 #include "mem.h"
 #include "context.h"
 #include "path.h"
 #include "node.h"
 #include "cache.h"
+#include "digest.h"
+#include "artifact.h"
 #include "support.h"
 #include "session.h"
 #include "verify.h"
@@ -22,6 +25,45 @@ int context_default_target(struct CONTEXT *context, struct NODE *node)
 	return 0;
 }
 
+void context_add_scriptinput(struct CONTEXT *context, const char *path)
+{
+	struct SCRIPTINPUT *input;
+	size_t len;
+
+	/* there is no context when a file is run with -e */
+	if(!context || !context->track_scriptinputs)
+		return;
+
+	/* the current directory is listed as "" */
+	if(path[0] == 0)
+		path = ".";
+
+	len = strlen(path);
+	input = (struct SCRIPTINPUT *)mem_allocate(context->graphheap, sizeof(struct SCRIPTINPUT) + len + 1);
+	input->path = (const char *)(input + 1);
+	memcpy(input + 1, path, len + 1);
+	input->timestamp = file_timestamp(path);
+	input->isdir = file_isdir(path);
+	input->next = context->firstscriptinput;
+	context->firstscriptinput = input;
+}
+
+int context_scriptinputs_changed(struct CONTEXT *context, time_t scripttime, int dirs)
+{
+	struct SCRIPTINPUT *input;
+	for(input = context->firstscriptinput; input; input = input->next)
+	{
+		if(input->isdir && !dirs)
+			continue;
+
+		/* a timestamp from the same second as the script ran in could
+			hide a change made right after it was read */
+		if(input->timestamp >= scripttime || file_timestamp(input->path) != input->timestamp)
+			return 1;
+	}
+	return 0;
+}
+
 static void progressbar_clear()
 {
 	printf("                                                 \r");
@@ -84,54 +126,135 @@ static int constraints_check(struct JOB *job)
 	return 0;
 }
 
-/* prints infomation about the job being run */
-static void runjob_print_report(struct CONTEXT *context, struct JOB *job, int thread_id)
+/*
+	prints a message that belongs to a job. when the output of the job is
+	captured, the message is kept together with it.
+*/
+static void job_printf(struct JOB *job, const char *format, ...)
 {
-	static const char *format = 0;
+	va_list args;
+	va_start(args, format);
+	if(job->output)
+		buffer_vprintf(job->output, format, args);
+	else
+		vprintf(format, args);
+	va_end(args);
+}
 
-	if(!format)
-	{
-		static char buf[128];
-		int jobdigits = 0;
-		int threaddigits = 0;
-		int c;
-		for(c = context->num_jobs; c; c /= 10)
-			jobdigits++;
+static const char *report_format = NULL;
 
-		for(c = session.threads; c; c /= 10)
-			threaddigits++;
-		
-		if(session.report_color)
-			sprintf(buf, "\033[01;32m[%%%dd/%%%dd] \033[01;36m[%%%dd]\033[00m %%s\n", jobdigits, jobdigits, threaddigits);
-		else
-			sprintf(buf, "[%%%dd/%%%dd] [%%%dd] %%s\n", jobdigits, jobdigits, threaddigits);
-		format = buf;
-	}
+/* creates the format for the job reports, must be done before the threads are started */
+static void runjob_report_setup(struct CONTEXT *context)
+{
+	static char buf[128];
+	int jobdigits = 0;
+	int threaddigits = 0;
+	int c;
+	for(c = context->num_jobs; c; c /= 10)
+		jobdigits++;
+
+	for(c = session.threads; c; c /= 10)
+		threaddigits++;
 	
-	if(session.report_bar)
-		progressbar_clear();
+	if(session.report_color)
+		sprintf(buf, "\033[01;32m[%%%dd/%%%dd] \033[01;36m[%%%dd]\033[00m %%s\n", jobdigits, jobdigits, threaddigits);
+	else
+		sprintf(buf, "[%%%dd/%%%dd] [%%%dd] %%s\n", jobdigits, jobdigits, threaddigits);
+	report_format = buf;
+}
+
+/* prints infomation about the job being run */
+static void runjob_print_report(struct CONTEXT *context, struct JOB *job, unsigned job_num, int thread_id)
+{
+	/* when the report goes into the captured output, the progress bar is drawn when it's written */
+	if(!job->output)
+	{
+		output_enter();
+		if(session.report_bar)
+			progressbar_clear();
+	}
+
 	if(session.report_steps)
 	{
 		if(session.simpleoutput)
-			printf("%s", job->label);
+			job_printf(job, "%s", job->label);
 		else
-			printf(format, context->current_job_num, context->num_jobs, thread_id, job->label);
+			job_printf(job, report_format, job_num, context->num_jobs, thread_id, job->label);
 	}
 	
-	if(session.report_bar)
-		progressbar_draw(context);
-	
 	if(session.verbose)
 	{
 		if(session.report_color)
-			printf("\033[01;33m%s\033[00m\n", job->cmdline);
+			job_printf(job, "\033[01;33m%s\033[00m\n", job->cmdline);
 		else
-			printf("%s\n", job->cmdline);
+			job_printf(job, "%s\n", job->cmdline);
 	}
-		
+
+	if(!job->output)
+	{
+		if(session.report_bar)
+			progressbar_draw(context);
+		fflush(stdout);
+		output_leave();
+	}
+}
+
+/* writes captured output to stdout, the output lock must be held */
+static void runjob_write_output(struct CONTEXT *context, struct BUFFER *output)
+{
+	if(output->size == 0)
+		return;
+
+	if(session.report_bar)
+		progressbar_clear();
+	fwrite(output->data, 1, output->size, stdout);
+	if(session.report_bar)
+		progressbar_draw(context);
 	fflush(stdout);
 }
 
+/*
+	writes the captured output of the job in one go. with ordered output
+	it's held back until the output of all jobs that started before it
+	has been written.
+*/
+static void runjob_flush_output(struct CONTEXT *context, struct JOB *job)
+{
+	struct BUFFER *output = job->output;
+	struct BUFFER *queued;
+
+	if(!output)
+		return;
+	job->output = NULL;
+
+	output_enter();
+	if(session.ordered_output)
+	{
+		/* take over the buffer and write out everything that is next in line */
+		queued = (struct BUFFER *)malloc(sizeof(struct BUFFER));
+		*queued = *output;
+		memset(output, 0, sizeof(struct BUFFER));
+		context->outputqueue[job->job_num-1] = queued;
+
+		while(context->next_output < context->num_jobs && context->outputqueue[context->next_output])
+		{
+			queued = context->outputqueue[context->next_output];
+			context->outputqueue[context->next_output] = NULL;
+			context->next_output++;
+
+			runjob_write_output(context, queued);
+			buffer_free(queued);
+			free(queued);
+		}
+	}
+	else
+	{
+		runjob_write_output(context, output);
+		buffer_free(output);
+	}
+	output_leave();
+}
+
 static int runjob_create_outputpaths(struct JOB *job)
 {
 	struct NODELINK *link;
@@ -142,15 +265,17 @@ static int runjob_create_outputpaths(struct JOB *job)
 		/* TODO: perhaps we can skip running this if we know that the file exists on disk already */
 		if(file_createpath(link->node->filename) != 0)
 		{
+			output_enter();
 			if(session.report_color)
-				printf("\033[01;31m");
+				job_printf(job, "\033[01;31m");
 			
-			printf("%s: could not create output directory for '%s'\n", session.name, link->node->filename);
+			job_printf(job, "%s: could not create output directory for '%s'\n", session.name, link->node->filename);
 
 			if(session.report_color)
-				printf("\033[00m");
+				job_printf(job, "\033[00m");
 				
 			fflush(stdout);
+			output_leave();
 			return 1;
 		}
 	}
@@ -181,7 +306,9 @@ static int verify_outputs(struct CONTEXT *context, struct JOB *job, time_t jobst
 		reason = NULL;
 		if(output_stamp == 0)
 		{
-			printf("%s: job '%s' did not produce expected output '%s'\n", session.name, job->label, link->node->filename);
+			output_enter();
+			job_printf(job, "%s: job '%s' did not produce expected output '%s'\n", session.name, job->label, link->node->filename);
+			output_leave();
 			errors++;
 		}
 		else if(output_stamp == link->node->timestamp_raw)
@@ -199,7 +326,9 @@ static int verify_outputs(struct CONTEXT *context, struct JOB *job, time_t jobst
 
 			if(session.verbose)
 			{
-				printf("%s: output '%s' was touched. %s\n", session.name, link->node->filename, reason);
+				output_enter();
+				job_printf(job, "%s: output '%s' was touched. %s\n", session.name, link->node->filename, reason);
+				output_leave();
 			}
 		}
 
@@ -233,12 +362,14 @@ static int verify_callback(const char *fullpath, hash_t hashid, time_t oldstamp,
 
 		if(link == NULL && slink == NULL)
 		{
+			output_enter();
 			if(oldstamp == 0)
-				printf("%s: verification error: %s was created and not specified as an output\n", session.name, fullpath);
+				job_printf(job, "%s: verification error: %s was created and not specified as an output\n", session.name, fullpath);
 			else if(newstamp == 0)
-				printf("%s: verification error: %s was deleted\n", session.name, fullpath);
+				job_printf(job, "%s: verification error: %s was deleted\n", session.name, fullpath);
 			else
-				printf("%s: verification error: %s was updated and not specified as an output\n", session.name, fullpath);
+				job_printf(job, "%s: verification error: %s was updated and not specified as an output\n", session.name, fullpath);
+			output_leave();
 			return 1;
 		}
 	}
@@ -246,19 +377,16 @@ static int verify_callback(const char *fullpath, hash_t hashid, time_t oldstamp,
 	return 0;
 }
 
-static int run_job(struct CONTEXT *context, struct JOB *job, int thread_id)
+/*
+	prepares the job for execution. returns non-zero if the job can't be
+	started, the job is then marked as broken.
+*/
+static int runjob_begin(struct CONTEXT *context, struct JOB *job, int thread_id)
 {
-	struct NODELINK *link;
-	int errorcode;
-	time_t starttime;
-
-	context->current_job_num++;
-
-	/* mark the node as its in the working */
-	job->status = JOBSTATUS_WORKING;
+	job->job_num = atomic_inc(&context->current_job_num);
 
 	/* print some nice information */
-	runjob_print_report(context, job, thread_id);
+	runjob_print_report(context, job, job->job_num, thread_id);
 
 	/* create output paths */
 	if(runjob_create_outputpaths(job) != 0)
@@ -267,29 +395,42 @@ static int run_job(struct CONTEXT *context, struct JOB *job, int thread_id)
 		return 1;
 	}
 
-	/* add constraints count */
-	constraints_update(job, 1);
-	
 	event_begin(thread_id, "job", job->label);
+	return 0;
+}
+
+/*
+	checks the result of the command and sets the status of the job
+	to done or broken.
+*/
+static int runjob_end(struct CONTEXT *context, struct JOB *job, int thread_id, int errorcode, time_t starttime)
+{
+	struct NODELINK *link;
 
-	/* execute the command */
-	criticalsection_leave();
-	starttime = timestamp();
-	errorcode = run_command(job->cmdline, job->filter);
 	if(errorcode == 0)
 	{
 		/* make sure that the tool updated the timestamp and produced all outputs */
 		errorcode = verify_outputs(context, job, starttime);
 	}
-	criticalsection_enter();
 
 	event_end(thread_id, "job", NULL);
 	
-	/* sub constraints count */
-	constraints_update(job, -1);
-	
 	if(errorcode == 0)
 	{
+		/* the dependents can be cut off if the outputs are the same as before */
+		if(session.digest)
+		{
+			for(link = job->firstoutput; link; link = link->next)
+				digest_node(link->node);
+		}
+
+		if(job->artifactkey && !job->restored)
+		{
+			event_begin(thread_id, "artifact store", job->label);
+			artifactcache_store(context->artifactcache, job->artifactkey, job);
+			event_end(thread_id, "artifact store", NULL);
+		}
+
 		/* job done successfully */
 		job->status = JOBSTATUS_DONE;
 		job->cachehash = job->cmdhash;
@@ -300,34 +441,98 @@ static int run_job(struct CONTEXT *context, struct JOB *job, int thread_id)
 		job->status = JOBSTATUS_BROKEN;
 
 		/* report the error */
+		output_enter();
 		if(session.report_color)
-			printf("\033[01;31m");
+			job_printf(job, "\033[01;31m");
 		
-		printf("%s: '%s' error %d\n", session.name, job->label, errorcode);
+		job_printf(job, "%s: '%s' error %d\n", session.name, job->label, errorcode);
 		
 		for(link = job->firstoutput; link; link = link->next)
 		{
 			if(file_timestamp(link->node->filename) != link->node->timestamp_raw)
 			{
 				remove(link->node->filename);
-				printf("%s: '%s' removed because job updated it even it failed.\n", session.name, link->node->filename);
+				job_printf(job, "%s: '%s' removed because job updated it even it failed.\n", session.name, link->node->filename);
 			}
 		}
 
 		if(session.report_color)
-			printf("\033[00m");
+			job_printf(job, "\033[00m");
 			
 		fflush(stdout);
+		output_leave();
 	}
 
-	/* run verify if requested */
+	/* run verify if requested, it checks the whole file system so only one at the time */
 	if(errorcode == 0 && context->verifystate != NULL)
 	{
+		criticalsection_enter();
 		event_begin(thread_id, "verify", job->label);
 		errorcode = verify_update(context->verifystate, verify_callback, job);
 		event_end(thread_id, "verify", NULL);
+		criticalsection_leave();
+	}
+
+	return errorcode;
+}
+
+/* copies the outputs of the job from the artifact cache instead of running
+	it, returns 1 if they were all restored */
+static int runjob_restore(struct CONTEXT *context, struct JOB *job)
+{
+	if(!job->artifactkey || !artifactcache_restore(context->artifactcache, job->artifactkey, job))
+		return 0;
+
+	job->restored = 1;
+	if(session.verbose)
+	{
+		output_enter();
+		job_printf(job, "%s: '%s' restored from the artifact cache\n", session.name, job->label);
+		output_leave();
+	}
+	return 1;
+}
+
+/* runs the job without holding any locks */
+static int run_job(struct CONTEXT *context, struct JOB *job, int thread_id)
+{
+	struct BUFFER output = {NULL, 0, 0};
+	time_t starttime;
+	int errorcode;
+
+	/* with ordered output the report is kept together with the output */
+	if(session.ordered_output)
+		job->output = &output;
+
+	errorcode = runjob_begin(context, job, thread_id);
+	if(errorcode == 0)
+	{
+		if(session.capture_output)
+			job->output = &output;
+
+		/* execute the command */
+		starttime = timestamp();
+		if(runjob_restore(context, job))
+			errorcode = 0;
+		else
+		{
+			errorcode = run_command(job->cmdline, job->filter, job->output);
+			if(session.verbose)
+			{
+				if(!job->output)
+					output_enter();
+				job_printf(job, "%s: ret=%d %s\n", session.name, errorcode, job->cmdline);
+				if(!job->output)
+				{
+					fflush(stdout);
+					output_leave();
+				}
+			}
+		}
+		errorcode = runjob_end(context, job, thread_id, errorcode, starttime);
 	}
 
+	runjob_flush_output(context, job);
 	return errorcode;
 }
 
@@ -337,68 +542,465 @@ struct THREADINFO
 	struct CONTEXT *context;
 };
 
-/* returns 1 if we can run this job */
-static int check_job(struct CONTEXT *context, struct JOB *job)
+/* returns 1 if job a should run before job b */
+static int readyqueue_before(struct JOB *a, struct JOB *b)
+{
+	if(a->priority != b->priority)
+		return a->priority > b->priority;
+	return a->buildorder < b->buildorder;
+}
+
+/* the ready queue is a binary heap of the jobs that can be run, highest priority first */
+static void readyqueue_push(struct CONTEXT *context, struct JOB *job)
+{
+	struct JOB **heap = context->readyjobs;
+	unsigned i = context->num_readyjobs++;
+	unsigned parent;
+
+	while(i > 0)
+	{
+		parent = (i-1)/2;
+		if(!readyqueue_before(job, heap[parent]))
+			break;
+		heap[i] = heap[parent];
+		i = parent;
+	}
+
+	heap[i] = job;
+}
+
+static struct JOB *readyqueue_pop(struct CONTEXT *context)
+{
+	struct JOB **heap = context->readyjobs;
+	struct JOB *top;
+	struct JOB *last;
+	unsigned i = 0;
+	unsigned child;
+
+	if(context->num_readyjobs == 0)
+		return NULL;
+
+	top = heap[0];
+	last = heap[--context->num_readyjobs];
+
+	/* sift the last job down from the top */
+	while(1)
+	{
+		child = i*2+1;
+		if(child >= context->num_readyjobs)
+			break;
+		if(child+1 < context->num_readyjobs && readyqueue_before(heap[child+1], heap[child]))
+			child++;
+		if(!readyqueue_before(heap[child], last))
+			break;
+		heap[i] = heap[child];
+		i = child;
+	}
+
+	heap[i] = last;
+	return top;
+}
+
+/*
+	counts the unfinished dependencies of every job and links each job to
+	the jobs that depends on it. jobs without pending dependencies goes
+	directly into the ready queue.
+*/
+static void schedule_setup(struct CONTEXT *context)
 {
 	struct NODELINK *link;
-	int broken = 0;
+	struct JOB *job;
+	struct JOB *depjob;
+	struct JOB **dependents;
+	unsigned num_links = 0;
+	unsigned i;
 
-	if(job->status != JOBSTATUS_UNDONE)
-		return 0;
+	for(i = 0; i < context->num_jobs; i++)
+	{
+		job = context->joblist[i];
+		job->buildorder = i;
+		job->num_pending_deps = 0;
+		job->num_dependents = 0;
+	}
 
-	/* make sure that all deps are done and propagate broken status */
-	for(link = job->firstjobdep; link; link = link->next)
+	/* count. a dependency only blocks if it is dirty, the rest are already done */
+	for(i = 0; i < context->num_jobs; i++)
 	{
-		if(link->node->job->status == JOBSTATUS_BROKEN)
-			broken = 1;
-		else if(link->node->dirty && link->node->job->status != JOBSTATUS_DONE)
-			return 0;
+		job = context->joblist[i];
+		for(link = job->firstjobdep; link; link = link->next)
+		{
+			if(!link->node->dirty)
+				continue;
+
+			/* a dirty dependency that isn't part of the build will never
+				finish so the job stays blocked, just as it would be anyway */
+			job->num_pending_deps++;
+			depjob = link->node->job;
+			if(depjob->counted)
+			{
+				depjob->num_dependents++;
+				num_links++;
+			}
+		}
 	}
 
-	/* check if we are broken and propagate the result */
-	if(broken)
+	/* hand out the dependent lists */
+	context->dependents = (struct JOB **)malloc((num_links+1) * sizeof(struct JOB *));
+	dependents = context->dependents;
+	for(i = 0; i < context->num_jobs; i++)
 	{
-		job->status = JOBSTATUS_BROKEN;
-		return 0;
+		job = context->joblist[i];
+		job->dependents = dependents;
+		dependents += job->num_dependents;
+		job->num_dependents = 0;
 	}
 
-	/* if it doesn't have a tool, just mark it as done */
-	if(!job->cmdline)
+	for(i = 0; i < context->num_jobs; i++)
 	{
-		job->status = JOBSTATUS_DONE;
+		job = context->joblist[i];
+		for(link = job->firstjobdep; link; link = link->next)
+		{
+			depjob = link->node->job;
+			if(link->node->dirty && depjob->counted)
+				depjob->dependents[depjob->num_dependents++] = job;
+		}
+	}
+
+	context->queuelock = lock_create();
+	if(session.ordered_output)
+		context->outputqueue = (struct BUFFER **)calloc(context->num_jobs+1, sizeof(struct BUFFER *));
+	context->next_output = 0;
+	context->num_running_jobs = 0;
+	context->num_finished_jobs = 0;
+	context->num_waiting_threads = 0;
+
+	/* seed the ready queue */
+	context->readyjobs = (struct JOB **)malloc((context->num_jobs+1) * sizeof(struct JOB *));
+	context->finishedjobs = (struct JOB **)malloc((context->num_jobs+1) * sizeof(struct JOB *));
+	context->constrainedjobs = (struct JOB **)malloc((context->num_jobs+1) * sizeof(struct JOB *));
+	context->num_readyjobs = 0;
+	context->num_constrainedjobs = 0;
+	for(i = 0; i < context->num_jobs; i++)
+	{
+		job = context->joblist[i];
+		if(job->num_pending_deps == 0)
+			readyqueue_push(context, job);
+	}
+}
+
+static void schedule_cleanup(struct CONTEXT *context)
+{
+	lock_destroy(context->queuelock);
+	context->queuelock = NULL;
+	free(context->outputqueue);
+	context->outputqueue = NULL;
+	free(context->dependents);
+	free(context->readyjobs);
+	free(context->finishedjobs);
+	free(context->constrainedjobs);
+	context->dependents = NULL;
+	context->readyjobs = NULL;
+	context->finishedjobs = NULL;
+	context->constrainedjobs = NULL;
+}
+
+/*
+	decrements the pending count of the jobs that depends on this job. it
+	doesn't need the queuelock. the jobs that became ready are moved to
+	the front of the dependents list and the number of them is returned.
+*/
+static unsigned schedule_release(struct JOB *job)
+{
+	struct JOB *dependent;
+	unsigned num_released = 0;
+	unsigned i;
+
+	for(i = 0; i < job->num_dependents; i++)
+	{
+		dependent = job->dependents[i];
+
+		/* propagate broken status. the atomic decrement makes sure that
+			it's visible to the thread that sees the count reach zero */
+		if(job->status == JOBSTATUS_BROKEN)
+			dependent->status = JOBSTATUS_BROKEN;
+
+		if(atomic_dec(&dependent->num_pending_deps) == 0)
+		{
+			job->dependents[i] = job->dependents[num_released];
+			job->dependents[num_released++] = dependent;
+		}
+	}
+
+	return num_released;
+}
+
+/*
+	called with the queuelock held when a job has released its dependents.
+	queues the released jobs and propagates broken status. returns the
+	number of jobs that became ready.
+*/
+static unsigned schedule_queue_released(struct CONTEXT *context, struct JOB *job, unsigned num_released)
+{
+	struct JOB **stack = context->finishedjobs;
+	struct JOB *dependent;
+	unsigned num_stack = 0;
+	unsigned num_ready = 0;
+	unsigned i;
+
+	while(1)
+	{
+		for(i = 0; i < num_released; i++)
+		{
+			dependent = job->dependents[i];
+			if(dependent->status == JOBSTATUS_BROKEN)
+				stack[num_stack++] = dependent;
+			else
+			{
+				readyqueue_push(context, dependent);
+				num_ready++;
+			}
+		}
+
+		if(num_stack == 0)
+			break;
+
+		/* broken jobs are never run, release their dependents directly */
+		job = stack[--num_stack];
+		context->num_finished_jobs++;
+		num_released = schedule_release(job);
+	}
+
+	return num_ready;
+}
+
+/*
+	called with the queuelock held when a job has been run and released its
+	dependents. returns the number of jobs that became ready.
+*/
+static unsigned schedule_finish(struct CONTEXT *context, struct JOB *job, unsigned num_released)
+{
+	unsigned num_ready;
+	unsigned i;
+
+	constraints_update(job, -1);
+	context->num_running_jobs--;
+	context->num_finished_jobs++;
+
+	/* parked jobs might be allowed to run now that the constraints are released */
+	for(i = 0; i < context->num_constrainedjobs; i++)
+		readyqueue_push(context, context->constrainedjobs[i]);
+	num_ready = context->num_constrainedjobs;
+	context->num_constrainedjobs = 0;
+
+	return num_ready + schedule_queue_released(context, job, num_released);
+}
+
+/* adds up the digests of the dependencies of the node, and their
+	dependencies down to the outputs of other jobs */
+static hash_t depdigest_add(struct NODE *node, unsigned walk, int *unknown)
+{
+	struct NODELINK *dep;
+	hash_t digest = 0;
+
+	for(dep = node->firstdep; dep; dep = dep->next)
+	{
+		struct NODE *depnode = dep->node;
+		if(depnode->digestwalk == walk)
+			continue;
+		depnode->digestwalk = walk;
+
+		/* outputs of jobs that hasn't run yet will change */
+		if(depnode->timestamp_raw && !depnode->digest)
+			*unknown = 1;
+		else if(depnode->dirty && depnode->job->cmdline && depnode->job->status != JOBSTATUS_DONE)
+			*unknown = 1;
+		digest += digest_combine(depnode->hashid, depnode->digest);
+
+		/* the inputs of other jobs are covered by the digest of their outputs */
+		if(!depnode->job->cmdline)
+			digest += depdigest_add(depnode, walk, unknown);
+	}
+
+	return digest;
+}
+
+/* returns a digest of all the files that the node is built from, 0 if
+	the digest of one of them isn't known */
+static hash_t node_depdigest(struct CONTEXT *context, struct NODE *node)
+{
+	hash_t digest;
+	int unknown = 0;
+
+	node->digestwalk = ++context->digestwalk;
+	digest = depdigest_add(node, context->digestwalk, &unknown);
+	if(unknown)
 		return 0;
+	return digest ? digest : 1;
+}
+
+/* returns 1 if the inputs of every output of the job has the same
+	content as when the outputs were built */
+static int job_inputs_unchanged(struct CONTEXT *context, struct JOB *job)
+{
+	struct CACHEINFO_OUTPUT *outputcacheinfo;
+	struct NODELINK *link;
+
+	for(link = job->firstoutput; link; link = link->next)
+	{
+		outputcacheinfo = outputcache_find_byhash(context->outputcache, link->node->hashid);
+		if(!outputcacheinfo || !outputcacheinfo->depdigest)
+			return 0;
+		if(outputcacheinfo->timestamp != link->node->timestamp_raw)
+			return 0;
+		if(node_depdigest(context, link->node) != outputcacheinfo->depdigest)
+			return 0;
 	}
-	
-	/* check if constraints allows it */
-	if(constraints_check(job))
+
+	return 1;
+}
+
+/* returns the key of the job in the artifact cache. it's made from the
+	command line, the outputs and the digests of all the files that the job
+	is built from. 0 if one of the digests isn't known. queuelock must be
+	held as the digest walks marks the nodes */
+static hash_t job_artifactkey(struct CONTEXT *context, struct JOB *job)
+{
+	struct NODELINK *link;
+	hash_t outputs = 0;
+	hash_t inputs = 0;
+	unsigned walk = ++context->digestwalk;
+	int unknown = 0;
+
+	/* outputs that depends on each other are made by the job itself */
+	for(link = job->firstoutput; link; link = link->next)
+	{
+		link->node->digestwalk = walk;
+		outputs += link->node->hashid;
+	}
+
+	for(link = job->firstoutput; link; link = link->next)
+		inputs += depdigest_add(link->node, walk, &unknown);
+
+	if(unknown)
 		return 0;
-	
+	return digest_combine(digest_combine(job->cmdhash, outputs), inputs);
+}
+
+/*
+	returns 1 if the job doesn't have to run after all. with --digest a job
+	that is dirty only because of its dependencies is up to date if they
+	were rebuilt with the same content as before. queuelock must be held
+	as the digest walks marks the nodes.
+*/
+static int schedule_cutoff(struct CONTEXT *context, struct JOB *job)
+{
+	struct NODELINK *link;
+
+	if(!session.digest || job->status == JOBSTATUS_BROKEN)
+		return 0;
+
+	for(link = job->firstoutput; link; link = link->next)
+		if(link->node->dirty & ~(NODEDIRTY_DEPDIRTY|NODEDIRTY_DEPNEWER))
+			return 0;
+
+	if(!job_inputs_unchanged(context, job))
+		return 0;
+
+	/* the outputs are up to date, the job is done without running */
+	for(link = job->firstoutput; link; link = link->next)
+		link->node->dirty = 0;
+	job->cutoff = 1;
+	job->status = JOBSTATUS_DONE;
+	job->cachehash = job->cmdhash;
+
+	if(session.verbose)
+	{
+		/* with ordered output the message waits for its turn like the
+			output of a job that has run */
+		struct BUFFER output = {NULL, 0, 0};
+		if(session.ordered_output)
+		{
+			job->job_num = atomic_inc(&context->current_job_num);
+			job->output = &output;
+		}
+		else
+			output_enter();
+
+		job_printf(job, "%s: '%s' is up to date, the inputs didn't change\n", session.name, job->label);
+
+		if(job->output)
+			runjob_flush_output(context, job);
+		else
+			output_leave();
+	}
 	return 1;
 }
 
 /*
-	searches the context for a job that we can do
+	called with the queuelock held when nothing is ready or running. jobs
+	that are left waits on a dependency that never finishes, for example
+	one that isn't part of the build. they are reported and counted as
+	broken so the build fails instead of passing without them.
 */
-static struct JOB *find_job(struct CONTEXT *context)
+static void schedule_check_stuck(struct CONTEXT *context)
 {
 	struct JOB *job;
 	unsigned i;
 
-	/* advance first_undone_job */
-	while(context->first_undone_job < context->num_jobs &&
-		context->joblist[context->first_undone_job]->status != JOBSTATUS_UNDONE)
+	if(context->num_finished_jobs == context->num_jobs)
+		return;
+
+	for(i = 0; i < context->num_jobs; i++)
 	{
-		context->first_undone_job++;
+		job = context->joblist[i];
+		if(job->num_pending_deps && job->status == JOBSTATUS_UNDONE)
+		{
+			printf("%s: '%s' can't be built, one of its dependencies never finished\n", session.name, job->label);
+			break;
+		}
 	}
 
-	for(i = context->first_undone_job; i < context->num_jobs; i++)
+	for(i = 0; i < context->num_jobs; i++)
 	{
 		job = context->joblist[i];
-		if(check_job(context, job))
+		if(job->num_pending_deps)
+			job->status = JOBSTATUS_BROKEN;
+	}
+
+	context->num_finished_jobs = context->num_jobs;
+	context->errorcode = 1;
+}
+
+/* fetches the highest priority job that we can run right now, queuelock must be held */
+static struct JOB *schedule_next(struct CONTEXT *context)
+{
+	struct JOB *job;
+
+	while((job = readyqueue_pop(context)) != NULL)
+	{
+		/* jobs that are cut off releases their dependents directly */
+		if(schedule_cutoff(context, job))
+		{
+			context->num_finished_jobs++;
+			schedule_queue_released(context, job, schedule_release(job));
+			continue;
+		}
+
+		if(context->artifactcache)
+			job->artifactkey = job_artifactkey(context, job);
+
+		/* check if constraints allows it, else park it until a job finishes */
+		if(!constraints_check(job))
+		{
+			constraints_update(job, 1);
+			job->status = JOBSTATUS_WORKING;
+			context->num_running_jobs++;
 			return job;
+		}
+		context->constrainedjobs[context->num_constrainedjobs++] = job;
 	}
 
-	return 0;
+	return NULL;
 }
 
 static void threads_run(void *u)
@@ -406,10 +1008,11 @@ static void threads_run(void *u)
 	struct THREADINFO *info = (struct THREADINFO *)u;
 	struct CONTEXT *context = info->context;
 	struct JOB *job;
-	int backofftime = 1;
+	unsigned num_released;
+	unsigned num_ready;
+	int errorcode;
 	
-	/* lock the dependency graph */
-	criticalsection_enter();
+	lock_enter(context->queuelock);
 	
 	install_abort_signal();
 
@@ -418,35 +1021,159 @@ static void threads_run(void *u)
 		if(session.abort)
 			break;
 
-		/* check if we are done */
-		if(context->first_undone_job >= context->num_jobs)
-			break;
-
 		if(context->exit_on_error && context->errorcode)
 			break;
 
-		job = find_job(context);
+		job = schedule_next(context);
 		if(job)
 		{
-			backofftime = 1;
-			if(run_job(context, job, info->id + 1))
+			/* run the job and release the dependents without the lock */
+			lock_leave(context->queuelock);
+			errorcode = run_job(context, job, info->id + 1);
+			num_released = schedule_release(job);
+			lock_enter(context->queuelock);
+
+			if(errorcode)
 				context->errorcode = 1;
+
+			/* we take one of the released jobs ourself, wake up threads for the rest */
+			num_ready = schedule_finish(context, job, num_released);
+			for(; num_ready > 1 && context->num_waiting_threads; num_ready--)
+				lock_signal(context->queuelock);
+		}
+		else if(context->num_running_jobs == 0)
+		{
+			/* we are done, nothing is running that could make another job ready */
+			schedule_check_stuck(context);
+			break;
 		}
 		else
 		{
-			/* if we didn't find a job todo, be a bit nice to the processor */
-			criticalsection_leave();
-			/* TODO: we should wait for an event here */
-			/* back off more and more up to 200ms */
-			backofftime *= 2;
-			if(backofftime > 200)
-				backofftime = 200;
-			threads_sleep(backofftime);
-			criticalsection_enter();
+			/* wait for a running job to finish */
+			context->num_waiting_threads++;
+			lock_wait(context->queuelock);
+			context->num_waiting_threads--;
 		}
 	}
-	
-	criticalsection_leave();
+
+	/* make sure that the waiting threads notice that we are done */
+	lock_broadcast(context->queuelock);
+	lock_leave(context->queuelock);
+}
+
+/*
+	asynchronous mode. this thread starts all the jobs without waiting for
+	them and reaps them as they finish. session.threads sets how many jobs
+	that can run at the same time.
+*/
+static void async_run(struct CONTEXT *context)
+{
+	struct COMMAND *commands;
+	struct JOB **jobs;
+	time_t *starttimes;
+	struct JOB *job;
+	unsigned num_released;
+	int num_slots = session.threads;
+	int errorcode;
+	int i;
+
+	commands = (struct COMMAND *)calloc(num_slots, sizeof(struct COMMAND));
+	jobs = (struct JOB **)calloc(num_slots, sizeof(struct JOB *));
+	starttimes = (time_t *)calloc(num_slots, sizeof(time_t));
+
+	/* the scheduler expects the lock to be held, there is no one else to contend with */
+	lock_enter(context->queuelock);
+
+	install_abort_signal();
+
+	while(1)
+	{
+		/* start as many jobs as we can, unless we are giving up */
+		while(!session.abort && !(context->exit_on_error && context->errorcode) &&
+			(int)context->num_running_jobs < num_slots && (job = schedule_next(context)) != NULL)
+		{
+			for(i = 0; jobs[i]; i++)
+				;
+
+			/* with ordered output the report is kept together with the output */
+			if(session.ordered_output)
+				job->output = &commands[i].output;
+
+			errorcode = runjob_begin(context, job, i + 1);
+			if(errorcode == 0)
+			{
+				if(session.capture_output)
+					job->output = &commands[i].output;
+
+				starttimes[i] = timestamp();
+				if(runjob_restore(context, job))
+					errorcode = runjob_end(context, job, i + 1, 0, starttimes[i]);
+				else if(run_command_start(&commands[i], job->cmdline, job->filter, session.capture_output) == 0)
+				{
+					jobs[i] = job;
+					continue;
+				}
+				else
+					errorcode = runjob_end(context, job, i + 1, -1, starttimes[i]);
+			}
+
+			/* the job never started, finish it directly */
+			runjob_flush_output(context, job);
+			if(errorcode)
+				context->errorcode = 1;
+			num_released = schedule_release(job);
+			schedule_finish(context, job, num_released);
+		}
+
+		/* we are done when there is nothing left running */
+		if(context->num_running_jobs == 0)
+		{
+			if(!session.abort && !(context->exit_on_error && context->errorcode))
+				schedule_check_stuck(context);
+			break;
+		}
+
+		/* wait for a job to finish */
+		i = run_command_wait(commands, num_slots);
+		if(i == -1)
+		{
+			/* the jobs that are still running can't be waited for, stop
+				them and count them as broken */
+			printf("%s: error waiting for the jobs to finish\n", session.name);
+			context->errorcode = 1;
+			run_command_kill(commands, num_slots);
+			for(i = 0; i < num_slots; i++)
+			{
+				job = jobs[i];
+				if(!job)
+					continue;
+				jobs[i] = NULL;
+				runjob_end(context, job, i + 1, -1, starttimes[i]);
+				runjob_flush_output(context, job);
+				num_released = schedule_release(job);
+				schedule_finish(context, job, num_released);
+			}
+			break;
+		}
+
+		job = jobs[i];
+		jobs[i] = NULL;
+
+		if(session.verbose)
+			job_printf(job, "%s: ret=%d %s\n", session.name, commands[i].status, job->cmdline);
+
+		if(runjob_end(context, job, i + 1, commands[i].status, starttimes[i]))
+			context->errorcode = 1;
+
+		runjob_flush_output(context, job);
+		num_released = schedule_release(job);
+		schedule_finish(context, job, num_released);
+	}
+
+	lock_leave(context->queuelock);
+	free(commands);
+	free(jobs);
+	free(starttimes);
 }
 
 int context_build_make(struct CONTEXT *context)
@@ -456,8 +1183,8 @@ int context_build_make(struct CONTEXT *context)
 	void *threads[BAM_MAX_THREADS];
 	int i;
 	
-	/* clamp number of threads */
-	if(session.threads > BAM_MAX_THREADS)
+	/* clamp number of threads, asynchronous mode only uses this thread */
+	if(session.threads > BAM_MAX_THREADS && !session.async)
 	{
 		printf("%s: reduced %d threads down to %d due to hard limit\n", session.name, session.threads, BAM_MAX_THREADS);
 		printf("%s: change BAM_MAX_THREADS during compile to increase\n", session.name);
@@ -472,7 +1199,17 @@ int context_build_make(struct CONTEXT *context)
 		info[i].id = i;
 	}
 
-	if(session.threads <= 1)
+	schedule_setup(context);
+	runjob_report_setup(context);
+
+	if(session.async)
+	{
+		/* one thread that supervises all the processes */
+		async_run(context);
+		if(session.report_bar)
+			progressbar_clear();
+	}
+	else if(session.threads <= 1)
 	{
 		/* no threading, use this thread then */
 		threads_run(&info[0]);
@@ -492,6 +1229,8 @@ int context_build_make(struct CONTEXT *context)
 		if(session.report_bar)
 			progressbar_clear();
 	}
+
+	schedule_cleanup(context);
 	return context->errorcode;
 }
 
@@ -623,6 +1362,11 @@ static int build_prepare_callback(struct NODEWALK *walkinfo)
 		}
 	}
 
+	/* a job that only has inputs that are newer doesn't have to run if
+		the content of them is the same as when it was built */
+	if(session.digest && node->dirty == NODEDIRTY_DEPNEWER && job_inputs_unchanged(context, node->job))
+		node->dirty = 0;
+
 	/* mark as targeted */
 	if(!walkinfo->revisiting)
 		node->targeted = 1;
@@ -670,6 +1414,32 @@ static int build_prepare_callback(struct NODEWALK *walkinfo)
 
 /* prepare does time sanity checking, dirty propagation,
 	graph validation and job counting */
+/* takes the digests from the output cache for the files that hasn't
+	changed and computes the rest */
+static void build_prepare_digests(struct CONTEXT *context)
+{
+	struct CACHEINFO_OUTPUT *outputcacheinfo;
+	struct NODE **nodes;
+	struct NODE *node;
+	unsigned num = 0;
+
+	nodes = (struct NODE **)malloc(context->graph->num_nodes * sizeof(struct NODE *));
+	for(node = context->graph->first; node; node = node->next)
+	{
+		if(!node->timestamp_raw)
+			continue;
+
+		outputcacheinfo = outputcache_find_byhash(context->outputcache, node->hashid);
+		if(outputcacheinfo && outputcacheinfo->digest && outputcacheinfo->timestamp == node->timestamp_raw)
+			node->digest = outputcacheinfo->digest;
+		else
+			nodes[num++] = node;
+	}
+
+	digest_nodes(nodes, num, session.threads);
+	free(nodes);
+}
+
 int context_build_prepare(struct CONTEXT *context)
 {
 	int error_code;
@@ -677,6 +1447,9 @@ int context_build_prepare(struct CONTEXT *context)
 	/* create the job list */
 	context->joblist = (struct JOB **)malloc(context->graph->num_jobs * sizeof(struct JOB *));
 
+	if(session.digest)
+		build_prepare_digests(context);
+
 	/* revisit is used here to solve the problems
 		where we have circular dependencies */
 	error_code = node_walk(context->target,
@@ -686,6 +1459,45 @@ int context_build_prepare(struct CONTEXT *context)
 	return error_code;
 }
 
+void context_build_digests(struct CONTEXT *context)
+{
+	struct NODELINK *link;
+	struct JOB *job;
+
+	/* outputs that are up to date are built from what their inputs are
+		now, the outputs that were built got their digests when the job
+		finished */
+	for(job = context->graph->firstjob; job; job = job->next)
+	{
+		int uptodate = job->cachehash != 0 && job->cachehash == job->cmdhash;
+		for(link = job->firstoutput; link; link = link->next)
+			link->node->depdigest = uptodate ? node_depdigest(context, link->node) : 0;
+	}
+}
+
+void context_build_lookup_artifacts(struct CONTEXT *context)
+{
+	hash_t *keys;
+	unsigned num_keys = 0;
+	unsigned i;
+
+	/* jobs that depends on jobs that hasn't run yet doesn't get a key
+		until they are scheduled */
+	keys = (hash_t *)malloc((context->num_jobs+1) * sizeof(hash_t));
+	for(i = 0; i < context->num_jobs; i++)
+	{
+		hash_t key = job_artifactkey(context, context->joblist[i]);
+		if(key)
+			keys[num_keys++] = key;
+	}
+
+	artifactcache_lookup(context->artifactcache, keys, num_keys);
+	free(keys);
+
+	if(session.verbose)
+		printf("%s: looked up %u of %u jobs in the artifact cache\n", session.name, num_keys, context->num_jobs);
+}
+
 static int build_prioritize_callback(struct NODEWALK *walkinfo)
 {
 	struct JOB *job = walkinfo->node->job;
@@ -8,6 +8,7 @@ struct DEFERRED
 	struct DEFERRED *next;
 	struct NODE *node;
 	int (*run)(struct CONTEXT *context, struct DEFERRED *info);
+	void (*queue)(struct CONTEXT *context, struct DEFERRED *info); /* optional, queues work that run will need */
 	void *user;
 	hash_t depcontext;
 };
@@ -21,6 +22,15 @@ struct DEFERRED_CSCAN
 
 #define CSCAN_HASHSIZE 256 /* must be power of 2 */
 
+/* file or directory that the script looked at */
+struct SCRIPTINPUT
+{
+	struct SCRIPTINPUT *next;
+	const char *path;
+	time_t timestamp;
+	int isdir; /* the script listed the directory */
+};
+
 struct CONTEXT
 {
 	/* lua state */
@@ -35,6 +45,9 @@ struct CONTEXT
 	struct DEPCACHE *depcache;
 	struct OUTPUTCACHE *outputcache;
 	struct SCANCACHE *scancache;
+	struct RESOLVECACHE *resolvecache;
+	struct DIRCACHE *dircache;
+	struct ARTIFACTCACHE *artifactcache; /* NULL if there is no artifact cache */
 
 	struct STATCACHE *statcache;
 
@@ -42,11 +55,29 @@ struct CONTEXT
 	struct NODE *defaulttarget;	/* default target if no targets are specified */
 	struct NODE *target;		/* target to build */
 
+	unsigned digestwalk;		/* counter for the walks done when making depdigests */
+
 	/* list of jobs that we must build */
 	struct JOB **joblist;
 	unsigned num_jobs;			/* number of jobs in the joblist */
-	unsigned first_undone_job;	/* index to first job in the joblist that is undone */
-	unsigned current_job_num;	/* current job we are building, not an index, just a count */
+	volatile unsigned current_job_num;	/* current job we are building, not an index, just a count */
+
+	/* scheduling, only valid during context_build_make. the fields below
+		are protected by the queuelock */
+	struct LOCK *queuelock;
+	unsigned num_running_jobs;	/* number of jobs that are executing right now */
+	unsigned num_finished_jobs;	/* number of jobs that are done, broken or cut off */
+	unsigned num_waiting_threads; /* number of threads waiting for a job to finish */
+	struct JOB **readyjobs;		/* heap of jobs that can be run, ordered by priority */
+	unsigned num_readyjobs;
+	struct JOB **constrainedjobs; /* ready jobs that waits for a constraint to be released */
+	unsigned num_constrainedjobs;
+	struct JOB **finishedjobs;	/* scratch space when releasing dependents of a finished job */
+	struct JOB **dependents;	/* storage for the dependent lists of the jobs */
+
+	/* ordered output, protected by the output lock */
+	struct BUFFER **outputqueue;	/* captured output by job number, waiting for the jobs before */
+	unsigned next_output;		/* index in the outputqueue that should be written next */
 
 	/* this heap is used for dependency lookups that has to happen after we 
 		parsed the whole file */
@@ -54,8 +85,11 @@ struct CONTEXT
 	struct DEFERRED *firstdeferred_cpp;
 	struct DEFERRED *firstdeferred_search;
 	struct DEFERRED_CSCAN *firstcscans[CSCAN_HASHSIZE];
+	struct CSCAN *cscan;		/* header scanning, only valid while the deferred functions run */
 	
 	time_t globaltimestamp;		/* timestamp of the script files */
+	int track_scriptinputs;		/* the build server wants to know what the script looked at */
+	struct SCRIPTINPUT *firstscriptinput;
 	time_t buildtime;			/* timestamp when the build started */
 	time_t postsetuptime;		/* timestamp after the setup when script has run to completion etc */
 
@@ -70,9 +104,27 @@ struct CONTEXT
 
 int context_default_target(struct CONTEXT *context, struct NODE *node);
 
+/* remembers the timestamp of a file or directory that the result of the
+	script depends on, if the inputs are tracked */
+void context_add_scriptinput(struct CONTEXT *context, const char *path);
+
+/* returns 1 if any of the script inputs has changed since the script
+	started running at scripttime. directories are left out if dirs is 0,
+	--watch finds out if their listings changed from the watcher since the
+	timestamps changes when the build writes outputs into them */
+int context_scriptinputs_changed(struct CONTEXT *context, time_t scripttime, int dirs);
+
 int context_build_prepare(struct CONTEXT *context);
 int context_build_prioritize(struct CONTEXT *context);
 int context_build_clean(struct CONTEXT *context);
 int context_build_make(struct CONTEXT *context);
 
+/* updates the depdigests of all the outputs so they can be written to
+	the output cache */
+void context_build_digests(struct CONTEXT *context);
+
+/* looks up the jobs that can be looked up before the build in the
+	artifact cache, the rest are looked up one by one as they are run */
+void context_build_lookup_artifacts(struct CONTEXT *context);
+
 void context_dump_joblist(struct CONTEXT *context);
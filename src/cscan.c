@@ -0,0 +1,564 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stddef.h> /* ptrdiff_t */
+
+#include "cscan.h"
+#include "node.h"
+#include "platform.h"
+#include "support.h"
+
+#ifdef BAM_FAMILY_UNIX
+	#include <fcntl.h>
+	#include <unistd.h>
+	#include <sys/types.h>
+	#include <sys/stat.h>
+	#include <sys/mman.h>
+	#define CSCAN_USE_MMAP
+#endif
+
+#define CSCAN_MAX_THREADS 32
+
+/* files this large are mapped instead of read, mapping small files costs
+	more than reading them into a buffer that is reused */
+#ifndef CSCAN_MMAP_SIZE
+	#define CSCAN_MMAP_SIZE (64*1024)
+#endif
+
+/* file states */
+#define CSCANSTATE_NEW		0	/* not scanned */
+#define CSCANSTATE_QUEUED	1	/* waiting for a worker */
+#define CSCANSTATE_SCANNING	2	/* a worker is scanning it */
+#define CSCANSTATE_DONE		3	/* the result is available */
+#define CSCANSTATE_RELEASED	4	/* the result has been released, it might still be in the queue */
+
+/* read buffer, one for each thread */
+struct CSCAN_BUFFER
+{
+	char *data;
+	size_t size;
+};
+
+struct CSCAN_THREAD
+{
+	struct CSCAN *cscan;
+	struct CSCAN_BUFFER buffer;
+	int id;
+};
+
+struct CSCAN
+{
+	/* the queue and the file states are protected by the lock */
+	struct LOCK *lock;
+	struct CSCAN_FILE *first;
+	struct CSCAN_FILE *last;
+	int quit;
+
+	/* all files that has been queued or fetched, indexed by node id. only
+		touched by the thread that queues and fetches */
+	struct CSCAN_FILE **files;
+	unsigned num_files;
+	struct CSCAN_BUFFER buffer;
+
+	struct CSCAN_THREAD threadinfo[CSCAN_MAX_THREADS];
+	void *threads[CSCAN_MAX_THREADS];
+	int num_threads;
+};
+
+/* lines ends at a newline, a zero or the end of the buffer */
+#define is_lineend(p) ((p) == bufferend || *(p) == 0 || *(p) == '\n' || *(p) == '\r')
+
+int cscan_processline(const char *line, const char *bufferend, const char **start, const char **end, int *systemheader)
+{
+	const char *include_text = "include";
+	const char *current = line;
+	*start = 0;
+	*end = 0;
+	*systemheader = 0;
+	
+	/* search for # */
+	while(1)
+	{
+		if(is_lineend(current))
+			return 0;
+		else if(*current == ' ' || *current == '\t')
+			current++; /* next char */
+		else if(*current == '#')
+			break;
+		else
+			return 0;
+	}
+
+	current++; /* skip # */
+
+	/* search for first character */
+	while(1)
+	{
+		if(is_lineend(current))
+			return 0;
+		else if(*current == ' ' || *current == '\t')
+			current++;
+		else
+			break;
+	}
+
+	/* match "include" */
+	while(*include_text)
+	{
+		if(!is_lineend(current) && *current == *include_text)
+		{
+			current++;
+			include_text++;
+		}
+		else
+			return 0;
+	}
+
+	/* search for first character */
+	while(1)
+	{
+		if(is_lineend(current))
+			return 0;
+		else if(*current == ' ' || *current == '\t')
+			current++;
+		else
+			break;
+	}
+
+	/* match starting < or " */
+	*start = current+1;
+	if(*current == '<')
+		*systemheader = 1;
+	else if(*current == '"')
+		*systemheader = 0;
+	else
+		return 0;
+
+	/* skip < or " */
+	current++;
+
+	/* search for < or " to end it */
+	while(1)
+	{
+		if(is_lineend(current))
+			return 0;
+		else if(*current == '>' || *current == '"')
+			break;
+		else
+			current++;
+	}
+
+	*end = current;
+	return 1;
+}
+
+/* finds the includes in the file contents without modifying them */
+static void find_includes(struct CSCAN_FILE *file, const char *buffer, const char *bufferend)
+{
+	const char *current = buffer;
+	const char *linestart;
+	const char *includestart;
+	const char *includeend;
+	int systemheader;
+	unsigned capacity = 0;
+	unsigned names_size = 0;
+	unsigned names_capacity = 0;
+	unsigned i;
+
+	/* an include has to start with a #, so jump between them instead of
+		looking at every line. memchr is vectorized by the c library */
+	while(current < bufferend)
+	{
+		current = (const char *)memchr(current, '#', bufferend - current);
+		if(!current)
+			break;
+
+		/* only whitespace is allowed before it on the line */
+		linestart = current;
+		while(linestart != buffer && (linestart[-1] == ' ' || linestart[-1] == '\t'))
+			linestart--;
+		if(linestart != buffer && linestart[-1] != '\n' && linestart[-1] != '\r')
+		{
+			current++;
+			continue;
+		}
+
+		/* process the line */
+		if(!cscan_processline(current, bufferend, &includestart, &includeend, &systemheader))
+			current++;
+		else
+		{
+			struct CSCAN_INCLUDE *include;
+			unsigned len = includeend - includestart;
+
+			if(file->num_includes == capacity)
+			{
+				capacity = capacity ? capacity*2 : 16;
+				file->includes = (struct CSCAN_INCLUDE *)realloc(file->includes, capacity*sizeof(struct CSCAN_INCLUDE));
+			}
+
+			if(names_size + len + 1 > names_capacity)
+			{
+				names_capacity = names_capacity ? names_capacity*2 : 1024;
+				while(names_size + len + 1 > names_capacity)
+					names_capacity *= 2;
+				file->names = (char *)realloc(file->names, names_capacity);
+			}
+
+			/* the names can move when they grow so the offset is stored for now */
+			include = &file->includes[file->num_includes++];
+			include->filename = (const char *)((ptrdiff_t)names_size);
+			include->filename_len = len + 1;
+			include->sys = systemheader;
+
+			memcpy(file->names + names_size, includestart, len);
+			file->names[names_size + len] = 0;
+			names_size += len + 1;
+			current = includeend + 1;
+		}
+	}
+
+	/* patch the filename pointers */
+	for(i = 0; i < file->num_includes; i++)
+		file->includes[i].filename = file->names + (ptrdiff_t)file->includes[i].filename;
+}
+
+/* makes sure that the buffer can hold size bytes */
+static int buffer_reserve(struct CSCAN_BUFFER *buffer, size_t size)
+{
+	char *data;
+	if(buffer->size >= size)
+		return 0;
+	data = (char *)realloc(buffer->data, size);
+	if(!data)
+		return -1;
+	buffer->data = data;
+	buffer->size = size;
+	return 0;
+}
+
+/* reads the file and finds the includes, doesn't touch anything but the
+	file and the buffer */
+static void scan_file(struct CSCAN_FILE *file, struct CSCAN_BUFFER *buffer)
+{
+	const char *filename = file->node->filename;
+	const char *data;
+	long filesize;
+	long readitems;
+#ifdef CSCAN_USE_MMAP
+	struct stat s;
+	void *mapping = MAP_FAILED;
+	int fd;
+
+	fd = open(filename, O_RDONLY);
+	if(fd == -1)
+	{
+		file->error = CSCAN_MISSING;
+		return;
+	}
+
+	if(fstat(fd, &s) != 0)
+	{
+		printf("cpp-dep: %s: error reading file size\n", filename);
+		close(fd);
+		file->error = CSCAN_ERROR;
+		return;
+	}
+	filesize = s.st_size;
+
+	/* large files are mapped */
+	if(filesize >= CSCAN_MMAP_SIZE)
+		mapping = mmap(NULL, filesize, PROT_READ, MAP_PRIVATE, fd, 0);
+
+	if(mapping != MAP_FAILED)
+		data = (const char *)mapping;
+	else
+	{
+		/* small files, or if the mapping failed, are read into the buffer */
+		if(buffer_reserve(buffer, filesize))
+		{
+			printf("cpp-dep: %s: error allocating %ld bytes\n", filename, filesize);
+			close(fd);
+			file->error = CSCAN_ERROR;
+			return;
+		}
+
+		readitems = 0;
+		while(readitems < filesize)
+		{
+			ssize_t result = read(fd, buffer->data + readitems, filesize - readitems);
+			if(result <= 0)
+				break;
+			readitems += result;
+		}
+
+		if(readitems != filesize)
+		{
+			printf("cpp-dep: %s: error reading. %ld of %ld bytes read\n", filename, readitems, filesize);
+			close(fd);
+			file->error = CSCAN_ERROR;
+			return;
+		}
+		data = buffer->data;
+	}
+	close(fd);
+
+	find_includes(file, data, data + filesize);
+
+	if(mapping != MAP_FAILED)
+		munmap(mapping, filesize);
+#else
+	FILE *fp;
+
+	fp = fopen(filename, "rb");
+	if(!fp)
+	{
+		file->error = CSCAN_MISSING;
+		return;
+	}
+
+	/* read the whole file */
+	fseek(fp, 0, SEEK_END);
+	filesize = ftell(fp);
+	fseek(fp, 0, SEEK_SET);
+
+	if(buffer_reserve(buffer, filesize))
+	{
+		printf("cpp-dep: %s: error allocating %ld bytes\n", filename, filesize);
+		fclose(fp);
+		file->error = CSCAN_ERROR;
+		return;
+	}
+
+	/* read the file and close it */
+	readitems = fread(buffer->data, 1, filesize, fp);
+	fclose(fp);
+
+	if(readitems != filesize)
+	{
+		printf("cpp-dep: %s: error reading. %ld of %ld bytes read\n", filename, readitems, filesize);
+		file->error = CSCAN_ERROR;
+		return;
+	}
+
+	data = buffer->data;
+	find_includes(file, data, data + filesize);
+#endif
+
+	file->error = CSCAN_OK;
+}
+
+static void cscan_thread(void *u)
+{
+	struct CSCAN_THREAD *info = (struct CSCAN_THREAD *)u;
+	struct CSCAN *cscan = info->cscan;
+	struct CSCAN_FILE *file;
+
+	lock_enter(cscan->lock);
+	while(1)
+	{
+		while(!cscan->first && !cscan->quit)
+			lock_wait(cscan->lock);
+		if(cscan->quit)
+			break;
+
+		file = cscan->first;
+		cscan->first = file->next;
+		if(!cscan->first)
+			cscan->last = NULL;
+
+		/* the fetching thread might have taken it already */
+		if(file->state != CSCANSTATE_QUEUED)
+			continue;
+
+		file->state = CSCANSTATE_SCANNING;
+		lock_leave(cscan->lock);
+
+		event_begin(info->id, "scan", file->node->filename);
+		scan_file(file, &info->buffer);
+		event_end(info->id, "scan", NULL);
+
+		lock_enter(cscan->lock);
+		file->state = CSCANSTATE_DONE;
+		lock_broadcast(cscan->lock);
+	}
+	lock_leave(cscan->lock);
+}
+
+struct CSCAN *cscan_create(int threads)
+{
+	struct CSCAN *cscan = (struct CSCAN *)calloc(1, sizeof(struct CSCAN));
+	int i;
+
+	if(threads > CSCAN_MAX_THREADS)
+		threads = CSCAN_MAX_THREADS;
+
+	/* a single worker doesn't buy us anything, the fetching thread does the work then */
+	if(threads > 1)
+	{
+		cscan->lock = lock_create();
+		cscan->num_threads = threads;
+		for(i = 0; i < threads; i++)
+		{
+			cscan->threadinfo[i].cscan = cscan;
+			cscan->threadinfo[i].id = i+1;
+			cscan->threads[i] = threads_create(cscan_thread, &cscan->threadinfo[i]);
+		}
+	}
+
+	return cscan;
+}
+
+static void file_free(struct CSCAN_FILE *file)
+{
+	free(file->names);
+	free(file->includes);
+	file->names = NULL;
+	file->includes = NULL;
+	file->num_includes = 0;
+}
+
+void cscan_destroy(struct CSCAN *cscan)
+{
+	unsigned i;
+	int t;
+
+	if(!cscan)
+		return;
+
+	if(cscan->num_threads)
+	{
+		lock_enter(cscan->lock);
+		cscan->quit = 1;
+		lock_broadcast(cscan->lock);
+		lock_leave(cscan->lock);
+
+		for(t = 0; t < cscan->num_threads; t++)
+		{
+			threads_join(cscan->threads[t]);
+			free(cscan->threadinfo[t].buffer.data);
+		}
+		lock_destroy(cscan->lock);
+	}
+
+	for(i = 0; i < cscan->num_files; i++)
+	{
+		if(cscan->files[i])
+		{
+			file_free(cscan->files[i]);
+			free(cscan->files[i]);
+		}
+	}
+
+	free(cscan->files);
+	free(cscan->buffer.data);
+	free(cscan);
+}
+
+/* returns the file for the node, creates it if needed */
+static struct CSCAN_FILE *cscan_file(struct CSCAN *cscan, struct NODE *node)
+{
+	struct CSCAN_FILE *file;
+
+	if(node->id >= cscan->num_files)
+	{
+		unsigned num = cscan->num_files ? cscan->num_files*2 : 1024;
+		while(num <= node->id)
+			num *= 2;
+		cscan->files = (struct CSCAN_FILE **)realloc(cscan->files, num*sizeof(struct CSCAN_FILE *));
+		memset(cscan->files+cscan->num_files, 0, (num-cscan->num_files)*sizeof(struct CSCAN_FILE *));
+		cscan->num_files = num;
+	}
+
+	file = cscan->files[node->id];
+	if(!file)
+	{
+		file = (struct CSCAN_FILE *)calloc(1, sizeof(struct CSCAN_FILE));
+		file->node = node;
+		cscan->files[node->id] = file;
+	}
+
+	return file;
+}
+
+/* the workers reads the state of the files in the queue, so it's only
+	changed under the lock when there are workers */
+static void file_setstate(struct CSCAN *cscan, struct CSCAN_FILE *file, int state)
+{
+	if(!cscan->num_threads)
+	{
+		file->state = state;
+		return;
+	}
+
+	lock_enter(cscan->lock);
+	file->state = state;
+	lock_leave(cscan->lock);
+}
+
+void cscan_queue(struct CSCAN *cscan, struct NODE *node)
+{
+	struct CSCAN_FILE *file;
+
+	if(!cscan->num_threads)
+		return;
+
+	file = cscan_file(cscan, node);
+
+	lock_enter(cscan->lock);
+	if(file->state != CSCANSTATE_NEW)
+	{
+		lock_leave(cscan->lock);
+		return;
+	}
+
+	file->state = CSCANSTATE_QUEUED;
+	file->next = NULL;
+	if(cscan->last)
+		cscan->last->next = file;
+	else
+		cscan->first = file;
+	cscan->last = file;
+	lock_signal(cscan->lock);
+	lock_leave(cscan->lock);
+}
+
+struct CSCAN_FILE *cscan_fetch(struct CSCAN *cscan, struct NODE *node)
+{
+	struct CSCAN_FILE *file = cscan_file(cscan, node);
+	int scan = 0;
+
+	if(cscan->num_threads)
+	{
+		lock_enter(cscan->lock);
+		if(file->state != CSCANSTATE_SCANNING && file->state != CSCANSTATE_DONE)
+		{
+			/* no worker has started on it, do it ourself */
+			file->state = CSCANSTATE_SCANNING;
+			scan = 1;
+		}
+		else
+		{
+			while(file->state != CSCANSTATE_DONE)
+				lock_wait(cscan->lock);
+		}
+		lock_leave(cscan->lock);
+	}
+	else
+		scan = 1;
+
+	if(scan)
+	{
+		scan_file(file, &cscan->buffer);
+		file_setstate(cscan, file, CSCANSTATE_DONE);
+	}
+
+	return file;
+}
+
+void cscan_release(struct CSCAN *cscan, struct CSCAN_FILE *file)
+{
+	/* fetching it again will scan it again */
+	file_free(file);
+	file_setstate(cscan, file, CSCANSTATE_RELEASED);
+}
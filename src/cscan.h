@@ -0,0 +1,62 @@
+#ifndef FILE_CSCAN_H
+#define FILE_CSCAN_H
+
+struct NODE;
+struct CSCAN;
+
+/*
+	C/C++ header scanning
+	Reads source files and finds the #include lines in them. Large files
+	are mapped into memory, small ones are read into a buffer that each
+	thread reuses. Files can be queued so they are read and tokenized on
+	worker threads before the dependency checker gets to them. Everything
+	that touches the graph is done by the caller, the workers only look
+	at the filename of the node.
+*/
+
+/* an include found in a file */
+struct CSCAN_INCLUDE
+{
+	const char *filename; /* zero terminated, points into the names of the file */
+	int filename_len; /* length including the zero termination */
+	int sys; /* set for <system.header> */
+};
+
+/* scan result for a file */
+struct CSCAN_FILE
+{
+	struct CSCAN_FILE *next; /* next in the queue */
+	struct NODE *node;
+
+	char *names; /* storage for the include filenames */
+	struct CSCAN_INCLUDE *includes;
+	unsigned num_includes;
+	int error; /* CSCAN_* */
+
+	volatile int state; /* protected by the pool lock */
+};
+
+/* scan results */
+#define CSCAN_OK		0
+#define CSCAN_MISSING	1	/* the file couldn't be opened */
+#define CSCAN_ERROR		2	/* the file couldn't be read, an error has been printed */
+
+/* creates a pool with the number of worker threads, 0 scans everything on
+	the calling thread */
+struct CSCAN *cscan_create(int threads);
+void cscan_destroy(struct CSCAN *cscan);
+
+/* hints that the file of the node will be fetched later on */
+void cscan_queue(struct CSCAN *cscan, struct NODE *node);
+
+/* returns the scan result for the node, scans it right away if it hasn't
+	been done already. the result must be released with cscan_release */
+struct CSCAN_FILE *cscan_fetch(struct CSCAN *cscan, struct NODE *node);
+void cscan_release(struct CSCAN *cscan, struct CSCAN_FILE *file);
+
+/* finds an #include on a line, returns 1 if found and sets start and end to
+	the filename. the line ends at a newline, a zero or at bufferend. the
+	line isn't modified */
+int cscan_processline(const char *line, const char *bufferend, const char **start, const char **end, int *systemheader);
+
+#endif
@@ -3,6 +3,10 @@
 int dep_cpp(struct CONTEXT *context, struct DEFERRED *info);
 int dep_cpp2(struct CONTEXT *context, struct DEFERRED *info);
 
+/* queues the file of the deferred node for scanning */
+void dep_cpp_queue(struct CONTEXT *context, struct DEFERRED *info);
+void dep_cpp2_queue(struct CONTEXT *context, struct DEFERRED *info);
+
 /* generic file search checker, used for libs */
 struct DEPPLAIN
 {
@@ -6,123 +6,57 @@
 #include "node.h"
 #include "cache.h"
 #include "context.h"
+#include "cscan.h"
+#include "dep.h"
 #include "mem.h"
 #include "support.h"
 #include "session.h"
 
-static int processline(char *line, char **start, char **end, int *systemheader)
-{
-	const char *include_text = "include";
-	char *current = line;
-	*start = 0;
-	*end = 0;
-	*systemheader = 0;
-	
-	/* search for # */
-	while(*current != '#')
-	{
-		if(*current == ' ' || *current == '\t')
-			current++; /* next char */
-		else
-			return 0; /* this catches \0 aswell */
-	}
-	
-	current++; /* skip # */
-	
-	/* search for first character */
-	while(1)
-	{
-		if(*current == ' ' || *current == '\t')
-			current++;
-		else if(*current == 0)
-			return 0;
-		else
-			break;
-	}
-	
-	/* match "include" */
-	while(*include_text)
-	{
-		if(*current == *include_text)
-		{
-			current++;
-			include_text++;
-		}
-		else
-			return 0;
-	}
-	
-	/* search for first character */
-	while(1)
-	{
-		if(*current == ' ' || *current == '\t')
-			current++;
-		else if(*current == 0)
-			return 0;
-		else
-			break;
-	}
-
-	/* match starting < or " */
-	*start = current+1;
-	if(*current == '<')
-		*systemheader = 1;
-	else if(*current == '"')
-		*systemheader = 0;
-	else
-		return 0;
-	
-	/* skip < or " */
-	current++;
-	
-	/* search for < or " to end it */
-	while(1)
-	{
-		if(*current == '>' || *current == '"')
-			break;
-		else if(*current == 0)
-			return 0;
-		else
-			current++;
-	}
-	
-	*end = current; 
-	return 1;
-}
-
-struct CACHERUNINFO
+struct CPPDEPINFO
 {
 	struct CONTEXT *context;
-	int (*callback)(struct NODE *, void *, const char *, int);
-	void *userdata;
+	struct STRINGLIST *paths;
 };
 
-static int dependency_cpp_run(struct CONTEXT *context, struct NODE *node,
-		int (*callback)(struct NODE *, void *, const char *, int), void *userdata);
+static int dependency_cpp_run(struct CONTEXT *context, struct NODE *node, struct CPPDEPINFO *depinfo);
+
+/* queues the file for scanning unless the dependencies will be taken from the cache */
+static void dependency_cpp_queue(struct CONTEXT *context, struct NODE *node)
+{
+	struct CACHEINFO_DEPS *cacheinfo;
+	if(node->depchecked)
+		return;
+	cacheinfo = depcache_find_byhash(context->depcache, node->hashid);
+	if(cacheinfo && cacheinfo->cached && cacheinfo->timestamp_raw == node->timestamp_raw)
+		return;
+	cscan_queue(context->cscan, node);
+}
 
 static void cachehit_callback(struct NODE *node, struct CACHEINFO_DEPS *cacheinfo, void *user)
 {
-	struct CACHERUNINFO *info = (struct CACHERUNINFO *)user;
+	struct CPPDEPINFO *depinfo = (struct CPPDEPINFO *)user;
+	struct CONTEXT *context = depinfo->context;
 	
 	/* check if the file has been removed */
 	struct NODE *existing_node = node_find_byhash(node->graph, cacheinfo->hashid);
 	if(existing_node)
 	{
 		struct NODE *newnode = node_add_dependency (node, existing_node);
-		dependency_cpp_run(info->context, newnode, info->callback, info->userdata);
+		dependency_cpp_run(context, newnode, depinfo);
 	}
 	else
 	{
-		time_t timestamp = file_timestamp(cacheinfo->filename);
+		const char *filename = depcache_node_filename(context->depcache, cacheinfo);
+		time_t timestamp = file_timestamp(filename);
 		if(timestamp)
 		{
 			/* this shouldn't be able to fail */
 			struct NODE *newnode;
-			node_create(&newnode, info->context->graph, cacheinfo->filename, NULL, timestamp);
+			node_create(&newnode, context->graph, filename, NULL, timestamp);
 			node_add_dependency (node, newnode);
 
 			/* recurse the dependency checking */
-			dependency_cpp_run(info->context, newnode, info->callback, info->userdata);
+			dependency_cpp_run(context, newnode, depinfo);
 		}
 		else
 		{
@@ -131,106 +65,6 @@ static void cachehit_callback(struct NODE *node, struct CACHEINFO_DEPS *cacheinf
 	}
 }
 
-/* dependency calculator for c/c++ preprocessor */
-static int dependency_cpp_run(struct CONTEXT *context, struct NODE *node,
-		int (*callback)(struct NODE *, void *, const char *, int), void *userdata)
-{
-	char *linestart;
-	char *includestart;
-	char *includeend;
-	int systemheader;
-	int errorcode = 0;
-	int linecount = 0;
-
-	/* open file */
-	long filesize;
-	long readitems;
-	char *filebuf;
-	char *filebufcur;
-	char *filebufend;
-	FILE *file;
-	struct CACHERUNINFO cacheinfo;
-
-	/* don't run depcheck twice */
-	if(node->depchecked)
-		return 0;
-		
-	/* mark the node for caching */
-	node_cached(node);
-	
-	/* check if we have the dependencies in the cache frist */
-	cacheinfo.context = context;
-	cacheinfo.callback = callback;
-	cacheinfo.userdata = userdata;
-	if(depcache_do_dependency(context, node, cachehit_callback, &cacheinfo))
-		return 0;
-
-	/* mark the node as checked */
-	node->depchecked = 1;
-
-	file = fopen(node->filename, "rb");
-	if(!file)
-		return 0;
-	
-	/* read the whole file */
-	fseek(file, 0, SEEK_END);
-	filesize = ftell(file);
-	fseek(file, 0, SEEK_SET);
-	
-	filebuf = malloc(filesize+1); /* +1 for null termination */
-	
-	if(!filebuf)
-	{
-		printf("cpp-dep: %s: error allocating %ld bytes\n", node->filename, filesize);
-		fclose(file);
-		return 1;
-	}
-		
-	/* read the file and close it */
-	readitems = fread(filebuf, 1, filesize, file);
-	fclose(file);
-
-	if(readitems != filesize)
-	{
-		printf("cpp-dep: %s: error reading. %ld of %ld bytes read\n", node->filename, readitems, filesize);
-		free(filebuf);
-		return 1;
-	}
-	
-	filebufcur = filebuf;
-	filebufend = filebuf+filesize;
-	
-	while(filebufcur < filebufend)
-	{
-		/* search for next line */
-		linestart = filebufcur;
-		while(filebufcur != filebufend && *filebufcur != '\n' && *filebufcur != '\r')
-			filebufcur++;
-		*filebufcur = 0;
-		filebufcur++;
-		linecount++;
-
-		if(processline(linestart, &includestart, &includeend, &systemheader))
-		{
-			*includeend = 0;
-			/* run callback */
-			errorcode = callback(node, userdata, includestart, systemheader);
-			if(errorcode)
-				break;
-		}
-	}
-
-	/* clean up and return*/
-	free(filebuf);
-	return errorcode;
-}
-
-struct CPPDEPINFO
-{
-	struct CONTEXT *context;
-	struct STRINGLIST *paths;
-};
-
 static int node_findfile(struct GRAPH *graph, const char *filename, struct NODE **node, time_t *timestamp)
 {
 	/* first check the graph */
@@ -246,11 +80,9 @@ static int node_findfile(struct GRAPH *graph, const char *filename, struct NODE
 	return 0;
 }
 
-/* */
-static int dependency_cpp_callback(struct NODE *node, void *user, const char *filename, int sys)
+/* finds the file that an include refers to and adds it as a dependency */
+static int dependency_cpp_resolve(struct NODE *node, struct CPPDEPINFO *depinfo, const char *filename, int sys, struct NODE **result)
 {
-	struct CPPDEPINFO *depinfo = (struct CPPDEPINFO *)user;
-	struct CPPDEPINFO recurseinfo;
 	char buf[MAX_PATH_LENGTH];
 	int check_system = sys;
 
@@ -258,6 +90,7 @@ static int dependency_cpp_callback(struct NODE *node, void *user, const char *fi
 	struct NODE *depnode = NULL;
 	time_t timestamp = 0;
 	
+	*result = NULL;
 	
 	if(!sys)
 	{
@@ -319,26 +152,80 @@ static int dependency_cpp_callback(struct NODE *node, void *user, const char *fi
 
 		if(!depnode)
 			return 3;
-	
-		/* do the dependency walk */
-		if(!depnode->depchecked)
-		{
-			recurseinfo.paths = depinfo->paths;
-			recurseinfo.context = depinfo->context;
-			if(dependency_cpp_run(depinfo->context, depnode, dependency_cpp_callback, &recurseinfo) != 0)
-				return 4;
-		}
+
+		*result = depnode;
 	}
 		
 	return 0;
 }
 
+/* dependency calculator for c/c++ preprocessor */
+static int dependency_cpp_run(struct CONTEXT *context, struct NODE *node, struct CPPDEPINFO *depinfo)
+{
+	struct CSCAN_FILE *file;
+	struct NODE **depnodes;
+	int errorcode = 0;
+	unsigned num_depnodes = 0;
+	unsigned i;
+
+	/* don't run depcheck twice */
+	if(node->depchecked)
+		return 0;
+		
+	/* mark the node for caching */
+	node_cached(node);
+	
+	/* check if we have the dependencies in the cache frist */
+	if(depcache_do_dependency(context, node, cachehit_callback, depinfo))
+		return 0;
+
+	/* mark the node as checked */
+	node->depchecked = 1;
+
+	file = cscan_fetch(context->cscan, node);
+	if(file->error != CSCAN_OK)
+	{
+		errorcode = file->error == CSCAN_ERROR;
+		cscan_release(context->cscan, file);
+		return errorcode;
+	}
+
+	/* resolve all the includes first so the headers can be scanned
+		while we walk down the first ones */
+	depnodes = (struct NODE **)malloc((file->num_includes+1) * sizeof(struct NODE *));
+	for(i = 0; i < file->num_includes; i++)
+	{
+		errorcode = dependency_cpp_resolve(node, depinfo, file->includes[i].filename, file->includes[i].sys, &depnodes[num_depnodes]);
+		if(errorcode)
+			break;
+		if(depnodes[num_depnodes])
+			dependency_cpp_queue(context, depnodes[num_depnodes++]);
+	}
+	cscan_release(context->cscan, file);
+
+	/* do the dependency walk */
+	for(i = 0; i < num_depnodes && !errorcode; i++)
+	{
+		if(!depnodes[i]->depchecked && dependency_cpp_run(context, depnodes[i], depinfo) != 0)
+			errorcode = 4;
+	}
+
+	/* clean up and return*/
+	free(depnodes);
+	return errorcode;
+}
+
+void dep_cpp_queue(struct CONTEXT *context, struct DEFERRED *info)
+{
+	dependency_cpp_queue(context, info->node);
+}
+
 int dep_cpp(struct CONTEXT *context, struct DEFERRED *info)
 {
 	struct CPPDEPINFO depinfo;
 	depinfo.context = context;
 	depinfo.paths = (struct STRINGLIST *)info->user;
-	if(dependency_cpp_run(context, info->node, dependency_cpp_callback, &depinfo) != 0)
+	if(dependency_cpp_run(context, info->node, &depinfo) != 0)
 		return -1;
 	return 0;
 }
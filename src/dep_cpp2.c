@@ -7,110 +7,20 @@
 #include "cache.h"
 #include "statcache.h"
 #include "context.h"
+#include "cscan.h"
+#include "dep.h"
 #include "mem.h"
 #include "support.h"
 #include "session.h"
 
-static int processline(char *line, char **start, char **end, int *systemheader)
-{
-	const char *include_text = "include";
-	char *current = line;
-	*start = 0;
-	*end = 0;
-	*systemheader = 0;
-	
-	/* search for # */
-	while(*current != '#')
-	{
-		if(*current == ' ' || *current == '\t')
-			current++; /* next char */
-		else
-			return 0; /* this catches \0 aswell */
-	}
-	
-	current++; /* skip # */
-	
-	/* search for first character */
-	while(1)
-	{
-		if(*current == ' ' || *current == '\t')
-			current++;
-		else if(*current == 0)
-			return 0;
-		else
-			break;
-	}
-	
-	/* match "include" */
-	while(*include_text)
-	{
-		if(*current == *include_text)
-		{
-			current++;
-			include_text++;
-		}
-		else
-			return 0;
-	}
-	
-	/* search for first character */
-	while(1)
-	{
-		if(*current == ' ' || *current == '\t')
-			current++;
-		else if(*current == 0)
-			return 0;
-		else
-			break;
-	}
-
-	/* match starting < or " */
-	*start = current+1;
-	if(*current == '<')
-		*systemheader = 1;
-	else if(*current == '"')
-		*systemheader = 0;
-	else
-		return 0;
-	
-	/* skip < or " */
-	current++;
-	
-	/* search for < or " to end it */
-	while(1)
-	{
-		if(*current == '>' || *current == '"')
-			break;
-		else if(*current == 0)
-			return 0;
-		else
-			current++;
-	}
-	
-	*end = current; 
-	return 1;
-}
-
-
 /*
 	scans a file for headers and adds them to the nodes c header references
 */
 static int scan_source_file(struct CONTEXT * context, struct NODE *node)
 {
-	char *linestart;
-	char *includestart;
-	char *includeend;
-	int systemheader;
-	int linecount = 0;
-
-	/* open file */
-	long filesize;
-	long readitems;
-	char *filebuf;
-	char *filebufcur;
-	char *filebufend;
-	FILE *file;
+	struct CSCAN_FILE *file;
 	struct CHEADERREF * currentref = NULL;
+	unsigned i;
 	
 	if(node->headerscanned)
 		return 0;
@@ -125,92 +35,42 @@ static int scan_source_file(struct CONTEXT * context, struct NODE *node)
 		return 0;
 	}
 
-	file = fopen(node->filename, "rb");
-	if(!file)
-		return 0;
-	
-	/* read the whole file */
-	fseek(file, 0, SEEK_END);
-	filesize = ftell(file);
-	fseek(file, 0, SEEK_SET);
-	
-	filebuf = malloc(filesize+1); /* +1 for null termination */
-	
-	if(!filebuf)
+	file = cscan_fetch(context->cscan, node);
+	if(file->error != CSCAN_OK)
 	{
-		printf("cpp-dep: %s: error allocating %ld bytes\n", node->filename, filesize);
-		fclose(file);
-		return 1;
+		int errorcode = file->error == CSCAN_ERROR;
+		cscan_release(context->cscan, file);
+		return errorcode;
 	}
-		
-	/* read the file and close it */
-	readitems = fread(filebuf, 1, filesize, file);
-	fclose(file);
 
-	if(readitems != filesize)
+	for(i = 0; i < file->num_includes; i++)
 	{
-		printf("cpp-dep: %s: error reading. %ld of %ld bytes read\n", node->filename, readitems, filesize);
-		free(filebuf);
-		return 1;
-	}
-	
-	filebufcur = filebuf;
-	filebufend = filebuf+filesize;
-	
-	while(filebufcur < filebufend)
-	{
-		/* search for next line */
-		linestart = filebufcur;
-		while(filebufcur != filebufend && *filebufcur != '\n' && *filebufcur != '\r')
-			filebufcur++;
-		*filebufcur = 0;
-		filebufcur++;
-		linecount++;
-
-		/* process the line */
-		if(processline(linestart, &includestart, &includeend, &systemheader))
-		{
-			struct CHEADERREF * header = (struct CHEADERREF *)mem_allocate(node->graph->heap, sizeof(struct CHEADERREF));
-			*includeend = 0;
-			header->filename_len = includeend - includestart + 1;
-			header->filename = string_duplicate(node->graph->heap, includestart, includeend - includestart);
-
-			if ( currentref ) {
-				currentref->next = header;
-			} else {
-				node->firstcheaderref = header;
-			}
-			currentref = header;
+		struct CSCAN_INCLUDE *include = &file->includes[i];
+		struct CHEADERREF * header = (struct CHEADERREF *)mem_allocate(node->graph->heap, sizeof(struct CHEADERREF));
+		header->filename_len = include->filename_len;
+		header->filename = string_duplicate(node->graph->heap, include->filename, include->filename_len-1);
+
+		if ( currentref ) {
+			currentref->next = header;
+		} else {
+			node->firstcheaderref = header;
 		}
+		currentref = header;
 	}
 
 	/* clean up and return */
-	free(filebuf);
+	cscan_release(context->cscan, file);
 	node->headerscannedsuccess = 1;
 	return 0;
 }
 
-struct CACHERUNINFO
+/* queues the file for scanning unless the headers will be taken from the cache */
+static void scan_source_file_queue(struct CONTEXT *context, struct NODE *node)
 {
-	struct CONTEXT *context;
-	int (*callback)(struct NODE *, void *, const char *, int);
-	void *userdata;
-};
-
-static int dependency_cpp_run(struct CONTEXT *context, struct NODE *node,
-		int (*callback)(struct NODE *, void *, const char *, int), void *userdata)
-{
-	scan_source_file(context, node);
-	int errorcode = 0;
-
-	struct CHEADERREF * curref = node->firstcheaderref;
-	for(; curref; curref = curref->next)
-	{
-		errorcode = callback(node, userdata, curref->filename, curref->sys);
-		if(errorcode)
-			return errorcode;
-	}
-	return 0;
+	struct CHEADERREF *refs;
+	if(node->headerscanned || scancache_find(context->scancache, node, &refs) == 0)
+		return;
+	cscan_queue(context->cscan, node);
 }
 
 struct CPPDEPINFO
@@ -220,86 +80,133 @@ struct CPPDEPINFO
 	hash_t depcontext;
 };
 
-static int node_findfile(struct GRAPH *graph, struct STATCACHE* statcache, const char *filename, struct NODE **node, time_t *timestamp)
+static int file_exists(struct STATCACHE *statcache, const char *filename, time_t *timestamp)
 {
-	/* first check the graph */
-	*node = node_find(graph, filename);
-	if(*node)
-		return 1;
-
 	int isregular = 0;
-	if(statcache_getstat( statcache, filename, timestamp, &isregular)==0)
+	if(statcache_getstat(statcache, filename, timestamp, &isregular) == 0)
 		return *timestamp != 0 && isregular == 1;
 
-	/* then check the file system */
 	*timestamp = file_timestamp(filename);
-	if(*timestamp && file_isregular(filename))
+	return *timestamp && file_isregular(filename);
+}
+
+/* the places that an include is looked for, in order */
+struct CANDIDATES
+{
+	int index;	/* index of the next candidate */
+	struct STRINGLIST *path;
+};
+
+/* puts the next place to look for the include in buf, returns 0 when
+	there are no more. the index of the candidate is iter->index-1 */
+static int candidate_next(struct NODE *node, struct CPPDEPINFO *depinfo, const char *filename, int sys, struct CANDIDATES *iter, char *buf, int bufsize)
+{
+	int index = iter->index++;
+
+	if(index == 0)
+	{
+		if(!sys)
+		{
+			/* "normal.header" is looked for next to the file first */
+			int flen = strlen(node->filename)-1;
+			while(flen)
+			{
+				if(node->filename[flen] == '/')
+					break;
+				flen--;
+			}
+			path_join(node->filename, flen, filename, -1, buf, bufsize);
+			return 1;
+		}
+		index = iter->index++;
+	}
+
+	/* <system.header> */
+	if(path_isabs(filename))
+	{
+		if(index != 1)
+			return 0;
+		snprintf(buf, bufsize, "%s", filename);
 		return 1;
+	}
 
-	return 0;
+	if(index == 1)
+		iter->path = depinfo->paths;
+	if(!iter->path)
+		return 0;
+	path_join(iter->path->str, iter->path->len, filename, -1, buf, bufsize);
+	iter->path = iter->path->next;
+	return 1;
 }
 
-/* */
-static int dependency_cpp_callback(struct NODE *node, void *user, const char *filename, int sys)
+/* returns the index of the first candidate that exists on disk, -1 if
+	none of them does. the answer is kept in the resolve cache so the
+	candidates don't have to be checked again as long as the directories
+	that they are in doesn't change */
+static int find_on_disk(struct NODE *node, struct CPPDEPINFO *depinfo, const char *filename, int sys)
 {
-	struct CPPDEPINFO *depinfo = (struct CPPDEPINFO *)user;
+	struct CONTEXT *context = depinfo->context;
+	struct CANDIDATES iter = {0, NULL};
 	char buf[MAX_PATH_LENGTH];
-	int check_system = sys;
+	time_t timestamp;
+	hash_t key;
+	int found = -1;
 
-	int found = 0;
-	struct NODE *depnode = NULL;
-	time_t timestamp = 0;
+	/* the candidates depends on the include paths, the include and
+		where the file that includes it is for "normal.header" */
+	key = string_hash_djb2_add(depinfo->depcontext, filename);
+	key = string_hash_djb2_add(key, sys ? "<>" : "\"\"");
+	if(candidate_next(node, depinfo, filename, sys, &iter, buf, sizeof(buf)))
+		key = string_hash_path_add(key, buf);
+
+	if(resolvecache_find(context->resolvecache, context->statcache, key, &found))
+		return found;
 
-	if(!sys)
+	resolvecache_begin(context->resolvecache, key);
+	iter.index = 0;
+	while(candidate_next(node, depinfo, filename, sys, &iter, buf, sizeof(buf)))
 	{
-		/* "normal.header" */
-		int flen = strlen(node->filename)-1;
-		while(flen)
+		resolvecache_add_searched(context->resolvecache, context->statcache, buf);
+		if(file_exists(context->statcache, buf, &timestamp))
 		{
-			if(node->filename[flen] == '/')
-				break;
-			flen--;
-		}
-		path_join(node->filename, flen, filename, -1, buf, sizeof(buf));
-		
-		if(node_findfile(node->graph, depinfo->context->statcache, buf, &depnode, &timestamp))
-			found = 1;
-		else
-		{
-			/* file does not exist */
-			check_system = 1;
+			found = iter.index-1;
+			break;
 		}
 	}
+	resolvecache_end(context->resolvecache, found);
+	return found;
+}
 
-	if(check_system)
+/* finds the file that an include refers to and adds it as a dependency */
+static int dependency_cpp_resolve(struct NODE *node, struct CPPDEPINFO *depinfo, const char *filename, int sys, struct NODE **result)
+{
+	struct CANDIDATES iter = {0, NULL};
+	char buf[MAX_PATH_LENGTH];
+	int on_disk = find_on_disk(node, depinfo, filename, sys);
+	int found = 0;
+	struct NODE *depnode = NULL;
+	time_t timestamp = 0;
+
+	*result = NULL;
+
+	/* nodes in the graph goes before files on disk so the candidates
+		up to the one on disk are checked against the graph */
+	while(candidate_next(node, depinfo, filename, sys, &iter, buf, sizeof(buf)))
 	{
-		/* <system.header> */
-		if(path_isabs(filename))
+		depnode = node_find(node->graph, buf);
+		if(depnode)
 		{
-			if(node_findfile(node->graph, depinfo->context->statcache, filename, &depnode, &timestamp))
-			{
-				strcpy(buf, filename);
-				found = 1;
-			}
+			found = 1;
+			break;
 		}
-		else
-		{
-			struct STRINGLIST *cur;
-			int flen = strlen(filename);
 
-			for(cur = depinfo->paths; cur; cur = cur->next)
-			{
-				path_join(cur->str, cur->len, filename, flen, buf, sizeof(buf));
-				if(node_findfile(node->graph, depinfo->context->statcache, buf, &depnode, &timestamp))
-				{
-					found = 1;
-					break;
-				}
-			}
+		if(iter.index-1 == on_disk)
+		{
+			found = file_exists(depinfo->context->statcache, buf, &timestamp);
+			break;
 		}
 	}
 
-	/* */
 	if(found)
 	{
 		path_normalize(buf);
@@ -310,19 +217,59 @@ static int dependency_cpp_callback(struct NODE *node, void *user, const char *fi
 
 		if(!depnode)
 			return 3;
-	
-		/* do the dependency walk */
-		if(depnode->depcontext != depinfo->depcontext)
-		{
-			depnode->depcontext = depinfo->depcontext;
-			if(dependency_cpp_run(depinfo->context, depnode, dependency_cpp_callback, depinfo) != 0)
-				return 4;
-		}
+
+		*result = depnode;
 	}
 		
 	return 0;
 }
 
+static int dependency_cpp_run(struct CONTEXT *context, struct NODE *node, struct CPPDEPINFO *depinfo)
+{
+	struct CHEADERREF *curref;
+	struct NODE **depnodes;
+	unsigned num_refs = 0;
+	unsigned num_depnodes = 0;
+	unsigned i;
+	int errorcode = 0;
+
+	scan_source_file(context, node);
+
+	for(curref = node->firstcheaderref; curref; curref = curref->next)
+		num_refs++;
+
+	/* resolve all the includes first so the headers can be scanned
+		while we walk down the first ones */
+	depnodes = (struct NODE **)malloc((num_refs+1) * sizeof(struct NODE *));
+	for(curref = node->firstcheaderref; curref; curref = curref->next)
+	{
+		errorcode = dependency_cpp_resolve(node, depinfo, curref->filename, curref->sys, &depnodes[num_depnodes]);
+		if(errorcode)
+			break;
+		if(depnodes[num_depnodes])
+			scan_source_file_queue(context, depnodes[num_depnodes++]);
+	}
+
+	/* do the dependency walk */
+	for(i = 0; i < num_depnodes && !errorcode; i++)
+	{
+		if(depnodes[i]->depcontext != depinfo->depcontext)
+		{
+			depnodes[i]->depcontext = depinfo->depcontext;
+			if(dependency_cpp_run(context, depnodes[i], depinfo) != 0)
+				errorcode = 4;
+		}
+	}
+
+	free(depnodes);
+	return errorcode;
+}
+
+void dep_cpp2_queue(struct CONTEXT *context, struct DEFERRED *info)
+{
+	scan_source_file_queue(context, info->node);
+}
+
 int dep_cpp2(struct CONTEXT *context, struct DEFERRED *info)
 {
 	struct CPPDEPINFO depinfo;
@@ -333,7 +280,7 @@ int dep_cpp2(struct CONTEXT *context, struct DEFERRED *info)
 	if(info->node->depcontext == info->depcontext)
 		return 0;
 
-	if(dependency_cpp_run(context, info->node, dependency_cpp_callback, &depinfo) != 0)
+	if(dependency_cpp_run(context, info->node, &depinfo) != 0)
 		return -1;
 	return 0;
 }
@@ -1,4 +1,5 @@
 #include "path.h"
+#include "cache.h"
 #include "context.h"
 #include "mem.h"
 #include "node.h"
@@ -20,7 +21,10 @@ static int checkpath(struct CONTEXT *context, struct NODE *node, const char *pat
 		return 1;
 	}
 	
-	/* check if it exists on the disk */
+	/* check if it exists on the disk, the listing of the directory can
+		tell that it doesn't without a stat */
+	if(dircache_missing(context->dircache, context->statcache, path))
+		return 0;
 	stamp = file_timestamp(path);
 	if(stamp)
 	{
@@ -0,0 +1,270 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "digest.h"
+#include "node.h"
+#include "support.h"
+
+#define DIGEST_MAX_THREADS 32
+#define DIGEST_BUFFERSIZE (64*1024)
+
+#define PRIME1 0x9E3779B185EBCA87ULL
+#define PRIME2 0xC2B2AE3D27D4EB4FULL
+#define PRIME3 0x165667B19E3779F9ULL
+#define PRIME4 0x85EBCA77C2B2AE63ULL
+#define PRIME5 0x27D4EB2F165667C5ULL
+
+#define rotl(x, r) (((x) << (r)) | ((x) >> (64 - (r))))
+
+struct DIGEST_STATE
+{
+	hash_t v[4];
+	hash_t total;
+	unsigned char mem[32]; /* bytes that doesn't fill up a stripe yet */
+	unsigned memsize;
+};
+
+/* reads are little endian on every platform that bam runs on, the cache
+	header has a byte order mark so digests are never mixed */
+static hash_t read64(const unsigned char *p)
+{
+	hash_t v;
+	memcpy(&v, p, sizeof(v));
+	return v;
+}
+
+static hash_t read32(const unsigned char *p)
+{
+	unsigned int v;
+	memcpy(&v, p, sizeof(v));
+	return v;
+}
+
+static hash_t digest_round(hash_t acc, hash_t input)
+{
+	acc += input * PRIME2;
+	acc = rotl(acc, 31);
+	return acc * PRIME1;
+}
+
+static hash_t digest_merge(hash_t acc, hash_t v)
+{
+	acc ^= digest_round(0, v);
+	return acc * PRIME1 + PRIME4;
+}
+
+static void digest_init(struct DIGEST_STATE *state)
+{
+	memset(state, 0, sizeof(struct DIGEST_STATE));
+	state->v[0] = PRIME1 + PRIME2;
+	state->v[1] = PRIME2;
+	state->v[2] = 0;
+	state->v[3] = 0 - PRIME1;
+}
+
+static const unsigned char *digest_stripes(struct DIGEST_STATE *state, const unsigned char *p, const unsigned char *end)
+{
+	hash_t v0 = state->v[0], v1 = state->v[1], v2 = state->v[2], v3 = state->v[3];
+	for(; p+32 <= end; p += 32)
+	{
+		v0 = digest_round(v0, read64(p));
+		v1 = digest_round(v1, read64(p+8));
+		v2 = digest_round(v2, read64(p+16));
+		v3 = digest_round(v3, read64(p+24));
+	}
+	state->v[0] = v0; state->v[1] = v1; state->v[2] = v2; state->v[3] = v3;
+	return p;
+}
+
+static void digest_update(struct DIGEST_STATE *state, const void *data, size_t size)
+{
+	const unsigned char *p = (const unsigned char *)data;
+	const unsigned char *end = p + size;
+
+	state->total += size;
+
+	/* fill up the stripe that was started */
+	if(state->memsize)
+	{
+		size_t fill = 32 - state->memsize;
+		if(size < fill)
+		{
+			memcpy(state->mem + state->memsize, p, size);
+			state->memsize += size;
+			return;
+		}
+		memcpy(state->mem + state->memsize, p, fill);
+		digest_stripes(state, state->mem, state->mem+32);
+		state->memsize = 0;
+		p += fill;
+	}
+
+	p = digest_stripes(state, p, end);
+	memcpy(state->mem, p, end-p);
+	state->memsize = end-p;
+}
+
+static hash_t digest_final(struct DIGEST_STATE *state)
+{
+	const unsigned char *p = state->mem;
+	const unsigned char *end = state->mem + state->memsize;
+	hash_t h;
+
+	if(state->total >= 32)
+	{
+		h = rotl(state->v[0], 1) + rotl(state->v[1], 7) + rotl(state->v[2], 12) + rotl(state->v[3], 18);
+		h = digest_merge(h, state->v[0]);
+		h = digest_merge(h, state->v[1]);
+		h = digest_merge(h, state->v[2]);
+		h = digest_merge(h, state->v[3]);
+	}
+	else
+		h = PRIME5;
+
+	h += state->total;
+
+	for(; p+8 <= end; p += 8)
+	{
+		h ^= digest_round(0, read64(p));
+		h = rotl(h, 27) * PRIME1 + PRIME4;
+	}
+
+	if(p+4 <= end)
+	{
+		h ^= read32(p) * PRIME1;
+		h = rotl(h, 23) * PRIME2 + PRIME3;
+		p += 4;
+	}
+
+	for(; p < end; p++)
+	{
+		h ^= (*p) * PRIME5;
+		h = rotl(h, 11) * PRIME1;
+	}
+
+	h ^= h >> 33;
+	h *= PRIME2;
+	h ^= h >> 29;
+	h *= PRIME3;
+	h ^= h >> 32;
+
+	/* 0 is for unknown */
+	return h ? h : 1;
+}
+
+hash_t digest_buffer(const void *data, size_t size)
+{
+	struct DIGEST_STATE state;
+	digest_init(&state);
+	digest_update(&state, data, size);
+	return digest_final(&state);
+}
+
+hash_t digest_file(const char *filename, char *buffer, size_t buffersize)
+{
+	struct DIGEST_STATE state;
+	size_t bytes;
+	FILE *fp;
+
+	fp = fopen(filename, "rb");
+	if(!fp)
+		return 0;
+
+	digest_init(&state);
+	while((bytes = fread(buffer, 1, buffersize, fp)) > 0)
+		digest_update(&state, buffer, bytes);
+
+	if(ferror(fp))
+	{
+		fclose(fp);
+		return 0;
+	}
+
+	fclose(fp);
+	return digest_final(&state);
+}
+
+hash_t digest_combine(hash_t a, hash_t b)
+{
+	hash_t h = a ^ rotl(b, 29) ^ PRIME3;
+	h ^= h >> 33;
+	h *= PRIME2;
+	h ^= h >> 29;
+	h *= PRIME3;
+	h ^= h >> 32;
+	return h;
+}
+
+struct DIGEST_THREAD
+{
+	struct NODE **nodes;
+	unsigned num;
+	unsigned first;
+	unsigned step;
+	time_t starttime;
+	int id;
+};
+
+static void digest_node_buffer(struct NODE *node, char *buffer, time_t starttime)
+{
+	node->digest = digest_file(node->filename, buffer, DIGEST_BUFFERSIZE);
+
+	/* the file can change again during the same second without
+		getting a new timestamp, the digest is only good for this run */
+	node->digestuntrusted = node->timestamp_raw >= starttime;
+}
+
+void digest_node(struct NODE *node)
+{
+	char *buffer = (char *)malloc(DIGEST_BUFFERSIZE);
+	digest_node_buffer(node, buffer, time(NULL));
+	free(buffer);
+}
+
+static void digest_thread(void *u)
+{
+	struct DIGEST_THREAD *info = (struct DIGEST_THREAD *)u;
+	char *buffer = (char *)malloc(DIGEST_BUFFERSIZE);
+	unsigned i;
+
+	event_begin(info->id, "digest", NULL);
+	for(i = info->first; i < info->num; i += info->step)
+		digest_node_buffer(info->nodes[i], buffer, info->starttime);
+	event_end(info->id, "digest", NULL);
+
+	free(buffer);
+}
+
+void digest_nodes(struct NODE **nodes, unsigned num, int threads)
+{
+	struct DIGEST_THREAD threadinfo[DIGEST_MAX_THREADS];
+	void *handles[DIGEST_MAX_THREADS];
+	time_t starttime = time(NULL);
+	int i;
+
+	if(threads > DIGEST_MAX_THREADS)
+		threads = DIGEST_MAX_THREADS;
+	if((unsigned)threads > num)
+		threads = num;
+	if(threads < 1)
+		threads = 1;
+
+	for(i = 0; i < threads; i++)
+	{
+		threadinfo[i].nodes = nodes;
+		threadinfo[i].num = num;
+		threadinfo[i].first = i;
+		threadinfo[i].step = threads;
+		threadinfo[i].starttime = starttime;
+		threadinfo[i].id = i+1;
+	}
+
+	/* the calling thread takes the first share */
+	for(i = 1; i < threads; i++)
+		handles[i] = threads_create(digest_thread, &threadinfo[i]);
+	threadinfo[0].id = 0;
+	digest_thread(&threadinfo[0]);
+	for(i = 1; i < threads; i++)
+		threads_join(handles[i]);
+}
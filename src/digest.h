@@ -0,0 +1,31 @@
+#ifndef FILE_DIGEST_H
+#define FILE_DIGEST_H
+
+#include "support.h"
+
+struct NODE;
+
+/*
+	Content digests
+	64 bit digests of file contents, used to tell if a file has changed
+	when its timestamp has. The digest is XXH64 with a zero seed. A digest
+	is never 0 so 0 can be used for unknown.
+*/
+
+hash_t digest_buffer(const void *data, size_t size);
+
+/* returns 0 if the file couldn't be read, buffer is used for reading */
+hash_t digest_file(const char *filename, char *buffer, size_t buffersize);
+
+/* mixes two digests together, the result is added up to make a digest of
+	a set of files so the order doesn't matter */
+hash_t digest_combine(hash_t a, hash_t b);
+
+/* sets the digest of the file of the node */
+void digest_node(struct NODE *node);
+
+/* sets the digest of the files of the nodes, the work is split over a
+	number of threads */
+void digest_nodes(struct NODE **nodes, unsigned num, int threads);
+
+#endif
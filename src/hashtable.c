@@ -0,0 +1,87 @@
+#include <stdlib.h> /* malloc */
+#include <string.h> /* memset */
+#include <assert.h>
+
+#include "hashtable.h"
+
+unsigned hashtable_size(unsigned num)
+{
+	unsigned long long wanted = (unsigned long long)num*2;
+	unsigned size = 16;
+	while(size < wanted && size < 0x80000000u)
+		size *= 2;
+	return size;
+}
+
+void hashtable_create(struct HASHTABLE *table, unsigned num)
+{
+	unsigned size = hashtable_size(num);
+	table->keys = (hash_t *)malloc(size * (sizeof(hash_t) + sizeof(unsigned)));
+	table->values = (unsigned *)(table->keys + size);
+	table->mask = size - 1;
+	table->zero = 0;
+	table->count = 0;
+	table->allocated = 1;
+	memset(table->keys, 0, size * sizeof(hash_t));
+}
+
+void hashtable_init(struct HASHTABLE *table, hash_t *keys, unsigned *values, unsigned size, unsigned zero)
+{
+	table->keys = keys;
+	table->values = values;
+	table->mask = size - 1;
+	table->zero = zero;
+	table->count = 0;
+	table->allocated = 0;
+}
+
+void hashtable_destroy(struct HASHTABLE *table)
+{
+	if(table->allocated)
+		free(table->keys);
+	table->keys = NULL;
+	table->values = NULL;
+}
+
+void hashtable_insert(struct HASHTABLE *table, hash_t key, unsigned value)
+{
+	unsigned slot;
+
+	if(key == 0)
+	{
+		table->zero = value + 1;
+		return;
+	}
+
+	slot = (unsigned)key & table->mask;
+	while(table->keys[slot] && table->keys[slot] != key)
+		slot = (slot + 1) & table->mask;
+
+	if(!table->keys[slot])
+	{
+		/* the probing only ends if there are empty slots left */
+		assert(table->count < (table->mask + 1) / 2);
+		table->count++;
+	}
+
+	table->keys[slot] = key;
+	table->values[slot] = value;
+}
+
+unsigned hashtable_find(const struct HASHTABLE *table, hash_t key)
+{
+	unsigned slot;
+
+	if(key == 0)
+		return table->zero ? table->zero - 1 : HASHTABLE_NOTFOUND;
+
+	slot = (unsigned)key & table->mask;
+	while(table->keys[slot])
+	{
+		if(table->keys[slot] == key)
+			return table->values[slot];
+		slot = (slot + 1) & table->mask;
+	}
+
+	return HASHTABLE_NOTFOUND;
+}
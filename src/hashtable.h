@@ -0,0 +1,50 @@
+#ifndef FILE_HASHTABLE_H
+#define FILE_HASHTABLE_H
+
+#include "support.h"
+
+/*
+	Open addressing hash table from a hash_t to an unsigned, used by the
+	caches to look up entries by hash id.
+
+	The keys and the values are kept in separate arrays so a lookup only
+	walks the key array, which is probed linearly. The table is kept at
+	most half full. The key 0 marks an empty slot so it's stored on the
+	side in the zero member.
+
+	The arrays are plain data without any pointers so a table can be
+	written to a file and used directly from memory when loaded again,
+	see hashtable_init().
+*/
+struct HASHTABLE
+{
+	hash_t *keys; /* 0 == empty slot */
+	unsigned *values;
+	unsigned mask; /* number of slots - 1, the number of slots is a power of two */
+	unsigned zero; /* value+1 for the key 0, 0 if it isn't in the table */
+	unsigned count; /* number of keys in the slots, the key 0 isn't counted */
+	int allocated; /* set if the arrays are owned by the table */
+};
+
+#define HASHTABLE_NOTFOUND (~0u)
+
+/* returns the number of slots to use for num entries, at most 2^31 */
+unsigned hashtable_size(unsigned num);
+
+/* allocates an empty table with room for num entries */
+void hashtable_create(struct HASHTABLE *table, unsigned num);
+
+/* sets up a table that uses arrays from somewhere else, for example a
+	mapped cache file. size must be a power of two. the count starts at 0
+	so only empty arrays should be inserted into */
+void hashtable_init(struct HASHTABLE *table, hash_t *keys, unsigned *values, unsigned size, unsigned zero);
+void hashtable_destroy(struct HASHTABLE *table);
+
+/* inserts or replaces the value for a key. the table must not get more
+	than half full, the caller has to make it larger before that */
+void hashtable_insert(struct HASHTABLE *table, hash_t key, unsigned value);
+
+/* returns the value for the key or HASHTABLE_NOTFOUND */
+unsigned hashtable_find(const struct HASHTABLE *table, hash_t key);
+
+#endif
@@ -0,0 +1,2795 @@
+typedef struct
+{
+	const char *filename;
+	const char *content;
+} INTERNALFILE;
+
+const char internal_file_1[] = {0x2d, 0x2d, 0x20, 0x6a, 0x75, 0x73, 0x74, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x61, 0x6c, 0x6c, 0x20, 
+	0x61, 0x20, 0x62, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x66, 0x6f, 
+	0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 
+	0x61, 0x6e, 0x64, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x73, 0xa, 0x53, 0x63, 0x72, 0x69, 0x70, 
+	0x74, 0x41, 0x72, 0x67, 0x73, 0x20, 0x3d, 0x20, 0x5f, 0x62, 0x61, 0x6d, 0x5f, 0x73, 0x63, 0x72, 
+	0x69, 0x70, 0x74, 0x61, 0x72, 0x67, 0x73, 0xa, 0x49, 0x73, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 
+	0x20, 0x3d, 0x20, 0x62, 0x61, 0x6d, 0x5f, 0x69, 0x73, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0xa, 
+	0x49, 0x73, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x3d, 0x20, 0x62, 0x61, 0x6d, 0x5f, 0x69, 0x73, 
+	0x74, 0x61, 0x62, 0x6c, 0x65, 0xa, 0x49, 0x73, 0x4f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x20, 0x3d, 
+	0x20, 0x62, 0x61, 0x6d, 0x5f, 0x69, 0x73, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0xa, 0x53, 0x6c, 
+	0x65, 0x65, 0x70, 0x20, 0x3d, 0x20, 0x62, 0x61, 0x6d, 0x5f, 0x73, 0x6c, 0x65, 0x65, 0x70, 0xa, 
+	0xa, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x55, 0x4e, 0x49, 0x54, 0x54, 0x45, 0x53, 0x54, 0x53, 0xa, 
+	0x9, 0x65, 0x72, 0x72, 0x3d, 0x30, 0x20, 0x3a, 0x20, 0x69, 0x66, 0x20, 0x62, 0x61, 0x6d, 0x5f, 
+	0x69, 0x73, 0x64, 0x69, 0x72, 0x28, 0x22, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x5f, 0x66, 0x69, 0x6c, 
+	0x65, 0x22, 0x29, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x28, 0x22, 
+	0x22, 0x29, 0x20, 0x65, 0x6e, 0x64, 0xa, 0x9, 0x65, 0x72, 0x72, 0x3d, 0x30, 0x20, 0x3a, 0x20, 
+	0x69, 0x66, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x62, 0x61, 0x6d, 0x5f, 0x69, 0x73, 0x64, 0x69, 0x72, 
+	0x28, 0x22, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x5f, 0x64, 0x69, 0x72, 0x22, 0x29, 0x20, 0x74, 0x68, 
+	0x65, 0x6e, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x28, 0x22, 0x22, 0x29, 0x20, 0x65, 0x6e, 0x64, 
+	0xa, 0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 0x2d, 0x2d, 0xa, 0x49, 0x73, 0x44, 0x69, 0x72, 0x65, 
+	0x63, 0x74, 0x6f, 0x72, 0x79, 0x20, 0x3d, 0x20, 0x62, 0x61, 0x6d, 0x5f, 0x69, 0x73, 0x64, 0x69, 
+	0x72, 0xa, 0xa, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x55, 0x4e, 0x49, 0x54, 0x54, 0x45, 0x53, 0x54, 
+	0x53, 0xa, 0x9, 0x65, 0x72, 0x72, 0x3d, 0x30, 0x20, 0x3a, 0x20, 0x69, 0x66, 0x20, 0x6e, 0x6f, 
+	0x74, 0x20, 0x62, 0x61, 0x6d, 0x5f, 0x69, 0x73, 0x66, 0x69, 0x6c, 0x65, 0x28, 0x22, 0x76, 0x61, 
+	0x6c, 0x69, 0x64, 0x5f, 0x66, 0x69, 0x6c, 0x65, 0x22, 0x29, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x20, 
+	0x65, 0x72, 0x72, 0x6f, 0x72, 0x28, 0x22, 0x22, 0x29, 0x20, 0x65, 0x6e, 0x64, 0xa, 0x9, 0x65, 
+	0x72, 0x72, 0x3d, 0x30, 0x20, 0x3a, 0x20, 0x69, 0x66, 0x20, 0x62, 0x61, 0x6d, 0x5f, 0x69, 0x73, 
+	0x66, 0x69, 0x6c, 0x65, 0x28, 0x22, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x5f, 0x64, 0x69, 0x72, 0x22, 
+	0x29, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x28, 0x22, 0x22, 0x29, 
+	0x20, 0x65, 0x6e, 0x64, 0xa, 0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 0x2d, 0x2d, 0xa, 0x49, 0x73, 
+	0x46, 0x69, 0x6c, 0x65, 0x20, 0x3d, 0x20, 0x62, 0x61, 0x6d, 0x5f, 0x69, 0x73, 0x66, 0x69, 0x6c, 
+	0x65, 0xa, 0xa, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x55, 0x4e, 0x49, 0x54, 0x54, 0x45, 0x53, 0x54, 
+	0x53, 0xa, 0x9, 0x65, 0x72, 0x72, 0x3d, 0x30, 0x20, 0x3a, 0x20, 0x69, 0x66, 0x20, 0x6e, 0x6f, 
+	0x74, 0x20, 0x62, 0x61, 0x6d, 0x5f, 0x66, 0x69, 0x6c, 0x65, 0x65, 0x78, 0x69, 0x73, 0x74, 0x28, 
+	0x22, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x5f, 0x66, 0x69, 0x6c, 0x65, 0x22, 0x29, 0x20, 0x74, 0x68, 
+	0x65, 0x6e, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x28, 0x22, 0x22, 0x29, 0x20, 0x65, 0x6e, 0x64, 
+	0xa, 0x9, 0x65, 0x72, 0x72, 0x3d, 0x30, 0x20, 0x3a, 0x20, 0x69, 0x66, 0x20, 0x62, 0x61, 0x6d, 
+	0x5f, 0x66, 0x69, 0x6c, 0x65, 0x65, 0x78, 0x69, 0x73, 0x74, 0x28, 0x22, 0x69, 0x6e, 0x76, 0x61, 
+	0x6c, 0x69, 0x64, 0x5f, 0x66, 0x69, 0x6c, 0x65, 0x22, 0x29, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x20, 
+	0x65, 0x72, 0x72, 0x6f, 0x72, 0x28, 0x22, 0x22, 0x29, 0x20, 0x65, 0x6e, 0x64, 0xa, 0x40, 0x45, 
+	0x4e, 0x44, 0x5d, 0x5d, 0x2d, 0x2d, 0xa, 0x45, 0x78, 0x69, 0x73, 0x74, 0x20, 0x3d, 0x20, 0x62, 
+	0x61, 0x6d, 0x5f, 0x66, 0x69, 0x6c, 0x65, 0x65, 0x78, 0x69, 0x73, 0x74, 0xa, 0x4e, 0x6f, 0x64, 
+	0x65, 0x45, 0x78, 0x69, 0x73, 0x74, 0x20, 0x3d, 0x20, 0x62, 0x61, 0x6d, 0x5f, 0x6e, 0x6f, 0x64, 
+	0x65, 0x65, 0x78, 0x69, 0x73, 0x74, 0xa, 0x53, 0x65, 0x74, 0x46, 0x69, 0x6c, 0x74, 0x65, 0x72, 
+	0x20, 0x3d, 0x20, 0x62, 0x61, 0x6d, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x66, 0x69, 0x6c, 0x74, 0x65, 
+	0x72, 0xa, 0x41, 0x64, 0x64, 0x4f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x20, 0x3d, 0x20, 0x62, 0x61, 
+	0x6d, 0x5f, 0x61, 0x64, 0x64, 0x5f, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0xa, 0x41, 0x64, 0x64, 
+	0x53, 0x69, 0x64, 0x65, 0x45, 0x66, 0x66, 0x65, 0x63, 0x74, 0x20, 0x3d, 0x20, 0x62, 0x61, 0x6d, 
+	0x5f, 0x61, 0x64, 0x64, 0x5f, 0x73, 0x69, 0x64, 0x65, 0x65, 0x66, 0x66, 0x65, 0x63, 0x74, 0xa, 
+	0x41, 0x64, 0x64, 0x43, 0x6c, 0x65, 0x61, 0x6e, 0x20, 0x3d, 0x20, 0x62, 0x61, 0x6d, 0x5f, 0x61, 
+	0x64, 0x64, 0x5f, 0x63, 0x6c, 0x65, 0x61, 0x6e, 0xa, 0x53, 0x65, 0x74, 0x50, 0x72, 0x69, 0x6f, 
+	0x72, 0x69, 0x74, 0x79, 0x20, 0x3d, 0x20, 0x62, 0x61, 0x6d, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x70, 
+	0x72, 0x69, 0x6f, 0x72, 0x69, 0x74, 0x79, 0xa, 0x4d, 0x6f, 0x64, 0x69, 0x66, 0x79, 0x50, 0x72, 
+	0x69, 0x6f, 0x72, 0x69, 0x74, 0x79, 0x20, 0x3d, 0x20, 0x62, 0x61, 0x6d, 0x5f, 0x6d, 0x6f, 0x64, 
+	0x69, 0x66, 0x79, 0x5f, 0x70, 0x72, 0x69, 0x6f, 0x72, 0x69, 0x74, 0x79, 0xa, 0xa, 0x2d, 0x2d, 
+	0x5b, 0x5b, 0x40, 0x55, 0x4e, 0x49, 0x54, 0x54, 0x45, 0x53, 0x54, 0x53, 0xa, 0x9, 0x65, 0x72, 
+	0x72, 0x3d, 0x30, 0x20, 0x3a, 0x20, 0x69, 0x66, 0x20, 0x62, 0x61, 0x6d, 0x5f, 0x70, 0x61, 0x74, 
+	0x68, 0x5f, 0x69, 0x73, 0x6e, 0x69, 0x63, 0x65, 0x28, 0x22, 0x22, 0x29, 0x20, 0x74, 0x68, 0x65, 
+	0x6e, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x28, 0x22, 0x22, 0x29, 0x20, 0x65, 0x6e, 0x64, 0xa, 
+	0x9, 0x65, 0x72, 0x72, 0x3d, 0x30, 0x20, 0x3a, 0x20, 0x69, 0x66, 0x20, 0x62, 0x61, 0x6d, 0x5f, 
+	0x70, 0x61, 0x74, 0x68, 0x5f, 0x69, 0x73, 0x6e, 0x69, 0x63, 0x65, 0x28, 0x22, 0x74, 0x65, 0x73, 
+	0x74, 0x2f, 0x2e, 0x2e, 0x2f, 0x74, 0x65, 0x73, 0x74, 0x22, 0x29, 0x20, 0x74, 0x68, 0x65, 0x6e, 
+	0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x28, 0x22, 0x22, 0x29, 0x20, 0x65, 0x6e, 0x64, 0xa, 0x9, 
+	0x65, 0x72, 0x72, 0x3d, 0x30, 0x20, 0x3a, 0x20, 0x69, 0x66, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x62, 
+	0x61, 0x6d, 0x5f, 0x70, 0x61, 0x74, 0x68, 0x5f, 0x69, 0x73, 0x6e, 0x69, 0x63, 0x65, 0x28, 0x22, 
+	0x74, 0x65, 0x73, 0x74, 0x2f, 0x74, 0x65, 0x73, 0x74, 0x22, 0x29, 0x20, 0x74, 0x68, 0x65, 0x6e, 
+	0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x28, 0x22, 0x22, 0x29, 0x20, 0x65, 0x6e, 0x64, 0xa, 0x40, 
+	0x45, 0x4e, 0x44, 0x5d, 0x5d, 0x2d, 0x2d, 0xa, 0xa, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x55, 0x4e, 
+	0x49, 0x54, 0x54, 0x45, 0x53, 0x54, 0x53, 0xa, 0x9, 0x65, 0x72, 0x72, 0x3d, 0x31, 0x20, 0x3a, 
+	0x20, 0x62, 0x61, 0x6d, 0x5f, 0x61, 0x64, 0x64, 0x5f, 0x64, 0x65, 0x70, 0x65, 0x6e, 0x64, 0x65, 
+	0x6e, 0x63, 0x79, 0x5f, 0x63, 0x70, 0x70, 0x28, 0x22, 0x6d, 0x69, 0x73, 0x73, 0x69, 0x6e, 0x67, 
+	0x20, 0x6e, 0x6f, 0x64, 0x65, 0x22, 0x29, 0xa, 0x9, 0x65, 0x72, 0x72, 0x3d, 0x30, 0x20, 0x3a, 
+	0x20, 0x50, 0x73, 0x65, 0x75, 0x64, 0x6f, 0x54, 0x61, 0x72, 0x67, 0x65, 0x74, 0x28, 0x22, 0x66, 
+	0x61, 0x6b, 0x65, 0x6e, 0x6f, 0x64, 0x65, 0x22, 0x29, 0x3b, 0x20, 0x62, 0x61, 0x6d, 0x5f, 0x61, 
+	0x64, 0x64, 0x5f, 0x64, 0x65, 0x70, 0x65, 0x6e, 0x64, 0x65, 0x6e, 0x63, 0x79, 0x5f, 0x63, 0x70, 
+	0x70, 0x28, 0x22, 0x66, 0x61, 0x6b, 0x65, 0x6e, 0x6f, 0x64, 0x65, 0x22, 0x29, 0xa, 0x40, 0x45, 
+	0x4e, 0x44, 0x5d, 0x5d, 0x2d, 0x2d, 0xa, 0xa, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x46, 0x55, 0x4e, 
+	0x43, 0x54, 0x49, 0x4f, 0x4e, 0x20, 0x48, 0x61, 0x73, 0x68, 0xa, 0x9, 0x50, 0x65, 0x72, 0x66, 
+	0x6f, 0x72, 0x6d, 0x73, 0x20, 0x61, 0x20, 0x36, 0x34, 0x2d, 0x62, 0x69, 0x74, 0x20, 0x44, 0x4a, 
+	0x42, 0x32, 0x20, 0x68, 0x61, 0x73, 0x68, 0x20, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 
+	0x74, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 
+	0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x20, 0x68, 0x61, 0x73, 
+	0x20, 0x69, 0x6e, 0x20, 0x61, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0xa, 0x40, 0x45, 0x4e, 
+	0x44, 0x5d, 0x5d, 0x2d, 0x2d, 0xa, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x55, 0x4e, 0x49, 0x54, 0x54, 
+	0x45, 0x53, 0x54, 0x53, 0xa, 0x9, 0x63, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x30, 0x30, 0x30, 
+	0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x31, 0x35, 0x30, 0x35, 0x22, 0x20, 0x3a, 
+	0x20, 0x48, 0x61, 0x73, 0x68, 0x28, 0x22, 0x22, 0x29, 0xa, 0x9, 0x63, 0x61, 0x74, 0x63, 0x68, 
+	0x3d, 0x22, 0x61, 0x31, 0x65, 0x39, 0x38, 0x32, 0x33, 0x36, 0x31, 0x31, 0x39, 0x30, 0x62, 0x62, 
+	0x63, 0x34, 0x22, 0x20, 0x3a, 0x20, 0x48, 0x61, 0x73, 0x68, 0x28, 0x22, 0x68, 0x65, 0x6c, 0x6c, 
+	0x6f, 0x20, 0x77, 0x6f, 0x72, 0x6c, 0x64, 0x21, 0x22, 0x29, 0xa, 0x40, 0x45, 0x4e, 0x44, 0x5d, 
+	0x5d, 0x2d, 0x2d, 0xa, 0x48, 0x61, 0x73, 0x68, 0x20, 0x3d, 0x20, 0x62, 0x61, 0x6d, 0x5f, 0x68, 
+	0x61, 0x73, 0x68, 0xa, 0xa, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x46, 0x55, 0x4e, 0x43, 0x54, 0x49, 
+	0x4f, 0x4e, 0x20, 0x50, 0x61, 0x74, 0x68, 0x48, 0x61, 0x73, 0x68, 0xa, 0x9, 0x50, 0x65, 0x72, 
+	0x66, 0x6f, 0x72, 0x6d, 0x73, 0x20, 0x61, 0x20, 0x36, 0x34, 0x2d, 0x62, 0x69, 0x74, 0x20, 0x44, 
+	0x4a, 0x42, 0x32, 0x20, 0x68, 0x61, 0x73, 0x68, 0x20, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 
+	0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x2c, 0x20, 0x62, 0x75, 0x74, 0x20, 0x64, 0x6f, 0x65, 0x73, 
+	0x20, 0x63, 0x65, 0x72, 0x74, 0x61, 0x69, 0x6e, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 
+	0x65, 0x72, 0x20, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x28, 
+	0x61, 0x6c, 0x6c, 0x20, 0x6c, 0x6f, 0x77, 0x65, 0x72, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x6f, 
+	0x6e, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x29, 0x20, 0x6f, 0x6e, 0x20, 0x76, 0x61, 
+	0x72, 0x69, 0x6f, 0x75, 0x73, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x73, 0x2e, 0x20, 0xa, 
+	0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 0x2d, 0x2d, 0xa, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x55, 0x4e, 
+	0x49, 0x54, 0x54, 0x45, 0x53, 0x54, 0x53, 0xa, 0x9, 0x63, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 
+	0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x31, 0x35, 0x30, 0x35, 
+	0x22, 0x20, 0x3a, 0x20, 0x50, 0x61, 0x74, 0x68, 0x48, 0x61, 0x73, 0x68, 0x28, 0x22, 0x22, 0x29, 
+	0xa, 0x9, 0x63, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x61, 0x31, 0x65, 0x39, 0x38, 0x32, 0x33, 
+	0x36, 0x31, 0x31, 0x39, 0x30, 0x62, 0x62, 0x63, 0x34, 0x22, 0x20, 0x3a, 0x20, 0x50, 0x61, 0x74, 
+	0x68, 0x48, 0x61, 0x73, 0x68, 0x28, 0x22, 0x68, 0x65, 0x6c, 0x6c, 0x6f, 0x20, 0x77, 0x6f, 0x72, 
+	0x6c, 0x64, 0x21, 0x22, 0x29, 0xa, 0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 0x2d, 0x2d, 0xa, 0x50, 
+	0x61, 0x74, 0x68, 0x48, 0x61, 0x73, 0x68, 0x20, 0x3d, 0x20, 0x62, 0x61, 0x6d, 0x5f, 0x70, 0x61, 
+	0x74, 0x68, 0x5f, 0x68, 0x61, 0x73, 0x68, 0xa, 0xa, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x47, 0x52, 
+	0x4f, 0x55, 0x50, 0x20, 0x43, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x20, 0x40, 0x45, 0x4e, 0x44, 0x5d, 
+	0x5d, 0x2d, 0x2d, 0xa, 0xa, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x46, 0x55, 0x4e, 0x43, 0x54, 0x49, 
+	0x4f, 0x4e, 0x20, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0xa, 
+	0x9, 0x54, 0x65, 0x6c, 0x6c, 0x73, 0x20, 0x62, 0x61, 0x6d, 0x20, 0x77, 0x68, 0x61, 0x74, 0x20, 
+	0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x73, 0x63, 0x72, 
+	0x69, 0x70, 0x74, 0x20, 0x69, 0x73, 0x20, 0x77, 0x72, 0x69, 0x74, 0x74, 0x65, 0x6e, 0x20, 0x66, 
+	0x6f, 0x72, 0x2e, 0x20, 0x49, 0x74, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x65, 0x69, 0x74, 0x68, 
+	0x65, 0x72, 0xa, 0x9, 0x6d, 0x61, 0x6b, 0x65, 0x20, 0x73, 0x75, 0x72, 0x65, 0x20, 0x74, 0x68, 
+	0x61, 0x74, 0x20, 0x69, 0x74, 0x20, 0x62, 0x65, 0x68, 0x61, 0x76, 0x65, 0x73, 0x20, 0x6c, 0x69, 
+	0x6b, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 
+	0x6f, 0x72, 0x20, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x20, 0x6f, 0x75, 0x74, 0x20, 0x61, 0x6e, 0x20, 
+	0x65, 0x72, 0x72, 0x6f, 0x72, 0x2e, 0xa, 0x9, 0xa, 0x9, 0x7b, 0x7b, 0x7b, 0x7b, 0xa, 0x9, 
+	0x43, 0x68, 0x65, 0x63, 0x6b, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x28, 0x22, 0x30, 0x2e, 
+	0x31, 0x2e, 0x30, 0x22, 0x29, 0xa, 0x9, 0x7d, 0x7d, 0x7d, 0x7d, 0xa, 0x40, 0x45, 0x4e, 0x44, 
+	0x5d, 0x5d, 0x2d, 0x2d, 0xa, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x43, 0x68, 
+	0x65, 0x63, 0x6b, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x28, 0x76, 0x65, 0x72, 0x73, 0x69, 
+	0x6f, 0x6e, 0x29, 0xa, 0x9, 0x69, 0x66, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 
+	0x3d, 0x3d, 0x20, 0x5f, 0x62, 0x61, 0x6d, 0x5f, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 
+	0x74, 0x68, 0x65, 0x6e, 0xa, 0x9, 0x65, 0x6c, 0x73, 0x65, 0xa, 0x9, 0x9, 0x65, 0x72, 0x72, 
+	0x6f, 0x72, 0x28, 0x22, 0x74, 0x68, 0x69, 0x73, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x20, 0x66, 0x6f, 
+	0x72, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x22, 0x2e, 0x2e, 0x76, 0x65, 0x72, 
+	0x73, 0x69, 0x6f, 0x6e, 0x2e, 0x2e, 0x22, 0x2e, 0x78, 0x20, 0x6f, 0x66, 0x20, 0x62, 0x61, 0x6d, 
+	0x2e, 0x20, 0x79, 0x6f, 0x75, 0x20, 0x61, 0x72, 0x65, 0x20, 0x72, 0x75, 0x6e, 0x6e, 0x69, 0x6e, 
+	0x67, 0x20, 0x22, 0x2e, 0x2e, 0x5f, 0x62, 0x61, 0x6d, 0x5f, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 
+	0x6e, 0x2e, 0x2e, 0x22, 0x2e, 0x78, 0x2e, 0x22, 0x29, 0xa, 0x9, 0x65, 0x6e, 0x64, 0xa, 0x65, 
+	0x6e, 0x64, 0xa, 0xa, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x46, 0x55, 0x4e, 0x43, 0x54, 0x49, 0x4f, 
+	0x4e, 0x20, 0x45, 0x78, 0x65, 0x63, 0x75, 0x74, 0x65, 0x28, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 
+	0x64, 0x29, 0xa, 0x9, 0x45, 0x78, 0x65, 0x63, 0x75, 0x74, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 
+	0x20, 0x5e, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x5e, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 
+	0x65, 0x20, 0x73, 0x68, 0x65, 0x6c, 0x6c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x72, 0x65, 0x74, 0x75, 
+	0x72, 0x6e, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x63, 0x6f, 
+	0x64, 0x65, 0x2e, 0xa, 0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 0x2d, 0x2d, 0xa, 0x2d, 0x2d, 0x5b, 
+	0x5b, 0x40, 0x55, 0x4e, 0x49, 0x54, 0x54, 0x45, 0x53, 0x54, 0x53, 0xa, 0x9, 0x65, 0x72, 0x72, 
+	0x3d, 0x30, 0x20, 0x3a, 0x20, 0x45, 0x78, 0x65, 0x63, 0x75, 0x74, 0x65, 0x28, 0x22, 0x65, 0x63, 
+	0x68, 0x6f, 0x22, 0x29, 0xa, 0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 0x2d, 0x2d, 0xa, 0x66, 0x75, 
+	0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x45, 0x78, 0x65, 0x63, 0x75, 0x74, 0x65, 0x28, 0x63, 
+	0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x29, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x72, 
+	0x65, 0x73, 0x2c, 0x73, 0x74, 0x72, 0x2c, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x3d, 0x20, 0x6f, 0x73, 
+	0x2e, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x65, 0x28, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 
+	0x29, 0xa, 0x9, 0x69, 0x66, 0x20, 0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79, 0x20, 0x3d, 0x3d, 0x20, 
+	0x27, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x27, 0x20, 0x74, 0x68, 0x65, 0x6e, 0xa, 0x9, 
+	0x9, 0x69, 0x66, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x72, 0x65, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 
+	0x63, 0x6f, 0x64, 0x65, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x20, 0x74, 0x68, 0x65, 0x6e, 0xa, 0x9, 
+	0x9, 0x2d, 0x2d, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x6f, 0x67, 0x72, 
+	0x61, 0x6d, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x20, 0x2d, 0x31, 0x2c, 0x20, 0x73, 
+	0x79, 0x73, 0x74, 0x65, 0x6d, 0x28, 0x29, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x20, 
+	0x2d, 0x31, 0x2c, 0x20, 0x62, 0x75, 0x74, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 0x20, 
+	0x77, 0x68, 0x61, 0x74, 0x20, 0x69, 0x74, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x20, 
+	0x77, 0x68, 0x65, 0x6e, 0x20, 0x69, 0x74, 0x20, 0x73, 0x65, 0x74, 0x20, 0x65, 0x72, 0x72, 0x6e, 
+	0x6f, 0x2c, 0x20, 0x73, 0x6f, 0x20, 0x6c, 0x75, 0x61, 0x20, 0x6f, 0x73, 0x2e, 0x65, 0x78, 0x65, 
+	0x63, 0x75, 0x74, 0x65, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x20, 0x65, 0x72, 0x72, 
+	0x6e, 0x6f, 0x2c, 0x20, 0x62, 0x75, 0x74, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 0x20, 
+	0x30, 0x2e, 0x20, 0x53, 0x75, 0x63, 0x68, 0x20, 0x61, 0x20, 0x6d, 0x65, 0x73, 0x73, 0x2c, 0x20, 
+	0x62, 0x75, 0x74, 0x20, 0x77, 0x65, 0x20, 0x72, 0x65, 0x61, 0x6c, 0x6c, 0x79, 0x20, 0x64, 0x6f, 
+	0x6e, 0x27, 0x74, 0x20, 0x77, 0x61, 0x6e, 0x27, 0x74, 0x20, 0x74, 0x6f, 0x20, 0x72, 0x65, 0x74, 
+	0x75, 0x72, 0x6e, 0x20, 0x30, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x66, 0x61, 0x69, 0x6c, 0x65, 0x64, 
+	0x20, 0x63, 0x61, 0x6c, 0x6c, 0x73, 0xa, 0x9, 0x9, 0x2d, 0x2d, 0x20, 0x74, 0x68, 0x65, 0x72, 
+	0x65, 0x20, 0x77, 0x61, 0x73, 0x20, 0x73, 0x6f, 0x6d, 0x65, 0x20, 0x74, 0x61, 0x6c, 0x6b, 0x20, 
+	0x61, 0x62, 0x6f, 0x75, 0x74, 0x20, 0x69, 0x74, 0x20, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 
+	0x6c, 0x75, 0x61, 0x20, 0x6d, 0x61, 0x69, 0x6e, 0x6c, 0x69, 0x6e, 0x67, 0x20, 0x6c, 0x69, 0x73, 
+	0x74, 0x20, 0x28, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6c, 0x75, 0x61, 0x2d, 0x75, 0x73, 
+	0x65, 0x72, 0x73, 0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x6c, 0x69, 0x73, 0x74, 0x73, 0x2f, 0x6c, 0x75, 
+	0x61, 0x2d, 0x6c, 0x2f, 0x32, 0x30, 0x31, 0x38, 0x2d, 0x30, 0x35, 0x2f, 0x6d, 0x73, 0x67, 0x30, 
+	0x30, 0x30, 0x34, 0x35, 0x2e, 0x68, 0x74, 0x6d, 0x6c, 0x29, 0x2c, 0x20, 0x62, 0x75, 0x74, 0x20, 
+	0x74, 0x68, 0x65, 0x20, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x74, 0x20, 0x35, 0x2e, 0x34, 0x20, 0x62, 
+	0x65, 0x74, 0x61, 0x20, 0x68, 0x61, 0x73, 0x20, 0x6e, 0x6f, 0x20, 0x66, 0x69, 0x78, 0x65, 0x73, 
+	0x2e, 0xa, 0x9, 0x9, 0x9, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x2d, 0x31, 0x20, 0xa, 
+	0x9, 0x9, 0x65, 0x6e, 0x64, 0xa, 0x9, 0x65, 0x6e, 0x64, 0xa, 0x9, 0x72, 0x65, 0x74, 0x75, 
+	0x72, 0x6e, 0x20, 0x63, 0x6f, 0x64, 0x65, 0xa, 0x65, 0x6e, 0x64, 0xa, 0xa, 0x2d, 0x2d, 0x5b, 
+	0x5b, 0x40, 0x46, 0x55, 0x4e, 0x43, 0x54, 0x49, 0x4f, 0x4e, 0x20, 0x45, 0x78, 0x65, 0x63, 0x75, 
+	0x74, 0x65, 0x53, 0x69, 0x6c, 0x65, 0x6e, 0x74, 0x28, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 
+	0x29, 0xa, 0x9, 0x44, 0x6f, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6d, 0x65, 
+	0x20, 0x61, 0x73, 0x20, 0x5e, 0x45, 0x78, 0x65, 0x63, 0x75, 0x74, 0x65, 0x28, 0x63, 0x6f, 0x6d, 
+	0x6d, 0x61, 0x6e, 0x64, 0x29, 0x5e, 0x20, 0x62, 0x75, 0x74, 0x20, 0x73, 0x75, 0x70, 0x72, 0x65, 
+	0x73, 0x73, 0x65, 0x73, 0x20, 0x73, 0x74, 0x64, 0x6f, 0x75, 0x74, 0x20, 0x61, 0x6e, 0x64, 0x20, 
+	0x73, 0x74, 0x64, 0x65, 0x72, 0x72, 0x20, 0x6f, 0x66, 0xa, 0x9, 0x74, 0x68, 0x61, 0x74, 0x20, 
+	0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x2e, 0xa, 0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 0x2d, 
+	0x2d, 0xa, 0x69, 0x66, 0x20, 0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79, 0x20, 0x3d, 0x3d, 0x20, 0x22, 
+	0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6e, 0xa, 0x9, 0x45, 
+	0x78, 0x65, 0x63, 0x75, 0x74, 0x65, 0x53, 0x69, 0x6c, 0x65, 0x6e, 0x74, 0x20, 0x3d, 0x20, 0x66, 
+	0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x29, 
+	0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x45, 0x78, 0x65, 0x63, 0x75, 0x74, 0x65, 0x28, 
+	0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x20, 0x2e, 0x2e, 0x20, 0x22, 0x20, 0x3e, 0x6e, 0x75, 
+	0x6c, 0x20, 0x32, 0x3e, 0x26, 0x31, 0x22, 0x29, 0x20, 0x65, 0x6e, 0x64, 0xa, 0x65, 0x6c, 0x73, 
+	0x65, 0xa, 0x9, 0x45, 0x78, 0x65, 0x63, 0x75, 0x74, 0x65, 0x53, 0x69, 0x6c, 0x65, 0x6e, 0x74, 
+	0x20, 0x3d, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x63, 0x6f, 0x6d, 0x6d, 
+	0x61, 0x6e, 0x64, 0x29, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x45, 0x78, 0x65, 0x63, 
+	0x75, 0x74, 0x65, 0x28, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x20, 0x2e, 0x2e, 0x20, 0x22, 
+	0x20, 0x3e, 0x2f, 0x64, 0x65, 0x76, 0x2f, 0x6e, 0x75, 0x6c, 0x6c, 0x20, 0x32, 0x3e, 0x2f, 0x64, 
+	0x65, 0x76, 0x2f, 0x6e, 0x75, 0x6c, 0x6c, 0x22, 0x29, 0x20, 0x65, 0x6e, 0x64, 0xa, 0x65, 0x6e, 
+	0x64, 0xa, 0xa, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x47, 0x52, 0x4f, 0x55, 0x50, 0x20, 0x50, 0x61, 
+	0x74, 0x68, 0x20, 0x4d, 0x61, 0x6e, 0x69, 0x70, 0x75, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 
+	0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 0x2d, 0x2d, 0xa, 0xa, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x55, 
+	0x4e, 0x49, 0x54, 0x54, 0x45, 0x53, 0x54, 0x53, 0xa, 0x9, 0x65, 0x72, 0x72, 0x3d, 0x31, 0x20, 
+	0x3a, 0x20, 0x50, 0x61, 0x74, 0x68, 0x28, 0x6e, 0x69, 0x6c, 0x29, 0xa, 0x9, 0x65, 0x72, 0x72, 
+	0x3d, 0x31, 0x20, 0x3a, 0x20, 0x50, 0x61, 0x74, 0x68, 0x28, 0x7b, 0x7d, 0x29, 0xa, 0x9, 0x65, 
+	0x72, 0x72, 0x3d, 0x31, 0x20, 0x3a, 0x20, 0x50, 0x61, 0x74, 0x68, 0x28, 0x22, 0x61, 0x73, 0x64, 
+	0x66, 0x22, 0x2c, 0x20, 0x22, 0x61, 0x73, 0x64, 0x66, 0x22, 0x29, 0xa, 0x9, 0x63, 0x61, 0x74, 
+	0x63, 0x68, 0x3d, 0x22, 0x22, 0x20, 0x3a, 0x20, 0x50, 0x61, 0x74, 0x68, 0x28, 0x22, 0x22, 0x29, 
+	0xa, 0x9, 0x63, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x22, 0x20, 0x3a, 0x20, 0x50, 0x61, 0x74, 
+	0x68, 0x28, 0x22, 0x2f, 0x22, 0x29, 0xa, 0x9, 0x63, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x2f, 
+	0x62, 0x2e, 0x63, 0x2f, 0x66, 0x69, 0x6c, 0x65, 0x2e, 0x65, 0x78, 0x74, 0x22, 0x20, 0x3a, 0x20, 
+	0x50, 0x61, 0x74, 0x68, 0x28, 0x22, 0x2f, 0x61, 0x2f, 0x2e, 0x2e, 0x2f, 0x62, 0x2e, 0x63, 0x2f, 
+	0x2e, 0x2f, 0x66, 0x69, 0x6c, 0x65, 0x2e, 0x65, 0x78, 0x74, 0x22, 0x29, 0xa, 0x9, 0x63, 0x61, 
+	0x74, 0x63, 0x68, 0x3d, 0x22, 0x2f, 0x62, 0x2e, 0x63, 0x22, 0x20, 0x3a, 0x20, 0x50, 0x61, 0x74, 
+	0x68, 0x28, 0x22, 0x2f, 0x61, 0x2f, 0x2e, 0x2e, 0x2f, 0x62, 0x2e, 0x63, 0x2f, 0x2e, 0x2f, 0x22, 
+	0x29, 0xa, 0x9, 0x63, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x2f, 0x2e, 0x62, 0x63, 0x22, 0x20, 
+	0x3a, 0x20, 0x50, 0x61, 0x74, 0x68, 0x28, 0x22, 0x2f, 0x61, 0x2f, 0x2e, 0x2e, 0x2f, 0x2e, 0x62, 
+	0x63, 0x2f, 0x2e, 0x2f, 0x22, 0x29, 0xa, 0x9, 0x63, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x2f, 
+	0x61, 0x22, 0x20, 0x3a, 0x20, 0x50, 0x61, 0x74, 0x68, 0x28, 0x22, 0x2f, 0x61, 0x2f, 0x62, 0x2f, 
+	0x2e, 0x2e, 0x22, 0x29, 0xa, 0x9, 0x63, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x2f, 0x61, 0x2f, 
+	0x2e, 0x2e, 0x62, 0x22, 0x20, 0x3a, 0x20, 0x50, 0x61, 0x74, 0x68, 0x28, 0x22, 0x2f, 0x61, 0x2f, 
+	0x2e, 0x2e, 0x62, 0x2f, 0x22, 0x29, 0xa, 0x9, 0x63, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x2f, 
+	0x61, 0x2f, 0x62, 0x22, 0x20, 0x3a, 0x20, 0x50, 0x61, 0x74, 0x68, 0x28, 0x22, 0x2f, 0x61, 0x2f, 
+	0x2f, 0x62, 0x2f, 0x22, 0x29, 0xa, 0x9, 0x63, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x2f, 0x61, 
+	0x22, 0x20, 0x3a, 0x20, 0x50, 0x61, 0x74, 0x68, 0x28, 0x22, 0x2f, 0x61, 0x2f, 0x62, 0x2f, 0x2e, 
+	0x2e, 0x2f, 0x22, 0x29, 0xa, 0x9, 0x63, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x2f, 0x61, 0x22, 
+	0x20, 0x3a, 0x20, 0x50, 0x61, 0x74, 0x68, 0x28, 0x22, 0x2f, 0x61, 0x2f, 0x2e, 0x62, 0x2f, 0x2e, 
+	0x2e, 0x2f, 0x22, 0x29, 0xa, 0x9, 0x63, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x2f, 0x61, 0x2f, 
+	0x2e, 0x62, 0x22, 0x20, 0x3a, 0x20, 0x50, 0x61, 0x74, 0x68, 0x28, 0x22, 0x2f, 0x61, 0x2f, 0x2e, 
+	0x62, 0x22, 0x29, 0xa, 0x9, 0x63, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x2f, 0x61, 0x2f, 0x2e, 
+	0x62, 0x22, 0x20, 0x3a, 0x20, 0x50, 0x61, 0x74, 0x68, 0x28, 0x22, 0x2f, 0x61, 0x2f, 0x2e, 0x62, 
+	0x2f, 0x22, 0x29, 0xa, 0x9, 0x63, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x2e, 0x2e, 0x2f, 0x2e, 
+	0x2e, 0x2f, 0x62, 0x2e, 0x63, 0x22, 0x20, 0x3a, 0x20, 0x50, 0x61, 0x74, 0x68, 0x28, 0x22, 0x2e, 
+	0x2e, 0x2f, 0x2e, 0x2e, 0x2f, 0x61, 0x2f, 0x2e, 0x2e, 0x2f, 0x62, 0x2e, 0x63, 0x2f, 0x2e, 0x2f, 
+	0x22, 0x29, 0xa, 0x9, 0x63, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x2e, 0x2e, 0x2f, 0x70, 0x61, 
+	0x74, 0x68, 0x2f, 0x66, 0x69, 0x6c, 0x65, 0x2e, 0x6e, 0x61, 0x6d, 0x65, 0x2e, 0x65, 0x78, 0x74, 
+	0x22, 0x20, 0x3a, 0x20, 0x50, 0x61, 0x74, 0x68, 0x28, 0x22, 0x2e, 0x2e, 0x2f, 0x74, 0x65, 0x73, 
+	0x74, 0x2f, 0x2e, 0x2e, 0x2f, 0x70, 0x61, 0x74, 0x68, 0x2f, 0x66, 0x69, 0x6c, 0x65, 0x2e, 0x6e, 
+	0x61, 0x6d, 0x65, 0x2e, 0x65, 0x78, 0x74, 0x22, 0x29, 0xa, 0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 
+	0x2d, 0x2d, 0xa, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x46, 0x55, 0x4e, 0x43, 0x54, 0x49, 0x4f, 0x4e, 
+	0x20, 0x50, 0x61, 0x74, 0x68, 0x28, 0x73, 0x74, 0x72, 0x29, 0xa, 0x9, 0x4e, 0x6f, 0x72, 0x6d, 
+	0x61, 0x6c, 0x69, 0x7a, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 
+	0x5e, 0x73, 0x74, 0x72, 0x5e, 0x20, 0x62, 0x79, 0x20, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x69, 0x6e, 
+	0x67, 0x20, 0x22, 0x2e, 0x2e, 0x22, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x22, 0x2e, 0x22, 0x20, 0x66, 
+	0x72, 0x6f, 0x6d, 0x20, 0x69, 0x74, 0x2e, 0xa, 0xa, 0x9, 0x7b, 0x7b, 0x7b, 0x7b, 0xa, 0x9, 
+	0x50, 0x61, 0x74, 0x68, 0x28, 0x22, 0x74, 0x65, 0x73, 0x74, 0x2f, 0x2e, 0x2f, 0x70, 0x61, 0x74, 
+	0x68, 0x2f, 0x2e, 0x2e, 0x2f, 0x66, 0x69, 0x6c, 0x65, 0x2e, 0x6e, 0x61, 0x6d, 0x65, 0x2e, 0x65, 
+	0x78, 0x74, 0x22, 0x29, 0x20, 0x2d, 0x2d, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x20, 
+	0x22, 0x74, 0x65, 0x73, 0x74, 0x2f, 0x66, 0x69, 0x6c, 0x65, 0x2e, 0x6e, 0x61, 0x6d, 0x65, 0x2e, 
+	0x65, 0x78, 0x74, 0x22, 0xa, 0x9, 0x50, 0x61, 0x74, 0x68, 0x28, 0x22, 0x2e, 0x2e, 0x2f, 0x74, 
+	0x65, 0x73, 0x74, 0x2f, 0x2e, 0x2e, 0x2f, 0x70, 0x61, 0x74, 0x68, 0x2f, 0x66, 0x69, 0x6c, 0x65, 
+	0x2e, 0x6e, 0x61, 0x6d, 0x65, 0x2e, 0x65, 0x78, 0x74, 0x22, 0x29, 0x20, 0x2d, 0x2d, 0x20, 0x52, 
+	0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x20, 0x22, 0x2e, 0x2e, 0x2f, 0x70, 0x61, 0x74, 0x68, 0x2f, 
+	0x66, 0x69, 0x6c, 0x65, 0x2e, 0x6e, 0x61, 0x6d, 0x65, 0x2e, 0x65, 0x78, 0x74, 0x22, 0xa, 0x9, 
+	0x7d, 0x7d, 0x7d, 0x7d, 0xa, 0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 0x2d, 0x2d, 0xa, 0x50, 0x61, 
+	0x74, 0x68, 0x20, 0x3d, 0x20, 0x62, 0x61, 0x6d, 0x5f, 0x70, 0x61, 0x74, 0x68, 0x5f, 0x6e, 0x6f, 
+	0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0xa, 0xa, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x55, 0x4e, 
+	0x49, 0x54, 0x54, 0x45, 0x53, 0x54, 0x53, 0xa, 0x9, 0x65, 0x72, 0x72, 0x3d, 0x31, 0x3a, 0x20, 
+	0x50, 0x61, 0x74, 0x68, 0x42, 0x61, 0x73, 0x65, 0x28, 0x6e, 0x69, 0x6c, 0x29, 0xa, 0x9, 0x65, 
+	0x72, 0x72, 0x3d, 0x31, 0x3a, 0x20, 0x50, 0x61, 0x74, 0x68, 0x42, 0x61, 0x73, 0x65, 0x28, 0x7b, 
+	0x7d, 0x29, 0xa, 0x9, 0x65, 0x72, 0x72, 0x3d, 0x31, 0x3a, 0x20, 0x50, 0x61, 0x74, 0x68, 0x42, 
+	0x61, 0x73, 0x65, 0x28, 0x22, 0x22, 0x2c, 0x20, 0x22, 0x22, 0x29, 0xa, 0x9, 0x63, 0x61, 0x74, 
+	0x63, 0x68, 0x3d, 0x22, 0x22, 0x3a, 0x20, 0x50, 0x61, 0x74, 0x68, 0x42, 0x61, 0x73, 0x65, 0x28, 
+	0x22, 0x22, 0x29, 0xa, 0x9, 0x63, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x2f, 0x22, 0x3a, 0x20, 
+	0x50, 0x61, 0x74, 0x68, 0x42, 0x61, 0x73, 0x65, 0x28, 0x22, 0x2f, 0x22, 0x29, 0xa, 0x9, 0x63, 
+	0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x74, 0x65, 0x73, 0x74, 0x2f, 0x70, 0x61, 0x74, 0x68, 0x2f, 
+	0x66, 0x69, 0x6c, 0x65, 0x2e, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3a, 0x20, 0x50, 0x61, 0x74, 0x68, 
+	0x42, 0x61, 0x73, 0x65, 0x28, 0x22, 0x74, 0x65, 0x73, 0x74, 0x2f, 0x70, 0x61, 0x74, 0x68, 0x2f, 
+	0x66, 0x69, 0x6c, 0x65, 0x2e, 0x6e, 0x61, 0x6d, 0x65, 0x2e, 0x65, 0x78, 0x74, 0x22, 0x29, 0xa, 
+	0x9, 0x63, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x2f, 0x61, 0x2f, 0x2e, 0x2e, 0x2f, 0x62, 0x2e, 
+	0x63, 0x2f, 0x2e, 0x2f, 0x66, 0x69, 0x6c, 0x65, 0x22, 0x3a, 0x20, 0x50, 0x61, 0x74, 0x68, 0x42, 
+	0x61, 0x73, 0x65, 0x28, 0x22, 0x2f, 0x61, 0x2f, 0x2e, 0x2e, 0x2f, 0x62, 0x2e, 0x63, 0x2f, 0x2e, 
+	0x2f, 0x66, 0x69, 0x6c, 0x65, 0x2e, 0x65, 0x78, 0x74, 0x22, 0x29, 0xa, 0x40, 0x45, 0x4e, 0x44, 
+	0x5d, 0x5d, 0x2d, 0x2d, 0xa, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x46, 0x55, 0x4e, 0x43, 0x54, 0x49, 
+	0x4f, 0x4e, 0x20, 0x50, 0x61, 0x74, 0x68, 0x42, 0x61, 0x73, 0x65, 0x28, 0x70, 0x61, 0x74, 0x68, 
+	0x29, 0xa, 0x9, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 
+	0x76, 0x65, 0x72, 0x74, 0x68, 0x69, 0x6e, 0x67, 0x20, 0x65, 0x78, 0x63, 0x65, 0x70, 0x74, 0x20, 
+	0x74, 0x68, 0x65, 0x20, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x69, 0x6e, 
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x74, 0x68, 0x2e, 0xa, 0xa, 0x9, 0x7b, 0x7b, 0x7b, 
+	0x7b, 0xa, 0x9, 0x50, 0x61, 0x74, 0x68, 0x42, 0x61, 0x73, 0x65, 0x28, 0x22, 0x74, 0x65, 0x73, 
+	0x74, 0x2f, 0x70, 0x61, 0x74, 0x68, 0x2f, 0x66, 0x69, 0x6c, 0x65, 0x2e, 0x6e, 0x61, 0x6d, 0x65, 
+	0x2e, 0x65, 0x78, 0x74, 0x22, 0x29, 0x20, 0x2d, 0x2d, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 
+	0x73, 0x20, 0x22, 0x74, 0x65, 0x73, 0x74, 0x2f, 0x70, 0x61, 0x74, 0x68, 0x2f, 0x66, 0x69, 0x6c, 
+	0x65, 0x2e, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0xa, 0x9, 0x50, 0x61, 0x74, 0x68, 0x42, 0x61, 0x73, 
+	0x65, 0x28, 0x22, 0x74, 0x65, 0x73, 0x74, 0x2f, 0x70, 0x61, 0x74, 0x68, 0x2f, 0x66, 0x69, 0x6c, 
+	0x65, 0x2e, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x29, 0x20, 0x2d, 0x2d, 0x20, 0x52, 0x65, 0x74, 0x75, 
+	0x72, 0x6e, 0x73, 0x20, 0x22, 0x74, 0x65, 0x73, 0x74, 0x2f, 0x70, 0x61, 0x74, 0x68, 0x2f, 0x66, 
+	0x69, 0x6c, 0x65, 0x22, 0xa, 0x9, 0x50, 0x61, 0x74, 0x68, 0x42, 0x61, 0x73, 0x65, 0x28, 0x22, 
+	0x74, 0x65, 0x73, 0x74, 0x2f, 0x70, 0x61, 0x74, 0x68, 0x2f, 0x66, 0x69, 0x6c, 0x65, 0x22, 0x29, 
+	0x20, 0x2d, 0x2d, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x20, 0x22, 0x74, 0x65, 0x73, 
+	0x74, 0x2f, 0x70, 0x61, 0x74, 0x68, 0x2f, 0x66, 0x69, 0x6c, 0x65, 0x22, 0xa, 0x9, 0x7d, 0x7d, 
+	0x7d, 0x7d, 0xa, 0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 0x2d, 0x2d, 0xa, 0x50, 0x61, 0x74, 0x68, 
+	0x42, 0x61, 0x73, 0x65, 0x20, 0x3d, 0x20, 0x62, 0x61, 0x6d, 0x5f, 0x70, 0x61, 0x74, 0x68, 0x5f, 
+	0x62, 0x61, 0x73, 0x65, 0xa, 0xa, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x55, 0x4e, 0x49, 0x54, 0x54, 
+	0x45, 0x53, 0x54, 0x53, 0xa, 0x9, 0x65, 0x72, 0x72, 0x3d, 0x31, 0x20, 0x3a, 0x20, 0x50, 0x61, 
+	0x74, 0x68, 0x46, 0x69, 0x6c, 0x65, 0x45, 0x78, 0x74, 0x28, 0x6e, 0x69, 0x6c, 0x29, 0xa, 0x9, 
+	0x65, 0x72, 0x72, 0x3d, 0x31, 0x20, 0x3a, 0x20, 0x50, 0x61, 0x74, 0x68, 0x46, 0x69, 0x6c, 0x65, 
+	0x45, 0x78, 0x74, 0x28, 0x7b, 0x7d, 0x29, 0xa, 0x9, 0x65, 0x72, 0x72, 0x3d, 0x31, 0x20, 0x3a, 
+	0x20, 0x50, 0x61, 0x74, 0x68, 0x46, 0x69, 0x6c, 0x65, 0x45, 0x78, 0x74, 0x28, 0x22, 0x22, 0x2c, 
+	0x20, 0x22, 0x22, 0x29, 0xa, 0x9, 0x63, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x22, 0x20, 0x3a, 
+	0x20, 0x50, 0x61, 0x74, 0x68, 0x46, 0x69, 0x6c, 0x65, 0x45, 0x78, 0x74, 0x28, 0x22, 0x22, 0x29, 
+	0xa, 0x9, 0x63, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x22, 0x20, 0x3a, 0x20, 0x50, 0x61, 0x74, 
+	0x68, 0x46, 0x69, 0x6c, 0x65, 0x45, 0x78, 0x74, 0x28, 0x22, 0x2f, 0x22, 0x29, 0xa, 0x9, 0x63, 
+	0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x65, 0x78, 0x74, 0x22, 0x20, 0x3a, 0x20, 0x50, 0x61, 0x74, 
+	0x68, 0x46, 0x69, 0x6c, 0x65, 0x45, 0x78, 0x74, 0x28, 0x22, 0x2f, 0x61, 0x2f, 0x2e, 0x2e, 0x2f, 
+	0x62, 0x2e, 0x63, 0x2f, 0x2e, 0x2f, 0x66, 0x69, 0x6c, 0x65, 0x2e, 0x65, 0x78, 0x74, 0x22, 0x29, 
+	0xa, 0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 0x2d, 0x2d, 0xa, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x46, 
+	0x55, 0x4e, 0x43, 0x54, 0x49, 0x4f, 0x4e, 0x20, 0x50, 0x61, 0x74, 0x68, 0x46, 0x69, 0x6c, 0x65, 
+	0x45, 0x78, 0x74, 0x28, 0x73, 0x74, 0x72, 0x29, 0xa, 0x9, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 
+	0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x73, 0x69, 0x6f, 0x6e, 0x20, 
+	0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x20, 
+	0x69, 0x6e, 0x20, 0x5e, 0x73, 0x74, 0x72, 0x5e, 0x2e, 0xa, 0x9, 0xa, 0x9, 0x7b, 0x7b, 0x7b, 
+	0x7b, 0xa, 0x9, 0x50, 0x61, 0x74, 0x68, 0x46, 0x69, 0x6c, 0x65, 0x45, 0x78, 0x74, 0x28, 0x22, 
+	0x74, 0x65, 0x73, 0x74, 0x2f, 0x70, 0x61, 0x74, 0x68, 0x2f, 0x66, 0x69, 0x6c, 0x65, 0x2e, 0x6e, 
+	0x61, 0x6d, 0x65, 0x2e, 0x65, 0x78, 0x74, 0x22, 0x29, 0x20, 0x2d, 0x2d, 0x20, 0x52, 0x65, 0x74, 
+	0x75, 0x72, 0x6e, 0x73, 0x20, 0x22, 0x65, 0x78, 0x74, 0x22, 0xa, 0x9, 0x7d, 0x7d, 0x7d, 0x7d, 
+	0xa, 0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 0x2d, 0x2d, 0xa, 0x50, 0x61, 0x74, 0x68, 0x46, 0x69, 
+	0x6c, 0x65, 0x45, 0x78, 0x74, 0x20, 0x3d, 0x20, 0x62, 0x61, 0x6d, 0x5f, 0x70, 0x61, 0x74, 0x68, 
+	0x5f, 0x65, 0x78, 0x74, 0xa, 0xa, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x55, 0x4e, 0x49, 0x54, 0x54, 
+	0x45, 0x53, 0x54, 0x53, 0xa, 0x9, 0x65, 0x72, 0x72, 0x3d, 0x31, 0x20, 0x3a, 0x20, 0x50, 0x61, 
+	0x74, 0x68, 0x46, 0x69, 0x6c, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x28, 0x6e, 0x69, 0x6c, 0x29, 0xa, 
+	0x9, 0x65, 0x72, 0x72, 0x3d, 0x31, 0x20, 0x3a, 0x20, 0x50, 0x61, 0x74, 0x68, 0x46, 0x69, 0x6c, 
+	0x65, 0x6e, 0x61, 0x6d, 0x65, 0x28, 0x7b, 0x7d, 0x29, 0xa, 0x9, 0x65, 0x72, 0x72, 0x3d, 0x31, 
+	0x20, 0x3a, 0x20, 0x50, 0x61, 0x74, 0x68, 0x46, 0x69, 0x6c, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x28, 
+	0x22, 0x22, 0x2c, 0x20, 0x22, 0x22, 0x29, 0xa, 0x9, 0x63, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 
+	0x22, 0x20, 0x3a, 0x20, 0x50, 0x61, 0x74, 0x68, 0x46, 0x69, 0x6c, 0x65, 0x6e, 0x61, 0x6d, 0x65, 
+	0x28, 0x22, 0x22, 0x29, 0xa, 0x9, 0x63, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x22, 0x20, 0x3a, 
+	0x20, 0x50, 0x61, 0x74, 0x68, 0x46, 0x69, 0x6c, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x28, 0x22, 0x2f, 
+	0x22, 0x29, 0xa, 0x9, 0x63, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x66, 0x69, 0x6c, 0x65, 0x2e, 
+	0x65, 0x78, 0x74, 0x22, 0x20, 0x3a, 0x20, 0x50, 0x61, 0x74, 0x68, 0x46, 0x69, 0x6c, 0x65, 0x6e, 
+	0x61, 0x6d, 0x65, 0x28, 0x22, 0x2f, 0x61, 0x2f, 0x2e, 0x2e, 0x2f, 0x62, 0x2e, 0x63, 0x2f, 0x2e, 
+	0x2f, 0x66, 0x69, 0x6c, 0x65, 0x2e, 0x65, 0x78, 0x74, 0x22, 0x29, 0xa, 0x40, 0x45, 0x4e, 0x44, 
+	0x5d, 0x5d, 0x2d, 0x2d, 0xa, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x46, 0x55, 0x4e, 0x43, 0x54, 0x49, 
+	0x4f, 0x4e, 0x20, 0x50, 0x61, 0x74, 0x68, 0x46, 0x69, 0x6c, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x28, 
+	0x73, 0x74, 0x72, 0x29, 0xa, 0x9, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x20, 0x74, 0x68, 
+	0x65, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 
+	0x65, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x69, 0x6e, 0x20, 0x5e, 0x73, 0x74, 0x72, 0x5e, 0x2e, 
+	0xa, 0xa, 0x9, 0x7b, 0x7b, 0x7b, 0x7b, 0xa, 0x9, 0x50, 0x61, 0x74, 0x68, 0x46, 0x69, 0x6c, 
+	0x65, 0x6e, 0x61, 0x6d, 0x65, 0x28, 0x22, 0x74, 0x65, 0x73, 0x74, 0x2f, 0x70, 0x61, 0x74, 0x68, 
+	0x2f, 0x66, 0x69, 0x6c, 0x65, 0x2e, 0x6e, 0x61, 0x6d, 0x65, 0x2e, 0x65, 0x78, 0x74, 0x22, 0x29, 
+	0x20, 0x2d, 0x2d, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x20, 0x22, 0x66, 0x69, 0x6c, 
+	0x65, 0x2e, 0x6e, 0x61, 0x6d, 0x65, 0x2e, 0x65, 0x78, 0x74, 0x22, 0xa, 0x9, 0x7d, 0x7d, 0x7d, 
+	0x7d, 0xa, 0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 0x2d, 0x2d, 0xa, 0x50, 0x61, 0x74, 0x68, 0x46, 
+	0x69, 0x6c, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x3d, 0x20, 0x62, 0x61, 0x6d, 0x5f, 0x70, 0x61, 
+	0x74, 0x68, 0x5f, 0x66, 0x69, 0x6c, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0xa, 0xa, 0x2d, 0x2d, 0x5b, 
+	0x5b, 0x40, 0x55, 0x4e, 0x49, 0x54, 0x54, 0x45, 0x53, 0x54, 0x53, 0xa, 0x9, 0x65, 0x72, 0x72, 
+	0x3d, 0x31, 0x20, 0x3a, 0x20, 0x50, 0x61, 0x74, 0x68, 0x4a, 0x6f, 0x69, 0x6e, 0x28, 0x6e, 0x69, 
+	0x6c, 0x29, 0xa, 0x9, 0x65, 0x72, 0x72, 0x3d, 0x31, 0x20, 0x3a, 0x20, 0x50, 0x61, 0x74, 0x68, 
+	0x4a, 0x6f, 0x69, 0x6e, 0x28, 0x22, 0x61, 0x73, 0x64, 0x66, 0x22, 0x2c, 0x20, 0x22, 0x61, 0x73, 
+	0x64, 0x66, 0x22, 0x2c, 0x20, 0x22, 0x61, 0x73, 0x64, 0x66, 0x22, 0x29, 0xa, 0x9, 0x63, 0x61, 
+	0x74, 0x63, 0x68, 0x3d, 0x22, 0x61, 0x2f, 0x62, 0x22, 0x20, 0x3a, 0x20, 0x50, 0x61, 0x74, 0x68, 
+	0x4a, 0x6f, 0x69, 0x6e, 0x28, 0x22, 0x61, 0x2f, 0x62, 0x22, 0x2c, 0x20, 0x22, 0x22, 0x29, 0xa, 
+	0x9, 0x63, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x61, 0x2f, 0x62, 0x22, 0x20, 0x3a, 0x20, 0x50, 
+	0x61, 0x74, 0x68, 0x4a, 0x6f, 0x69, 0x6e, 0x28, 0x22, 0x61, 0x2f, 0x62, 0x2f, 0x22, 0x2c, 0x20, 
+	0x22, 0x22, 0x29, 0xa, 0x9, 0x63, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x61, 0x2f, 0x62, 0x22, 
+	0x20, 0x3a, 0x20, 0x50, 0x61, 0x74, 0x68, 0x4a, 0x6f, 0x69, 0x6e, 0x28, 0x22, 0x61, 0x22, 0x2c, 
+	0x20, 0x22, 0x62, 0x22, 0x29, 0xa, 0x9, 0x63, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x61, 0x22, 
+	0x20, 0x3a, 0x20, 0x50, 0x61, 0x74, 0x68, 0x4a, 0x6f, 0x69, 0x6e, 0x28, 0x22, 0x22, 0x2c, 0x20, 
+	0x22, 0x61, 0x22, 0x29, 0xa, 0x9, 0x63, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x61, 0x2f, 0x62, 
+	0x22, 0x20, 0x3a, 0x20, 0x50, 0x61, 0x74, 0x68, 0x4a, 0x6f, 0x69, 0x6e, 0x28, 0x22, 0x22, 0x2c, 
+	0x20, 0x22, 0x61, 0x2f, 0x62, 0x22, 0x29, 0xa, 0x9, 0x63, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 
+	0x61, 0x22, 0x20, 0x3a, 0x20, 0x50, 0x61, 0x74, 0x68, 0x4a, 0x6f, 0x69, 0x6e, 0x28, 0x22, 0x61, 
+	0x2f, 0x62, 0x22, 0x2c, 0x20, 0x22, 0x2e, 0x2e, 0x22, 0x29, 0xa, 0x9, 0x63, 0x61, 0x74, 0x63, 
+	0x68, 0x3d, 0x22, 0x61, 0x2f, 0x62, 0x22, 0x20, 0x3a, 0x20, 0x50, 0x61, 0x74, 0x68, 0x4a, 0x6f, 
+	0x69, 0x6e, 0x28, 0x22, 0x61, 0x2f, 0x62, 0x2f, 0x22, 0x2c, 0x20, 0x22, 0x22, 0x29, 0xa, 0x9, 
+	0x63, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x61, 0x2f, 0x62, 0x22, 0x20, 0x3a, 0x20, 0x50, 0x61, 
+	0x74, 0x68, 0x4a, 0x6f, 0x69, 0x6e, 0x28, 0x22, 0x61, 0x2f, 0x22, 0x2c, 0x20, 0x22, 0x62, 0x2f, 
+	0x22, 0x29, 0xa, 0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 0x2d, 0x2d, 0xa, 0x2d, 0x2d, 0x5b, 0x5b, 
+	0x40, 0x46, 0x55, 0x4e, 0x43, 0x54, 0x49, 0x4f, 0x4e, 0x20, 0x50, 0x61, 0x74, 0x68, 0x4a, 0x6f, 
+	0x69, 0x6e, 0x28, 0x62, 0x61, 0x73, 0x65, 0x2c, 0x20, 0x61, 0x64, 0x64, 0x29, 0xa, 0x9, 0x4a, 
+	0x6f, 0x69, 0x6e, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x77, 0x6f, 0x20, 0x70, 0x61, 0x74, 
+	0x68, 0x73, 0x20, 0x5e, 0x62, 0x61, 0x73, 0x65, 0x5e, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x5e, 0x61, 
+	0x64, 0x64, 0x5e, 0x20, 0x74, 0x6f, 0x67, 0x65, 0x74, 0x68, 0x65, 0x72, 0x20, 0x61, 0x6e, 0x64, 
+	0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x20, 0x61, 0xa, 0x9, 0x6e, 0x6f, 0x72, 0x6d, 
+	0x61, 0x6c, 0x69, 0x7a, 0x65, 0x64, 0x20, 0x70, 0x61, 0x74, 0x68, 0x2e, 0x20, 0x54, 0x68, 0x69, 
+	0x73, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x68, 0x61, 0x6c, 0x64, 0x65, 
+	0x73, 0x20, 0x74, 0x72, 0x61, 0x69, 0x6c, 0x69, 0x6e, 0x67, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 
+	0x73, 0x65, 0x70, 0x61, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x73, 0x20, 0x69, 0x6e, 0xa, 0x9, 0x74, 
+	0x68, 0x65, 0x20, 0x5e, 0x62, 0x61, 0x73, 0x65, 0x5e, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 
+	0x6e, 0x74, 0x2e, 0xa, 0x9, 0x9, 0xa, 0x9, 0x7b, 0x7b, 0x7b, 0x7b, 0xa, 0x9, 0x50, 0x61, 
+	0x74, 0x68, 0x4a, 0x6f, 0x69, 0x6e, 0x28, 0x22, 0x74, 0x65, 0x73, 0x74, 0x2f, 0x70, 0x61, 0x74, 
+	0x68, 0x2f, 0x22, 0x2c, 0x20, 0x22, 0x2e, 0x2e, 0x2f, 0x66, 0x69, 0x6c, 0x65, 0x6e, 0x61, 0x6d, 
+	0x65, 0x2e, 0x65, 0x78, 0x74, 0x22, 0x29, 0x20, 0x2d, 0x2d, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 
+	0x6e, 0x73, 0x20, 0x22, 0x74, 0x65, 0x73, 0x74, 0x2f, 0x66, 0x69, 0x6c, 0x65, 0x6e, 0x61, 0x6d, 
+	0x65, 0x2e, 0x65, 0x78, 0x74, 0x22, 0xa, 0x9, 0x50, 0x61, 0x74, 0x68, 0x4a, 0x6f, 0x69, 0x6e, 
+	0x28, 0x22, 0x2e, 0x2e, 0x2f, 0x74, 0x65, 0x73, 0x74, 0x22, 0x2c, 0x20, 0x22, 0x70, 0x61, 0x74, 
+	0x68, 0x2f, 0x66, 0x69, 0x6c, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x2e, 0x65, 0x78, 0x74, 0x22, 0x29, 
+	0x20, 0x2d, 0x2d, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x20, 0x22, 0x2e, 0x2e, 0x2f, 
+	0x74, 0x65, 0x73, 0x74, 0x2f, 0x70, 0x61, 0x74, 0x68, 0x2f, 0x66, 0x69, 0x6c, 0x65, 0x6e, 0x61, 
+	0x6d, 0x65, 0x2e, 0x65, 0x78, 0x74, 0x22, 0xa, 0x9, 0x7d, 0x7d, 0x7d, 0x7d, 0x9, 0xa, 0x9, 
+	0xa, 0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 0x2d, 0x2d, 0xa, 0x50, 0x61, 0x74, 0x68, 0x4a, 0x6f, 
+	0x69, 0x6e, 0x20, 0x3d, 0x20, 0x62, 0x61, 0x6d, 0x5f, 0x70, 0x61, 0x74, 0x68, 0x5f, 0x6a, 0x6f, 
+	0x69, 0x6e, 0xa, 0xa, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x55, 0x4e, 0x49, 0x54, 0x54, 0x45, 0x53, 
+	0x54, 0x53, 0xa, 0x9, 0x65, 0x72, 0x72, 0x3d, 0x31, 0x20, 0x3a, 0x20, 0x50, 0x61, 0x74, 0x68, 
+	0x44, 0x69, 0x72, 0x28, 0x6e, 0x69, 0x6c, 0x29, 0xa, 0x9, 0x65, 0x72, 0x72, 0x3d, 0x31, 0x20, 
+	0x3a, 0x20, 0x50, 0x61, 0x74, 0x68, 0x44, 0x69, 0x72, 0x28, 0x7b, 0x7d, 0x29, 0xa, 0x9, 0x65, 
+	0x72, 0x72, 0x3d, 0x31, 0x20, 0x3a, 0x20, 0x50, 0x61, 0x74, 0x68, 0x44, 0x69, 0x72, 0x28, 0x22, 
+	0x22, 0x2c, 0x20, 0x22, 0x22, 0x29, 0xa, 0x9, 0x63, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x22, 
+	0x20, 0x3a, 0x20, 0x50, 0x61, 0x74, 0x68, 0x44, 0x69, 0x72, 0x28, 0x22, 0x22, 0x29, 0xa, 0x9, 
+	0x63, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x22, 0x20, 0x3a, 0x20, 0x50, 0x61, 0x74, 0x68, 0x44, 
+	0x69, 0x72, 0x28, 0x22, 0x2f, 0x22, 0x29, 0xa, 0x9, 0x63, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 
+	0x2f, 0x62, 0x2e, 0x63, 0x22, 0x20, 0x3a, 0x20, 0x50, 0x61, 0x74, 0x68, 0x44, 0x69, 0x72, 0x28, 
+	0x22, 0x2f, 0x61, 0x2f, 0x2e, 0x2e, 0x2f, 0x62, 0x2e, 0x63, 0x2f, 0x2e, 0x2f, 0x66, 0x69, 0x6c, 
+	0x65, 0x2e, 0x65, 0x78, 0x74, 0x22, 0x29, 0xa, 0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 0x2d, 0x2d, 
+	0xa, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x46, 0x55, 0x4e, 0x43, 0x54, 0x49, 0x4f, 0x4e, 0x20, 0x50, 
+	0x61, 0x74, 0x68, 0x44, 0x69, 0x72, 0x28, 0x73, 0x74, 0x72, 0x29, 0xa, 0x9, 0x52, 0x65, 0x74, 
+	0x75, 0x72, 0x6e, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x6f, 0x66, 
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x69, 0x6e, 
+	0x20, 0x5e, 0x73, 0x74, 0x72, 0x5e, 0x2e, 0xa, 0xa, 0x9, 0x7b, 0x7b, 0x7b, 0x7b, 0xa, 0x9, 
+	0x50, 0x61, 0x74, 0x68, 0x44, 0x69, 0x72, 0x28, 0x22, 0x74, 0x65, 0x73, 0x74, 0x2f, 0x70, 0x61, 
+	0x74, 0x68, 0x2f, 0x66, 0x69, 0x6c, 0x65, 0x2e, 0x6e, 0x61, 0x6d, 0x65, 0x2e, 0x65, 0x78, 0x74, 
+	0x22, 0x29, 0x20, 0x2d, 0x2d, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x20, 0x22, 0x74, 
+	0x65, 0x73, 0x74, 0x2f, 0x70, 0x61, 0x74, 0x68, 0x22, 0xa, 0x9, 0x7d, 0x7d, 0x7d, 0x7d, 0xa, 
+	0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 0x2d, 0x2d, 0xa, 0x50, 0x61, 0x74, 0x68, 0x44, 0x69, 0x72, 
+	0x20, 0x3d, 0x20, 0x62, 0x61, 0x6d, 0x5f, 0x70, 0x61, 0x74, 0x68, 0x5f, 0x64, 0x69, 0x72, 0xa, 
+	0xa, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x47, 0x52, 0x4f, 0x55, 0x50, 0x20, 0x54, 0x61, 0x62, 0x6c, 
+	0x65, 0x73, 0x20, 0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 0x2d, 0x2d, 0xa, 0xa, 0x2d, 0x2d, 0x5b, 
+	0x5b, 0x40, 0x55, 0x4e, 0x49, 0x54, 0x54, 0x45, 0x53, 0x54, 0x53, 0xa, 0x9, 0x65, 0x72, 0x72, 
+	0x3d, 0x31, 0x20, 0x3a, 0x20, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x44, 0x65, 0x65, 0x70, 0x43, 0x6f, 
+	0x70, 0x79, 0x28, 0x6e, 0x69, 0x6c, 0x29, 0xa, 0x9, 0x65, 0x72, 0x72, 0x3d, 0x31, 0x20, 0x3a, 
+	0x20, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x44, 0x65, 0x65, 0x70, 0x43, 0x6f, 0x70, 0x79, 0x28, 0x22, 
+	0x22, 0x29, 0xa, 0x9, 0x65, 0x72, 0x72, 0x3d, 0x31, 0x20, 0x3a, 0x20, 0x54, 0x61, 0x62, 0x6c, 
+	0x65, 0x44, 0x65, 0x65, 0x70, 0x43, 0x6f, 0x70, 0x79, 0x28, 0x7b, 0x7d, 0x2c, 0x20, 0x7b, 0x7d, 
+	0x29, 0xa, 0x9, 0x65, 0x72, 0x72, 0x3d, 0x30, 0x20, 0x3a, 0x20, 0x54, 0x61, 0x62, 0x6c, 0x65, 
+	0x44, 0x65, 0x65, 0x70, 0x43, 0x6f, 0x70, 0x79, 0x28, 0x7b, 0x7b, 0x7b, 0x22, 0x61, 0x22, 0x7d, 
+	0x2c, 0x20, 0x22, 0x62, 0x22, 0x7d, 0x2c, 0x20, 0x22, 0x63, 0x22, 0x2c, 0x20, 0x22, 0x64, 0x22, 
+	0x2c, 0x20, 0x7b, 0x22, 0x65, 0x22, 0x2c, 0x20, 0x22, 0x66, 0x22, 0x7d, 0x7d, 0x29, 0xa, 0x40, 
+	0x45, 0x4e, 0x44, 0x5d, 0x5d, 0x2d, 0x2d, 0x9, 0xa, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x46, 0x55, 
+	0x4e, 0x43, 0x54, 0x49, 0x4f, 0x4e, 0x20, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x44, 0x65, 0x65, 0x70, 
+	0x43, 0x6f, 0x70, 0x79, 0x28, 0x74, 0x62, 0x6c, 0x29, 0xa, 0x9, 0x4d, 0x61, 0x6b, 0x65, 0x73, 
+	0x20, 0x61, 0x20, 0x64, 0x65, 0x65, 0x70, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x20, 0x6f, 0x66, 0x20, 
+	0x74, 0x68, 0x65, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x5e, 0x74, 0x62, 0x6c, 0x5e, 0x20, 
+	0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x69, 0x6e, 0x20, 0x61, 0x20, 0x63, 
+	0x6f, 0x6d, 0x70, 0x6c, 0x65, 0x74, 0x65, 0x20, 0x73, 0x65, 0x70, 0x61, 0x72, 0x61, 0x74, 0x65, 
+	0xa, 0x9, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x2e, 0xa, 0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 0x2d, 
+	0x2d, 0xa, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x44, 0x65, 0x65, 0x70, 0x43, 0x6f, 0x70, 0x79, 0x20, 
+	0x3d, 0x20, 0x62, 0x61, 0x6d, 0x5f, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x5f, 0x64, 0x65, 0x65, 0x70, 
+	0x63, 0x6f, 0x70, 0x79, 0xa, 0xa, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x55, 0x4e, 0x49, 0x54, 0x54, 
+	0x45, 0x53, 0x54, 0x53, 0xa, 0x9, 0x65, 0x72, 0x72, 0x3d, 0x30, 0x20, 0x3a, 0x20, 0x54, 0x61, 
+	0x62, 0x6c, 0x65, 0x46, 0x6c, 0x61, 0x74, 0x74, 0x65, 0x6e, 0x28, 0x7b, 0x22, 0x22, 0x2c, 0x20, 
+	0x7b, 0x22, 0x22, 0x2c, 0x20, 0x7b, 0x22, 0x22, 0x7d, 0x2c, 0x20, 0x22, 0x22, 0x7d, 0x2c, 0x20, 
+	0x22, 0x22, 0x2c, 0x20, 0x7b, 0x7d, 0x2c, 0x20, 0x7b, 0x22, 0x22, 0x7d, 0x7d, 0x29, 0xa, 0x9, 
+	0x65, 0x72, 0x72, 0x3d, 0x31, 0x20, 0x3a, 0x20, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x46, 0x6c, 0x61, 
+	0x74, 0x74, 0x65, 0x6e, 0x28, 0x7b, 0x22, 0x22, 0x2c, 0x20, 0x7b, 0x22, 0x22, 0x2c, 0x20, 0x7b, 
+	0x22, 0x22, 0x7d, 0x2c, 0x20, 0x22, 0x22, 0x7d, 0x2c, 0x20, 0x31, 0x2c, 0x20, 0x7b, 0x22, 0x22, 
+	0x7d, 0x7d, 0x29, 0xa, 0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 0x2d, 0x2d, 0xa, 0x2d, 0x2d, 0x5b, 
+	0x5b, 0x40, 0x46, 0x55, 0x4e, 0x43, 0x54, 0x49, 0x4f, 0x4e, 0x20, 0x54, 0x61, 0x62, 0x6c, 0x65, 
+	0x46, 0x6c, 0x61, 0x74, 0x74, 0x65, 0x6e, 0x28, 0x74, 0x62, 0x6c, 0x29, 0xa, 0x9, 0x44, 0x6f, 
+	0x65, 0x73, 0x20, 0x61, 0x20, 0x64, 0x65, 0x65, 0x70, 0x20, 0x77, 0x61, 0x6c, 0x6b, 0x20, 0x6f, 
+	0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x5e, 0x74, 0x62, 0x6c, 0x5e, 0x20, 0x74, 0x61, 0x62, 0x6c, 
+	0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x73, 0x20, 0x61, 0x6e, 
+	0x64, 0x20, 0x67, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x65, 0x73, 0x20, 0x61, 0x20, 0x6e, 0x65, 
+	0x77, 0xa, 0x9, 0x66, 0x6c, 0x61, 0x74, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x77, 0x69, 
+	0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x20, 
+	0x49, 0x66, 0x20, 0x69, 0x74, 0x20, 0x6f, 0x63, 0x63, 0x75, 0x72, 0x73, 0x20, 0x61, 0x6e, 0x79, 
+	0x74, 0x68, 0x69, 0x6e, 0x67, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x20, 
+	0x61, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0xa, 0x9, 0x6f, 0x72, 0x20, 0x73, 0x74, 0x72, 0x69, 
+	0x6e, 0x67, 0x2c, 0x20, 0x69, 0x74, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x67, 0x65, 0x6e, 0x65, 
+	0x72, 0x61, 0x74, 0x65, 0x20, 0x61, 0x6e, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x2e, 0xa, 0x9, 
+	0xa, 0x9, 0x7b, 0x7b, 0x7b, 0x7b, 0xa, 0x9, 0x2d, 0x2d, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 
+	0x6e, 0x73, 0x20, 0x7b, 0x22, 0x61, 0x22, 0x2c, 0x20, 0x22, 0x62, 0x22, 0x2c, 0x20, 0x22, 0x63, 
+	0x22, 0x2c, 0x20, 0x22, 0x64, 0x22, 0x2c, 0x20, 0x22, 0x65, 0x22, 0x2c, 0x20, 0x22, 0x66, 0x22, 
+	0x7d, 0xa, 0x9, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x46, 0x6c, 0x61, 0x74, 0x74, 0x65, 0x6e, 0x28, 
+	0x7b, 0x22, 0x61, 0x22, 0x2c, 0x20, 0x7b, 0x22, 0x62, 0x22, 0x2c, 0x20, 0x7b, 0x22, 0x63, 0x22, 
+	0x7d, 0x2c, 0x20, 0x22, 0x64, 0x22, 0x7d, 0x2c, 0x20, 0x22, 0x65, 0x22, 0x2c, 0x20, 0x7b, 0x7d, 
+	0x2c, 0x20, 0x7b, 0x22, 0x66, 0x22, 0x7d, 0x7d, 0x29, 0xa, 0x9, 0x7d, 0x7d, 0x7d, 0x7d, 0xa, 
+	0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 0x2d, 0x2d, 0xa, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x46, 0x6c, 
+	0x61, 0x74, 0x74, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x62, 0x61, 0x6d, 0x5f, 0x74, 0x61, 0x62, 0x6c, 
+	0x65, 0x5f, 0x66, 0x6c, 0x61, 0x74, 0x74, 0x65, 0x6e, 0xa, 0xa, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 
+	0x55, 0x4e, 0x49, 0x54, 0x54, 0x45, 0x53, 0x54, 0x53, 0xa, 0x9, 0x65, 0x72, 0x72, 0x3d, 0x30, 
+	0x20, 0x3a, 0x20, 0x74, 0x20, 0x3d, 0x20, 0x7b, 0x61, 0x20, 0x3d, 0x20, 0x31, 0x7d, 0x3b, 0x20, 
+	0x54, 0x61, 0x62, 0x6c, 0x65, 0x4c, 0x6f, 0x63, 0x6b, 0x28, 0x74, 0x29, 0x3b, 0x20, 0x74, 0x2e, 
+	0x61, 0x20, 0x3d, 0x20, 0x32, 0xa, 0x9, 0x65, 0x72, 0x72, 0x3d, 0x31, 0x20, 0x3a, 0x20, 0x74, 
+	0x20, 0x3d, 0x20, 0x7b, 0x61, 0x20, 0x3d, 0x20, 0x31, 0x7d, 0x3b, 0x20, 0x54, 0x61, 0x62, 0x6c, 
+	0x65, 0x4c, 0x6f, 0x63, 0x6b, 0x28, 0x74, 0x29, 0x3b, 0x20, 0x74, 0x2e, 0x62, 0x20, 0x3d, 0x20, 
+	0x32, 0xa, 0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 0x2d, 0x2d, 0xa, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 
+	0x46, 0x55, 0x4e, 0x43, 0x54, 0x49, 0x4f, 0x4e, 0x20, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x4c, 0x6f, 
+	0x63, 0x6b, 0x28, 0x74, 0x62, 0x6c, 0x29, 0xa, 0x9, 0x4c, 0x6f, 0x63, 0x6b, 0x73, 0x20, 0x74, 
+	0x68, 0x65, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x5e, 0x74, 0x62, 0x6c, 0x5e, 0x20, 0x73, 
+	0x6f, 0x20, 0x6e, 0x6f, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x6b, 0x65, 0x79, 0x73, 0x20, 0x63, 0x61, 
+	0x6e, 0x20, 0x62, 0x65, 0x20, 0x61, 0x64, 0x64, 0x65, 0x64, 0x2e, 0x20, 0x54, 0x72, 0x79, 0x69, 
+	0x6e, 0x67, 0x20, 0x74, 0x6f, 0x20, 0x61, 0x64, 0x64, 0x20, 0x61, 0x20, 0x6e, 0x65, 0x77, 0xa, 
+	0x9, 0x6b, 0x65, 0x79, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 
+	0x20, 0x69, 0x6e, 0x20, 0x61, 0x6e, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x2e, 0xa, 0x40, 0x45, 
+	0x4e, 0x44, 0x5d, 0x5d, 0x2d, 0x2d, 0xa, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 
+	0x54, 0x61, 0x62, 0x6c, 0x65, 0x4c, 0x6f, 0x63, 0x6b, 0x28, 0x74, 0x62, 0x6c, 0x29, 0xa, 0x9, 
+	0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x6d, 0x74, 0x20, 0x3d, 0x20, 0x67, 0x65, 0x74, 0x6d, 0x65, 
+	0x74, 0x61, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x28, 0x74, 0x62, 0x6c, 0x29, 0xa, 0x9, 0x69, 0x66, 
+	0x20, 0x6e, 0x6f, 0x74, 0x20, 0x6d, 0x74, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x20, 0x6d, 0x74, 0x20, 
+	0x3d, 0x20, 0x7b, 0x7d, 0x20, 0x65, 0x6e, 0x64, 0xa, 0x9, 0x6d, 0x74, 0x2e, 0x5f, 0x5f, 0x6e, 
+	0x65, 0x77, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x3d, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 
+	0x6f, 0x6e, 0x28, 0x74, 0x62, 0x6c, 0x2c, 0x20, 0x6b, 0x65, 0x79, 0x2c, 0x20, 0x76, 0x61, 0x6c, 
+	0x75, 0x65, 0x29, 0xa, 0x9, 0x9, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x28, 0x22, 0x74, 0x72, 0x79, 
+	0x69, 0x6e, 0x67, 0x20, 0x74, 0x6f, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x20, 0x6b, 0x65, 
+	0x79, 0x20, 0x27, 0x22, 0x20, 0x2e, 0x2e, 0x20, 0x6b, 0x65, 0x79, 0x20, 0x2e, 0x2e, 0x20, 0x22, 
+	0x27, 0x20, 0x6f, 0x6e, 0x20, 0x61, 0x20, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x64, 0x20, 0x74, 0x61, 
+	0x62, 0x6c, 0x65, 0x22, 0x29, 0xa, 0x9, 0x65, 0x6e, 0x64, 0xa, 0x9, 0x73, 0x65, 0x74, 0x6d, 
+	0x65, 0x74, 0x61, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x28, 0x74, 0x62, 0x6c, 0x2c, 0x20, 0x6d, 0x74, 
+	0x29, 0xa, 0x65, 0x6e, 0x64, 0xa, 0xa, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x55, 0x4e, 0x49, 0x54, 
+	0x54, 0x45, 0x53, 0x54, 0x53, 0xa, 0x9, 0x63, 0x61, 0x74, 0x63, 0x68, 0x3d, 0x22, 0x5b, 0x61, 
+	0x5d, 0x5b, 0x62, 0x5d, 0x22, 0x20, 0x3a, 0x20, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x54, 0x6f, 0x53, 
+	0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x7b, 0x22, 0x61, 0x22, 0x2c, 0x20, 0x22, 0x62, 0x22, 0x7d, 
+	0x2c, 0x20, 0x22, 0x5b, 0x22, 0x2c, 0x20, 0x22, 0x5d, 0x22, 0x29, 0xa, 0x40, 0x45, 0x4e, 0x44, 
+	0x5d, 0x5d, 0x2d, 0x2d, 0xa, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x46, 0x55, 0x4e, 0x43, 0x54, 0x49, 
+	0x4f, 0x4e, 0x20, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x54, 0x6f, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 
+	0x28, 0x74, 0x62, 0x6c, 0x2c, 0x20, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x2c, 0x20, 0x70, 0x6f, 
+	0x73, 0x74, 0x66, 0x69, 0x78, 0x29, 0xa, 0x9, 0x54, 0x61, 0x6b, 0x65, 0x73, 0x20, 0x65, 0x76, 
+	0x65, 0x72, 0x79, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x65, 
+	0x6e, 0x74, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x5e, 0x74, 0x62, 0x6c, 0x5e, 0x20, 
+	0x74, 0x61, 0x62, 0x6c, 0x65, 0x2c, 0x20, 0x70, 0x72, 0x65, 0x70, 0x65, 0x6e, 0x64, 0x73, 0x20, 
+	0x5e, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x5e, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x61, 0x70, 0x70, 
+	0x65, 0x6e, 0x64, 0x73, 0x20, 0x5e, 0x70, 0x6f, 0x73, 0x74, 0x66, 0x69, 0x78, 0x5e, 0xa, 0x9, 
+	0x74, 0x6f, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 
+	0x61, 0x6e, 0x64, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 
+	0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x2e, 0xa, 0x9, 0xa, 0x9, 0x7b, 0x7b, 0x7b, 0x7b, 0xa, 
+	0x9, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x54, 0x6f, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x7b, 
+	0x22, 0x61, 0x22, 0x2c, 0x20, 0x22, 0x62, 0x22, 0x7d, 0x2c, 0x20, 0x22, 0x5b, 0x22, 0x2c, 0x20, 
+	0x22, 0x5d, 0x22, 0x29, 0x20, 0x2d, 0x2d, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x20, 
+	0x22, 0x5b, 0x61, 0x5d, 0x5b, 0x62, 0x5d, 0x22, 0xa, 0x9, 0x7d, 0x7d, 0x7d, 0x7d, 0xa, 0x40, 
+	0x45, 0x4e, 0x44, 0x5d, 0x5d, 0x2d, 0x2d, 0xa, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x54, 0x6f, 0x53, 
+	0x74, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x3d, 0x20, 0x62, 0x61, 0x6d, 0x5f, 0x74, 0x61, 0x62, 0x6c, 
+	0x65, 0x5f, 0x74, 0x6f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0xa, 0xa, 0x2d, 0x2d, 0x5b, 0x5b, 
+	0x40, 0x55, 0x4e, 0x49, 0x54, 0x54, 0x45, 0x53, 0x54, 0x53, 0xa, 0x9, 0x65, 0x72, 0x72, 0x3d, 
+	0x30, 0x20, 0x3a, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x54, 0x61, 0x62, 
+	0x6c, 0x65, 0x57, 0x61, 0x6c, 0x6b, 0x28, 0x7b, 0x22, 0x22, 0x2c, 0x20, 0x7b, 0x22, 0x22, 0x2c, 
+	0x20, 0x7b, 0x22, 0x22, 0x7d, 0x2c, 0x20, 0x22, 0x22, 0x7d, 0x2c, 0x20, 0x22, 0x22, 0x2c, 0x20, 
+	0x7b, 0x7d, 0x2c, 0x20, 0x7b, 0x22, 0x22, 0x7d, 0x7d, 0x29, 0x20, 0x64, 0x6f, 0x20, 0x65, 0x6e, 
+	0x64, 0xa, 0x9, 0x65, 0x72, 0x72, 0x3d, 0x31, 0x20, 0x3a, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x73, 
+	0x20, 0x69, 0x6e, 0x20, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x57, 0x61, 0x6c, 0x6b, 0x28, 0x7b, 0x22, 
+	0x22, 0x2c, 0x20, 0x7b, 0x22, 0x22, 0x2c, 0x20, 0x7b, 0x22, 0x22, 0x2c, 0x20, 0x31, 0x7d, 0x2c, 
+	0x20, 0x22, 0x22, 0x7d, 0x2c, 0x20, 0x7b, 0x22, 0x22, 0x7d, 0x7d, 0x29, 0x20, 0x64, 0x6f, 0x20, 
+	0x65, 0x6e, 0x64, 0xa, 0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 0x2d, 0x2d, 0xa, 0x2d, 0x2d, 0x5b, 
+	0x5b, 0x40, 0x46, 0x55, 0x4e, 0x43, 0x54, 0x49, 0x4f, 0x4e, 0x20, 0x54, 0x61, 0x62, 0x6c, 0x65, 
+	0x57, 0x61, 0x6c, 0x6b, 0x28, 0x74, 0x62, 0x6c, 0x29, 0xa, 0x9, 0x52, 0x65, 0x74, 0x75, 0x72, 
+	0x6e, 0x73, 0x20, 0x61, 0x6e, 0x20, 0x69, 0x74, 0x65, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x20, 0x74, 
+	0x68, 0x61, 0x74, 0x20, 0x64, 0x6f, 0x65, 0x73, 0x20, 0x61, 0x20, 0x64, 0x65, 0x65, 0x70, 0x20, 
+	0x77, 0x61, 0x6c, 0x6b, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 
+	0x6c, 0x6f, 0x6f, 0x6b, 0x69, 0x6e, 0x67, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x73, 0x74, 0x72, 0x69, 
+	0x6e, 0x67, 0x73, 0x2e, 0xa, 0x9, 0x4f, 0x6e, 0x6c, 0x79, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 
+	0x73, 0x20, 0x6e, 0x75, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x20, 0x6b, 0x65, 0x79, 0x73, 0x20, 0x61, 
+	0x6e, 0x64, 0x20, 0x61, 0x6e, 0x79, 0x74, 0x68, 0x69, 0x6e, 0x67, 0x20, 0x65, 0x6c, 0x73, 0x65, 
+	0x20, 0x74, 0x68, 0x65, 0x6e, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 
+	0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x73, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0xa, 0x9, 0x63, 0x61, 
+	0x75, 0x73, 0x65, 0x20, 0x61, 0x6e, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x2e, 0xa, 0xa, 0x9, 
+	0x7b, 0x7b, 0x7b, 0x7b, 0xa, 0x9, 0x66, 0x6f, 0x72, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x6e, 0x61, 
+	0x6d, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x57, 0x61, 0x6c, 0x6b, 0x28, 
+	0x7b, 0x2e, 0x2e, 0x2e, 0x7d, 0x29, 0x20, 0x64, 0x6f, 0xa, 0x9, 0x9, 0x70, 0x72, 0x69, 0x6e, 
+	0x74, 0x28, 0x66, 0x69, 0x6c, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x29, 0xa, 0x9, 0x65, 0x6e, 0x64, 
+	0xa, 0x9, 0x7d, 0x7d, 0x7d, 0x7d, 0xa, 0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 0x2d, 0x2d, 0xa, 
+	0x54, 0x61, 0x62, 0x6c, 0x65, 0x57, 0x61, 0x6c, 0x6b, 0x20, 0x3d, 0x20, 0x62, 0x61, 0x6d, 0x5f, 
+	0x74, 0x61, 0x62, 0x6c, 0x65, 0x5f, 0x77, 0x61, 0x6c, 0x6b, 0xa, 0xa, 0x2d, 0x2d, 0x5b, 0x5b, 
+	0x40, 0x47, 0x52, 0x4f, 0x55, 0x50, 0x20, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x20, 
+	0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 0x2d, 0x2d, 0xa, 0xa, 0x5f, 0x62, 0x61, 0x6d, 0x5f, 0x74, 
+	0x6f, 0x6f, 0x6c, 0x73, 0x20, 0x3d, 0x20, 0x7b, 0x7d, 0xa, 0xa, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 
+	0x55, 0x4e, 0x49, 0x54, 0x54, 0x45, 0x53, 0x54, 0x53, 0xa, 0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 
+	0x2d, 0x2d, 0xa, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x46, 0x55, 0x4e, 0x43, 0x54, 0x49, 0x4f, 0x4e, 
+	0xa, 0x9, 0x41, 0x64, 0x64, 0x73, 0x20, 0x61, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x74, 0x6f, 0x6f, 
+	0x6c, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x65, 0x64, 0x20, 0x5e, 0x6e, 0x61, 0x6d, 0x65, 0x5e, 0x20, 
+	0x74, 0x6f, 0x20, 0x62, 0x61, 0x6d, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x5e, 0x66, 0x75, 0x6e, 
+	0x63, 0x5e, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x62, 0x65, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x65, 
+	0x64, 0xa, 0x9, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x5e, 0x4e, 0x65, 0x77, 0x53, 0x65, 0x74, 0x74, 
+	0x69, 0x6e, 0x67, 0x73, 0x5e, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x69, 
+	0x73, 0x20, 0x69, 0x6e, 0x76, 0x6f, 0x6b, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 
+	0x68, 0x65, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x20, 0x6f, 0x62, 0x6a, 0x65, 
+	0x63, 0x74, 0x20, 0x61, 0x73, 0xa, 0x9, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x70, 0x61, 0x72, 
+	0x61, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x2e, 0xa, 0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 0x2d, 0x2d, 
+	0xa, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x41, 0x64, 0x64, 0x54, 0x6f, 0x6f, 
+	0x6c, 0x28, 0x66, 0x75, 0x6e, 0x63, 0x29, 0xa, 0x9, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x2e, 0x69, 
+	0x6e, 0x73, 0x65, 0x72, 0x74, 0x28, 0x5f, 0x62, 0x61, 0x6d, 0x5f, 0x74, 0x6f, 0x6f, 0x6c, 0x73, 
+	0x2c, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x29, 0xa, 0x65, 0x6e, 0x64, 0xa, 0xa, 0x2d, 0x2d, 0x5b, 
+	0x5b, 0x40, 0x55, 0x4e, 0x49, 0x54, 0x54, 0x45, 0x53, 0x54, 0x53, 0xa, 0x9, 0x65, 0x72, 0x72, 
+	0x3d, 0x31, 0x3b, 0x20, 0x66, 0x69, 0x6e, 0x64, 0x3d, 0x22, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 
+	0x65, 0x64, 0x20, 0x61, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x20, 0x6f, 0x62, 
+	0x6a, 0x65, 0x63, 0x74, 0x22, 0x3a, 0x20, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x53, 0x65, 0x74, 0x74, 
+	0x69, 0x6e, 0x67, 0x73, 0x28, 0x6e, 0x69, 0x6c, 0x29, 0xa, 0x9, 0x65, 0x72, 0x72, 0x3d, 0x31, 
+	0x3b, 0x20, 0x66, 0x69, 0x6e, 0x64, 0x3d, 0x22, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 
+	0x20, 0x61, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x20, 0x6f, 0x62, 0x6a, 0x65, 
+	0x63, 0x74, 0x22, 0x3a, 0x20, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6e, 
+	0x67, 0x73, 0x28, 0x22, 0x22, 0x29, 0xa, 0x9, 0x65, 0x72, 0x72, 0x3d, 0x31, 0x3b, 0x20, 0x66, 
+	0x69, 0x6e, 0x64, 0x3d, 0x22, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x61, 0x20, 
+	0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x20, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x22, 
+	0x3a, 0x20, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x28, 
+	0x7b, 0x7d, 0x29, 0xa, 0x9, 0x65, 0x72, 0x72, 0x3d, 0x30, 0x20, 0x3a, 0x20, 0x43, 0x68, 0x65, 
+	0x63, 0x6b, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x28, 0x4e, 0x65, 0x77, 0x53, 0x65, 
+	0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x28, 0x29, 0x29, 0xa, 0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 
+	0x2d, 0x2d, 0xa, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x43, 0x68, 0x65, 0x63, 
+	0x6b, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 
+	0x67, 0x73, 0x29, 0xa, 0x9, 0x69, 0x66, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x49, 0x73, 0x54, 0x61, 
+	0x62, 0x6c, 0x65, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x29, 0x20, 0x6f, 0x72, 
+	0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x5f, 0x69, 0x73, 0x5f, 0x73, 0x65, 
+	0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x20, 0x3d, 0x3d, 0x20, 
+	0x6e, 0x69, 0x6c, 0x20, 0x74, 0x68, 0x65, 0x6e, 0xa, 0x9, 0x9, 0x65, 0x72, 0x72, 0x6f, 0x72, 
+	0x28, 0x22, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x61, 0x20, 0x73, 0x65, 0x74, 
+	0x74, 0x69, 0x6e, 0x67, 0x73, 0x20, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x2c, 0x20, 0x67, 0x6f, 
+	0x74, 0x20, 0x61, 0x6e, 0x20, 0x22, 0x20, 0x2e, 0x2e, 0x20, 0x74, 0x79, 0x70, 0x65, 0x28, 0x73, 
+	0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x29, 0x20, 0x2e, 0x2e, 0x20, 0x22, 0x20, 0x69, 0x6e, 
+	0x73, 0x74, 0x65, 0x61, 0x64, 0x22, 0x29, 0xa, 0x9, 0x65, 0x6e, 0x64, 0xa, 0x65, 0x6e, 0x64, 
+	0xa, 0xa, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x55, 0x4e, 0x49, 0x54, 0x54, 0x45, 0x53, 0x54, 0x53, 
+	0xa, 0x9, 0x65, 0x72, 0x72, 0x3d, 0x30, 0x20, 0x3a, 0x20, 0x4e, 0x65, 0x77, 0x53, 0x65, 0x74, 
+	0x74, 0x69, 0x6e, 0x67, 0x73, 0x28, 0x29, 0xa, 0x9, 0x65, 0x72, 0x72, 0x3d, 0x31, 0x20, 0x3a, 
+	0x20, 0x74, 0x20, 0x3d, 0x20, 0x4e, 0x65, 0x77, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 
+	0x28, 0x29, 0x3b, 0x20, 0x74, 0x2e, 0x63, 0x63, 0x2e, 0x44, 0x4f, 0x45, 0x53, 0x5f, 0x4e, 0x4f, 
+	0x54, 0x5f, 0x45, 0x58, 0x49, 0x53, 0x54, 0x20, 0x3d, 0x20, 0x31, 0xa, 0x9, 0x65, 0x72, 0x72, 
+	0x3d, 0x31, 0x20, 0x3a, 0x20, 0x74, 0x20, 0x3d, 0x20, 0x4e, 0x65, 0x77, 0x53, 0x65, 0x74, 0x74, 
+	0x69, 0x6e, 0x67, 0x73, 0x28, 0x29, 0x3a, 0x43, 0x6f, 0x70, 0x79, 0x28, 0x29, 0x3b, 0x20, 0x74, 
+	0x2e, 0x63, 0x63, 0x2e, 0x44, 0x4f, 0x45, 0x53, 0x5f, 0x4e, 0x4f, 0x54, 0x5f, 0x45, 0x58, 0x49, 
+	0x53, 0x54, 0x20, 0x3d, 0x20, 0x31, 0xa, 0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 0x2d, 0x2d, 0xa, 
+	0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x46, 0x55, 0x4e, 0x43, 0x54, 0x49, 0x4f, 0x4e, 0xa, 0x9, 0x43, 
+	0x72, 0x65, 0x61, 0x74, 0x65, 0x20, 0x61, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x73, 0x65, 0x74, 0x74, 
+	0x69, 0x6e, 0x67, 0x73, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 
+	0x74, 0x68, 0x65, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x20, 0x66, 0x6f, 0x72, 
+	0x20, 0x61, 0x6c, 0x6c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x67, 0x69, 0x73, 0x74, 0x65, 
+	0x72, 0x65, 0x64, 0xa, 0x9, 0x74, 0x6f, 0x6f, 0x6c, 0x73, 0x2e, 0x20, 0x54, 0x68, 0x69, 0x73, 
+	0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x69, 0x73, 0x20, 0x70, 0x61, 0x73, 0x73, 0x65, 0x64, 
+	0x20, 0x74, 0x6f, 0x20, 0x6d, 0x61, 0x6e, 0x79, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 
+	0x74, 0x6f, 0x6f, 0x6c, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 
+	0x6e, 0x73, 0x20, 0x68, 0x6f, 0x77, 0xa, 0x9, 0x74, 0x68, 0x65, 0x79, 0x20, 0x73, 0x68, 0x6f, 
+	0x75, 0x6c, 0x64, 0x20, 0x61, 0x63, 0x74, 0x2e, 0xa, 0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 0x2d, 
+	0x2d, 0xa, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x4e, 0x65, 0x77, 0x53, 0x65, 
+	0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x28, 0x29, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 
+	0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x20, 0x3d, 0x20, 0x7b, 0x7d, 0xa, 0x9, 0xa, 
+	0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x5f, 0x69, 0x73, 0x5f, 0x73, 0x65, 
+	0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x20, 0x3d, 0x20, 0x74, 
+	0x72, 0x75, 0x65, 0xa, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x69, 0x6e, 
+	0x76, 0x6f, 0x6b, 0x65, 0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x3d, 0x20, 0x30, 0xa, 0x9, 
+	0xa, 0x9, 0x53, 0x65, 0x74, 0x43, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x53, 0x65, 0x74, 0x74, 0x69, 
+	0x6e, 0x67, 0x73, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x29, 0xa, 0x9, 0xa, 
+	0x9, 0x2d, 0x2d, 0x20, 0x61, 0x64, 0x64, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x74, 0x6f, 0x6f, 0x6c, 
+	0x73, 0xa, 0x9, 0x66, 0x6f, 0x72, 0x20, 0x5f, 0x2c, 0x20, 0x74, 0x6f, 0x6f, 0x6c, 0x20, 0x69, 
+	0x6e, 0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 0x28, 0x5f, 0x62, 0x61, 0x6d, 0x5f, 0x74, 0x6f, 0x6f, 
+	0x6c, 0x73, 0x29, 0x20, 0x64, 0x6f, 0xa, 0x9, 0x9, 0x74, 0x6f, 0x6f, 0x6c, 0x28, 0x73, 0x65, 
+	0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x29, 0xa, 0x9, 0x65, 0x6e, 0x64, 0xa, 0x9, 0xa, 0x9, 
+	0x2d, 0x2d, 0x20, 0x48, 0x41, 0x43, 0x4b, 0x3a, 0x20, 0x73, 0x65, 0x74, 0x75, 0x70, 0x20, 0x64, 
+	0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x72, 0x73, 0xa, 0x9, 
+	0x53, 0x65, 0x74, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 
+	0x73, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x29, 0xa, 0xa, 0x9, 0x2d, 0x2d, 
+	0x20, 0x6c, 0x6f, 0x63, 0x6b, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 
+	0x61, 0x6e, 0x64, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0xa, 0x9, 0x54, 0x61, 0x62, 0x6c, 
+	0x65, 0x4c, 0x6f, 0x63, 0x6b, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x29, 0x9, 
+	0xa, 0x9, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 
+	0x73, 0xa, 0x65, 0x6e, 0x64, 0xa, 0xa, 0xa, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x47, 0x52, 0x4f, 
+	0x55, 0x50, 0x20, 0x46, 0x69, 0x6c, 0x65, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x44, 0x69, 0x72, 
+	0x65, 0x63, 0x74, 0x6f, 0x72, 0x69, 0x65, 0x73, 0x20, 0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 0x2d, 
+	0x2d, 0xa, 0xa, 0x2d, 0x2d, 0x20, 0x43, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x73, 0x20, 0x66, 
+	0x69, 0x6c, 0x65, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x61, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 
+	0x6f, 0x72, 0x79, 0x2e, 0xa, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x46, 0x55, 0x4e, 0x43, 0x54, 0x49, 
+	0x4f, 0x4e, 0x20, 0x43, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x28, 0x2e, 0x2e, 0x2e, 0x29, 0xa, 
+	0x9, 0x47, 0x61, 0x74, 0x68, 0x65, 0x72, 0x73, 0x20, 0x61, 0x20, 0x73, 0x65, 0x74, 0x20, 0x6f, 
+	0x66, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x20, 0x75, 0x73, 0x69, 0x6e, 0x67, 0x20, 0x77, 0x69, 
+	0x6c, 0x64, 0x63, 0x61, 0x72, 0x64, 0x2e, 0x20, 0x41, 0x63, 0x63, 0x65, 0x70, 0x74, 0x73, 0x20, 
+	0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x61, 0x62, 0x6c, 
+	0x65, 0x73, 0xa, 0x9, 0x6f, 0x66, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x73, 0x20, 0x61, 
+	0x73, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x72, 0x65, 0x74, 0x75, 
+	0x72, 0x6e, 0x73, 0x20, 0x61, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x61, 
+	0x6c, 0x6c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x20, 0x74, 0x68, 0x61, 
+	0x74, 0xa, 0x9, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x65, 0x73, 0x20, 0x41, 0x20, 0x73, 0x69, 0x6e, 
+	0x67, 0x6c, 0x65, 0x20, 0x77, 0x69, 0x6c, 0x64, 0x63, 0x61, 0x72, 0x64, 0x20, 0x2a, 0x20, 0x6d, 
+	0x61, 0x79, 0x20, 0x62, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x65, 0x61, 
+	0x63, 0x68, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x6f, 0x20, 0x63, 0x6f, 0x6c, 
+	0x6c, 0x65, 0x63, 0x74, 0xa, 0x9, 0x61, 0x20, 0x73, 0x65, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x66, 
+	0x69, 0x6c, 0x65, 0x73, 0x2e, 0xa, 0x9, 0xa, 0x9, 0x45, 0x78, 0x61, 0x6d, 0x70, 0x6c, 0x65, 
+	0x3a, 0xa, 0x9, 0x7b, 0x7b, 0x7b, 0x7b, 0xa, 0x9, 0x9, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 
+	0x5f, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x20, 0x3d, 0x20, 0x43, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 
+	0x28, 0x22, 0x73, 0x72, 0x63, 0x2f, 0x2a, 0x2e, 0x63, 0x22, 0x2c, 0x20, 0x22, 0x6c, 0x69, 0x62, 
+	0x2f, 0x2a, 0x2e, 0x63, 0x22, 0x29, 0xa, 0x9, 0x7d, 0x7d, 0x7d, 0x7d, 0xa, 0x9, 0xa, 0x9, 
+	0x4e, 0x6f, 0x74, 0x65, 0x2e, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 
+	0x6f, 0x6e, 0x20, 0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x73, 0x20, 0x66, 0x69, 0x6c, 0x65, 
+	0x73, 0x2c, 0x20, 0x6e, 0x6f, 0x6e, 0x2d, 0x72, 0x65, 0x63, 0x75, 0x72, 0x73, 0x69, 0x76, 0x65, 
+	0x2e, 0xa, 0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 0x2d, 0x2d, 0xa, 0x43, 0x6f, 0x6c, 0x6c, 0x65, 
+	0x63, 0x74, 0x20, 0x3d, 0x20, 0x62, 0x61, 0x6d, 0x5f, 0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 
+	0xa, 0xa, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x46, 0x55, 0x4e, 0x43, 0x54, 0x49, 0x4f, 0x4e, 0x20, 
+	0x43, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x52, 0x65, 0x63, 0x75, 0x72, 0x73, 0x69, 0x76, 0x65, 
+	0x28, 0x2e, 0x2e, 0x2e, 0x29, 0xa, 0x9, 0x43, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x73, 0x20, 
+	0x66, 0x69, 0x6c, 0x65, 0x73, 0x20, 0x61, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x5b, 0x43, 0x6f, 
+	0x6c, 0x6c, 0x65, 0x63, 0x74, 0x5d, 0x20, 0x62, 0x75, 0x74, 0x20, 0x64, 0x6f, 0x65, 0x73, 0x20, 
+	0x73, 0x6f, 0x20, 0x72, 0x65, 0x63, 0x75, 0x72, 0x73, 0x69, 0x76, 0x6c, 0x79, 0x2e, 0xa, 0x40, 
+	0x45, 0x4e, 0x44, 0x5d, 0x5d, 0x2d, 0x2d, 0xa, 0x43, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x52, 
+	0x65, 0x63, 0x75, 0x72, 0x73, 0x69, 0x76, 0x65, 0x20, 0x3d, 0x20, 0x62, 0x61, 0x6d, 0x5f, 0x63, 
+	0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x72, 0x65, 0x63, 0x75, 0x72, 0x73, 0x69, 0x76, 0x65, 0xa, 
+	0xa, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x46, 0x55, 0x4e, 0x43, 0x54, 0x49, 0x4f, 0x4e, 0x20, 0x43, 
+	0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x44, 0x69, 0x72, 0x73, 0x28, 0x2e, 0x2e, 0x2e, 0x29, 0xa, 
+	0x9, 0x43, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x73, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 
+	0x6f, 0x72, 0x69, 0x65, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6d, 
+	0x65, 0x20, 0x66, 0x61, 0x73, 0x68, 0x69, 0x6f, 0x6e, 0x20, 0x61, 0x73, 0x20, 0x5b, 0x43, 0x6f, 
+	0x6c, 0x6c, 0x65, 0x63, 0x74, 0x5d, 0x20, 0x62, 0x75, 0x74, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 
+	0x6e, 0x73, 0xa, 0x9, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x69, 0x65, 0x73, 0x20, 
+	0x69, 0x6e, 0x73, 0x74, 0x65, 0x61, 0x64, 0x2e, 0xa, 0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 0x2d, 
+	0x2d, 0xa, 0x43, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x44, 0x69, 0x72, 0x73, 0x20, 0x3d, 0x20, 
+	0x62, 0x61, 0x6d, 0x5f, 0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x64, 0x69, 0x72, 0x73, 0xa, 
+	0xa, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x46, 0x55, 0x4e, 0x43, 0x54, 0x49, 0x4f, 0x4e, 0x20, 0x43, 
+	0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x44, 0x69, 0x72, 0x73, 0x52, 0x65, 0x63, 0x75, 0x72, 0x73, 
+	0x69, 0x76, 0x65, 0x28, 0x2e, 0x2e, 0x2e, 0x29, 0xa, 0x9, 0x43, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 
+	0x74, 0x73, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x69, 0x65, 0x73, 0x20, 0x69, 
+	0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6d, 0x65, 0x20, 0x66, 0x61, 0x73, 0x68, 0x69, 
+	0x6f, 0x6e, 0x20, 0x61, 0x73, 0x20, 0x5b, 0x43, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x5d, 0x20, 
+	0x62, 0x75, 0x74, 0x20, 0x64, 0x6f, 0x65, 0x73, 0x20, 0x73, 0x6f, 0xa, 0x9, 0x72, 0x65, 0x63, 
+	0x75, 0x72, 0x73, 0x69, 0x76, 0x6c, 0x79, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x72, 0x65, 0x74, 0x75, 
+	0x72, 0x6e, 0x73, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x69, 0x65, 0x73, 0x20, 
+	0x69, 0x6e, 0x73, 0x74, 0x65, 0x61, 0x64, 0x2e, 0xa, 0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 0x2d, 
+	0x2d, 0xa, 0x43, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x44, 0x69, 0x72, 0x73, 0x52, 0x65, 0x63, 
+	0x75, 0x72, 0x73, 0x69, 0x76, 0x65, 0x20, 0x3d, 0x20, 0x62, 0x61, 0x6d, 0x5f, 0x63, 0x6f, 0x6c, 
+	0x6c, 0x65, 0x63, 0x74, 0x64, 0x69, 0x72, 0x73, 0x72, 0x65, 0x63, 0x75, 0x72, 0x73, 0x69, 0x76, 
+	0x65, 0xa, 0xa, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x46, 0x55, 0x4e, 0x43, 0x54, 0x49, 0x4f, 0x4e, 
+	0x20, 0x4d, 0x61, 0x6b, 0x65, 0x44, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x79, 0x28, 0x70, 
+	0x61, 0x74, 0x68, 0x29, 0xa, 0x9, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x73, 0x20, 0x74, 0x68, 
+	0x65, 0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x65, 0x64, 0x20, 0x64, 0x69, 0x72, 0x65, 
+	0x63, 0x74, 0x6f, 0x72, 0x79, 0x2e, 0xa, 0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 0x2d, 0x2d, 0xa, 
+	0x4d, 0x61, 0x6b, 0x65, 0x44, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x79, 0x20, 0x3d, 0x20, 
+	0x62, 0x61, 0x6d, 0x5f, 0x6d, 0x6b, 0x64, 0x69, 0x72, 0xa, 0xa, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 
+	0x46, 0x55, 0x4e, 0x43, 0x54, 0x49, 0x4f, 0x4e, 0x20, 0x4d, 0x61, 0x6b, 0x65, 0x44, 0x69, 0x72, 
+	0x65, 0x63, 0x74, 0x6f, 0x72, 0x69, 0x65, 0x73, 0x28, 0x66, 0x69, 0x6c, 0x65, 0x6e, 0x61, 0x6d, 
+	0x65, 0x29, 0xa, 0x9, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 
+	0x70, 0x61, 0x74, 0x68, 0x20, 0x75, 0x70, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 
+	0x6c, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x2e, 0xa, 0xa, 0x9, 0x45, 0x78, 0x61, 0x6d, 0x70, 0x6c, 
+	0x65, 0x3a, 0xa, 0x9, 0x7b, 0x7b, 0x7b, 0x7b, 0xa, 0x9, 0x9, 0x4d, 0x61, 0x6b, 0x65, 0x44, 
+	0x69, 0x72, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x69, 0x65, 0x73, 0x28, 0x22, 0x6f, 0x75, 0x74, 0x70, 
+	0x75, 0x74, 0x2f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x79, 0x2f, 0x6f, 0x62, 0x6a, 
+	0x65, 0x63, 0x74, 0x2e, 0x6f, 0x22, 0x29, 0xa, 0x9, 0x7d, 0x7d, 0x7d, 0x7d, 0xa, 0xa, 0x9, 
+	0x54, 0x68, 0x69, 0x73, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x6c, 0x65, 0x74, 0x65, 0x20, 0x22, 0x6f, 
+	0x75, 0x74, 0x70, 0x75, 0x74, 0x2f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x79, 0x22, 
+	0x20, 0x70, 0x61, 0x74, 0x68, 0x2e, 0xa, 0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 0x2d, 0x2d, 0xa, 
+	0x4d, 0x61, 0x6b, 0x65, 0x44, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x69, 0x65, 0x73, 0x20, 
+	0x3d, 0x20, 0x62, 0x61, 0x6d, 0x5f, 0x6d, 0x6b, 0x64, 0x69, 0x72, 0x73, 0xa, 0xa, 0x2d, 0x2d, 
+	0x5b, 0x5b, 0x40, 0x47, 0x52, 0x4f, 0x55, 0x50, 0x20, 0x54, 0x61, 0x72, 0x67, 0x65, 0x74, 0x73, 
+	0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 0x2d, 0x2d, 0xa, 0xa, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x46, 
+	0x55, 0x4e, 0x43, 0x54, 0x49, 0x4f, 0x4e, 0x20, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x54, 
+	0x61, 0x72, 0x67, 0x65, 0x74, 0x28, 0x66, 0x69, 0x6c, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x29, 0xa, 
+	0x9, 0x53, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 
+	0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x20, 0x75, 0x73, 
+	0x65, 0x20, 0x62, 0x75, 0x69, 0x6c, 0x64, 0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x6e, 0x6f, 0x20, 
+	0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x73, 0x20, 0x61, 0x72, 0x65, 0xa, 0x9, 0x73, 0x70, 0x65, 
+	0x63, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x62, 0x61, 0x6d, 0x20, 
+	0x69, 0x73, 0x20, 0x69, 0x6e, 0x76, 0x6f, 0x6b, 0x65, 0x64, 0x2e, 0xa, 0x40, 0x45, 0x4e, 0x44, 
+	0x5d, 0x5d, 0x2d, 0x2d, 0xa, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x54, 0x61, 0x72, 0x67, 
+	0x65, 0x74, 0x20, 0x3d, 0x20, 0x62, 0x61, 0x6d, 0x5f, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 
+	0x5f, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0xa, 0xa, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x46, 0x55, 
+	0x4e, 0x43, 0x54, 0x49, 0x4f, 0x4e, 0xa, 0x9, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x73, 0x20, 
+	0x61, 0x20, 0x70, 0x73, 0x65, 0x75, 0x64, 0x6f, 0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x20, 
+	0x6e, 0x61, 0x6d, 0x65, 0x64, 0x20, 0x5e, 0x6e, 0x61, 0x6d, 0x65, 0x5e, 0x20, 0x61, 0x6e, 0x64, 
+	0x20, 0x61, 0x73, 0x73, 0x69, 0x67, 0x6e, 0x73, 0x20, 0x61, 0x20, 0x73, 0x65, 0x74, 0x20, 0x6f, 
+	0x66, 0x20, 0x64, 0x65, 0x70, 0x65, 0x6e, 0x64, 0x65, 0x6e, 0x63, 0x69, 0x65, 0x73, 0xa, 0x9, 
+	0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x5e, 0x2e, 0x2e, 
+	0x2e, 0x5e, 0x2e, 0xa, 0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 0x2d, 0x2d, 0xa, 0x66, 0x75, 0x6e, 
+	0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x50, 0x73, 0x65, 0x75, 0x64, 0x6f, 0x54, 0x61, 0x72, 0x67, 
+	0x65, 0x74, 0x28, 0x6e, 0x61, 0x6d, 0x65, 0x2c, 0x20, 0x2e, 0x2e, 0x2e, 0x29, 0xa, 0x9, 0x6c, 
+	0x6f, 0x63, 0x61, 0x6c, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x3d, 0x20, 0x50, 0x61, 0x74, 0x68, 
+	0x28, 0x6e, 0x61, 0x6d, 0x65, 0x29, 0xa, 0x9, 0x62, 0x61, 0x6d, 0x5f, 0x61, 0x64, 0x64, 0x5f, 
+	0x70, 0x73, 0x65, 0x75, 0x64, 0x6f, 0x28, 0x6e, 0x61, 0x6d, 0x65, 0x29, 0xa, 0x9, 0xa, 0x9, 
+	0x2d, 0x2d, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x73, 
+	0xa, 0x9, 0x66, 0x6f, 0x72, 0x20, 0x69, 0x6e, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x69, 0x6e, 0x20, 
+	0x54, 0x61, 0x62, 0x6c, 0x65, 0x57, 0x61, 0x6c, 0x6b, 0x28, 0x7b, 0x2e, 0x2e, 0x2e, 0x7d, 0x29, 
+	0x20, 0x64, 0x6f, 0xa, 0x9, 0x9, 0x41, 0x64, 0x64, 0x44, 0x65, 0x70, 0x65, 0x6e, 0x64, 0x65, 
+	0x6e, 0x63, 0x79, 0x28, 0x6e, 0x61, 0x6d, 0x65, 0x2c, 0x20, 0x69, 0x6e, 0x6e, 0x61, 0x6d, 0x65, 
+	0x29, 0xa, 0x9, 0x65, 0x6e, 0x64, 0xa, 0xa, 0x9, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 
+	0x6e, 0x61, 0x6d, 0x65, 0xa, 0x65, 0x6e, 0x64, 0xa, 0xa, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x47, 
+	0x52, 0x4f, 0x55, 0x50, 0x20, 0x4d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x73, 0x40, 0x45, 0x4e, 0x44, 
+	0x5d, 0x5d, 0x2d, 0x2d, 0xa, 0xa, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x46, 0x55, 0x4e, 0x43, 0x54, 
+	0x49, 0x4f, 0x4e, 0x20, 0x49, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x28, 0x66, 0x69, 0x6c, 0x65, 0x6e, 
+	0x61, 0x6d, 0x65, 0x29, 0xa, 0x9, 0x49, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x73, 0x20, 0x61, 0x20, 
+	0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 0x64, 
+	0x20, 0x62, 0x79, 0x20, 0x5e, 0x66, 0x69, 0x6c, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x5e, 0x2e, 0x20, 
+	0x41, 0x20, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 0x68, 0x65, 
+	0x20, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x62, 0x65, 0xa, 
+	0x9, 0x64, 0x6f, 0x6e, 0x65, 0x20, 0x62, 0x79, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x63, 
+	0x68, 0x65, 0x63, 0x6b, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x75, 0x72, 0x72, 
+	0x65, 0x6e, 0x74, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x79, 0x20, 0x61, 0x6e, 
+	0x64, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x74, 0x68, 0x73, 
+	0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 0x64, 0xa, 0x9, 0x62, 0x79, 0x20, 0x74, 
+	0x68, 0x65, 0x20, 0x42, 0x41, 0x4d, 0x5f, 0x50, 0x41, 0x43, 0x4b, 0x41, 0x47, 0x45, 0x53, 0x20, 
+	0x65, 0x6e, 0x76, 0x69, 0x72, 0x6f, 0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x76, 0x61, 0x72, 0x69, 
+	0x61, 0x62, 0x6c, 0x65, 0x2e, 0x20, 0x53, 0x65, 0x76, 0x65, 0x72, 0x61, 0x6c, 0x20, 0x70, 0x61, 
+	0x74, 0x68, 0x73, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x62, 0x65, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 
+	0x66, 0x69, 0x65, 0x64, 0xa, 0x9, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x72, 
+	0x69, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x62, 0x79, 0x20, 0x73, 0x65, 0x70, 0x61, 0x72, 0x61, 0x74, 
+	0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x6d, 0x20, 0x62, 0x79, 0x20, 0x61, 0x20, 0x27, 0x3a, 
+	0x27, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x2e, 0xa, 0xa, 0x9, 0x54, 
+	0x68, 0x65, 0x20, 0x69, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x73, 0x63, 0x72, 
+	0x69, 0x70, 0x74, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x66, 0x69, 0x67, 0x75, 0x72, 0x65, 0x20, 0x6f, 
+	0x75, 0x74, 0x20, 0x69, 0x74, 0x27, 0x73, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x62, 0x79, 0x20, 
+	0x63, 0x61, 0x6c, 0x6c, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0xa, 0x9, 0x5b, 0x4d, 0x6f, 
+	0x64, 0x75, 0x6c, 0x65, 0x46, 0x69, 0x6c, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x5d, 0x20, 0x66, 0x75, 
+	0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0xa, 0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 0x2d, 0x2d, 
+	0xa, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x49, 0x6d, 0x70, 0x6f, 0x72, 0x74, 
+	0x28, 0x66, 0x69, 0x6c, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x29, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 
+	0x6c, 0x20, 0x70, 0x61, 0x74, 0x68, 0x73, 0x20, 0x3d, 0x20, 0x7b, 0x22, 0x22, 0x2c, 0x20, 0x50, 
+	0x61, 0x74, 0x68, 0x44, 0x69, 0x72, 0x28, 0x4d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x46, 0x69, 0x6c, 
+	0x65, 0x6e, 0x61, 0x6d, 0x65, 0x28, 0x29, 0x29, 0x7d, 0xa, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 
+	0x6c, 0x20, 0x73, 0x20, 0x3d, 0x20, 0x6f, 0x73, 0x2e, 0x67, 0x65, 0x74, 0x65, 0x6e, 0x76, 0x28, 
+	0x22, 0x42, 0x41, 0x4d, 0x5f, 0x50, 0x41, 0x43, 0x4b, 0x41, 0x47, 0x45, 0x53, 0x22, 0x29, 0xa, 
+	0x9, 0x69, 0x66, 0x20, 0x73, 0x20, 0x74, 0x68, 0x65, 0x6e, 0xa, 0x9, 0x9, 0x66, 0x6f, 0x72, 
+	0x20, 0x77, 0x20, 0x69, 0x6e, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x2e, 0x67, 0x6d, 0x61, 
+	0x74, 0x63, 0x68, 0x28, 0x73, 0x2c, 0x20, 0x22, 0x5b, 0x5e, 0x3a, 0x5d, 0x2a, 0x22, 0x29, 0x20, 
+	0x64, 0x6f, 0xa, 0x9, 0x9, 0x9, 0x69, 0x66, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x2e, 
+	0x6c, 0x65, 0x6e, 0x28, 0x77, 0x29, 0x20, 0x3e, 0x20, 0x30, 0x20, 0x74, 0x68, 0x65, 0x6e, 0xa, 
+	0x9, 0x9, 0x9, 0x9, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x2e, 0x69, 0x6e, 0x73, 0x65, 0x72, 0x74, 
+	0x28, 0x70, 0x61, 0x74, 0x68, 0x73, 0x2c, 0x20, 0x77, 0x29, 0xa, 0x9, 0x9, 0x9, 0x65, 0x6e, 
+	0x64, 0xa, 0x9, 0x9, 0x65, 0x6e, 0x64, 0xa, 0x9, 0x65, 0x6e, 0x64, 0xa, 0x9, 0xa, 0x9, 
+	0x66, 0x6f, 0x72, 0x20, 0x5f, 0x2c, 0x70, 0x61, 0x74, 0x68, 0x20, 0x69, 0x6e, 0x20, 0x70, 0x61, 
+	0x69, 0x72, 0x73, 0x28, 0x70, 0x61, 0x74, 0x68, 0x73, 0x29, 0x20, 0x64, 0x6f, 0xa, 0x9, 0x9, 
+	0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x70, 0x61, 0x74, 0x68, 0x20, 0x3d, 
+	0x20, 0x50, 0x61, 0x74, 0x68, 0x4a, 0x6f, 0x69, 0x6e, 0x28, 0x70, 0x61, 0x74, 0x68, 0x2c, 0x20, 
+	0x66, 0x69, 0x6c, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x29, 0xa, 0x9, 0x9, 0x69, 0x66, 0x20, 0x45, 
+	0x78, 0x69, 0x73, 0x74, 0x28, 0x66, 0x69, 0x6c, 0x65, 0x70, 0x61, 0x74, 0x68, 0x29, 0x20, 0x74, 
+	0x68, 0x65, 0x6e, 0xa, 0x9, 0x9, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x63, 0x68, 0x75, 
+	0x6e, 0x6b, 0x20, 0x3d, 0x20, 0x62, 0x61, 0x6d, 0x5f, 0x6c, 0x6f, 0x61, 0x64, 0x66, 0x69, 0x6c, 
+	0x65, 0x28, 0x66, 0x69, 0x6c, 0x65, 0x70, 0x61, 0x74, 0x68, 0x29, 0xa, 0x9, 0x9, 0x9, 0x69, 
+	0x66, 0x20, 0x63, 0x68, 0x75, 0x6e, 0x6b, 0x20, 0x74, 0x68, 0x65, 0x6e, 0xa, 0x9, 0x9, 0x9, 
+	0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x20, 0x3d, 
+	0x20, 0x5f, 0x62, 0x61, 0x6d, 0x5f, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x66, 0x69, 0x6c, 0x65, 
+	0x6e, 0x61, 0x6d, 0x65, 0xa, 0x9, 0x9, 0x9, 0x9, 0x5f, 0x62, 0x61, 0x6d, 0x5f, 0x6d, 0x6f, 
+	0x64, 0x75, 0x6c, 0x65, 0x66, 0x69, 0x6c, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x3d, 0x20, 0x66, 
+	0x69, 0x6c, 0x65, 0x70, 0x61, 0x74, 0x68, 0xa, 0x9, 0x9, 0x9, 0x9, 0x62, 0x61, 0x6d, 0x5f, 
+	0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x73, 0x74, 0x61, 
+	0x6d, 0x70, 0x28, 0x5f, 0x62, 0x61, 0x6d, 0x5f, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x66, 0x69, 
+	0x6c, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x29, 0xa, 0x9, 0x9, 0x9, 0x9, 0x63, 0x68, 0x75, 0x6e, 
+	0x6b, 0x28, 0x29, 0xa, 0x9, 0x9, 0x9, 0x9, 0x5f, 0x62, 0x61, 0x6d, 0x5f, 0x6d, 0x6f, 0x64, 
+	0x75, 0x6c, 0x65, 0x66, 0x69, 0x6c, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x3d, 0x20, 0x63, 0x75, 
+	0x72, 0x72, 0x65, 0x6e, 0x74, 0xa, 0x9, 0x9, 0x9, 0x9, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 
+	0xa, 0x9, 0x9, 0x9, 0x65, 0x6e, 0x64, 0xa, 0x9, 0x9, 0x65, 0x6e, 0x64, 0xa, 0x9, 0x65, 
+	0x6e, 0x64, 0xa, 0xa, 0x9, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x28, 0x66, 0x69, 0x6c, 0x65, 0x6e, 
+	0x61, 0x6d, 0x65, 0x20, 0x2e, 0x2e, 0x20, 0x22, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x66, 0x6f, 0x75, 
+	0x6e, 0x64, 0x22, 0x29, 0xa, 0x65, 0x6e, 0x64, 0xa, 0xa, 0xa, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 
+	0x46, 0x55, 0x4e, 0x43, 0x54, 0x49, 0x4f, 0x4e, 0xa, 0x9, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 
+	0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x6f, 
+	0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x20, 0x73, 0x63, 
+	0x72, 0x69, 0x70, 0x74, 0x20, 0x62, 0x65, 0x69, 0x6e, 0x67, 0x20, 0x69, 0x6d, 0x70, 0x6f, 0x72, 
+	0x74, 0x65, 0x64, 0x20, 0x28, 0x62, 0x79, 0x20, 0x5b, 0x49, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x5d, 
+	0x29, 0xa, 0x9, 0x61, 0x73, 0x20, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x74, 
+	0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x20, 0x77, 0x6f, 
+	0x72, 0x6b, 0x69, 0x6e, 0x67, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x79, 0x2e, 
+	0xa, 0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 0x2d, 0x2d, 0xa, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 
+	0x6f, 0x6e, 0x20, 0x4d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x46, 0x69, 0x6c, 0x65, 0x6e, 0x61, 0x6d, 
+	0x65, 0x28, 0x29, 0xa, 0x9, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x5f, 0x62, 0x61, 0x6d, 
+	0x5f, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x66, 0x69, 0x6c, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0xa, 
+	0x65, 0x6e, 0x64, 0xa, 0xa, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x47, 0x52, 0x4f, 0x55, 0x50, 0x20, 
+	0x4a, 0x6f, 0x62, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x44, 0x65, 0x70, 0x65, 0x6e, 0x64, 0x65, 0x6e, 
+	0x63, 0x69, 0x65, 0x73, 0x20, 0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 0x2d, 0x2d, 0xa, 0xa, 0x2d, 
+	0x2d, 0x5b, 0x5b, 0x40, 0x46, 0x55, 0x4e, 0x43, 0x54, 0x49, 0x4f, 0x4e, 0x20, 0x41, 0x64, 0x64, 
+	0x4a, 0x6f, 0x62, 0x28, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2c, 0x20, 0x6c, 0x61, 0x62, 0x65, 
+	0x6c, 0x2c, 0x20, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x2c, 0x20, 0x2e, 0x2e, 0x2e, 0x29, 
+	0xa, 0x9, 0x41, 0x64, 0x64, 0x73, 0x20, 0x61, 0x20, 0x6a, 0x6f, 0x62, 0x20, 0x74, 0x6f, 0x20, 
+	0x62, 0x65, 0x20, 0x64, 0x6f, 0x6e, 0x65, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x5e, 0x6f, 0x75, 
+	0x74, 0x70, 0x75, 0x74, 0x5e, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x73, 0x70, 0x65, 
+	0x63, 0x69, 0x66, 0x69, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x20, 
+	0x74, 0x68, 0x61, 0x74, 0xa, 0x9, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x62, 0x65, 0x20, 0x63, 0x72, 
+	0x65, 0x61, 0x74, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x6d, 
+	0x6d, 0x61, 0x6e, 0x64, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 
+	0x69, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x5e, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x5e, 
+	0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x2e, 0xa, 0x9, 0x54, 0x68, 0x65, 0x20, 0x5e, 0x6c, 
+	0x61, 0x62, 0x65, 0x6c, 0x5e, 0x20, 0x69, 0x73, 0x20, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x65, 0x64, 
+	0x20, 0x6f, 0x75, 0x74, 0x20, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x20, 0x5e, 0x63, 0x6f, 0x6d, 
+	0x6d, 0x61, 0x6e, 0x64, 0x5e, 0x20, 0x69, 0x73, 0x20, 0x72, 0x75, 0x6e, 0x6e, 0x65, 0x64, 0x2e, 
+	0x20, 0x59, 0x6f, 0x75, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x61, 0x6c, 0x73, 0x6f, 0xa, 0x9, 0x61, 
+	0x64, 0x64, 0x20, 0x65, 0x78, 0x74, 0x72, 0x61, 0x20, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 
+	0x65, 0x72, 0x73, 0x2c, 0x20, 0x74, 0x68, 0x6f, 0x73, 0x65, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 
+	0x62, 0x65, 0x63, 0x6f, 0x6d, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x64, 0x65, 0x70, 0x65, 0x6e, 
+	0x64, 0x65, 0x6e, 0x63, 0x69, 0x65, 0x73, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 
+	0x6a, 0x6f, 0x62, 0x2e, 0xa, 0x9, 0xa, 0x9, 0x7b, 0x7b, 0x7b, 0x7b, 0xa, 0x9, 0x9, 0x41, 
+	0x64, 0x64, 0x4a, 0x6f, 0x62, 0x28, 0x22, 0x6d, 0x79, 0x61, 0x70, 0x70, 0x2e, 0x6f, 0x22, 0x2c, 
+	0x20, 0x22, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x69, 0x6e, 0x67, 0x20, 0x6d, 0x79, 0x61, 0x70, 
+	0x70, 0x2e, 0x63, 0x22, 0x2c, 0x20, 0x22, 0x67, 0x63, 0x63, 0x20, 0x2d, 0x63, 0x20, 0x6d, 0x79, 
+	0x61, 0x70, 0x70, 0x2e, 0x63, 0x20, 0x2d, 0x6f, 0x20, 0x6d, 0x79, 0x61, 0x70, 0x70, 0x2e, 0x6f, 
+	0x22, 0x29, 0xa, 0x9, 0x9, 0x41, 0x64, 0x64, 0x44, 0x65, 0x70, 0x65, 0x6e, 0x64, 0x65, 0x6e, 
+	0x63, 0x79, 0x28, 0x22, 0x6d, 0x79, 0x61, 0x70, 0x70, 0x2e, 0x6f, 0x22, 0x2c, 0x20, 0x22, 0x6d, 
+	0x79, 0x61, 0x70, 0x70, 0x2e, 0x63, 0x22, 0x29, 0xa, 0x9, 0x7d, 0x7d, 0x7d, 0x7d, 0xa, 0x9, 
+	0x54, 0x68, 0x69, 0x73, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6d, 0x65, 
+	0x20, 0x61, 0x73, 0x20, 0x74, 0x68, 0x69, 0x73, 0x3a, 0xa, 0x9, 0x7b, 0x7b, 0x7b, 0x7b, 0xa, 
+	0x9, 0x9, 0x41, 0x64, 0x64, 0x4a, 0x6f, 0x62, 0x28, 0x22, 0x6d, 0x79, 0x61, 0x70, 0x70, 0x2e, 
+	0x6f, 0x22, 0x2c, 0x20, 0x22, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x69, 0x6e, 0x67, 0x20, 0x6d, 
+	0x79, 0x61, 0x70, 0x70, 0x2e, 0x63, 0x22, 0x2c, 0x20, 0x22, 0x67, 0x63, 0x63, 0x20, 0x2d, 0x63, 
+	0x20, 0x6d, 0x79, 0x61, 0x70, 0x70, 0x2e, 0x63, 0x20, 0x2d, 0x6f, 0x20, 0x6d, 0x79, 0x61, 0x70, 
+	0x70, 0x2e, 0x6f, 0x22, 0x2c, 0x20, 0x22, 0x6d, 0x79, 0x61, 0x70, 0x70, 0x2e, 0x63, 0x22, 0x29, 
+	0xa, 0x9, 0x7d, 0x7d, 0x7d, 0x7d, 0xa, 0x9, 0x59, 0x6f, 0x75, 0x20, 0x63, 0x61, 0x6e, 0x20, 
+	0x61, 0x6c, 0x73, 0x6f, 0x20, 0x61, 0x64, 0x64, 0x20, 0x73, 0x65, 0x76, 0x65, 0x72, 0x61, 0x6c, 
+	0x20, 0x64, 0x65, 0x70, 0x65, 0x6e, 0x64, 0x65, 0x6e, 0x63, 0x69, 0x65, 0x73, 0x20, 0x61, 0x74, 
+	0x20, 0x6f, 0x6e, 0x63, 0x65, 0x20, 0x6c, 0x69, 0x6b, 0x65, 0x20, 0x74, 0x68, 0x69, 0x73, 0x3a, 
+	0xa, 0x9, 0x7b, 0x7b, 0x7b, 0x7b, 0xa, 0x9, 0x9, 0x41, 0x64, 0x64, 0x4a, 0x6f, 0x62, 0x28, 
+	0x22, 0x6d, 0x79, 0x61, 0x70, 0x70, 0x22, 0x2c, 0x20, 0x22, 0x6c, 0x69, 0x6e, 0x6b, 0x69, 0x6e, 
+	0x67, 0x20, 0x6d, 0x79, 0x61, 0x70, 0x70, 0x22, 0x2c, 0x20, 0x22, 0x67, 0x63, 0x63, 0x20, 0x6d, 
+	0x79, 0x61, 0x70, 0x70, 0x31, 0x2e, 0x6f, 0x20, 0x6d, 0x79, 0x61, 0x70, 0x70, 0x32, 0x2e, 0x6f, 
+	0x20, 0x6d, 0x79, 0x61, 0x70, 0x70, 0x33, 0x2e, 0x6f, 0x20, 0x2d, 0x6f, 0x20, 0x6d, 0x79, 0x61, 
+	0x70, 0x70, 0x2e, 0x6f, 0x22, 0x2c, 0x20, 0x7b, 0x22, 0x6d, 0x79, 0x61, 0x70, 0x70, 0x31, 0x2e, 
+	0x6f, 0x22, 0x2c, 0x20, 0x22, 0x6d, 0x79, 0x61, 0x70, 0x70, 0x32, 0x2e, 0x6f, 0x22, 0x7d, 0x2c, 
+	0x20, 0x22, 0x6d, 0x79, 0x61, 0x70, 0x70, 0x33, 0x2e, 0x6f, 0x22, 0x29, 0xa, 0x9, 0x7d, 0x7d, 
+	0x7d, 0x7d, 0xa, 0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 0x2d, 0x2d, 0xa, 0x41, 0x64, 0x64, 0x4a, 
+	0x6f, 0x62, 0x20, 0x3d, 0x20, 0x62, 0x61, 0x6d, 0x5f, 0x61, 0x64, 0x64, 0x5f, 0x6a, 0x6f, 0x62, 
+	0xa, 0xa, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x46, 0x55, 0x4e, 0x43, 0x54, 0x49, 0x4f, 0x4e, 0x20, 
+	0x41, 0x64, 0x64, 0x44, 0x65, 0x70, 0x65, 0x6e, 0x64, 0x65, 0x6e, 0x63, 0x79, 0x28, 0x66, 0x69, 
+	0x6c, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x2c, 0x20, 0x2e, 0x2e, 0x2e, 0x29, 0xa, 0x9, 0x41, 0x64, 
+	0x64, 0x73, 0x20, 0x64, 0x65, 0x70, 0x65, 0x6e, 0x64, 0x65, 0x6e, 0x63, 0x69, 0x65, 0x73, 0x20, 
+	0x74, 0x6f, 0x20, 0x61, 0x20, 0x6a, 0x6f, 0x62, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x66, 0x69, 
+	0x6c, 0x65, 0x73, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x69, 0x6e, 
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6c, 0x69, 
+	0x73, 0x74, 0x20, 0x67, 0x65, 0x74, 0x73, 0x20, 0x61, 0x64, 0x64, 0x65, 0x64, 0x2e, 0xa, 0x9, 
+	0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x6e, 0x65, 0x73, 0x74, 
+	0x65, 0x64, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x74, 0x72, 
+	0x69, 0x6e, 0x67, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x61, 0x63, 0x63, 0x65, 0x70, 0x74, 0x65, 
+	0x64, 0x2e, 0xa, 0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 0x2d, 0x2d, 0xa, 0x41, 0x64, 0x64, 0x44, 
+	0x65, 0x70, 0x65, 0x6e, 0x64, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x3d, 0x20, 0x62, 0x61, 0x6d, 0x5f, 
+	0x61, 0x64, 0x64, 0x5f, 0x64, 0x65, 0x70, 0x65, 0x6e, 0x64, 0x65, 0x6e, 0x63, 0x79, 0xa, 0xa, 
+	0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x46, 0x55, 0x4e, 0x43, 0x54, 0x49, 0x4f, 0x4e, 0x20, 0x41, 0x64, 
+	0x64, 0x44, 0x65, 0x70, 0x65, 0x6e, 0x64, 0x65, 0x6e, 0x63, 0x79, 0x53, 0x65, 0x61, 0x72, 0x63, 
+	0x68, 0x28, 0x66, 0x69, 0x6c, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x2c, 0x20, 0x70, 0x61, 0x74, 0x68, 
+	0x73, 0x2c, 0x20, 0x2e, 0x2e, 0x2e, 0x29, 0xa, 0x9, 0x53, 0x65, 0x61, 0x72, 0x63, 0x68, 0x65, 
+	0x73, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x64, 0x65, 0x70, 0x65, 0x6e, 0x64, 0x65, 0x6e, 0x63, 0x69, 
+	0x65, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 
+	0x69, 0x65, 0x64, 0x20, 0x5e, 0x70, 0x61, 0x74, 0x68, 0x73, 0x5e, 0x20, 0x61, 0x6e, 0x64, 0x20, 
+	0x61, 0x64, 0x64, 0x73, 0x20, 0x74, 0x68, 0x65, 0x6d, 0x20, 0x74, 0x6f, 0xa, 0x9, 0x74, 0x68, 
+	0x65, 0x20, 0x5e, 0x66, 0x69, 0x6c, 0x65, 0x5e, 0x2e, 0xa, 0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 
+	0x2d, 0x2d, 0xa, 0x41, 0x64, 0x64, 0x44, 0x65, 0x70, 0x65, 0x6e, 0x64, 0x65, 0x6e, 0x63, 0x79, 
+	0x53, 0x65, 0x61, 0x72, 0x63, 0x68, 0x20, 0x3d, 0x20, 0x62, 0x61, 0x6d, 0x5f, 0x61, 0x64, 0x64, 
+	0x5f, 0x64, 0x65, 0x70, 0x65, 0x6e, 0x64, 0x65, 0x6e, 0x63, 0x79, 0x5f, 0x73, 0x65, 0x61, 0x72, 
+	0x63, 0x68, 0xa, 0xa, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x46, 0x55, 0x4e, 0x43, 0x54, 0x49, 0x4f, 
+	0x4e, 0x20, 0x53, 0x6b, 0x69, 0x70, 0x4f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x56, 0x65, 0x72, 0x69, 
+	0x66, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x29, 
+	0xa, 0x9, 0x53, 0x6b, 0x69, 0x70, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6f, 0x75, 0x74, 0x70, 
+	0x75, 0x74, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x73, 0x74, 0x61, 0x6d, 0x70, 0x20, 0x76, 0x65, 0x72, 
+	0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x69, 
+	0x73, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0xa, 0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 0x2d, 
+	0x2d, 0xa, 0x53, 0x6b, 0x69, 0x70, 0x4f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x56, 0x65, 0x72, 0x69, 
+	0x66, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x3d, 0x20, 0x62, 0x61, 0x6d, 0x5f, 0x73, 
+	0x6b, 0x69, 0x70, 0x5f, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x5f, 0x76, 0x65, 0x72, 0x69, 0x66, 
+	0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0xa, 0xa, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 
+	0x6e, 0x20, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x5f, 0x49, 0x6e, 0x74, 0x65, 0x72, 0x6d, 
+	0x65, 0x64, 0x69, 0x61, 0x74, 0x65, 0x5f, 0x4f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x28, 0x73, 0x65, 
+	0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2c, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x29, 0xa, 0x9, 
+	0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x50, 0x61, 0x74, 0x68, 0x42, 0x61, 0x73, 0x65, 0x28, 
+	0x69, 0x6e, 0x70, 0x75, 0x74, 0x29, 0x20, 0x2e, 0x2e, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 
+	0x67, 0x73, 0x2e, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x5f, 0x65, 0x78, 0x74, 0xa, 0x65, 0x6e, 
+	0x64, 0xa, 0xa, 0x2d, 0x2d, 0x20, 0x5b, 0x54, 0x4f, 0x44, 0x4f, 0x3a, 0x20, 0x53, 0x68, 0x6f, 
+	0x75, 0x6c, 0x64, 0x20, 0x62, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x43, 0x3f, 0x5d, 0xa, 0x66, 0x75, 
+	0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x73, 0x74, 0x72, 0x5f, 0x72, 0x65, 0x70, 0x6c, 0x61, 
+	0x63, 0x65, 0x28, 0x73, 0x2c, 0x20, 0x70, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6e, 0x2c, 0x20, 0x77, 
+	0x68, 0x61, 0x74, 0x29, 0xa, 0x9, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x73, 0x74, 0x72, 
+	0x69, 0x6e, 0x67, 0x2e, 0x67, 0x73, 0x75, 0x62, 0x28, 0x73, 0x2c, 0x20, 0x70, 0x61, 0x74, 0x74, 
+	0x65, 0x72, 0x6e, 0x2c, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x76, 0x29, 
+	0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x77, 0x68, 0x61, 0x74, 0x20, 0x65, 0x6e, 0x64, 
+	0x29, 0xa, 0x65, 0x6e, 0x64, 0xa, 0xa, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 
+	0x4e, 0x65, 0x77, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x28, 0x29, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 
+	0x6c, 0x20, 0x74, 0x20, 0x3d, 0x20, 0x7b, 0x7d, 0xa, 0xa, 0x9, 0x74, 0x2e, 0x41, 0x64, 0x64, 
+	0x20, 0x3d, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x73, 0x65, 0x6c, 0x66, 
+	0x2c, 0x20, 0x2e, 0x2e, 0x2e, 0x29, 0xa, 0x9, 0x9, 0x66, 0x6f, 0x72, 0x20, 0x69, 0x2c, 0x77, 
+	0x68, 0x61, 0x74, 0x20, 0x69, 0x6e, 0x20, 0x69, 0x70, 0x61, 0x69, 0x72, 0x73, 0x28, 0x7b, 0x2e, 
+	0x2e, 0x2e, 0x7d, 0x29, 0x20, 0x64, 0x6f, 0xa, 0x9, 0x9, 0x9, 0x74, 0x61, 0x62, 0x6c, 0x65, 
+	0x2e, 0x69, 0x6e, 0x73, 0x65, 0x72, 0x74, 0x28, 0x73, 0x65, 0x6c, 0x66, 0x2c, 0x20, 0x77, 0x68, 
+	0x61, 0x74, 0x29, 0xa, 0x9, 0x9, 0x65, 0x6e, 0x64, 0xa, 0x9, 0x9, 0x73, 0x65, 0x6c, 0x66, 
+	0x2e, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x3d, 0x20, 0x73, 0x65, 0x6c, 0x66, 0x2e, 
+	0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x2b, 0x20, 0x31, 0xa, 0x9, 0x65, 0x6e, 0x64, 
+	0xa, 0xa, 0x9, 0x74, 0x2e, 0x4d, 0x65, 0x72, 0x67, 0x65, 0x20, 0x3d, 0x20, 0x66, 0x75, 0x6e, 
+	0x63, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x73, 0x65, 0x6c, 0x66, 0x2c, 0x20, 0x73, 0x6f, 0x75, 0x72, 
+	0x63, 0x65, 0x29, 0xa, 0x9, 0x9, 0x66, 0x6f, 0x72, 0x20, 0x6b, 0x2c, 0x76, 0x20, 0x69, 0x6e, 
+	0x20, 0x69, 0x70, 0x61, 0x69, 0x72, 0x73, 0x28, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x29, 0x20, 
+	0x64, 0x6f, 0xa, 0x9, 0x9, 0x9, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x2e, 0x69, 0x6e, 0x73, 0x65, 
+	0x72, 0x74, 0x28, 0x73, 0x65, 0x6c, 0x66, 0x2c, 0x20, 0x76, 0x29, 0xa, 0x9, 0x9, 0x65, 0x6e, 
+	0x64, 0xa, 0x9, 0x9, 0x73, 0x65, 0x6c, 0x66, 0x2e, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 
+	0x20, 0x3d, 0x20, 0x73, 0x65, 0x6c, 0x66, 0x2e, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 
+	0x2b, 0x20, 0x31, 0xa, 0x9, 0x65, 0x6e, 0x64, 0xa, 0x9, 0xa, 0x9, 0x74, 0x2e, 0x52, 0x65, 
+	0x6d, 0x6f, 0x76, 0x65, 0x20, 0x3d, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x28, 
+	0x73, 0x65, 0x6c, 0x66, 0x2c, 0x20, 0x76, 0x61, 0x6c, 0x29, 0xa, 0x9, 0x9, 0x6c, 0x6f, 0x63, 
+	0x61, 0x6c, 0x20, 0x74, 0x6d, 0x70, 0x20, 0x3d, 0x20, 0x7b, 0x7d, 0xa, 0x9, 0x9, 0x66, 0x6f, 
+	0x72, 0x20, 0x6b, 0x2c, 0x76, 0x20, 0x69, 0x6e, 0x20, 0x69, 0x70, 0x61, 0x69, 0x72, 0x73, 0x28, 
+	0x73, 0x65, 0x6c, 0x66, 0x29, 0x20, 0x64, 0x6f, 0xa, 0x9, 0x9, 0x9, 0x69, 0x66, 0x20, 0x76, 
+	0x20, 0x3d, 0x3d, 0x20, 0x76, 0x61, 0x6c, 0x20, 0x74, 0x68, 0x65, 0x6e, 0xa, 0x9, 0x9, 0x9, 
+	0x9, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x2e, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x28, 0x73, 0x65, 
+	0x6c, 0x66, 0x2c, 0x20, 0x6b, 0x29, 0xa, 0x9, 0x9, 0x9, 0x65, 0x6e, 0x64, 0xa, 0x9, 0x9, 
+	0x65, 0x6e, 0x64, 0xa, 0x9, 0x9, 0x73, 0x65, 0x6c, 0x66, 0x2e, 0x76, 0x65, 0x72, 0x73, 0x69, 
+	0x6f, 0x6e, 0x20, 0x3d, 0x20, 0x73, 0x65, 0x6c, 0x66, 0x2e, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 
+	0x6e, 0x20, 0x2b, 0x20, 0x31, 0xa, 0x9, 0x65, 0x6e, 0x64, 0xa, 0xa, 0x9, 0x74, 0x2e, 0x76, 
+	0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x3d, 0x20, 0x30, 0xa, 0xa, 0x9, 0x72, 0x65, 0x74, 
+	0x75, 0x72, 0x6e, 0x20, 0x74, 0xa, 0x65, 0x6e, 0x64, 0xa, 0xa, 0x66, 0x75, 0x6e, 0x63, 0x74, 
+	0x69, 0x6f, 0x6e, 0x20, 0x4e, 0x65, 0x77, 0x46, 0x6c, 0x61, 0x67, 0x54, 0x61, 0x62, 0x6c, 0x65, 
+	0x28, 0x29, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x74, 0x20, 0x3d, 0x20, 0x4e, 0x65, 
+	0x77, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x28, 0x29, 0xa, 0x9, 0x74, 0x2e, 0x54, 0x6f, 0x53, 0x74, 
+	0x72, 0x69, 0x6e, 0x67, 0x20, 0x3d, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x28, 
+	0x73, 0x65, 0x6c, 0x66, 0x29, 0xa, 0x9, 0x9, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x54, 
+	0x61, 0x62, 0x6c, 0x65, 0x54, 0x6f, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x73, 0x65, 0x6c, 
+	0x66, 0x2c, 0x20, 0x6e, 0x69, 0x6c, 0x2c, 0x20, 0x22, 0x20, 0x22, 0x29, 0xa, 0x9, 0x65, 0x6e, 
+	0x64, 0xa, 0x9, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x74, 0xa, 0x65, 0x6e, 0x64, 0xa, 
+	0xa, 0x41, 0x64, 0x64, 0x43, 0x6f, 0x6e, 0x73, 0x74, 0x72, 0x61, 0x69, 0x6e, 0x74, 0x53, 0x68, 
+	0x61, 0x72, 0x65, 0x64, 0x20, 0x3d, 0x20, 0x62, 0x61, 0x6d, 0x5f, 0x61, 0x64, 0x64, 0x5f, 0x63, 
+	0x6f, 0x6e, 0x73, 0x74, 0x72, 0x61, 0x69, 0x6e, 0x74, 0x5f, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 
+	0xa, 0x41, 0x64, 0x64, 0x43, 0x6f, 0x6e, 0x73, 0x74, 0x72, 0x61, 0x69, 0x6e, 0x74, 0x45, 0x78, 
+	0x63, 0x6c, 0x75, 0x73, 0x69, 0x76, 0x65, 0x20, 0x3d, 0x20, 0x62, 0x61, 0x6d, 0x5f, 0x61, 0x64, 
+	0x64, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x72, 0x61, 0x69, 0x6e, 0x74, 0x5f, 0x65, 0x78, 0x63, 
+	0x6c, 0x75, 0x73, 0x69, 0x76, 0x65, 0xa, 0xa, 0};
+const char internal_file_2[] = {0x5f, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x64, 
+	0x5f, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x5f, 0x64, 0x72, 0x69, 0x76, 0x65, 0x72, 0x73, 
+	0x20, 0x3d, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0xa, 0x53, 0x65, 0x74, 0x44, 0x72, 0x69, 0x76, 
+	0x65, 0x72, 0x73, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x3d, 0x20, 0x66, 0x61, 0x6c, 
+	0x73, 0x65, 0xa, 0xa, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x53, 0x65, 0x74, 
+	0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x73, 0x28, 0x73, 
+	0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x29, 0xa, 0x9, 0x2d, 0x2d, 0x20, 0x63, 0x68, 0x65, 
+	0x63, 0x6b, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x72, 0x73, 
+	0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x74, 0x69, 0x6d, 0x65, 0xa, 0x9, 0x69, 0x66, 0x20, 
+	0x5f, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x64, 0x5f, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 
+	0x5f, 0x64, 0x72, 0x69, 0x76, 0x65, 0x72, 0x73, 0x20, 0x3d, 0x3d, 0x20, 0x66, 0x61, 0x6c, 0x73, 
+	0x65, 0x20, 0x74, 0x68, 0x65, 0x6e, 0xa, 0x9, 0x9, 0x5f, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 
+	0x64, 0x5f, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x5f, 0x64, 0x72, 0x69, 0x76, 0x65, 0x72, 
+	0x73, 0x20, 0x3d, 0x20, 0x74, 0x72, 0x75, 0x65, 0xa, 0x9, 0x9, 0x69, 0x66, 0x20, 0x6f, 0x73, 
+	0x2e, 0x67, 0x65, 0x74, 0x65, 0x6e, 0x76, 0x28, 0x22, 0x43, 0x43, 0x22, 0x29, 0x20, 0x74, 0x68, 
+	0x65, 0x6e, 0xa, 0x9, 0x9, 0x9, 0x69, 0x66, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x2e, 
+	0x6d, 0x61, 0x74, 0x63, 0x68, 0x28, 0x6f, 0x73, 0x2e, 0x67, 0x65, 0x74, 0x65, 0x6e, 0x76, 0x28, 
+	0x22, 0x43, 0x43, 0x22, 0x29, 0x2c, 0x20, 0x22, 0x2e, 0x2a, 0x63, 0x6c, 0x61, 0x6e, 0x67, 0x2e, 
+	0x2a, 0x22, 0x29, 0x20, 0x74, 0x68, 0x65, 0x6e, 0xa, 0x9, 0x9, 0x9, 0x9, 0x53, 0x65, 0x74, 
+	0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x73, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x3d, 
+	0x20, 0x53, 0x65, 0x74, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x73, 0x43, 0x6c, 0x61, 0x6e, 0x67, 
+	0xa, 0x9, 0x9, 0x9, 0x65, 0x6c, 0x73, 0x65, 0x69, 0x66, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 
+	0x67, 0x2e, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x28, 0x6f, 0x73, 0x2e, 0x67, 0x65, 0x74, 0x65, 0x6e, 
+	0x76, 0x28, 0x22, 0x43, 0x43, 0x22, 0x29, 0x2c, 0x20, 0x22, 0x2e, 0x2a, 0x67, 0x63, 0x63, 0x2e, 
+	0x2a, 0x22, 0x29, 0x20, 0x74, 0x68, 0x65, 0x6e, 0xa, 0x9, 0x9, 0x9, 0x9, 0x53, 0x65, 0x74, 
+	0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x73, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x3d, 
+	0x20, 0x53, 0x65, 0x74, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x73, 0x47, 0x43, 0x43, 0xa, 0x9, 
+	0x9, 0x9, 0x65, 0x6c, 0x73, 0x65, 0x69, 0x66, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x2e, 
+	0x6d, 0x61, 0x74, 0x63, 0x68, 0x28, 0x6f, 0x73, 0x2e, 0x67, 0x65, 0x74, 0x65, 0x6e, 0x76, 0x28, 
+	0x22, 0x43, 0x43, 0x22, 0x29, 0x2c, 0x20, 0x22, 0x2e, 0x2a, 0x63, 0x6c, 0x2e, 0x2a, 0x22, 0x29, 
+	0x20, 0x74, 0x68, 0x65, 0x6e, 0xa, 0x9, 0x9, 0x9, 0x9, 0x53, 0x65, 0x74, 0x44, 0x72, 0x69, 
+	0x76, 0x65, 0x72, 0x73, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x3d, 0x20, 0x53, 0x65, 
+	0x74, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x73, 0x43, 0x4c, 0xa, 0x9, 0x9, 0x9, 0x65, 0x6c, 
+	0x73, 0x65, 0x69, 0x66, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x2e, 0x6d, 0x61, 0x74, 0x63, 
+	0x68, 0x28, 0x6f, 0x73, 0x2e, 0x67, 0x65, 0x74, 0x65, 0x6e, 0x76, 0x28, 0x22, 0x43, 0x43, 0x22, 
+	0x29, 0x2c, 0x20, 0x22, 0x2e, 0x2a, 0x73, 0x75, 0x6e, 0x43, 0x43, 0x2e, 0x2a, 0x22, 0x29, 0x20, 
+	0x74, 0x68, 0x65, 0x6e, 0xa, 0x9, 0x9, 0x9, 0x9, 0x53, 0x65, 0x74, 0x44, 0x72, 0x69, 0x76, 
+	0x65, 0x72, 0x73, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x3d, 0x20, 0x53, 0x65, 0x74, 
+	0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x73, 0x53, 0x6f, 0x6c, 0x61, 0x72, 0x69, 0x73, 0x53, 0x74, 
+	0x75, 0x64, 0x69, 0x6f, 0xa, 0x9, 0x9, 0x9, 0x65, 0x6c, 0x73, 0x65, 0x69, 0x66, 0x20, 0x73, 
+	0x74, 0x72, 0x69, 0x6e, 0x67, 0x2e, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x28, 0x6f, 0x73, 0x2e, 0x67, 
+	0x65, 0x74, 0x65, 0x6e, 0x76, 0x28, 0x22, 0x43, 0x43, 0x22, 0x29, 0x2c, 0x20, 0x22, 0x2e, 0x2a, 
+	0x78, 0x6c, 0x43, 0x2e, 0x2a, 0x22, 0x29, 0x20, 0x74, 0x68, 0x65, 0x6e, 0xa, 0x9, 0x9, 0x9, 
+	0x9, 0x53, 0x65, 0x74, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x73, 0x44, 0x65, 0x66, 0x61, 0x75, 
+	0x6c, 0x74, 0x20, 0x3d, 0x20, 0x53, 0x65, 0x74, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x73, 0x58, 
+	0x4c, 0x43, 0xa, 0x9, 0x9, 0x9, 0x65, 0x6e, 0x64, 0xa, 0x9, 0x9, 0x65, 0x6c, 0x73, 0x65, 
+	0xa, 0x9, 0x9, 0x9, 0x69, 0x66, 0x20, 0x45, 0x78, 0x65, 0x63, 0x75, 0x74, 0x65, 0x53, 0x69, 
+	0x6c, 0x65, 0x6e, 0x74, 0x28, 0x22, 0x63, 0x6c, 0x61, 0x6e, 0x67, 0x20, 0x2d, 0x76, 0x22, 0x29, 
+	0x20, 0x3d, 0x3d, 0x20, 0x30, 0x20, 0x74, 0x68, 0x65, 0x6e, 0xa, 0x9, 0x9, 0x9, 0x9, 0x53, 
+	0x65, 0x74, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x73, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 
+	0x20, 0x3d, 0x20, 0x53, 0x65, 0x74, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x73, 0x43, 0x6c, 0x61, 
+	0x6e, 0x67, 0xa, 0x9, 0x9, 0x9, 0x65, 0x6c, 0x73, 0x65, 0x69, 0x66, 0x20, 0x45, 0x78, 0x65, 
+	0x63, 0x75, 0x74, 0x65, 0x53, 0x69, 0x6c, 0x65, 0x6e, 0x74, 0x28, 0x22, 0x67, 0x63, 0x63, 0x20, 
+	0x2d, 0x76, 0x22, 0x29, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x20, 0x74, 0x68, 0x65, 0x6e, 0xa, 0x9, 
+	0x9, 0x9, 0x9, 0x53, 0x65, 0x74, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x73, 0x44, 0x65, 0x66, 
+	0x61, 0x75, 0x6c, 0x74, 0x20, 0x3d, 0x20, 0x53, 0x65, 0x74, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 
+	0x73, 0x47, 0x43, 0x43, 0xa, 0x9, 0x9, 0x9, 0x65, 0x6c, 0x73, 0x65, 0x69, 0x66, 0x20, 0x45, 
+	0x78, 0x65, 0x63, 0x75, 0x74, 0x65, 0x53, 0x69, 0x6c, 0x65, 0x6e, 0x74, 0x28, 0x22, 0x63, 0x6c, 
+	0x22, 0x29, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x20, 0x74, 0x68, 0x65, 0x6e, 0xa, 0x9, 0x9, 0x9, 
+	0x9, 0x53, 0x65, 0x74, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x73, 0x44, 0x65, 0x66, 0x61, 0x75, 
+	0x6c, 0x74, 0x20, 0x3d, 0x20, 0x53, 0x65, 0x74, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x73, 0x43, 
+	0x4c, 0xa, 0x9, 0x9, 0x9, 0x65, 0x6c, 0x73, 0x65, 0x69, 0x66, 0x20, 0x45, 0x78, 0x65, 0x63, 
+	0x75, 0x74, 0x65, 0x53, 0x69, 0x6c, 0x65, 0x6e, 0x74, 0x28, 0x22, 0x73, 0x75, 0x6e, 0x63, 0x63, 
+	0x20, 0x2d, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x22, 0x29, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x20, 0x74, 
+	0x68, 0x65, 0x6e, 0xa, 0x9, 0x9, 0x9, 0x9, 0x53, 0x65, 0x74, 0x44, 0x72, 0x69, 0x76, 0x65, 
+	0x72, 0x73, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x3d, 0x20, 0x53, 0x65, 0x74, 0x44, 
+	0x72, 0x69, 0x76, 0x65, 0x72, 0x73, 0x53, 0x6f, 0x6c, 0x61, 0x72, 0x69, 0x73, 0x53, 0x74, 0x75, 
+	0x64, 0x69, 0x6f, 0xa, 0x9, 0x9, 0x9, 0x65, 0x6c, 0x73, 0x65, 0x69, 0x66, 0x20, 0x45, 0x78, 
+	0x65, 0x63, 0x75, 0x74, 0x65, 0x53, 0x69, 0x6c, 0x65, 0x6e, 0x74, 0x28, 0x22, 0x78, 0x6c, 0x63, 
+	0x5f, 0x72, 0x20, 0x2d, 0x71, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x22, 0x29, 0x20, 0x3d, 
+	0x3d, 0x20, 0x30, 0x20, 0x74, 0x68, 0x65, 0x6e, 0xa, 0x9, 0x9, 0x9, 0x9, 0x53, 0x65, 0x74, 
+	0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x73, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x3d, 
+	0x20, 0x53, 0x65, 0x74, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x73, 0x58, 0x4c, 0x43, 0xa, 0x9, 
+	0x9, 0x9, 0x65, 0x6e, 0x64, 0xa, 0x9, 0x9, 0x65, 0x6e, 0x64, 0xa, 0x9, 0x65, 0x6e, 0x64, 
+	0xa, 0xa, 0x9, 0x2d, 0x2d, 0x20, 0x73, 0x65, 0x74, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 
+	0x74, 0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x72, 0x73, 0xa, 0x9, 0x69, 0x66, 0x20, 0x53, 0x65, 
+	0x74, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x73, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x20, 
+	0x74, 0x68, 0x65, 0x6e, 0xa, 0x9, 0x9, 0x53, 0x65, 0x74, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 
+	0x73, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 
+	0x73, 0x29, 0xa, 0x9, 0x65, 0x6e, 0x64, 0xa, 0xa, 0x9, 0x2d, 0x2d, 0x20, 0x66, 0x69, 0x6e, 
+	0x64, 0x20, 0x6f, 0x75, 0x74, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x66, 0x72, 0x6f, 0x6d, 
+	0x20, 0x74, 0x68, 0x65, 0xa, 0x9, 0x69, 0x66, 0x20, 0x6f, 0x73, 0x2e, 0x67, 0x65, 0x74, 0x65, 
+	0x6e, 0x76, 0x28, 0x22, 0x43, 0x43, 0x22, 0x29, 0x20, 0x74, 0x68, 0x65, 0x6e, 0xa, 0x9, 0x9, 
+	0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 0x63, 0x2e, 0x65, 0x78, 0x65, 0x5f, 
+	0x63, 0x20, 0x3d, 0x20, 0x6f, 0x73, 0x2e, 0x67, 0x65, 0x74, 0x65, 0x6e, 0x76, 0x28, 0x22, 0x43, 
+	0x43, 0x22, 0x29, 0xa, 0x9, 0x65, 0x6e, 0x64, 0xa, 0xa, 0x9, 0x69, 0x66, 0x20, 0x6f, 0x73, 
+	0x2e, 0x67, 0x65, 0x74, 0x65, 0x6e, 0x76, 0x28, 0x22, 0x43, 0x58, 0x58, 0x22, 0x29, 0x20, 0x74, 
+	0x68, 0x65, 0x6e, 0xa, 0x9, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 
+	0x63, 0x2e, 0x65, 0x78, 0x65, 0x5f, 0x63, 0x78, 0x78, 0x20, 0x3d, 0x20, 0x6f, 0x73, 0x2e, 0x67, 
+	0x65, 0x74, 0x65, 0x6e, 0x76, 0x28, 0x22, 0x43, 0x58, 0x58, 0x22, 0x29, 0xa, 0x9, 0x9, 0x73, 
+	0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x69, 0x6e, 0x6b, 0x2e, 0x65, 0x78, 0x65, 
+	0x20, 0x3d, 0x20, 0x6f, 0x73, 0x2e, 0x67, 0x65, 0x74, 0x65, 0x6e, 0x76, 0x28, 0x22, 0x43, 0x58, 
+	0x58, 0x22, 0x29, 0xa, 0x9, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x64, 
+	0x6c, 0x6c, 0x2e, 0x65, 0x78, 0x65, 0x20, 0x3d, 0x20, 0x6f, 0x73, 0x2e, 0x67, 0x65, 0x74, 0x65, 
+	0x6e, 0x76, 0x28, 0x22, 0x43, 0x58, 0x58, 0x22, 0x29, 0xa, 0x9, 0x65, 0x6e, 0x64, 0xa, 0xa, 
+	0x9, 0x69, 0x66, 0x20, 0x6f, 0x73, 0x2e, 0x67, 0x65, 0x74, 0x65, 0x6e, 0x76, 0x28, 0x22, 0x41, 
+	0x52, 0x22, 0x29, 0x20, 0x74, 0x68, 0x65, 0x6e, 0xa, 0x9, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 
+	0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x69, 0x62, 0x2e, 0x65, 0x78, 0x65, 0x20, 0x3d, 0x20, 0x6f, 0x73, 
+	0x2e, 0x67, 0x65, 0x74, 0x65, 0x6e, 0x76, 0x28, 0x22, 0x41, 0x52, 0x22, 0x29, 0xa, 0x9, 0x65, 
+	0x6e, 0x64, 0xa, 0xa, 0x9, 0x69, 0x66, 0x20, 0x6f, 0x73, 0x2e, 0x67, 0x65, 0x74, 0x65, 0x6e, 
+	0x76, 0x28, 0x22, 0x43, 0x46, 0x4c, 0x41, 0x47, 0x53, 0x22, 0x29, 0x20, 0x74, 0x68, 0x65, 0x6e, 
+	0xa, 0x9, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 0x63, 0x2e, 0x66, 
+	0x6c, 0x61, 0x67, 0x73, 0x5f, 0x63, 0x3a, 0x41, 0x64, 0x64, 0x28, 0x6f, 0x73, 0x2e, 0x67, 0x65, 
+	0x74, 0x65, 0x6e, 0x76, 0x28, 0x22, 0x43, 0x46, 0x4c, 0x41, 0x47, 0x53, 0x22, 0x29, 0x29, 0xa, 
+	0x9, 0x65, 0x6e, 0x64, 0xa, 0xa, 0x9, 0x69, 0x66, 0x20, 0x6f, 0x73, 0x2e, 0x67, 0x65, 0x74, 
+	0x65, 0x6e, 0x76, 0x28, 0x22, 0x43, 0x58, 0x58, 0x46, 0x4c, 0x41, 0x47, 0x53, 0x22, 0x29, 0x20, 
+	0x74, 0x68, 0x65, 0x6e, 0xa, 0x9, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 
+	0x63, 0x63, 0x2e, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x5f, 0x63, 0x78, 0x78, 0x3a, 0x41, 0x64, 0x64, 
+	0x28, 0x6f, 0x73, 0x2e, 0x67, 0x65, 0x74, 0x65, 0x6e, 0x76, 0x28, 0x22, 0x43, 0x58, 0x58, 0x46, 
+	0x4c, 0x41, 0x47, 0x53, 0x22, 0x29, 0x29, 0xa, 0x9, 0x65, 0x6e, 0x64, 0xa, 0xa, 0x9, 0x69, 
+	0x66, 0x20, 0x6f, 0x73, 0x2e, 0x67, 0x65, 0x74, 0x65, 0x6e, 0x76, 0x28, 0x22, 0x4c, 0x44, 0x46, 
+	0x4c, 0x41, 0x47, 0x53, 0x22, 0x29, 0x20, 0x74, 0x68, 0x65, 0x6e, 0xa, 0x9, 0x9, 0x73, 0x65, 
+	0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x69, 0x6e, 0x6b, 0x2e, 0x66, 0x6c, 0x61, 0x67, 
+	0x73, 0x3a, 0x41, 0x64, 0x64, 0x28, 0x6f, 0x73, 0x2e, 0x67, 0x65, 0x74, 0x65, 0x6e, 0x76, 0x28, 
+	0x22, 0x4c, 0x44, 0x46, 0x4c, 0x41, 0x47, 0x53, 0x22, 0x29, 0x29, 0xa, 0x9, 0x65, 0x6e, 0x64, 
+	0xa, 0xa, 0x65, 0x6e, 0x64, 0xa, 0xa, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x47, 0x52, 0x4f, 0x55, 
+	0x50, 0x20, 0x43, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x20, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 
+	0x73, 0x20, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x29, 0x20, 0x40, 0x45, 0x4e, 
+	0x44, 0x5d, 0x5d, 0x2d, 0x2d, 0xa, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x53, 
+	0x65, 0x74, 0x43, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 
+	0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x29, 0xa, 0x9, 0x73, 0x65, 0x74, 0x74, 
+	0x69, 0x6e, 0x67, 0x73, 0x2e, 0x43, 0x6f, 0x70, 0x79, 0x20, 0x3d, 0x20, 0x54, 0x61, 0x62, 0x6c, 
+	0x65, 0x44, 0x65, 0x65, 0x70, 0x43, 0x6f, 0x70, 0x79, 0xa, 0x9, 0xa, 0x9, 0x2d, 0x2d, 0x5b, 
+	0x5b, 0x40, 0x46, 0x55, 0x4e, 0x43, 0x54, 0x49, 0x4f, 0x4e, 0x20, 0x63, 0x6f, 0x6e, 0x66, 0x69, 
+	0x67, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 0xa, 0x9, 0x9, 0x4e, 0x61, 0x6d, 0x65, 0x20, 0x6f, 0x66, 
+	0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0xa, 0x9, 
+	0x9, 0x54, 0x4f, 0x44, 0x4f, 0x3a, 0x20, 0x65, 0x78, 0x70, 0x6c, 0x61, 0x69, 0x6e, 0x20, 0x77, 
+	0x68, 0x65, 0x6e, 0x20, 0x79, 0x6f, 0x75, 0x20, 0x63, 0x6f, 0x75, 0x6c, 0x64, 0x20, 0x75, 0x73, 
+	0x65, 0x20, 0x69, 0x74, 0xa, 0x9, 0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 0xa, 0x9, 0x73, 0x65, 
+	0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x5f, 0x6e, 0x61, 
+	0x6d, 0x65, 0x20, 0x3d, 0x20, 0x22, 0x22, 0xa, 0xa, 0x9, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x46, 
+	0x55, 0x4e, 0x43, 0x54, 0x49, 0x4f, 0x4e, 0x20, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x5f, 0x65, 
+	0x78, 0x74, 0xa, 0x9, 0x9, 0x41, 0x20, 0x73, 0x68, 0x6f, 0x72, 0x74, 0x20, 0x70, 0x6f, 0x73, 
+	0x74, 0x66, 0x69, 0x78, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x79, 0x6f, 0x75, 0x20, 0x63, 0x61, 
+	0x6e, 0x20, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x66, 0x69, 0x6c, 0x65, 
+	0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x62, 0x65, 0x65, 0x6e, 
+	0x20, 0x62, 0x75, 0x69, 0x6c, 0x74, 0xa, 0x9, 0x9, 0x62, 0x79, 0x20, 0x74, 0x68, 0x69, 0x73, 
+	0x20, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x75, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0xa, 
+	0x9, 0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 0xa, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 
+	0x73, 0x2e, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x5f, 0x65, 0x78, 0x74, 0x20, 0x3d, 0x20, 0x22, 
+	0x22, 0xa, 0xa, 0x9, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x46, 0x55, 0x4e, 0x43, 0x54, 0x49, 0x4f, 
+	0x4e, 0x20, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0xa, 0x9, 0x9, 
+	0x50, 0x72, 0x65, 0x66, 0x69, 0x78, 0x20, 0x74, 0x6f, 0x20, 0x75, 0x73, 0x65, 0x20, 0x66, 0x6f, 
+	0x72, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x6a, 0x6f, 0x62, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 
+	0x61, 0x72, 0x65, 0x20, 0x61, 0x64, 0x64, 0x65, 0x64, 0x2e, 0xa, 0x9, 0x9, 0x54, 0x4f, 0x44, 
+	0x4f, 0x3a, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x66, 
+	0x65, 0x65, 0x6c, 0x73, 0x20, 0x61, 0x20, 0x62, 0x69, 0x74, 0x20, 0x73, 0x74, 0x72, 0x61, 0x6e, 
+	0x67, 0x65, 0xa, 0x9, 0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 0xa, 0x9, 0x73, 0x65, 0x74, 0x74, 
+	0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 
+	0x20, 0x3d, 0x20, 0x22, 0x22, 0xa, 0xa, 0x9, 0x2d, 0x2d, 0x20, 0x54, 0x4f, 0x44, 0x4f, 0x3a, 
+	0x20, 0x77, 0x68, 0x61, 0x74, 0x20, 0x74, 0x6f, 0x64, 0x6f, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 
+	0x74, 0x68, 0x65, 0x73, 0x65, 0xa, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 
+	0x64, 0x65, 0x62, 0x75, 0x67, 0x20, 0x3d, 0x20, 0x31, 0xa, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 
+	0x6e, 0x67, 0x73, 0x2e, 0x6f, 0x70, 0x74, 0x69, 0x6d, 0x69, 0x7a, 0x65, 0x20, 0x3d, 0x20, 0x30, 
+	0xa, 0x65, 0x6e, 0x64, 0xa, 0xa, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+	0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x20, 0x43, 
+	0x4f, 0x4d, 0x50, 0x49, 0x4c, 0x45, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4f, 0x4e, 0x20, 0x2d, 0x2d, 
+	0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+	0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0xa, 0x9, 0xa, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x47, 0x52, 
+	0x4f, 0x55, 0x50, 0x20, 0x43, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x20, 0x40, 0x45, 0x4e, 0x44, 
+	0x5d, 0x5d, 0x2d, 0x2d, 0xa, 0xa, 0x2d, 0x2d, 0x20, 0x43, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 
+	0x73, 0x20, 0x43, 0x2c, 0x20, 0x4f, 0x62, 0x6a, 0x2d, 0x43, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x43, 
+	0x2b, 0x2b, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x73, 0xa, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x55, 0x4e, 
+	0x49, 0x54, 0x54, 0x45, 0x53, 0x54, 0x53, 0xa, 0x9, 0x65, 0x72, 0x72, 0x3d, 0x31, 0x3b, 0x20, 
+	0x66, 0x69, 0x6e, 0x64, 0x3d, 0x22, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x61, 
+	0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x20, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 
+	0x22, 0x3a, 0x20, 0x43, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x28, 0x6e, 0x69, 0x6c, 0x29, 0xa, 
+	0x9, 0x65, 0x72, 0x72, 0x3d, 0x31, 0x3b, 0x20, 0x66, 0x69, 0x6e, 0x64, 0x3d, 0x22, 0x63, 0x6f, 
+	0x6d, 0x70, 0x69, 0x6c, 0x65, 0x72, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x65, 0x64, 0x20, 
+	0x61, 0x20, 0x6e, 0x69, 0x6c, 0x22, 0x3a, 0x20, 0x73, 0x20, 0x3d, 0x20, 0x4e, 0x65, 0x77, 0x53, 
+	0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x28, 0x29, 0x3b, 0x20, 0x73, 0x2e, 0x6d, 0x61, 0x70, 
+	0x70, 0x69, 0x6e, 0x67, 0x73, 0x5b, 0x22, 0x63, 0x22, 0x5d, 0x20, 0x3d, 0x20, 0x66, 0x75, 0x6e, 
+	0x63, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x29, 0x65, 0x6e, 0x64, 0x3b, 0x20, 0x43, 0x6f, 0x6d, 0x70, 
+	0x69, 0x6c, 0x65, 0x28, 0x73, 0x2c, 0x20, 0x22, 0x74, 0x65, 0x73, 0x74, 0x2e, 0x63, 0x22, 0x29, 
+	0xa, 0x9, 0x65, 0x72, 0x72, 0x3d, 0x30, 0x20, 0x3a, 0x20, 0x73, 0x20, 0x3d, 0x20, 0x4e, 0x65, 
+	0x77, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x28, 0x29, 0x3b, 0x20, 0x43, 0x6f, 0x6d, 
+	0x70, 0x69, 0x6c, 0x65, 0x28, 0x73, 0x29, 0xa, 0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 0x2d, 0x2d, 
+	0xa, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x46, 0x55, 0x4e, 0x43, 0x54, 0x49, 0x4f, 0x4e, 0x20, 0x43, 
+	0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2c, 
+	0x20, 0x2e, 0x2e, 0x2e, 0x29, 0xa, 0x9, 0x43, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x73, 0x20, 
+	0x61, 0x20, 0x73, 0x65, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x20, 0x75, 
+	0x73, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6c, 0x69, 0x65, 
+	0x64, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x20, 0x49, 0x74, 0x20, 0x75, 
+	0x73, 0x65, 0x73, 0xa, 0x9, 0x5e, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 
+	0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x2e, 0x6d, 0x61, 0x70, 0x70, 0x69, 0x6e, 0x67, 0x73, 0x5e, 
+	0x20, 0x74, 0x6f, 0x20, 0x6d, 0x61, 0x70, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6e, 0x70, 0x75, 
+	0x74, 0x20, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x74, 0x6f, 0x20, 0x61, 
+	0x20, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x72, 0xa, 0x9, 0x66, 0x75, 0x6e, 0x63, 0x74, 
+	0x69, 0x6f, 0x6e, 0x2e, 0x20, 0x41, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x72, 0x20, 
+	0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x73, 0x68, 0x6f, 0x75, 0x6c, 0x64, 
+	0x20, 0x6c, 0x6f, 0x6f, 0x6b, 0x20, 0x6c, 0x69, 0x6b, 0x65, 0x20, 0x5e, 0x43, 0x6f, 0x6d, 0x70, 
+	0x69, 0x6c, 0x65, 0x72, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2c, 0x20, 0x69, 
+	0x6e, 0x70, 0x75, 0x74, 0x29, 0x5e, 0xa, 0x9, 0x77, 0x68, 0x65, 0x72, 0x65, 0x20, 0x5e, 0x73, 
+	0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x5e, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 
+	0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x20, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x20, 
+	0x61, 0x6e, 0x64, 0x20, 0x5e, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x5e, 0x20, 0x69, 0x73, 0x20, 0x74, 
+	0x68, 0x65, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0xa, 0x9, 0x6f, 0x66, 0x20, 
+	0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x63, 0x6f, 0x6d, 0x70, 
+	0x69, 0x6c, 0x65, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 
+	0x6e, 0x20, 0x73, 0x68, 0x6f, 0x75, 0x6c, 0x64, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 
+	0x61, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x61, 0x74, 0xa, 0x9, 0x63, 
+	0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6f, 0x62, 0x6a, 0x65, 
+	0x63, 0x74, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x74, 0x20, 
+	0x77, 0x69, 0x6c, 0x6c, 0x20, 0x67, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x65, 0x2e, 0xa, 0xa, 
+	0x9, 0x7b, 0x7b, 0x7b, 0x7b, 0xa, 0x9, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 
+	0x4d, 0x79, 0x43, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x72, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 
+	0x6e, 0x67, 0x73, 0x2c, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x29, 0xa, 0x9, 0x5c, 0x74, 0x2d, 
+	0x2d, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x20, 0x73, 0x74, 0x75, 0x66, 0x66, 0xa, 
+	0x9, 0x5c, 0x74, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 
+	0xa, 0x9, 0x65, 0x6e, 0x64, 0xa, 0x9, 0xa, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 
+	0x73, 0x2e, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x2e, 0x6d, 0x61, 0x70, 0x70, 0x69, 0x6e, 
+	0x67, 0x73, 0x5b, 0x22, 0x2e, 0x6d, 0x79, 0x22, 0x5d, 0x20, 0x3d, 0x20, 0x4d, 0x79, 0x43, 0x6f, 
+	0x6d, 0x70, 0x69, 0x6c, 0x65, 0x72, 0xa, 0x9, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 
+	0x3d, 0x20, 0x43, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 
+	0x67, 0x73, 0x2c, 0x20, 0x22, 0x63, 0x6f, 0x64, 0x65, 0x2e, 0x6d, 0x79, 0x22, 0x29, 0x20, 0x2d, 
+	0x2d, 0x20, 0x49, 0x6e, 0x76, 0x6f, 0x6b, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x4d, 0x79, 
+	0x43, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x72, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 
+	0x6e, 0xa, 0x9, 0x7d, 0x7d, 0x7d, 0x7d, 0xa, 0x9, 0xa, 0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 
+	0x2d, 0x2d, 0xa, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x43, 0x6f, 0x6d, 0x70, 
+	0x69, 0x6c, 0x65, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2c, 0x20, 0x2e, 0x2e, 
+	0x2e, 0x29, 0xa, 0x9, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 
+	0x73, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x29, 0xa, 0x9, 0x6c, 0x6f, 0x63, 
+	0x61, 0x6c, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x73, 0x20, 0x3d, 0x20, 0x7b, 0x7d, 0xa, 
+	0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x6d, 0x61, 0x70, 0x70, 0x69, 0x6e, 0x67, 0x73, 0x20, 
+	0x3d, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 0x6f, 0x6d, 0x70, 0x69, 
+	0x6c, 0x65, 0x2e, 0x6d, 0x61, 0x70, 0x70, 0x69, 0x6e, 0x67, 0x73, 0xa, 0x9, 0x6c, 0x6f, 0x63, 
+	0x61, 0x6c, 0x20, 0x69, 0x6e, 0x73, 0x65, 0x72, 0x74, 0x20, 0x3d, 0x20, 0x74, 0x61, 0x62, 0x6c, 
+	0x65, 0x2e, 0x69, 0x6e, 0x73, 0x65, 0x72, 0x74, 0xa, 0x9, 0xa, 0x9, 0x2d, 0x2d, 0x20, 0x54, 
+	0x4f, 0x44, 0x4f, 0x3a, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x68, 0x65, 0x72, 0x65, 0x20, 0x69, 
+	0x73, 0x20, 0x61, 0x77, 0x61, 0x72, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 
+	0x69, 0x66, 0x66, 0x65, 0x72, 0x65, 0x6e, 0x74, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 
+	0x72, 0x73, 0x2c, 0x20, 0x73, 0x68, 0x6f, 0x75, 0x6c, 0x64, 0x20, 0x62, 0x65, 0x20, 0x6d, 0x6f, 
+	0x76, 0x65, 0x64, 0x20, 0x73, 0x6f, 0x6d, 0x65, 0x77, 0x68, 0x65, 0x72, 0x65, 0xa, 0x9, 0x62, 
+	0x61, 0x6d, 0x5f, 0x61, 0x64, 0x64, 0x5f, 0x64, 0x65, 0x70, 0x65, 0x6e, 0x64, 0x65, 0x6e, 0x63, 
+	0x79, 0x5f, 0x63, 0x70, 0x70, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x70, 0x61, 0x74, 0x68, 0x73, 0x28, 
+	0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 0x63, 0x2e, 0x69, 0x6e, 0x63, 0x6c, 
+	0x75, 0x64, 0x65, 0x73, 0x29, 0xa, 0x9, 0xa, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 
+	0x73, 0x2e, 0x69, 0x6e, 0x76, 0x6f, 0x6b, 0x65, 0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x3d, 
+	0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x69, 0x6e, 0x76, 0x6f, 0x6b, 0x65, 
+	0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x2b, 0x20, 0x31, 0xa, 0x9, 0x66, 0x6f, 0x72, 0x20, 
+	0x69, 0x6e, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x57, 
+	0x61, 0x6c, 0x6b, 0x28, 0x7b, 0x2e, 0x2e, 0x2e, 0x7d, 0x29, 0x20, 0x64, 0x6f, 0xa, 0x9, 0x9, 
+	0x2d, 0x2d, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x20, 0x63, 0x6f, 0x72, 0x72, 0x65, 0x63, 0x74, 
+	0x20, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x72, 0xa, 0x9, 0x9, 0x6c, 0x6f, 0x63, 0x61, 
+	0x6c, 0x20, 0x65, 0x78, 0x74, 0x20, 0x3d, 0x20, 0x50, 0x61, 0x74, 0x68, 0x46, 0x69, 0x6c, 0x65, 
+	0x45, 0x78, 0x74, 0x28, 0x69, 0x6e, 0x6e, 0x61, 0x6d, 0x65, 0x29, 0xa, 0x9, 0x9, 0x6c, 0x6f, 
+	0x63, 0x61, 0x6c, 0x20, 0x43, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x72, 0x20, 0x3d, 0x20, 0x6d, 
+	0x61, 0x70, 0x70, 0x69, 0x6e, 0x67, 0x73, 0x5b, 0x65, 0x78, 0x74, 0x5d, 0xa, 0xa, 0x9, 0x9, 
+	0x69, 0x66, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x43, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x72, 0x20, 
+	0x74, 0x68, 0x65, 0x6e, 0xa, 0x9, 0x9, 0x9, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x28, 0x22, 0x27, 
+	0x22, 0x2e, 0x2e, 0x69, 0x6e, 0x6e, 0x61, 0x6d, 0x65, 0x2e, 0x2e, 0x22, 0x27, 0x20, 0x68, 0x61, 
+	0x73, 0x20, 0x75, 0x6e, 0x6b, 0x6e, 0x6f, 0x77, 0x6e, 0x20, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x74, 
+	0x69, 0x6f, 0x6e, 0x20, 0x27, 0x22, 0x2e, 0x2e, 0x65, 0x78, 0x74, 0x2e, 0x2e, 0x22, 0x27, 0x20, 
+	0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x74, 0x68, 0x65, 0x72, 0x65, 0x20, 0x61, 0x72, 0x65, 0x20, 
+	0x6e, 0x6f, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x72, 0x20, 0x66, 0x6f, 0x72, 0x22, 
+	0x29, 0xa, 0x9, 0x9, 0x65, 0x6e, 0x64, 0xa, 0x9, 0x9, 0xa, 0x9, 0x9, 0x69, 0x6e, 0x73, 
+	0x65, 0x72, 0x74, 0x28, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x73, 0x2c, 0x20, 0x43, 0x6f, 0x6d, 
+	0x70, 0x69, 0x6c, 0x65, 0x72, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2c, 0x20, 
+	0x69, 0x6e, 0x6e, 0x61, 0x6d, 0x65, 0x29, 0x29, 0xa, 0x9, 0x65, 0x6e, 0x64, 0xa, 0x9, 0xa, 
+	0x9, 0x2d, 0x2d, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6f, 
+	0x75, 0x74, 0x70, 0x75, 0x74, 0xa, 0x9, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x6f, 0x75, 
+	0x74, 0x70, 0x75, 0x74, 0x73, 0xa, 0x65, 0x6e, 0x64, 0xa, 0xa, 0x66, 0x75, 0x6e, 0x63, 0x74, 
+	0x69, 0x6f, 0x6e, 0x20, 0x43, 0x54, 0x65, 0x73, 0x74, 0x43, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 
+	0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2c, 0x20, 0x63, 0x6f, 0x64, 0x65, 0x2c, 
+	0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x29, 0xa, 0x9, 0x72, 0x65, 0x74, 0x75, 0x72, 
+	0x6e, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 0x63, 0x2e, 0x44, 0x72, 
+	0x69, 0x76, 0x65, 0x72, 0x43, 0x54, 0x65, 0x73, 0x74, 0x28, 0x63, 0x6f, 0x64, 0x65, 0x2c, 0x20, 
+	0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x29, 0xa, 0x65, 0x6e, 0x64, 0xa, 0xa, 0x41, 0x64, 
+	0x64, 0x54, 0x6f, 0x6f, 0x6c, 0x28, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x28, 
+	0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x29, 0xa, 0x9, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 
+	0x46, 0x55, 0x4e, 0x43, 0x54, 0x49, 0x4f, 0x4e, 0x20, 0x43, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 
+	0x20, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x20, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 
+	0x6e, 0x67, 0x73, 0x2e, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x29, 0xa, 0x9, 0x9, 0x3c, 
+	0x74, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0xa, 0x9, 0x9, 0x3c, 0x74, 0x72, 0x3e, 0x3c, 0x74, 0x64, 
+	0x3e, 0x5e, 0x6d, 0x61, 0x70, 0x70, 0x69, 0x6e, 0x67, 0x73, 0x5e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 
+	0x3c, 0x74, 0x64, 0x3e, 0xa, 0x9, 0x9, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x74, 0x68, 0x61, 
+	0x74, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x65, 0x73, 0x20, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x74, 
+	0x69, 0x6f, 0x6e, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x61, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 
+	0x65, 0x72, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x20, 0x53, 0x65, 0x65, 
+	0x20, 0x74, 0x68, 0x65, 0xa, 0x9, 0x9, 0x43, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x20, 0x66, 
+	0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x61, 0x20, 0x72, 0x65, 
+	0x66, 0x65, 0x72, 0x65, 0x6e, 0x63, 0x65, 0x20, 0x68, 0x6f, 0x77, 0x20, 0x74, 0x68, 0x69, 0x73, 
+	0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x69, 0x73, 0x20, 0x75, 0x73, 0x65, 0x64, 0x2e, 0xa, 
+	0x9, 0x9, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xa, 0x9, 0x9, 0x3c, 
+	0x2f, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0xa, 0x9, 0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 0xa, 
+	0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 
+	0x65, 0x20, 0x3d, 0x20, 0x7b, 0x7d, 0xa, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 
+	0x2e, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x2e, 0x6d, 0x61, 0x70, 0x70, 0x69, 0x6e, 0x67, 
+	0x73, 0x20, 0x3d, 0x20, 0x7b, 0x7d, 0xa, 0x9, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x4c, 0x6f, 0x63, 
+	0x6b, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 0x6f, 0x6d, 0x70, 0x69, 
+	0x6c, 0x65, 0x29, 0xa, 0x65, 0x6e, 0x64, 0x29, 0xa, 0xa, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+	0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+	0x2d, 0x2d, 0x20, 0x43, 0x2f, 0x43, 0x2b, 0x2b, 0x20, 0x43, 0x4f, 0x4d, 0x50, 0x49, 0x4c, 0x45, 
+	0x20, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+	0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0xa, 0xa, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 
+	0x46, 0x55, 0x4e, 0x43, 0x54, 0x49, 0x4f, 0x4e, 0x20, 0x43, 0x2f, 0x43, 0x2b, 0x2b, 0x20, 0x53, 
+	0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x20, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 
+	0x73, 0x2e, 0x63, 0x63, 0x29, 0xa, 0x3c, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0xa, 0x40, 0x50, 
+	0x41, 0x55, 0x53, 0x45, 0x5d, 0x5d, 0xa, 0xa, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 
+	0x20, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x4e, 0x75, 0x6c, 0x6c, 0x28, 0x29, 0xa, 0x9, 0x65, 
+	0x72, 0x72, 0x6f, 0x72, 0x28, 0x22, 0x6e, 0x6f, 0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x72, 0x20, 
+	0x73, 0x65, 0x74, 0x22, 0x29, 0xa, 0x65, 0x6e, 0x64, 0xa, 0xa, 0x66, 0x75, 0x6e, 0x63, 0x74, 
+	0x69, 0x6f, 0x6e, 0x20, 0x49, 0x6e, 0x69, 0x74, 0x43, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x43, 0x43, 
+	0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x72, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 
+	0x29, 0xa, 0x9, 0x69, 0x66, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 
+	0x63, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x65, 0x6e, 
+	0x64, 0xa, 0x9, 0xa, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 0x63, 
+	0x20, 0x3d, 0x20, 0x7b, 0x7d, 0xa, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 
+	0x63, 0x63, 0x2e, 0x5f, 0x63, 0x5f, 0x63, 0x61, 0x63, 0x68, 0x65, 0x20, 0x3d, 0x20, 0x7b, 0x20, 
+	0x6e, 0x72, 0x20, 0x3d, 0x20, 0x30, 0x2c, 0x20, 0x73, 0x74, 0x72, 0x20, 0x3d, 0x20, 0x22, 0x22, 
+	0x20, 0x7d, 0xa, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 0x63, 0x2e, 
+	0x5f, 0x63, 0x78, 0x78, 0x5f, 0x63, 0x61, 0x63, 0x68, 0x65, 0x20, 0x3d, 0x20, 0x7b, 0x20, 0x6e, 
+	0x72, 0x20, 0x3d, 0x20, 0x30, 0x2c, 0x20, 0x73, 0x74, 0x72, 0x20, 0x3d, 0x20, 0x22, 0x22, 0x20, 
+	0x7d, 0xa, 0xa, 0x9, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x52, 0x45, 0x53, 0x55, 0x4d, 0x45, 0xa, 
+	0x9, 0x9, 0x3c, 0x74, 0x72, 0x3e, 0x3c, 0x74, 0x64, 0x3e, 0x5e, 0x64, 0x65, 0x66, 0x69, 0x6e, 
+	0x65, 0x73, 0x5e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x3c, 0x74, 0x64, 0x3e, 0xa, 0x9, 0x9, 0x54, 
+	0x61, 0x62, 0x6c, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x73, 0x20, 
+	0x74, 0x68, 0x61, 0x74, 0x20, 0x73, 0x68, 0x6f, 0x75, 0x6c, 0x64, 0x20, 0x62, 0x65, 0x20, 0x73, 
+	0x65, 0x74, 0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x69, 0x6e, 
+	0x67, 0x2e, 0xa, 0x9, 0x9, 0xa, 0x9, 0x9, 0x7b, 0x7b, 0x7b, 0x7b, 0xa, 0x9, 0x9, 0x9, 
+	0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 0x63, 0x2e, 0x64, 0x65, 0x66, 0x69, 
+	0x6e, 0x65, 0x73, 0x3a, 0x41, 0x64, 0x64, 0x28, 0x22, 0x41, 0x4e, 0x53, 0x57, 0x45, 0x52, 0x3d, 
+	0x34, 0x32, 0x22, 0x29, 0xa, 0x9, 0x9, 0x7d, 0x7d, 0x7d, 0x7d, 0xa, 0x9, 0x9, 0x3c, 0x2f, 
+	0x74, 0x64, 0x3e, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xa, 0x9, 0x40, 0x50, 0x41, 0x55, 0x53, 0x45, 
+	0x5d, 0x5d, 0xa, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 0x63, 0x2e, 
+	0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x73, 0x20, 0x3d, 0x20, 0x4e, 0x65, 0x77, 0x54, 0x61, 0x62, 
+	0x6c, 0x65, 0x28, 0x29, 0xa, 0xa, 0x9, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x52, 0x45, 0x53, 0x55, 
+	0x4d, 0x45, 0xa, 0x9, 0x40, 0x50, 0x41, 0x55, 0x53, 0x45, 0x5d, 0x5d, 0xa, 0x9, 0x73, 0x65, 
+	0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 0x63, 0x2e, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 
+	0x43, 0x54, 0x65, 0x73, 0x74, 0x20, 0x3d, 0x20, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x4e, 0x75, 
+	0x6c, 0x6c, 0xa, 0x9, 0xa, 0x9, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x52, 0x45, 0x53, 0x55, 0x4d, 
+	0x45, 0xa, 0x9, 0x9, 0x3c, 0x74, 0x72, 0x3e, 0x3c, 0x74, 0x64, 0x3e, 0x5e, 0x44, 0x72, 0x69, 
+	0x76, 0x65, 0x72, 0x43, 0x5e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x3c, 0x74, 0x64, 0x3e, 0xa, 0x9, 
+	0x9, 0x46, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x64, 
+	0x72, 0x69, 0x76, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x43, 0x20, 0x63, 0x6f, 0x6d, 0x70, 
+	0x69, 0x6c, 0x65, 0x72, 0x2e, 0x20, 0x46, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x69, 
+	0x73, 0x20, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x69, 0x62, 0x6c, 0x65, 0xa, 0x9, 0x9, 
+	0x66, 0x6f, 0x72, 0x20, 0x62, 0x75, 0x69, 0x6c, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 
+	0x20, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x61, 0x6e, 
+	0x64, 0x20, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6a, 0x6f, 0x62, 
+	0x20, 0x74, 0x6f, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x20, 0x74, 0x68, 0x65, 0xa, 
+	0x9, 0x9, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x2e, 0xa, 0x9, 0x9, 
+	0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xa, 0x9, 0x40, 0x50, 0x41, 0x55, 
+	0x53, 0x45, 0x5d, 0x5d, 0xa, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 
+	0x63, 0x2e, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x43, 0x20, 0x3d, 0x20, 0x44, 0x72, 0x69, 0x76, 
+	0x65, 0x72, 0x4e, 0x75, 0x6c, 0x6c, 0xa, 0x9, 0xa, 0x9, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x52, 
+	0x45, 0x53, 0x55, 0x4d, 0x45, 0xa, 0x9, 0x9, 0x3c, 0x74, 0x72, 0x3e, 0x3c, 0x74, 0x64, 0x3e, 
+	0x5e, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x43, 0x58, 0x58, 0x5e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 
+	0x3c, 0x74, 0x64, 0x3e, 0xa, 0x9, 0x9, 0x53, 0x61, 0x6d, 0x65, 0x20, 0x61, 0x73, 0x20, 0x44, 
+	0x72, 0x69, 0x76, 0x65, 0x72, 0x43, 0x20, 0x62, 0x75, 0x74, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 
+	0x68, 0x65, 0x20, 0x43, 0x2b, 0x2b, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x72, 0x2e, 
+	0xa, 0x9, 0x9, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xa, 0x9, 0x40, 
+	0x50, 0x41, 0x55, 0x53, 0x45, 0x5d, 0x5d, 0xa, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 
+	0x73, 0x2e, 0x63, 0x63, 0x2e, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x43, 0x58, 0x58, 0x20, 0x3d, 
+	0x20, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x4e, 0x75, 0x6c, 0x6c, 0xa, 0xa, 0x9, 0x2d, 0x2d, 
+	0x5b, 0x5b, 0x40, 0x52, 0x45, 0x53, 0x55, 0x4d, 0x45, 0xa, 0x9, 0x9, 0x3c, 0x74, 0x72, 0x3e, 
+	0x3c, 0x74, 0x64, 0x3e, 0x5e, 0x65, 0x78, 0x65, 0x5f, 0x63, 0x5e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 
+	0x3c, 0x74, 0x64, 0x3e, 0x4e, 0x61, 0x6d, 0x65, 0x20, 0x28, 0x61, 0x6e, 0x64, 0x20, 0x70, 0x61, 
+	0x74, 0x68, 0x29, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x78, 0x65, 0x63, 0x75, 
+	0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 
+	0x65, 0x20, 0x43, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x72, 0x3c, 0x2f, 0x74, 0x64, 
+	0x3e, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xa, 0x9, 0x40, 0x50, 0x41, 0x55, 0x53, 0x45, 0x5d, 0x5d, 
+	0xa, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 0x63, 0x2e, 0x65, 0x78, 
+	0x65, 0x5f, 0x63, 0x20, 0x3d, 0x20, 0x22, 0x22, 0xa, 0xa, 0x9, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 
+	0x52, 0x45, 0x53, 0x55, 0x4d, 0x45, 0xa, 0x9, 0x9, 0x3c, 0x74, 0x72, 0x3e, 0x3c, 0x74, 0x64, 
+	0x3e, 0x5e, 0x65, 0x78, 0x65, 0x5f, 0x63, 0x78, 0x78, 0x5e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x3c, 
+	0x74, 0x64, 0x3e, 0x53, 0x61, 0x6d, 0x65, 0x20, 0x61, 0x73, 0x20, 0x63, 0x5f, 0x65, 0x78, 0x65, 
+	0x20, 0x62, 0x75, 0x74, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x43, 0x2b, 0x2b, 
+	0x20, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x72, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x3c, 0x2f, 
+	0x74, 0x72, 0x3e, 0xa, 0x9, 0x40, 0x50, 0x41, 0x55, 0x53, 0x45, 0x5d, 0x5d, 0xa, 0x9, 0x73, 
+	0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 0x63, 0x2e, 0x65, 0x78, 0x65, 0x5f, 0x63, 
+	0x78, 0x78, 0x20, 0x3d, 0x20, 0x22, 0x22, 0xa, 0xa, 0x9, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x52, 
+	0x45, 0x53, 0x55, 0x4d, 0x45, 0xa, 0x9, 0x9, 0x3c, 0x74, 0x72, 0x3e, 0x3c, 0x74, 0x64, 0x3e, 
+	0x5e, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x73, 0x69, 0x6f, 0x6e, 0x5e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 
+	0x3c, 0x74, 0x64, 0x3e, 0xa, 0x9, 0x9, 0x45, 0x78, 0x74, 0x65, 0x6e, 0x74, 0x69, 0x6f, 0x6e, 
+	0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 
+	0x20, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x20, 0x73, 0x68, 0x6f, 0x75, 0x6c, 0x64, 0x20, 0x68, 0x61, 
+	0x76, 0x65, 0x2e, 0x20, 0x55, 0x73, 0x61, 0x6c, 0x6c, 0x79, 0x20, 0x22, 0x2e, 0x6f, 0x22, 0x20, 
+	0x6f, 0x72, 0x20, 0x22, 0x2e, 0x6f, 0x62, 0x6a, 0x22, 0xa, 0x9, 0x9, 0x64, 0x65, 0x70, 0x65, 
+	0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x6f, 0x6e, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 
+	0x72, 0x20, 0x74, 0x6f, 0x6f, 0x6c, 0x20, 0x63, 0x68, 0x61, 0x69, 0x6e, 0x2e, 0xa, 0x9, 0x9, 
+	0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xa, 0x9, 0x40, 0x50, 0x41, 0x55, 
+	0x53, 0x45, 0x5d, 0x5d, 0xa, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 
+	0x63, 0x2e, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x3d, 0x20, 0x22, 0x22, 
+	0xa, 0xa, 0x9, 0x9, 0xa, 0x9, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x52, 0x45, 0x53, 0x55, 0x4d, 
+	0x45, 0xa, 0x9, 0x9, 0x3c, 0x74, 0x72, 0x3e, 0x3c, 0x74, 0x64, 0x3e, 0x5e, 0x66, 0x6c, 0x61, 
+	0x67, 0x73, 0x5e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x3c, 0x74, 0x64, 0x3e, 0xa, 0x9, 0x9, 0x54, 
+	0x61, 0x62, 0x6c, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x74, 0x68, 
+	0x61, 0x74, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x62, 0x65, 0x20, 0x61, 0x70, 0x70, 0x65, 0x6e, 
+	0x64, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 
+	0x6e, 0x64, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0xa, 0x9, 
+	0x9, 0x43, 0x2f, 0x43, 0x2b, 0x2b, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x72, 0x2e, 
+	0x20, 0x54, 0x68, 0x65, 0x73, 0x65, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x61, 0x72, 0x65, 
+	0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x62, 0x6f, 0x74, 0x68, 0x20, 0x74, 
+	0x68, 0x65, 0x20, 0x43, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x43, 0x2b, 0x2b, 0xa, 0x9, 0x9, 0x63, 
+	0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x72, 0x2e, 0xa, 0x9, 0x9, 0xa, 0x9, 0x9, 0x7b, 0x7b, 
+	0x7b, 0x7b, 0xa, 0x9, 0x9, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 
+	0x63, 0x2e, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x3a, 0x41, 0x64, 0x64, 0x28, 0x22, 0x2d, 0x4f, 0x32, 
+	0x22, 0x2c, 0x20, 0x22, 0x2d, 0x67, 0x22, 0x29, 0xa, 0x9, 0x9, 0x7d, 0x7d, 0x7d, 0x7d, 0xa, 
+	0x9, 0x9, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xa, 0x9, 0x40, 0x50, 
+	0x41, 0x55, 0x53, 0x45, 0x5d, 0x5d, 0xa, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 
+	0x2e, 0x63, 0x63, 0x2e, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x3d, 0x20, 0x4e, 0x65, 0x77, 0x46, 
+	0x6c, 0x61, 0x67, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x28, 0x29, 0xa, 0x9, 0xa, 0x9, 0x2d, 0x2d, 
+	0x5b, 0x5b, 0x40, 0x52, 0x45, 0x53, 0x55, 0x4d, 0x45, 0xa, 0x9, 0x9, 0x3c, 0x74, 0x72, 0x3e, 
+	0x3c, 0x74, 0x64, 0x3e, 0x5e, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x5f, 0x63, 0x5e, 0x3c, 0x2f, 0x74, 
+	0x64, 0x3e, 0x3c, 0x74, 0x64, 0x3e, 0xa, 0x9, 0x9, 0x53, 0x61, 0x6d, 0x65, 0x20, 0x61, 0x73, 
+	0x20, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x62, 0x75, 0x74, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 
+	0x66, 0x69, 0x63, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x43, 0x20, 0x63, 0x6f, 
+	0x6d, 0x70, 0x69, 0x6c, 0x65, 0x72, 0x2e, 0xa, 0x9, 0x9, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x3c, 
+	0x2f, 0x74, 0x72, 0x3e, 0xa, 0x9, 0x40, 0x50, 0x41, 0x55, 0x53, 0x45, 0x5d, 0x5d, 0xa, 0x9, 
+	0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 0x63, 0x2e, 0x66, 0x6c, 0x61, 0x67, 
+	0x73, 0x5f, 0x63, 0x20, 0x3d, 0x20, 0x4e, 0x65, 0x77, 0x46, 0x6c, 0x61, 0x67, 0x54, 0x61, 0x62, 
+	0x6c, 0x65, 0x28, 0x29, 0xa, 0xa, 0x9, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x52, 0x45, 0x53, 0x55, 
+	0x4d, 0x45, 0xa, 0x9, 0x9, 0x3c, 0x74, 0x72, 0x3e, 0x3c, 0x74, 0x64, 0x3e, 0x5e, 0x66, 0x6c, 
+	0x61, 0x67, 0x73, 0x5f, 0x63, 0x78, 0x78, 0x5e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x3c, 0x74, 0x64, 
+	0x3e, 0xa, 0x9, 0x9, 0x53, 0x61, 0x6d, 0x65, 0x20, 0x61, 0x73, 0x20, 0x66, 0x6c, 0x61, 0x67, 
+	0x73, 0x20, 0x62, 0x75, 0x74, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x63, 0x20, 0x66, 
+	0x6f, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x43, 0x2b, 0x2b, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x69, 
+	0x6c, 0x65, 0x72, 0x2e, 0xa, 0x9, 0x9, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x3c, 0x2f, 0x74, 0x72, 
+	0x3e, 0xa, 0x9, 0x40, 0x50, 0x41, 0x55, 0x53, 0x45, 0x5d, 0x5d, 0xa, 0x9, 0x73, 0x65, 0x74, 
+	0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 0x63, 0x2e, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x5f, 0x63, 
+	0x78, 0x78, 0x20, 0x3d, 0x20, 0x4e, 0x65, 0x77, 0x46, 0x6c, 0x61, 0x67, 0x54, 0x61, 0x62, 0x6c, 
+	0x65, 0x28, 0x29, 0xa, 0xa, 0x9, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x52, 0x45, 0x53, 0x55, 0x4d, 
+	0x45, 0xa, 0x9, 0x9, 0x3c, 0x74, 0x72, 0x3e, 0x3c, 0x74, 0x64, 0x3e, 0x5e, 0x66, 0x72, 0x61, 
+	0x6d, 0x65, 0x77, 0x6f, 0x72, 0x6b, 0x73, 0x5e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x3c, 0x74, 0x64, 
+	0x3e, 0xa, 0x9, 0x9, 0x4d, 0x61, 0x63, 0x20, 0x4f, 0x53, 0x20, 0x58, 0x20, 0x73, 0x70, 0x65, 
+	0x63, 0x69, 0x66, 0x69, 0x63, 0x2e, 0x20, 0x57, 0x68, 0x61, 0x74, 0x20, 0x66, 0x72, 0x61, 0x6d, 
+	0x65, 0x77, 0x6f, 0x72, 0x6b, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x75, 0x73, 0x65, 0x20, 0x77, 0x68, 
+	0x65, 0x6e, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x69, 0x6e, 0x67, 0x2e, 0xa, 0x9, 0x9, 
+	0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xa, 0x9, 0x40, 0x50, 0x41, 0x55, 
+	0x53, 0x45, 0x5d, 0x5d, 0xa, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 
+	0x63, 0x2e, 0x66, 0x72, 0x61, 0x6d, 0x65, 0x77, 0x6f, 0x72, 0x6b, 0x73, 0x20, 0x3d, 0x20, 0x4e, 
+	0x65, 0x77, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x28, 0x29, 0xa, 0x9, 0x9, 0x9, 0xa, 0x9, 0x2d, 
+	0x2d, 0x5b, 0x5b, 0x40, 0x52, 0x45, 0x53, 0x55, 0x4d, 0x45, 0xa, 0x9, 0x9, 0x3c, 0x74, 0x72, 
+	0x3e, 0x3c, 0x74, 0x64, 0x3e, 0x5e, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x73, 0x5e, 0x3c, 
+	0x2f, 0x74, 0x64, 0x3e, 0x3c, 0x74, 0x64, 0x3e, 0xa, 0x9, 0x9, 0x54, 0x61, 0x62, 0x6c, 0x65, 
+	0x20, 0x6f, 0x66, 0x20, 0x70, 0x61, 0x74, 0x68, 0x73, 0x20, 0x77, 0x68, 0x65, 0x72, 0x65, 0x20, 
+	0x74, 0x6f, 0x20, 0x66, 0x69, 0x6e, 0x64, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73, 0x2e, 
+	0xa, 0x9, 0x9, 0xa, 0x9, 0x9, 0x7b, 0x7b, 0x7b, 0x7b, 0xa, 0x9, 0x9, 0x9, 0x73, 0x65, 
+	0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 0x63, 0x2e, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 
+	0x65, 0x73, 0x3a, 0x41, 0x64, 0x64, 0x28, 0x22, 0x6d, 0x79, 0x2f, 0x69, 0x6e, 0x63, 0x6c, 0x75, 
+	0x64, 0x65, 0x2f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x79, 0x22, 0x29, 0xa, 0x9, 
+	0x9, 0x7d, 0x7d, 0x7d, 0x7d, 0x9, 0x9, 0xa, 0x9, 0x9, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x3c, 
+	0x2f, 0x74, 0x72, 0x3e, 0xa, 0x9, 0x40, 0x50, 0x41, 0x55, 0x53, 0x45, 0x5d, 0x5d, 0xa, 0x9, 
+	0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 0x63, 0x2e, 0x69, 0x6e, 0x63, 0x6c, 
+	0x75, 0x64, 0x65, 0x73, 0x20, 0x3d, 0x20, 0x4e, 0x65, 0x77, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x28, 
+	0x29, 0xa, 0x9, 0xa, 0x9, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x52, 0x45, 0x53, 0x55, 0x4d, 0x45, 
+	0xa, 0x9, 0x9, 0x3c, 0x74, 0x72, 0x3e, 0x3c, 0x74, 0x64, 0x3e, 0x5e, 0x4f, 0x75, 0x74, 0x70, 
+	0x75, 0x74, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2c, 0x20, 0x70, 0x61, 0x74, 
+	0x68, 0x29, 0x5e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x3c, 0x74, 0x64, 0x3e, 0xa, 0x9, 0x9, 0x46, 
+	0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x73, 0x68, 0x6f, 
+	0x75, 0x6c, 0x64, 0x20, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x74, 0x68, 
+	0x65, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x70, 0x61, 0x74, 0x68, 0xa, 0x9, 0x9, 0x69, 
+	0x6e, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x20, 0x70, 
+	0x61, 0x74, 0x68, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x69, 
+	0x6e, 0x67, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x73, 
+	0x69, 0x6f, 0x6e, 0x20, 0x69, 0x73, 0x20, 0x64, 0x6f, 0x6e, 0x65, 0xa, 0x9, 0x9, 0x61, 0x75, 
+	0x74, 0x6f, 0x6d, 0x61, 0x74, 0x69, 0x63, 0x6c, 0x79, 0x2e, 0xa, 0x9, 0x9, 0xa, 0x9, 0x9, 
+	0x7b, 0x7b, 0x7b, 0x7b, 0xa, 0x9, 0x9, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 
+	0x2e, 0x63, 0x63, 0x2e, 0x4f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x20, 0x3d, 0x20, 0x66, 0x75, 0x6e, 
+	0x63, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2c, 0x20, 
+	0x69, 0x6e, 0x70, 0x75, 0x74, 0x29, 0xa, 0x9, 0x9, 0x9, 0x26, 0x6e, 0x62, 0x73, 0x70, 0x3b, 
+	0x26, 0x6e, 0x62, 0x73, 0x70, 0x3b, 0x26, 0x6e, 0x62, 0x73, 0x70, 0x3b, 0x26, 0x6e, 0x62, 0x73, 
+	0x70, 0x3b, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x50, 0x61, 0x74, 0x68, 0x42, 0x61, 0x73, 
+	0x65, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x29, 0x20, 0x2e, 0x2e, 0x20, 0x73, 0x65, 0x74, 0x74, 
+	0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x5f, 0x65, 0x78, 0x74, 0xa, 
+	0x9, 0x9, 0x9, 0x65, 0x6e, 0x64, 0xa, 0x9, 0x9, 0x7d, 0x7d, 0x7d, 0x7d, 0xa, 0x9, 0x9, 
+	0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xa, 0x9, 0x40, 0x50, 0x41, 0x55, 
+	0x53, 0x45, 0x5d, 0x5d, 0xa, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 
+	0x63, 0x2e, 0x4f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x20, 0x3d, 0x20, 0x44, 0x65, 0x66, 0x61, 0x75, 
+	0x6c, 0x74, 0x5f, 0x49, 0x6e, 0x74, 0x65, 0x72, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x74, 0x65, 0x5f, 
+	0x4f, 0x75, 0x74, 0x70, 0x75, 0x74, 0xa, 0x9, 0xa, 0x9, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x52, 
+	0x45, 0x53, 0x55, 0x4d, 0x45, 0xa, 0x9, 0x9, 0x3c, 0x74, 0x72, 0x3e, 0x3c, 0x74, 0x64, 0x3e, 
+	0x5e, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x73, 0x5e, 
+	0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x3c, 0x74, 0x64, 0x3e, 0xa, 0x9, 0x9, 0x4d, 0x61, 0x63, 0x20, 
+	0x4f, 0x53, 0x20, 0x58, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2e, 0x20, 0x54, 
+	0x61, 0x62, 0x6c, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x70, 0x61, 0x74, 0x68, 0x73, 0x20, 0x77, 0x68, 
+	0x65, 0x72, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x66, 0x69, 0x6e, 0x64, 0x20, 0x73, 0x79, 0x73, 0x74, 
+	0x65, 0x6d, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73, 0x2e, 0xa, 0x9, 0x9, 0x3c, 0x2f, 
+	0x74, 0x64, 0x3e, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xa, 0x9, 0x40, 0x50, 0x41, 0x55, 0x53, 0x45, 
+	0x5d, 0x5d, 0xa, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 0x63, 0x2e, 
+	0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x73, 0x20, 0x3d, 
+	0x20, 0x4e, 0x65, 0x77, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x28, 0x29, 0xa, 0xa, 0x9, 0x2d, 0x2d, 
+	0x5b, 0x5b, 0x40, 0x52, 0x45, 0x53, 0x55, 0x4d, 0x45, 0xa, 0x9, 0x9, 0x3c, 0x2f, 0x74, 0x61, 
+	0x62, 0x6c, 0x65, 0x3e, 0xa, 0x9, 0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 0xa, 0x9, 0xa, 0x9, 
+	0x54, 0x61, 0x62, 0x6c, 0x65, 0x4c, 0x6f, 0x63, 0x6b, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 
+	0x67, 0x73, 0x2e, 0x63, 0x63, 0x29, 0xa, 0x65, 0x6e, 0x64, 0xa, 0xa, 0x66, 0x75, 0x6e, 0x63, 
+	0x74, 0x69, 0x6f, 0x6e, 0x20, 0x43, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x43, 0x28, 0x73, 0x65, 
+	0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2c, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x29, 0xa, 0x9, 
+	0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x63, 0x63, 0x20, 0x3d, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 
+	0x6e, 0x67, 0x73, 0x2e, 0x63, 0x63, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x6f, 0x75, 
+	0x74, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x3d, 0x20, 0x63, 0x63, 0x2e, 0x4f, 0x75, 0x74, 0x70, 0x75, 
+	0x74, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2c, 0x20, 0x69, 0x6e, 0x70, 0x75, 
+	0x74, 0x29, 0x20, 0x2e, 0x2e, 0x20, 0x63, 0x63, 0x2e, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x73, 0x69, 
+	0x6f, 0x6e, 0xa, 0x9, 0x63, 0x63, 0x2e, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x43, 0x28, 0x73, 
+	0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x70, 0x72, 0x65, 
+	0x66, 0x69, 0x78, 0x20, 0x2e, 0x2e, 0x20, 0x22, 0x63, 0x20, 0x22, 0x20, 0x2e, 0x2e, 0x20, 0x69, 
+	0x6e, 0x70, 0x75, 0x74, 0x2c, 0x20, 0x6f, 0x75, 0x74, 0x6e, 0x61, 0x6d, 0x65, 0x2c, 0x20, 0x69, 
+	0x6e, 0x70, 0x75, 0x74, 0x2c, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x29, 0xa, 
+	0x9, 0x41, 0x64, 0x64, 0x44, 0x65, 0x70, 0x65, 0x6e, 0x64, 0x65, 0x6e, 0x63, 0x79, 0x28, 0x6f, 
+	0x75, 0x74, 0x6e, 0x61, 0x6d, 0x65, 0x2c, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x29, 0xa, 0x9, 
+	0x69, 0x66, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x49, 0x73, 0x4f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x28, 
+	0x69, 0x6e, 0x70, 0x75, 0x74, 0x29, 0x20, 0x74, 0x68, 0x65, 0x6e, 0xa, 0x9, 0x9, 0x62, 0x61, 
+	0x6d, 0x5f, 0x61, 0x64, 0x64, 0x5f, 0x64, 0x65, 0x70, 0x65, 0x6e, 0x64, 0x65, 0x6e, 0x63, 0x79, 
+	0x5f, 0x63, 0x70, 0x70, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x29, 0xa, 0x9, 0x65, 0x6e, 0x64, 
+	0xa, 0x9, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x6f, 0x75, 0x74, 0x6e, 0x61, 0x6d, 0x65, 
+	0xa, 0x65, 0x6e, 0x64, 0xa, 0xa, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x43, 
+	0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x43, 0x58, 0x58, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 
+	0x67, 0x73, 0x2c, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x29, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 
+	0x6c, 0x20, 0x63, 0x63, 0x20, 0x3d, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 
+	0x63, 0x63, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x6f, 0x75, 0x74, 0x6e, 0x61, 0x6d, 
+	0x65, 0x20, 0x3d, 0x20, 0x63, 0x63, 0x2e, 0x4f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x28, 0x73, 0x65, 
+	0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2c, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x29, 0x20, 0x2e, 
+	0x2e, 0x20, 0x63, 0x63, 0x2e, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x73, 0x69, 0x6f, 0x6e, 0xa, 0x9, 
+	0x63, 0x63, 0x2e, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x43, 0x58, 0x58, 0x28, 0x73, 0x65, 0x74, 
+	0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x70, 0x72, 0x65, 0x66, 0x69, 
+	0x78, 0x20, 0x2e, 0x2e, 0x20, 0x22, 0x63, 0x2b, 0x2b, 0x20, 0x22, 0x20, 0x2e, 0x2e, 0x20, 0x69, 
+	0x6e, 0x70, 0x75, 0x74, 0x2c, 0x20, 0x6f, 0x75, 0x74, 0x6e, 0x61, 0x6d, 0x65, 0x2c, 0x20, 0x69, 
+	0x6e, 0x70, 0x75, 0x74, 0x2c, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x29, 0xa, 
+	0x9, 0x41, 0x64, 0x64, 0x44, 0x65, 0x70, 0x65, 0x6e, 0x64, 0x65, 0x6e, 0x63, 0x79, 0x28, 0x6f, 
+	0x75, 0x74, 0x6e, 0x61, 0x6d, 0x65, 0x2c, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x29, 0xa, 0x9, 
+	0x69, 0x66, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x49, 0x73, 0x4f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x28, 
+	0x69, 0x6e, 0x70, 0x75, 0x74, 0x29, 0x20, 0x74, 0x68, 0x65, 0x6e, 0xa, 0x9, 0x9, 0x62, 0x61, 
+	0x6d, 0x5f, 0x61, 0x64, 0x64, 0x5f, 0x64, 0x65, 0x70, 0x65, 0x6e, 0x64, 0x65, 0x6e, 0x63, 0x79, 
+	0x5f, 0x63, 0x70, 0x70, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x29, 0xa, 0x9, 0x65, 0x6e, 0x64, 
+	0xa, 0x9, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x6f, 0x75, 0x74, 0x6e, 0x61, 0x6d, 0x65, 
+	0xa, 0x65, 0x6e, 0x64, 0xa, 0xa, 0xa, 0x41, 0x64, 0x64, 0x54, 0x6f, 0x6f, 0x6c, 0x28, 0x66, 
+	0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 
+	0x73, 0x29, 0xa, 0x9, 0x49, 0x6e, 0x69, 0x74, 0x43, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x43, 0x43, 
+	0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x72, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 
+	0x29, 0xa, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 0x6f, 0x6d, 0x70, 
+	0x69, 0x6c, 0x65, 0x2e, 0x6d, 0x61, 0x70, 0x70, 0x69, 0x6e, 0x67, 0x73, 0x5b, 0x22, 0x63, 0x22, 
+	0x5d, 0x20, 0x3d, 0x20, 0x43, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x43, 0xa, 0x9, 0x73, 0x65, 
+	0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x2e, 0x6d, 
+	0x61, 0x70, 0x70, 0x69, 0x6e, 0x67, 0x73, 0x5b, 0x22, 0x6d, 0x22, 0x5d, 0x20, 0x3d, 0x20, 0x43, 
+	0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x43, 0xa, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 
+	0x73, 0x2e, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x2e, 0x6d, 0x61, 0x70, 0x70, 0x69, 0x6e, 
+	0x67, 0x73, 0x5b, 0x22, 0x6d, 0x6d, 0x22, 0x5d, 0x20, 0x3d, 0x20, 0x43, 0x6f, 0x6d, 0x70, 0x69, 
+	0x6c, 0x65, 0x43, 0xa, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 0x6f, 
+	0x6d, 0x70, 0x69, 0x6c, 0x65, 0x2e, 0x6d, 0x61, 0x70, 0x70, 0x69, 0x6e, 0x67, 0x73, 0x5b, 0x22, 
+	0x53, 0x22, 0x5d, 0x20, 0x3d, 0x20, 0x43, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x43, 0xa, 0x9, 
+	0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 
+	0x2e, 0x6d, 0x61, 0x70, 0x70, 0x69, 0x6e, 0x67, 0x73, 0x5b, 0x22, 0x73, 0x22, 0x5d, 0x20, 0x3d, 
+	0x20, 0x43, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x43, 0xa, 0x65, 0x6e, 0x64, 0x29, 0xa, 0xa, 
+	0x41, 0x64, 0x64, 0x54, 0x6f, 0x6f, 0x6c, 0x28, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 
+	0x20, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x29, 0xa, 0x9, 0x49, 0x6e, 0x69, 
+	0x74, 0x43, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x43, 0x43, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x72, 
+	0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x29, 0xa, 0x9, 0x73, 0x65, 0x74, 0x74, 
+	0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x2e, 0x6d, 0x61, 0x70, 
+	0x70, 0x69, 0x6e, 0x67, 0x73, 0x5b, 0x22, 0x63, 0x70, 0x70, 0x22, 0x5d, 0x20, 0x3d, 0x20, 0x43, 
+	0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x43, 0x58, 0x58, 0xa, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 
+	0x6e, 0x67, 0x73, 0x2e, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x2e, 0x6d, 0x61, 0x70, 0x70, 
+	0x69, 0x6e, 0x67, 0x73, 0x5b, 0x22, 0x63, 0x78, 0x78, 0x22, 0x5d, 0x20, 0x3d, 0x20, 0x43, 0x6f, 
+	0x6d, 0x70, 0x69, 0x6c, 0x65, 0x43, 0x58, 0x58, 0xa, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 
+	0x67, 0x73, 0x2e, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x2e, 0x6d, 0x61, 0x70, 0x70, 0x69, 
+	0x6e, 0x67, 0x73, 0x5b, 0x22, 0x63, 0x2b, 0x2b, 0x22, 0x5d, 0x20, 0x3d, 0x20, 0x43, 0x6f, 0x6d, 
+	0x70, 0x69, 0x6c, 0x65, 0x43, 0x58, 0x58, 0xa, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 
+	0x73, 0x2e, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x2e, 0x6d, 0x61, 0x70, 0x70, 0x69, 0x6e, 
+	0x67, 0x73, 0x5b, 0x22, 0x63, 0x63, 0x22, 0x5d, 0x20, 0x3d, 0x20, 0x43, 0x6f, 0x6d, 0x70, 0x69, 
+	0x6c, 0x65, 0x43, 0x58, 0x58, 0xa, 0x65, 0x6e, 0x64, 0x29, 0xa, 0xa, 0x2d, 0x2d, 0x5b, 0x5b, 
+	0x40, 0x47, 0x52, 0x4f, 0x55, 0x50, 0x20, 0x4f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x40, 0x45, 0x4e, 
+	0x44, 0x5d, 0x5d, 0x2d, 0x2d, 0xa, 0xa, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x46, 0x55, 0x4e, 0x43, 
+	0x54, 0x49, 0x4f, 0x4e, 0x20, 0x43, 0x6f, 0x70, 0x79, 0x46, 0x69, 0x6c, 0x65, 0x28, 0x64, 0x73, 
+	0x74, 0x2c, 0x20, 0x73, 0x72, 0x63, 0x29, 0xa, 0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 0x2d, 0x2d, 
+	0xa, 0x69, 0x66, 0x20, 0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79, 0x20, 0x3d, 0x3d, 0x20, 0x22, 0x77, 
+	0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6e, 0xa, 0x9, 0x66, 0x75, 
+	0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x43, 0x6f, 0x70, 0x79, 0x46, 0x69, 0x6c, 0x65, 0x28, 
+	0x64, 0x73, 0x74, 0x2c, 0x20, 0x73, 0x72, 0x63, 0x29, 0xa, 0x9, 0x9, 0x41, 0x64, 0x64, 0x4a, 
+	0x6f, 0x62, 0x28, 0x64, 0x73, 0x74, 0x2c, 0xa, 0x9, 0x9, 0x9, 0x22, 0x63, 0x6f, 0x70, 0x79, 
+	0x20, 0x22, 0x20, 0x2e, 0x2e, 0x20, 0x73, 0x72, 0x63, 0x20, 0x2e, 0x2e, 0x20, 0x22, 0x20, 0x2d, 
+	0x3e, 0x20, 0x22, 0x20, 0x2e, 0x2e, 0x20, 0x64, 0x73, 0x74, 0x2c, 0xa, 0x9, 0x9, 0x9, 0x22, 
+	0x63, 0x6f, 0x70, 0x79, 0x20, 0x2f, 0x62, 0x20, 0x5c, 0x22, 0x22, 0x20, 0x2e, 0x2e, 0x20, 0x73, 
+	0x74, 0x72, 0x5f, 0x72, 0x65, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x28, 0x73, 0x72, 0x63, 0x2c, 0x20, 
+	0x22, 0x2f, 0x22, 0x2c, 0x20, 0x22, 0x5c, 0x5c, 0x22, 0x29, 0x20, 0x2e, 0x2e, 0x20, 0x22, 0x5c, 
+	0x22, 0x20, 0x5c, 0x22, 0x22, 0x20, 0x2e, 0x2e, 0x20, 0x73, 0x74, 0x72, 0x5f, 0x72, 0x65, 0x70, 
+	0x6c, 0x61, 0x63, 0x65, 0x28, 0x64, 0x73, 0x74, 0x2c, 0x20, 0x22, 0x2f, 0x22, 0x2c, 0x20, 0x22, 
+	0x5c, 0x5c, 0x22, 0x29, 0x20, 0x2e, 0x2e, 0x20, 0x22, 0x5c, 0x22, 0x20, 0x3e, 0x6e, 0x75, 0x6c, 
+	0x20, 0x32, 0x3e, 0x26, 0x31, 0x22, 0x2c, 0xa, 0x9, 0x9, 0x9, 0x73, 0x72, 0x63, 0x29, 0xa, 
+	0x9, 0x9, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x64, 0x73, 0x74, 0xa, 0x9, 0x65, 0x6e, 
+	0x64, 0xa, 0x65, 0x6c, 0x73, 0x65, 0xa, 0x9, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 
+	0x20, 0x43, 0x6f, 0x70, 0x79, 0x46, 0x69, 0x6c, 0x65, 0x28, 0x64, 0x73, 0x74, 0x2c, 0x20, 0x73, 
+	0x72, 0x63, 0x29, 0xa, 0x9, 0x9, 0x41, 0x64, 0x64, 0x4a, 0x6f, 0x62, 0x28, 0x64, 0x73, 0x74, 
+	0x2c, 0xa, 0x9, 0x9, 0x9, 0x22, 0x63, 0x6f, 0x70, 0x79, 0x20, 0x22, 0x20, 0x2e, 0x2e, 0x20, 
+	0x73, 0x72, 0x63, 0x20, 0x2e, 0x2e, 0x20, 0x22, 0x20, 0x2d, 0x3e, 0x20, 0x22, 0x20, 0x2e, 0x2e, 
+	0x20, 0x64, 0x73, 0x74, 0x2c, 0xa, 0x9, 0x9, 0x9, 0x22, 0x63, 0x70, 0x20, 0x5c, 0x22, 0x22, 
+	0x20, 0x2e, 0x2e, 0x20, 0x73, 0x72, 0x63, 0x20, 0x2e, 0x2e, 0x20, 0x22, 0x5c, 0x22, 0x20, 0x5c, 
+	0x22, 0x22, 0x20, 0x2e, 0x2e, 0x20, 0x64, 0x73, 0x74, 0x20, 0x2e, 0x2e, 0x20, 0x22, 0x5c, 0x22, 
+	0x22, 0x2c, 0xa, 0x9, 0x9, 0x9, 0x73, 0x72, 0x63, 0x29, 0xa, 0x9, 0x9, 0x72, 0x65, 0x74, 
+	0x75, 0x72, 0x6e, 0x20, 0x64, 0x73, 0x74, 0xa, 0x9, 0x65, 0x6e, 0x64, 0xa, 0x65, 0x6e, 0x64, 
+	0xa, 0xa, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x46, 0x55, 0x4e, 0x43, 0x54, 0x49, 0x4f, 0x4e, 0x20, 
+	0x43, 0x6f, 0x70, 0x79, 0x54, 0x6f, 0x44, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x79, 0x28, 
+	0x64, 0x73, 0x74, 0x2c, 0x20, 0x2e, 0x2e, 0x2e, 0x29, 0xa, 0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 
+	0x2d, 0x2d, 0xa, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x43, 0x6f, 0x70, 0x79, 
+	0x54, 0x6f, 0x44, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x79, 0x28, 0x64, 0x73, 0x74, 0x2c, 
+	0x20, 0x2e, 0x2e, 0x2e, 0x29, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x69, 0x6e, 0x73, 
+	0x65, 0x72, 0x74, 0x20, 0x3d, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x2e, 0x69, 0x6e, 0x73, 0x65, 
+	0x72, 0x74, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 
+	0x73, 0x20, 0x3d, 0x20, 0x7b, 0x7d, 0xa, 0x9, 0x66, 0x6f, 0x72, 0x20, 0x73, 0x72, 0x63, 0x20, 
+	0x69, 0x6e, 0x20, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x57, 0x61, 0x6c, 0x6b, 0x28, 0x7b, 0x2e, 0x2e, 
+	0x2e, 0x7d, 0x29, 0x20, 0x64, 0x6f, 0xa, 0x9, 0x9, 0x69, 0x6e, 0x73, 0x65, 0x72, 0x74, 0x28, 
+	0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x73, 0x2c, 0x20, 0x43, 0x6f, 0x70, 0x79, 0x46, 0x69, 0x6c, 
+	0x65, 0x28, 0x50, 0x61, 0x74, 0x68, 0x4a, 0x6f, 0x69, 0x6e, 0x28, 0x64, 0x73, 0x74, 0x2c, 0x20, 
+	0x50, 0x61, 0x74, 0x68, 0x46, 0x69, 0x6c, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x28, 0x73, 0x72, 0x63, 
+	0x29, 0x29, 0x2c, 0x20, 0x73, 0x72, 0x63, 0x29, 0x29, 0xa, 0x9, 0x65, 0x6e, 0x64, 0xa, 0x9, 
+	0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x73, 0xa, 0x65, 
+	0x6e, 0x64, 0xa, 0xa, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+	0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x20, 0x4c, 0x49, 0x4e, 
+	0x4b, 0x20, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+	0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0xa, 0xa, 0x2d, 0x2d, 0x5b, 0x5b, 
+	0x40, 0x47, 0x52, 0x4f, 0x55, 0x50, 0x20, 0x4c, 0x69, 0x6e, 0x6b, 0x20, 0x40, 0x45, 0x4e, 0x44, 
+	0x5d, 0x5d, 0x2d, 0x2d, 0xa, 0xa, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x46, 0x55, 0x4e, 0x43, 0x54, 
+	0x49, 0x4f, 0x4e, 0xa, 0x9, 0x54, 0x4f, 0x44, 0x4f, 0xa, 0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 
+	0x2d, 0x2d, 0xa, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x4c, 0x69, 0x6e, 0x6b, 
+	0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2c, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 
+	0x74, 0x2c, 0x20, 0x2e, 0x2e, 0x2e, 0x29, 0xa, 0x9, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x53, 0x65, 
+	0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x29, 
+	0xa, 0x9, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x73, 
+	0x20, 0x3d, 0x20, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x46, 0x6c, 0x61, 0x74, 0x74, 0x65, 0x6e, 0x28, 
+	0x7b, 0x2e, 0x2e, 0x2e, 0x7d, 0x29, 0xa, 0xa, 0x9, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x20, 
+	0x3d, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x69, 0x6e, 0x6b, 0x2e, 
+	0x4f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2c, 
+	0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x29, 0x20, 0x2e, 0x2e, 0x20, 0x73, 0x65, 0x74, 0x74, 
+	0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x69, 0x6e, 0x6b, 0x2e, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x73, 
+	0x69, 0x6f, 0x6e, 0xa, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x69, 
+	0x6e, 0x6b, 0x2e, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 
+	0x67, 0x73, 0x2e, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x20, 0x2e, 
+	0x2e, 0x20, 0x22, 0x6c, 0x69, 0x6e, 0x6b, 0x20, 0x22, 0x20, 0x2e, 0x2e, 0x20, 0x6f, 0x75, 0x74, 
+	0x70, 0x75, 0x74, 0x2c, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2c, 0x20, 0x69, 0x6e, 0x70, 
+	0x75, 0x74, 0x73, 0x2c, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x29, 0xa, 0xa, 
+	0x9, 0x2d, 0x2d, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6c, 0x65, 
+	0x73, 0xa, 0x9, 0x41, 0x64, 0x64, 0x44, 0x65, 0x70, 0x65, 0x6e, 0x64, 0x65, 0x6e, 0x63, 0x79, 
+	0x28, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2c, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x73, 0x29, 
+	0xa, 0x9, 0x41, 0x64, 0x64, 0x44, 0x65, 0x70, 0x65, 0x6e, 0x64, 0x65, 0x6e, 0x63, 0x79, 0x28, 
+	0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2c, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 
+	0x2e, 0x6c, 0x69, 0x6e, 0x6b, 0x2e, 0x65, 0x78, 0x74, 0x72, 0x61, 0x66, 0x69, 0x6c, 0x65, 0x73, 
+	0x29, 0xa, 0x9, 0xa, 0x9, 0x2d, 0x2d, 0x20, 0x61, 0x64, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 
+	0x6c, 0x69, 0x62, 0x61, 0x72, 0x69, 0x65, 0x73, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 
+	0x6c, 0x69, 0x62, 0x73, 0x20, 0x3d, 0x20, 0x7b, 0x7d, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 
+	0x20, 0x70, 0x61, 0x74, 0x68, 0x73, 0x20, 0x3d, 0x20, 0x7b, 0x7d, 0xa, 0x9, 0xa, 0x9, 0x66, 
+	0x6f, 0x72, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2c, 0x20, 0x69, 0x6e, 0x6e, 0x61, 0x6d, 0x65, 
+	0x20, 0x69, 0x6e, 0x20, 0x69, 0x70, 0x61, 0x69, 0x72, 0x73, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 
+	0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x69, 0x6e, 0x6b, 0x2e, 0x6c, 0x69, 0x62, 0x73, 0x29, 0x20, 0x64, 
+	0x6f, 0xa, 0x9, 0x9, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x2e, 0x69, 0x6e, 0x73, 0x65, 0x72, 0x74, 
+	0x28, 0x6c, 0x69, 0x62, 0x73, 0x2c, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 
+	0x6c, 0x69, 0x62, 0x2e, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x20, 0x2e, 0x2e, 0x20, 0x69, 0x6e, 
+	0x6e, 0x61, 0x6d, 0x65, 0x20, 0x2e, 0x2e, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 
+	0x2e, 0x6c, 0x69, 0x62, 0x2e, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x73, 0x69, 0x6f, 0x6e, 0x29, 0xa, 
+	0x9, 0x65, 0x6e, 0x64, 0xa, 0xa, 0x9, 0x66, 0x6f, 0x72, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 
+	0x2c, 0x20, 0x69, 0x6e, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x69, 0x70, 0x61, 0x69, 
+	0x72, 0x73, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x69, 0x6e, 0x6b, 
+	0x2e, 0x6c, 0x69, 0x62, 0x70, 0x61, 0x74, 0x68, 0x29, 0x20, 0x64, 0x6f, 0xa, 0x9, 0x9, 0x74, 
+	0x61, 0x62, 0x6c, 0x65, 0x2e, 0x69, 0x6e, 0x73, 0x65, 0x72, 0x74, 0x28, 0x70, 0x61, 0x74, 0x68, 
+	0x73, 0x2c, 0x20, 0x69, 0x6e, 0x6e, 0x61, 0x6d, 0x65, 0x29, 0xa, 0x9, 0x65, 0x6e, 0x64, 0xa, 
+	0x9, 0xa, 0x9, 0x41, 0x64, 0x64, 0x44, 0x65, 0x70, 0x65, 0x6e, 0x64, 0x65, 0x6e, 0x63, 0x79, 
+	0x53, 0x65, 0x61, 0x72, 0x63, 0x68, 0x28, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2c, 0x20, 0x70, 
+	0x61, 0x74, 0x68, 0x73, 0x2c, 0x20, 0x6c, 0x69, 0x62, 0x73, 0x29, 0xa, 0xa, 0x9, 0x72, 0x65, 
+	0x74, 0x75, 0x72, 0x6e, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0xa, 0x65, 0x6e, 0x64, 0xa, 
+	0xa, 0xa, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x46, 0x55, 0x4e, 0x43, 0x54, 0x49, 0x4f, 0x4e, 0x20, 
+	0x53, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x20, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 
+	0x67, 0x73, 0x2e, 0x6c, 0x69, 0x6e, 0x6b, 0x29, 0xa, 0x3c, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x3e, 
+	0xa, 0x40, 0x50, 0x41, 0x55, 0x53, 0x45, 0x5d, 0x5d, 0xa, 0xa, 0x41, 0x64, 0x64, 0x54, 0x6f, 
+	0x6f, 0x6c, 0x28, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x28, 0x73, 0x65, 0x74, 
+	0x74, 0x69, 0x6e, 0x67, 0x73, 0x29, 0xa, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 
+	0x2e, 0x6c, 0x69, 0x6e, 0x6b, 0x20, 0x3d, 0x20, 0x7b, 0x7d, 0xa, 0x9, 0xa, 0x9, 0x2d, 0x2d, 
+	0x5b, 0x5b, 0x40, 0x52, 0x45, 0x53, 0x55, 0x4d, 0x45, 0xa, 0x9, 0x9, 0x3c, 0x74, 0x72, 0x3e, 
+	0x3c, 0x74, 0x64, 0x3e, 0x5e, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x5e, 0x3c, 0x2f, 0x74, 0x64, 
+	0x3e, 0x3c, 0x74, 0x64, 0x3e, 0xa, 0x9, 0x9, 0x46, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 
+	0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x64, 0x72, 0x69, 0x76, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 
+	0x20, 0x6c, 0x69, 0x6e, 0x6b, 0x65, 0x72, 0x2e, 0x20, 0x46, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 
+	0x6e, 0x20, 0x69, 0x73, 0x20, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x69, 0x62, 0x6c, 0x65, 
+	0xa, 0x9, 0x9, 0x66, 0x6f, 0x72, 0x20, 0x62, 0x75, 0x69, 0x6c, 0x64, 0x69, 0x6e, 0x67, 0x20, 
+	0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x20, 0x6c, 0x69, 0x6e, 0x65, 
+	0x20, 0x61, 0x6e, 0x64, 0x20, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 
+	0x6a, 0x6f, 0x62, 0x20, 0x74, 0x6f, 0x20, 0x6c, 0x69, 0x6e, 0x6b, 0x20, 0x74, 0x68, 0x65, 0xa, 
+	0x9, 0x9, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x20, 0x69, 0x6e, 
+	0x74, 0x6f, 0x20, 0x61, 0x6e, 0x20, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x61, 0x62, 0x6c, 0x65, 
+	0x2e, 0xa, 0x9, 0x9, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xa, 0x9, 
+	0x40, 0x50, 0x41, 0x55, 0x53, 0x45, 0x5d, 0x5d, 0x9, 0xa, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 
+	0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x69, 0x6e, 0x6b, 0x2e, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x20, 
+	0x3d, 0x20, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x4e, 0x75, 0x6c, 0x6c, 0xa, 0xa, 0x9, 0x2d, 
+	0x2d, 0x5b, 0x5b, 0x40, 0x52, 0x45, 0x53, 0x55, 0x4d, 0x45, 0xa, 0x9, 0x9, 0x3c, 0x74, 0x72, 
+	0x3e, 0x3c, 0x74, 0x64, 0x3e, 0x5e, 0x65, 0x78, 0x65, 0x5e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x3c, 
+	0x74, 0x64, 0x3e, 0xa, 0x9, 0x9, 0x50, 0x61, 0x74, 0x68, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 
+	0x65, 0x20, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x74, 0x6f, 0x20, 
+	0x75, 0x73, 0x65, 0x20, 0x61, 0x73, 0x20, 0x6c, 0x69, 0x6e, 0x6b, 0x65, 0x72, 0x2e, 0xa, 0x9, 
+	0x9, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xa, 0x9, 0x40, 0x50, 0x41, 
+	0x55, 0x53, 0x45, 0x5d, 0x5d, 0x9, 0xa, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 
+	0x2e, 0x6c, 0x69, 0x6e, 0x6b, 0x2e, 0x65, 0x78, 0x65, 0x20, 0x3d, 0x20, 0x22, 0x22, 0xa, 0x9, 
+	0xa, 0x9, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x52, 0x45, 0x53, 0x55, 0x4d, 0x45, 0xa, 0x9, 0x9, 
+	0x3c, 0x74, 0x72, 0x3e, 0x3c, 0x74, 0x64, 0x3e, 0x5e, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x73, 0x69, 
+	0x6f, 0x6e, 0x5e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x3c, 0x74, 0x64, 0x3e, 0xa, 0x9, 0x9, 0x45, 
+	0x78, 0x74, 0x65, 0x6e, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 
+	0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x2e, 0x20, 0x55, 0x73, 0x61, 0x6c, 
+	0x6c, 0x79, 0x20, 0x22, 0x22, 0x20, 0x6f, 0x6e, 0x20, 0x6d, 0x6f, 0x73, 0x74, 0x20, 0x70, 0x6c, 
+	0x61, 0x74, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x62, 0x75, 0x74, 0x20, 0x63, 0x61, 0x6e, 0xa, 0x9, 
+	0x9, 0x62, 0x65, 0x20, 0x22, 0x2e, 0x65, 0x78, 0x65, 0x22, 0x20, 0x6f, 0x6e, 0x20, 0x70, 0x6c, 
+	0x61, 0x74, 0x66, 0x6f, 0x72, 0x6d, 0x73, 0x20, 0x6c, 0x69, 0x6b, 0x65, 0x20, 0x57, 0x69, 0x6e, 
+	0x64, 0x6f, 0x77, 0x73, 0x2e, 0xa, 0x9, 0x9, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x3c, 0x2f, 0x74, 
+	0x72, 0x3e, 0xa, 0x9, 0x40, 0x50, 0x41, 0x55, 0x53, 0x45, 0x5d, 0x5d, 0x9, 0xa, 0x9, 0x73, 
+	0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x69, 0x6e, 0x6b, 0x2e, 0x65, 0x78, 0x74, 
+	0x65, 0x6e, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x3d, 0x20, 0x22, 0x22, 0xa, 0xa, 0x9, 0x2d, 0x2d, 
+	0x5b, 0x5b, 0x40, 0x52, 0x45, 0x53, 0x55, 0x4d, 0x45, 0xa, 0x9, 0x9, 0x3c, 0x74, 0x72, 0x3e, 
+	0x3c, 0x74, 0x64, 0x3e, 0x5e, 0x65, 0x78, 0x74, 0x72, 0x61, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x5e, 
+	0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x3c, 0x74, 0x64, 0x3e, 0xa, 0x9, 0x9, 0x41, 0x20, 0x74, 0x61, 
+	0x62, 0x6c, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x64, 0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x61, 
+	0x6c, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x73, 0x68, 0x6f, 
+	0x75, 0x6c, 0x64, 0x20, 0x62, 0x65, 0x20, 0x6c, 0x69, 0x6e, 0x6b, 0x65, 0x64, 0x20, 0x61, 0x67, 
+	0x61, 0x69, 0x6e, 0x73, 0x74, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x73, 0x65, 0xa, 0x9, 0x9, 0x66, 
+	0x69, 0x6c, 0x65, 0x73, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x62, 0x65, 0x20, 0x74, 0x72, 0x65, 
+	0x61, 0x74, 0x65, 0x64, 0x20, 0x61, 0x73, 0x20, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x20, 0x6f, 
+	0x62, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x6c, 0x69, 0x6e, 0x6b, 
+	0x69, 0x6e, 0x67, 0x2e, 0xa, 0x9, 0x9, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x3c, 0x2f, 0x74, 0x72, 
+	0x3e, 0xa, 0x9, 0x40, 0x50, 0x41, 0x55, 0x53, 0x45, 0x5d, 0x5d, 0x9, 0xa, 0x9, 0x73, 0x65, 
+	0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x69, 0x6e, 0x6b, 0x2e, 0x65, 0x78, 0x74, 0x72, 
+	0x61, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x20, 0x3d, 0x20, 0x4e, 0x65, 0x77, 0x54, 0x61, 0x62, 0x6c, 
+	0x65, 0x28, 0x29, 0xa, 0xa, 0x9, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x52, 0x45, 0x53, 0x55, 0x4d, 
+	0x45, 0xa, 0x9, 0x9, 0x3c, 0x74, 0x72, 0x3e, 0x3c, 0x74, 0x64, 0x3e, 0x5e, 0x66, 0x6c, 0x61, 
+	0x67, 0x73, 0x5e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x3c, 0x74, 0x64, 0x3e, 0xa, 0x9, 0x9, 0x54, 
+	0x61, 0x62, 0x6c, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x72, 0x61, 0x77, 0x20, 0x66, 0x6c, 0x61, 0x67, 
+	0x73, 0x20, 0x74, 0x6f, 0x20, 0x73, 0x65, 0x6e, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 
+	0x20, 0x6c, 0x69, 0x6e, 0x6b, 0x65, 0x72, 0x2e, 0xa, 0x9, 0x9, 0x7b, 0x7b, 0x7b, 0x7b, 0xa, 
+	0x9, 0x9, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x69, 0x6e, 0x6b, 
+	0x2e, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x3a, 0x41, 0x64, 0x64, 0x28, 0x22, 0x2d, 0x76, 0x22, 0x29, 
+	0xa, 0x9, 0x9, 0x7d, 0x7d, 0x7d, 0x7d, 0xa, 0x9, 0x9, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x3c, 
+	0x2f, 0x74, 0x72, 0x3e, 0xa, 0x9, 0x40, 0x50, 0x41, 0x55, 0x53, 0x45, 0x5d, 0x5d, 0x9, 0xa, 
+	0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x69, 0x6e, 0x6b, 0x2e, 0x66, 
+	0x6c, 0x61, 0x67, 0x73, 0x20, 0x3d, 0x20, 0x4e, 0x65, 0x77, 0x46, 0x6c, 0x61, 0x67, 0x54, 0x61, 
+	0x62, 0x6c, 0x65, 0x28, 0x29, 0xa, 0xa, 0x9, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x52, 0x45, 0x53, 
+	0x55, 0x4d, 0x45, 0xa, 0x9, 0x9, 0x3c, 0x74, 0x72, 0x3e, 0x3c, 0x74, 0x64, 0x3e, 0x5e, 0x66, 
+	0x72, 0x61, 0x6d, 0x65, 0x77, 0x6f, 0x72, 0x6b, 0x73, 0x5e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x3c, 
+	0x74, 0x64, 0x3e, 0xa, 0x9, 0x9, 0x4d, 0x61, 0x63, 0x20, 0x4f, 0x53, 0x20, 0x58, 0x20, 0x73, 
+	0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2e, 0x20, 0x41, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 
+	0x20, 0x6f, 0x66, 0x20, 0x66, 0x72, 0x61, 0x6d, 0x65, 0x77, 0x6f, 0x72, 0x6b, 0x73, 0x20, 0x74, 
+	0x6f, 0x20, 0x6c, 0x69, 0x6e, 0x6b, 0x20, 0x61, 0x67, 0x61, 0x69, 0x6e, 0x73, 0x74, 0x2e, 0xa, 
+	0x9, 0x9, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xa, 0x9, 0x40, 0x50, 
+	0x41, 0x55, 0x53, 0x45, 0x5d, 0x5d, 0x9, 0xa, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 
+	0x73, 0x2e, 0x6c, 0x69, 0x6e, 0x6b, 0x2e, 0x66, 0x72, 0x61, 0x6d, 0x65, 0x77, 0x6f, 0x72, 0x6b, 
+	0x73, 0x20, 0x3d, 0x20, 0x4e, 0x65, 0x77, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x28, 0x29, 0xa, 0xa, 
+	0x9, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x52, 0x45, 0x53, 0x55, 0x4d, 0x45, 0xa, 0x9, 0x9, 0x3c, 
+	0x74, 0x72, 0x3e, 0x3c, 0x74, 0x64, 0x3e, 0x5e, 0x66, 0x72, 0x61, 0x6d, 0x65, 0x77, 0x6f, 0x72, 
+	0x6b, 0x70, 0x61, 0x74, 0x68, 0x5e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x3c, 0x74, 0x64, 0x3e, 0xa, 
+	0x9, 0x9, 0x4d, 0x61, 0x63, 0x20, 0x4f, 0x53, 0x20, 0x58, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 
+	0x66, 0x69, 0x63, 0x2e, 0x20, 0x41, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x6f, 0x66, 0x20, 
+	0x70, 0x61, 0x74, 0x68, 0x73, 0x20, 0x77, 0x65, 0x72, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x66, 0x69, 
+	0x6e, 0x64, 0x20, 0x66, 0x72, 0x61, 0x6d, 0x65, 0x77, 0x6f, 0x72, 0x6b, 0x73, 0x2e, 0xa, 0x9, 
+	0x9, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xa, 0x9, 0x40, 0x50, 0x41, 
+	0x55, 0x53, 0x45, 0x5d, 0x5d, 0x9, 0xa, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 
+	0x2e, 0x6c, 0x69, 0x6e, 0x6b, 0x2e, 0x66, 0x72, 0x61, 0x6d, 0x65, 0x77, 0x6f, 0x72, 0x6b, 0x70, 
+	0x61, 0x74, 0x68, 0x20, 0x3d, 0x20, 0x4e, 0x65, 0x77, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x28, 0x29, 
+	0xa, 0xa, 0x9, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x52, 0x45, 0x53, 0x55, 0x4d, 0x45, 0xa, 0x9, 
+	0x9, 0x3c, 0x74, 0x72, 0x3e, 0x3c, 0x74, 0x64, 0x3e, 0x5e, 0x6c, 0x69, 0x62, 0x73, 0x5e, 0x3c, 
+	0x2f, 0x74, 0x64, 0x3e, 0x3c, 0x74, 0x64, 0x3e, 0xa, 0x9, 0x9, 0x54, 0x61, 0x62, 0x6c, 0x65, 
+	0x20, 0x6f, 0x66, 0x20, 0x6c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x20, 0x66, 0x69, 0x6c, 0x65, 
+	0x73, 0x20, 0x74, 0x6f, 0x20, 0x6c, 0x69, 0x6e, 0x6b, 0x20, 0x77, 0x69, 0x74, 0x68, 0x2e, 0xa, 
+	0x9, 0x9, 0x7b, 0x7b, 0x7b, 0x7b, 0xa, 0x9, 0x9, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 
+	0x67, 0x73, 0x2e, 0x6c, 0x69, 0x6e, 0x6b, 0x2e, 0x6c, 0x69, 0x62, 0x73, 0x3a, 0x41, 0x64, 0x64, 
+	0x28, 0x22, 0x70, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x22, 0x29, 0xa, 0x9, 0x9, 0x7d, 0x7d, 
+	0x7d, 0x7d, 0xa, 0x9, 0x9, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xa, 
+	0x9, 0x40, 0x50, 0x41, 0x55, 0x53, 0x45, 0x5d, 0x5d, 0x9, 0xa, 0x9, 0x73, 0x65, 0x74, 0x74, 
+	0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x69, 0x6e, 0x6b, 0x2e, 0x6c, 0x69, 0x62, 0x73, 0x20, 0x3d, 
+	0x20, 0x4e, 0x65, 0x77, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x28, 0x29, 0xa, 0xa, 0x9, 0x2d, 0x2d, 
+	0x5b, 0x5b, 0x40, 0x52, 0x45, 0x53, 0x55, 0x4d, 0x45, 0xa, 0x9, 0x9, 0x3c, 0x74, 0x72, 0x3e, 
+	0x3c, 0x74, 0x64, 0x3e, 0x5e, 0x6c, 0x69, 0x62, 0x70, 0x61, 0x74, 0x68, 0x5e, 0x3c, 0x2f, 0x74, 
+	0x64, 0x3e, 0x3c, 0x74, 0x64, 0x3e, 0xa, 0x9, 0x9, 0x41, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 
+	0x20, 0x6f, 0x66, 0x20, 0x70, 0x61, 0x74, 0x68, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x77, 0x68, 0x65, 
+	0x72, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x66, 0x69, 0x6e, 0x64, 0x20, 0x6c, 0x69, 0x62, 0x72, 0x61, 
+	0x72, 0x79, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x63, 0x6f, 
+	0x75, 0x6c, 0x64, 0x20, 0x62, 0x65, 0xa, 0x9, 0x9, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 
+	0x64, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x69, 0x6e, 0x6b, 0x69, 0x6e, 0x67, 
+	0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x2e, 0xa, 0x9, 0x9, 0x3c, 0x2f, 0x74, 0x64, 
+	0x3e, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0xa, 0x9, 0x40, 0x50, 0x41, 0x55, 0x53, 0x45, 0x5d, 0x5d, 
+	0x9, 0xa, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x69, 0x6e, 0x6b, 
+	0x2e, 0x6c, 0x69, 0x62, 0x70, 0x61, 0x74, 0x68, 0x20, 0x3d, 0x20, 0x4e, 0x65, 0x77, 0x54, 0x61, 
+	0x62, 0x6c, 0x65, 0x28, 0x29, 0xa, 0x9, 0xa, 0x9, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x52, 0x45, 
+	0x53, 0x55, 0x4d, 0x45, 0xa, 0x9, 0x9, 0x3c, 0x74, 0x72, 0x3e, 0x3c, 0x74, 0x64, 0x3e, 0x5e, 
+	0x4f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x5e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x3c, 0x74, 0x64, 0x3e, 
+	0xa, 0x9, 0x9, 0x46, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x61, 0x74, 
+	0x20, 0x73, 0x68, 0x6f, 0x75, 0x6c, 0x64, 0x20, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72, 
+	0x6d, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x70, 0x61, 0x74, 0x68, 
+	0xa, 0x9, 0x9, 0x69, 0x6e, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6f, 0x75, 0x74, 0x70, 
+	0x75, 0x74, 0x20, 0x70, 0x61, 0x74, 0x68, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x61, 0x70, 0x70, 
+	0x65, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x78, 
+	0x74, 0x65, 0x6e, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x69, 0x73, 0x20, 0x64, 0x6f, 0x6e, 0x65, 0xa, 
+	0x9, 0x9, 0x61, 0x75, 0x74, 0x6f, 0x6d, 0x61, 0x74, 0x69, 0x63, 0x6c, 0x79, 0x2e, 0xa, 0x9, 
+	0x9, 0xa, 0x9, 0x9, 0x7b, 0x7b, 0x7b, 0x7b, 0xa, 0x9, 0x9, 0x9, 0x73, 0x65, 0x74, 0x74, 
+	0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x69, 0x6e, 0x6b, 0x2e, 0x4f, 0x75, 0x74, 0x70, 0x75, 0x74, 
+	0x20, 0x3d, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x73, 0x65, 0x74, 0x74, 
+	0x69, 0x6e, 0x67, 0x73, 0x2c, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x29, 0xa, 0x9, 0x9, 0x9, 
+	0x26, 0x6e, 0x62, 0x73, 0x70, 0x3b, 0x26, 0x6e, 0x62, 0x73, 0x70, 0x3b, 0x26, 0x6e, 0x62, 0x73, 
+	0x70, 0x3b, 0x26, 0x6e, 0x62, 0x73, 0x70, 0x3b, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x50, 
+	0x61, 0x74, 0x68, 0x42, 0x61, 0x73, 0x65, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x29, 0x20, 0x2e, 
+	0x2e, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 0x6f, 0x6e, 0x66, 0x69, 
+	0x67, 0x5f, 0x65, 0x78, 0x74, 0xa, 0x9, 0x9, 0x9, 0x65, 0x6e, 0x64, 0xa, 0x9, 0x9, 0x7d, 
+	0x7d, 0x7d, 0x7d, 0xa, 0x9, 0x9, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 
+	0xa, 0x9, 0x40, 0x50, 0x41, 0x55, 0x53, 0x45, 0x5d, 0x5d, 0x9, 0xa, 0x9, 0x73, 0x65, 0x74, 
+	0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x69, 0x6e, 0x6b, 0x2e, 0x4f, 0x75, 0x74, 0x70, 0x75, 
+	0x74, 0x20, 0x3d, 0x20, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x5f, 0x49, 0x6e, 0x74, 0x65, 
+	0x72, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x74, 0x65, 0x5f, 0x4f, 0x75, 0x74, 0x70, 0x75, 0x74, 0xa, 
+	0x9, 0xa, 0x9, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x52, 0x45, 0x53, 0x55, 0x4d, 0x45, 0xa, 0x9, 
+	0x9, 0x3c, 0x74, 0x72, 0x3e, 0x3c, 0x74, 0x64, 0x3e, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x66, 0x6c, 
+	0x61, 0x67, 0x73, 0x20, 0x28, 0x52, 0x45, 0x4d, 0x4f, 0x56, 0x45, 0x3f, 0x29, 0x3c, 0x2f, 0x74, 
+	0x64, 0x3e, 0x3c, 0x74, 0x64, 0x3e, 0xa, 0x9, 0x9, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x3c, 0x2f, 
+	0x74, 0x72, 0x3e, 0xa, 0x9, 0x40, 0x50, 0x41, 0x55, 0x53, 0x45, 0x5d, 0x5d, 0x9, 0xa, 0x9, 
+	0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x69, 0x6e, 0x6b, 0x2e, 0x69, 0x6e, 
+	0x70, 0x75, 0x74, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x3d, 0x20, 0x22, 0x22, 0xa, 0xa, 0x9, 
+	0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x52, 0x45, 0x53, 0x55, 0x4d, 0x45, 0xa, 0x9, 0x9, 0x3c, 0x2f, 
+	0x74, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0xa, 0x9, 0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 0xa, 0x9, 
+	0x9, 0xa, 0x9, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x4c, 0x6f, 0x63, 0x6b, 0x28, 0x73, 0x65, 0x74, 
+	0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x69, 0x6e, 0x6b, 0x29, 0xa, 0x65, 0x6e, 0x64, 0x29, 
+	0xa, 0xa, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+	0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x20, 0x53, 0x48, 0x41, 0x52, 0x45, 
+	0x44, 0x20, 0x4c, 0x49, 0x42, 0x52, 0x41, 0x52, 0x59, 0x20, 0x41, 0x43, 0x54, 0x49, 0x4f, 0x4e, 
+	0x20, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+	0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0xa, 0xa, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 
+	0x47, 0x52, 0x4f, 0x55, 0x50, 0x20, 0x53, 0x68, 0x61, 0x72, 0x65, 0x64, 0x4c, 0x69, 0x62, 0x72, 
+	0x61, 0x72, 0x79, 0x20, 0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 0x2d, 0x2d, 0xa, 0xa, 0x41, 0x64, 
+	0x64, 0x54, 0x6f, 0x6f, 0x6c, 0x28, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x28, 
+	0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x29, 0xa, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 
+	0x6e, 0x67, 0x73, 0x2e, 0x64, 0x6c, 0x6c, 0x20, 0x3d, 0x20, 0x7b, 0x7d, 0xa, 0x9, 0x73, 0x65, 
+	0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x64, 0x6c, 0x6c, 0x2e, 0x44, 0x72, 0x69, 0x76, 0x65, 
+	0x72, 0x20, 0x3d, 0x20, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x4e, 0x75, 0x6c, 0x6c, 0xa, 0x9, 
+	0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x64, 0x6c, 0x6c, 0x2e, 0x70, 0x72, 0x65, 
+	0x66, 0x69, 0x78, 0x20, 0x3d, 0x20, 0x22, 0x22, 0xa, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 
+	0x67, 0x73, 0x2e, 0x64, 0x6c, 0x6c, 0x2e, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x73, 0x69, 0x6f, 0x6e, 
+	0x20, 0x3d, 0x20, 0x22, 0x22, 0xa, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 
+	0x64, 0x6c, 0x6c, 0x2e, 0x4f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x20, 0x3d, 0x20, 0x44, 0x65, 0x66, 
+	0x61, 0x75, 0x6c, 0x74, 0x5f, 0x49, 0x6e, 0x74, 0x65, 0x72, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x74, 
+	0x65, 0x5f, 0x4f, 0x75, 0x74, 0x70, 0x75, 0x74, 0xa, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 
+	0x67, 0x73, 0x2e, 0x64, 0x6c, 0x6c, 0x2e, 0x65, 0x78, 0x65, 0x20, 0x3d, 0x20, 0x22, 0x22, 0xa, 
+	0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x64, 0x6c, 0x6c, 0x2e, 0x69, 0x6e, 
+	0x70, 0x75, 0x74, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x3d, 0x20, 0x22, 0x22, 0xa, 0x9, 0x73, 
+	0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x64, 0x6c, 0x6c, 0x2e, 0x66, 0x6c, 0x61, 0x67, 
+	0x73, 0x20, 0x3d, 0x20, 0x4e, 0x65, 0x77, 0x46, 0x6c, 0x61, 0x67, 0x54, 0x61, 0x62, 0x6c, 0x65, 
+	0x28, 0x29, 0xa, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x64, 0x6c, 0x6c, 
+	0x2e, 0x6c, 0x69, 0x62, 0x73, 0x20, 0x3d, 0x20, 0x4e, 0x65, 0x77, 0x54, 0x61, 0x62, 0x6c, 0x65, 
+	0x28, 0x29, 0xa, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x64, 0x6c, 0x6c, 
+	0x2e, 0x66, 0x72, 0x61, 0x6d, 0x65, 0x77, 0x6f, 0x72, 0x6b, 0x73, 0x20, 0x3d, 0x20, 0x4e, 0x65, 
+	0x77, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x28, 0x29, 0xa, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 
+	0x67, 0x73, 0x2e, 0x64, 0x6c, 0x6c, 0x2e, 0x66, 0x72, 0x61, 0x6d, 0x65, 0x77, 0x6f, 0x72, 0x6b, 
+	0x70, 0x61, 0x74, 0x68, 0x20, 0x3d, 0x20, 0x4e, 0x65, 0x77, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x28, 
+	0x29, 0xa, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x64, 0x6c, 0x6c, 0x2e, 
+	0x6c, 0x69, 0x62, 0x70, 0x61, 0x74, 0x68, 0x20, 0x3d, 0x20, 0x4e, 0x65, 0x77, 0x54, 0x61, 0x62, 
+	0x6c, 0x65, 0x28, 0x29, 0xa, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x64, 
+	0x6c, 0x6c, 0x2e, 0x65, 0x78, 0x74, 0x72, 0x61, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x20, 0x3d, 0x20, 
+	0x4e, 0x65, 0x77, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x28, 0x29, 0xa, 0xa, 0x9, 0x54, 0x61, 0x62, 
+	0x6c, 0x65, 0x4c, 0x6f, 0x63, 0x6b, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 
+	0x64, 0x6c, 0x6c, 0x29, 0xa, 0x65, 0x6e, 0x64, 0x29, 0xa, 0xa, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 
+	0x3c, 0x46, 0x55, 0x4e, 0x43, 0x54, 0x49, 0x4f, 0x4e, 0xa, 0x9, 0x54, 0x4f, 0x44, 0x4f, 0xa, 
+	0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 0x2d, 0x2d, 0xa, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 
+	0x6e, 0x20, 0x53, 0x68, 0x61, 0x72, 0x65, 0x64, 0x4c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x28, 
+	0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2c, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 
+	0x2c, 0x20, 0x2e, 0x2e, 0x2e, 0x29, 0xa, 0x9, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x53, 0x65, 0x74, 
+	0x74, 0x69, 0x6e, 0x67, 0x73, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x29, 0xa, 
+	0x9, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x73, 0x20, 
+	0x3d, 0x20, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x46, 0x6c, 0x61, 0x74, 0x74, 0x65, 0x6e, 0x28, 0x7b, 
+	0x2e, 0x2e, 0x2e, 0x7d, 0x29, 0xa, 0xa, 0x9, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x20, 0x3d, 
+	0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x64, 0x6c, 0x6c, 0x2e, 0x4f, 0x75, 
+	0x74, 0x70, 0x75, 0x74, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2c, 0x20, 0x50, 
+	0x61, 0x74, 0x68, 0x4a, 0x6f, 0x69, 0x6e, 0x28, 0x50, 0x61, 0x74, 0x68, 0x44, 0x69, 0x72, 0x28, 
+	0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x29, 0x2c, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 
+	0x73, 0x2e, 0x64, 0x6c, 0x6c, 0x2e, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x20, 0x2e, 0x2e, 0x20, 
+	0x50, 0x61, 0x74, 0x68, 0x46, 0x69, 0x6c, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x28, 0x6f, 0x75, 0x74, 
+	0x70, 0x75, 0x74, 0x29, 0x29, 0x29, 0x20, 0x2e, 0x2e, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 
+	0x67, 0x73, 0x2e, 0x64, 0x6c, 0x6c, 0x2e, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x73, 0x69, 0x6f, 0x6e, 
+	0xa, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x64, 0x6c, 0x6c, 0x2e, 0x44, 
+	0x72, 0x69, 0x76, 0x65, 0x72, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 
+	0x61, 0x62, 0x65, 0x6c, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x20, 0x2e, 0x2e, 0x20, 0x22, 0x64, 
+	0x6c, 0x6c, 0x20, 0x22, 0x2e, 0x2e, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2c, 0x20, 0x6f, 
+	0x75, 0x74, 0x70, 0x75, 0x74, 0x2c, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x73, 0x2c, 0x20, 0x73, 
+	0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x29, 0xa, 0xa, 0x9, 0x66, 0x6f, 0x72, 0x20, 0x69, 
+	0x6e, 0x64, 0x65, 0x78, 0x2c, 0x20, 0x69, 0x6e, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x69, 0x6e, 0x20, 
+	0x69, 0x70, 0x61, 0x69, 0x72, 0x73, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x73, 0x29, 0x20, 0x64, 
+	0x6f, 0xa, 0x9, 0x9, 0x41, 0x64, 0x64, 0x44, 0x65, 0x70, 0x65, 0x6e, 0x64, 0x65, 0x6e, 0x63, 
+	0x79, 0x28, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2c, 0x20, 0x69, 0x6e, 0x6e, 0x61, 0x6d, 0x65, 
+	0x29, 0xa, 0x9, 0x65, 0x6e, 0x64, 0xa, 0xa, 0x9, 0x2d, 0x2d, 0x20, 0x61, 0x64, 0x64, 0x20, 
+	0x74, 0x68, 0x65, 0x20, 0x6c, 0x69, 0x62, 0x61, 0x72, 0x69, 0x65, 0x73, 0xa, 0x9, 0x6c, 0x6f, 
+	0x63, 0x61, 0x6c, 0x20, 0x6c, 0x69, 0x62, 0x73, 0x20, 0x3d, 0x20, 0x7b, 0x7d, 0xa, 0x9, 0x6c, 
+	0x6f, 0x63, 0x61, 0x6c, 0x20, 0x70, 0x61, 0x74, 0x68, 0x73, 0x20, 0x3d, 0x20, 0x7b, 0x7d, 0xa, 
+	0x9, 0xa, 0x9, 0x66, 0x6f, 0x72, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2c, 0x20, 0x69, 0x6e, 
+	0x6e, 0x61, 0x6d, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x69, 0x70, 0x61, 0x69, 0x72, 0x73, 0x28, 0x73, 
+	0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x64, 0x6c, 0x6c, 0x2e, 0x6c, 0x69, 0x62, 0x73, 
+	0x29, 0x20, 0x64, 0x6f, 0xa, 0x9, 0x9, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x2e, 0x69, 0x6e, 0x73, 
+	0x65, 0x72, 0x74, 0x28, 0x6c, 0x69, 0x62, 0x73, 0x2c, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 
+	0x67, 0x73, 0x2e, 0x64, 0x6c, 0x6c, 0x2e, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x20, 0x2e, 0x2e, 
+	0x20, 0x69, 0x6e, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x2e, 0x2e, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 
+	0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x69, 0x62, 0x2e, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x73, 0x69, 0x6f, 
+	0x6e, 0x29, 0xa, 0x9, 0x65, 0x6e, 0x64, 0xa, 0xa, 0x9, 0x66, 0x6f, 0x72, 0x20, 0x69, 0x6e, 
+	0x64, 0x65, 0x78, 0x2c, 0x20, 0x69, 0x6e, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x69, 
+	0x70, 0x61, 0x69, 0x72, 0x73, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x64, 
+	0x6c, 0x6c, 0x2e, 0x6c, 0x69, 0x62, 0x70, 0x61, 0x74, 0x68, 0x29, 0x20, 0x64, 0x6f, 0xa, 0x9, 
+	0x9, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x2e, 0x69, 0x6e, 0x73, 0x65, 0x72, 0x74, 0x28, 0x70, 0x61, 
+	0x74, 0x68, 0x73, 0x2c, 0x20, 0x69, 0x6e, 0x6e, 0x61, 0x6d, 0x65, 0x29, 0xa, 0x9, 0x65, 0x6e, 
+	0x64, 0xa, 0x9, 0xa, 0x9, 0x41, 0x64, 0x64, 0x44, 0x65, 0x70, 0x65, 0x6e, 0x64, 0x65, 0x6e, 
+	0x63, 0x79, 0x53, 0x65, 0x61, 0x72, 0x63, 0x68, 0x28, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2c, 
+	0x20, 0x70, 0x61, 0x74, 0x68, 0x73, 0x2c, 0x20, 0x6c, 0x69, 0x62, 0x73, 0x29, 0xa, 0x9, 0xa, 
+	0x9, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0xa, 0x65, 
+	0x6e, 0x64, 0xa, 0xa, 0xa, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+	0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x20, 0x53, 0x54, 
+	0x41, 0x54, 0x49, 0x43, 0x20, 0x4c, 0x49, 0x42, 0x52, 0x41, 0x52, 0x59, 0x20, 0x41, 0x43, 0x54, 
+	0x49, 0x4f, 0x4e, 0x20, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+	0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0xa, 0xa, 0x2d, 0x2d, 
+	0x5b, 0x5b, 0x40, 0x47, 0x52, 0x4f, 0x55, 0x50, 0x20, 0x53, 0x74, 0x61, 0x74, 0x69, 0x63, 0x4c, 
+	0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x20, 0x40, 0x45, 0x4e, 0x44, 0x5d, 0x5d, 0x2d, 0x2d, 0xa, 
+	0xa, 0x41, 0x64, 0x64, 0x54, 0x6f, 0x6f, 0x6c, 0x28, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 
+	0x6e, 0x20, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x29, 0xa, 0x9, 0x73, 0x65, 
+	0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x69, 0x62, 0x20, 0x3d, 0x20, 0x7b, 0x7d, 0xa, 
+	0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x69, 0x62, 0x2e, 0x44, 0x72, 
+	0x69, 0x76, 0x65, 0x72, 0x20, 0x3d, 0x20, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x4e, 0x75, 0x6c, 
+	0x6c, 0xa, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x69, 0x62, 0x2e, 
+	0x4f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x20, 0x3d, 0x20, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 
+	0x5f, 0x49, 0x6e, 0x74, 0x65, 0x72, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x74, 0x65, 0x5f, 0x4f, 0x75, 
+	0x74, 0x70, 0x75, 0x74, 0xa, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 
+	0x69, 0x62, 0x2e, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x20, 0x3d, 0x20, 0x22, 0x22, 0xa, 0x9, 
+	0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x69, 0x62, 0x2e, 0x65, 0x78, 0x74, 
+	0x65, 0x6e, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x3d, 0x20, 0x22, 0x22, 0xa, 0x9, 0x73, 0x65, 0x74, 
+	0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x69, 0x62, 0x2e, 0x65, 0x78, 0x65, 0x20, 0x3d, 0x20, 
+	0x22, 0x22, 0xa, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x69, 0x62, 
+	0x2e, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x3d, 0x20, 0x4e, 0x65, 0x77, 0x46, 0x6c, 0x61, 0x67, 
+	0x54, 0x61, 0x62, 0x6c, 0x65, 0x28, 0x29, 0xa, 0x9, 0xa, 0x9, 0x54, 0x61, 0x62, 0x6c, 0x65, 
+	0x4c, 0x6f, 0x63, 0x6b, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x69, 
+	0x62, 0x29, 0xa, 0x65, 0x6e, 0x64, 0x29, 0xa, 0xa, 0x2d, 0x2d, 0x5b, 0x5b, 0x40, 0x46, 0x55, 
+	0x4e, 0x43, 0x54, 0x49, 0x4f, 0x4e, 0xa, 0x9, 0x54, 0x4f, 0x44, 0x4f, 0xa, 0x40, 0x45, 0x4e, 
+	0x44, 0x5d, 0x5d, 0x2d, 0x2d, 0xa, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x53, 
+	0x74, 0x61, 0x74, 0x69, 0x63, 0x4c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x28, 0x73, 0x65, 0x74, 
+	0x74, 0x69, 0x6e, 0x67, 0x73, 0x2c, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2c, 0x20, 0x2e, 
+	0x2e, 0x2e, 0x29, 0xa, 0x9, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6e, 
+	0x67, 0x73, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x29, 0xa, 0x9, 0xa, 0x9, 
+	0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x73, 0x20, 0x3d, 0x20, 0x54, 
+	0x61, 0x62, 0x6c, 0x65, 0x46, 0x6c, 0x61, 0x74, 0x74, 0x65, 0x6e, 0x28, 0x7b, 0x2e, 0x2e, 0x2e, 
+	0x7d, 0x29, 0xa, 0xa, 0x9, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x20, 0x3d, 0x20, 0x73, 0x65, 
+	0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x69, 0x62, 0x2e, 0x4f, 0x75, 0x74, 0x70, 0x75, 
+	0x74, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2c, 0x20, 0x50, 0x61, 0x74, 0x68, 
+	0x4a, 0x6f, 0x69, 0x6e, 0x28, 0x50, 0x61, 0x74, 0x68, 0x44, 0x69, 0x72, 0x28, 0x6f, 0x75, 0x74, 
+	0x70, 0x75, 0x74, 0x29, 0x2c, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 
+	0x69, 0x62, 0x2e, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x20, 0x2e, 0x2e, 0x20, 0x50, 0x61, 0x74, 
+	0x68, 0x46, 0x69, 0x6c, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x28, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 
+	0x29, 0x29, 0x29, 0x20, 0x2e, 0x2e, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 
+	0x6c, 0x69, 0x62, 0x2e, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x73, 0x69, 0x6f, 0x6e, 0xa, 0xa, 0x9, 
+	0x41, 0x64, 0x64, 0x4a, 0x6f, 0x62, 0x28, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2c, 0x20, 0x73, 
+	0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x70, 0x72, 0x65, 
+	0x66, 0x69, 0x78, 0x20, 0x2e, 0x2e, 0x20, 0x22, 0x6c, 0x69, 0x62, 0x20, 0x22, 0x20, 0x2e, 0x2e, 
+	0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2c, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 
+	0x73, 0x2e, 0x6c, 0x69, 0x62, 0x2e, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x28, 0x6f, 0x75, 0x74, 
+	0x70, 0x75, 0x74, 0x2c, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x73, 0x2c, 0x20, 0x73, 0x65, 0x74, 
+	0x74, 0x69, 0x6e, 0x67, 0x73, 0x29, 0x29, 0xa, 0xa, 0x9, 0x66, 0x6f, 0x72, 0x20, 0x69, 0x6e, 
+	0x64, 0x65, 0x78, 0x2c, 0x20, 0x69, 0x6e, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x69, 
+	0x70, 0x61, 0x69, 0x72, 0x73, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x73, 0x29, 0x20, 0x64, 0x6f, 
+	0xa, 0x9, 0x9, 0x41, 0x64, 0x64, 0x44, 0x65, 0x70, 0x65, 0x6e, 0x64, 0x65, 0x6e, 0x63, 0x79, 
+	0x28, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2c, 0x20, 0x69, 0x6e, 0x6e, 0x61, 0x6d, 0x65, 0x29, 
+	0xa, 0x9, 0x65, 0x6e, 0x64, 0xa, 0xa, 0x9, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x6f, 
+	0x75, 0x74, 0x70, 0x75, 0x74, 0xa, 0x65, 0x6e, 0x64, 0xa, 0};
+const char internal_file_3[] = {0xa, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+	0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+	0x2d, 0x2d, 0x2d, 0x20, 0x43, 0x2f, 0x43, 0x2b, 0x2b, 0x20, 0x47, 0x43, 0x43, 0x20, 0x44, 0x52, 
+	0x49, 0x56, 0x45, 0x52, 0x20, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+	0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0xa, 0x66, 0x75, 
+	0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x47, 0x43, 0x43, 
+	0x5f, 0x47, 0x65, 0x74, 0x28, 0x65, 0x78, 0x65, 0x2c, 0x20, 0x63, 0x61, 0x63, 0x68, 0x65, 0x5f, 
+	0x6e, 0x61, 0x6d, 0x65, 0x2c, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 
+	0x29, 0xa, 0x9, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 
+	0x6f, 0x6e, 0x28, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x2c, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 
+	0x2c, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x2c, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 
+	0x73, 0x29, 0xa, 0x9, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x63, 0x61, 0x63, 0x68, 0x65, 
+	0x20, 0x3d, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 0x63, 0x5b, 0x63, 
+	0x61, 0x63, 0x68, 0x65, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x5d, 0xa, 0x9, 0x9, 0x69, 0x66, 0x20, 
+	0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x69, 0x6e, 0x76, 0x6f, 0x6b, 0x65, 0x5f, 
+	0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x7e, 0x3d, 0x20, 0x63, 0x61, 0x63, 0x68, 0x65, 0x2e, 0x6e, 
+	0x72, 0x20, 0x74, 0x68, 0x65, 0x6e, 0xa, 0x9, 0x9, 0x9, 0x63, 0x61, 0x63, 0x68, 0x65, 0x2e, 
+	0x6e, 0x72, 0x20, 0x3d, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x69, 0x6e, 
+	0x76, 0x6f, 0x6b, 0x65, 0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0xa, 0x9, 0x9, 0x9, 0x6c, 0x6f, 
+	0x63, 0x61, 0x6c, 0x20, 0x63, 0x63, 0x20, 0x3d, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 
+	0x73, 0x2e, 0x63, 0x63, 0xa, 0x9, 0x9, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x64, 0x20, 
+	0x3d, 0x20, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x54, 0x6f, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 
+	0x63, 0x63, 0x2e, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x73, 0x2c, 0x20, 0x22, 0x2d, 0x44, 0x22, 
+	0x2c, 0x20, 0x22, 0x20, 0x22, 0x29, 0xa, 0x9, 0x9, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 
+	0x69, 0x20, 0x3d, 0x20, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x54, 0x6f, 0x53, 0x74, 0x72, 0x69, 0x6e, 
+	0x67, 0x28, 0x63, 0x63, 0x2e, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x73, 0x2c, 0x20, 0x27, 
+	0x2d, 0x49, 0x20, 0x22, 0x27, 0x2c, 0x20, 0x27, 0x22, 0x20, 0x27, 0x29, 0xa, 0x9, 0x9, 0x9, 
+	0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x69, 0x20, 0x3d, 0x20, 0x69, 0x20, 0x2e, 0x2e, 0x20, 0x54, 
+	0x61, 0x62, 0x6c, 0x65, 0x54, 0x6f, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x63, 0x63, 0x2e, 
+	0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x73, 0x2c, 0x20, 
+	0x27, 0x2d, 0x69, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x20, 0x22, 0x27, 0x2c, 0x20, 0x27, 0x22, 
+	0x20, 0x27, 0x29, 0xa, 0x9, 0x9, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x69, 0x20, 0x3d, 
+	0x20, 0x69, 0x20, 0x2e, 0x2e, 0x20, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x54, 0x6f, 0x53, 0x74, 0x72, 
+	0x69, 0x6e, 0x67, 0x28, 0x63, 0x63, 0x2e, 0x66, 0x72, 0x61, 0x6d, 0x65, 0x77, 0x6f, 0x72, 0x6b, 
+	0x73, 0x2c, 0x20, 0x27, 0x2d, 0x66, 0x72, 0x61, 0x6d, 0x65, 0x77, 0x6f, 0x72, 0x6b, 0x20, 0x27, 
+	0x2c, 0x20, 0x27, 0x20, 0x27, 0x29, 0xa, 0x9, 0x9, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 
+	0x66, 0x20, 0x3d, 0x20, 0x63, 0x63, 0x2e, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x3a, 0x54, 0x6f, 0x53, 
+	0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x29, 0xa, 0x9, 0x9, 0x9, 0x66, 0x20, 0x3d, 0x20, 0x66, 
+	0x20, 0x2e, 0x2e, 0x20, 0x63, 0x63, 0x5b, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x5f, 0x6e, 0x61, 0x6d, 
+	0x65, 0x5d, 0x3a, 0x54, 0x6f, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x29, 0xa, 0x9, 0x9, 
+	0x9, 0x69, 0x66, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x64, 0x65, 0x62, 
+	0x75, 0x67, 0x20, 0x3e, 0x20, 0x30, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x20, 0x66, 0x20, 0x3d, 0x20, 
+	0x66, 0x20, 0x2e, 0x2e, 0x20, 0x22, 0x2d, 0x67, 0x20, 0x22, 0x20, 0x65, 0x6e, 0x64, 0xa, 0x9, 
+	0x9, 0x9, 0x69, 0x66, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6f, 0x70, 
+	0x74, 0x69, 0x6d, 0x69, 0x7a, 0x65, 0x20, 0x3e, 0x20, 0x30, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x20, 
+	0x66, 0x20, 0x3d, 0x20, 0x66, 0x20, 0x2e, 0x2e, 0x20, 0x22, 0x2d, 0x4f, 0x32, 0x20, 0x22, 0x20, 
+	0x65, 0x6e, 0x64, 0xa, 0x9, 0x9, 0x9, 0xa, 0x9, 0x9, 0x9, 0x63, 0x61, 0x63, 0x68, 0x65, 
+	0x2e, 0x73, 0x74, 0x72, 0x20, 0x3d, 0x20, 0x63, 0x63, 0x5b, 0x65, 0x78, 0x65, 0x5d, 0x20, 0x2e, 
+	0x2e, 0x20, 0x22, 0x20, 0x22, 0x20, 0x2e, 0x2e, 0x20, 0x66, 0x20, 0x2e, 0x2e, 0x20, 0x22, 0x2d, 
+	0x63, 0x20, 0x22, 0x20, 0x2e, 0x2e, 0x20, 0x64, 0x20, 0x2e, 0x2e, 0x20, 0x69, 0x20, 0x2e, 0x2e, 
+	0x20, 0x22, 0x20, 0x2d, 0x6f, 0x20, 0x22, 0xa, 0x9, 0x9, 0x65, 0x6e, 0x64, 0xa, 0x9, 0x9, 
+	0xa, 0x9, 0x9, 0x41, 0x64, 0x64, 0x4a, 0x6f, 0x62, 0x28, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 
+	0x2c, 0x20, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x2c, 0x20, 0x63, 0x61, 0x63, 0x68, 0x65, 0x2e, 0x73, 
+	0x74, 0x72, 0x20, 0x2e, 0x2e, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x20, 0x2e, 0x2e, 0x20, 
+	0x22, 0x20, 0x22, 0x20, 0x2e, 0x2e, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x29, 0xa, 0x9, 0x65, 
+	0x6e, 0x64, 0xa, 0x65, 0x6e, 0x64, 0xa, 0xa, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 
+	0x20, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x47, 0x43, 0x43, 0x5f, 0x43, 0x54, 0x65, 0x73, 0x74, 
+	0x28, 0x63, 0x6f, 0x64, 0x65, 0x2c, 0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x29, 0xa, 
+	0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x66, 0x20, 0x3d, 0x20, 0x69, 0x6f, 0x2e, 0x6f, 0x70, 
+	0x65, 0x6e, 0x28, 0x22, 0x5f, 0x74, 0x65, 0x73, 0x74, 0x2e, 0x63, 0x22, 0x2c, 0x20, 0x22, 0x77, 
+	0x22, 0x29, 0xa, 0x9, 0x66, 0x3a, 0x77, 0x72, 0x69, 0x74, 0x65, 0x28, 0x63, 0x6f, 0x64, 0x65, 
+	0x29, 0xa, 0x9, 0x66, 0x3a, 0x77, 0x72, 0x69, 0x74, 0x65, 0x28, 0x22, 0x5c, 0x6e, 0x22, 0x29, 
+	0xa, 0x9, 0x66, 0x3a, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x28, 0x29, 0xa, 0x9, 0x6c, 0x6f, 0x63, 
+	0x61, 0x6c, 0x20, 0x72, 0x65, 0x74, 0x20, 0x3d, 0x20, 0x45, 0x78, 0x65, 0x63, 0x75, 0x74, 0x65, 
+	0x53, 0x69, 0x6c, 0x65, 0x6e, 0x74, 0x28, 0x22, 0x67, 0x63, 0x63, 0x20, 0x5f, 0x74, 0x65, 0x73, 
+	0x74, 0x2e, 0x63, 0x20, 0x2d, 0x6f, 0x20, 0x5f, 0x74, 0x65, 0x73, 0x74, 0x20, 0x22, 0x20, 0x2e, 
+	0x2e, 0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x29, 0xa, 0x9, 0x6f, 0x73, 0x2e, 0x72, 
+	0x65, 0x6d, 0x6f, 0x76, 0x65, 0x28, 0x22, 0x5f, 0x74, 0x65, 0x73, 0x74, 0x2e, 0x63, 0x22, 0x29, 
+	0xa, 0x9, 0x6f, 0x73, 0x2e, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x28, 0x22, 0x5f, 0x74, 0x65, 
+	0x73, 0x74, 0x2e, 0x65, 0x78, 0x65, 0x22, 0x29, 0xa, 0x9, 0x6f, 0x73, 0x2e, 0x72, 0x65, 0x6d, 
+	0x6f, 0x76, 0x65, 0x28, 0x22, 0x5f, 0x74, 0x65, 0x73, 0x74, 0x22, 0x29, 0xa, 0x9, 0x72, 0x65, 
+	0x74, 0x75, 0x72, 0x6e, 0x20, 0x72, 0x65, 0x74, 0x3d, 0x3d, 0x30, 0xa, 0x65, 0x6e, 0x64, 0xa, 
+	0xa, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+	0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x20, 0x4c, 0x49, 0x4e, 0x4b, 0x20, 0x47, 
+	0x43, 0x43, 0x20, 0x44, 0x52, 0x49, 0x56, 0x45, 0x52, 0x20, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+	0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+	0x2d, 0x2d, 0xa, 0xa, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x44, 0x72, 0x69, 
+	0x76, 0x65, 0x72, 0x47, 0x43, 0x43, 0x5f, 0x4c, 0x69, 0x6e, 0x6b, 0x28, 0x6c, 0x61, 0x62, 0x65, 
+	0x6c, 0x2c, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2c, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 
+	0x73, 0x2c, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x29, 0xa, 0x9, 0x6c, 0x6f, 
+	0x63, 0x61, 0x6c, 0x20, 0x65, 0x20, 0x3d, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 
+	0x2e, 0x6c, 0x69, 0x6e, 0x6b, 0x2e, 0x65, 0x78, 0x65, 0x20, 0x2e, 0x2e, 0x20, 0x22, 0x20, 0x2d, 
+	0x6f, 0x20, 0x22, 0x20, 0x2e, 0x2e, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0xa, 0x9, 0x6c, 
+	0x6f, 0x63, 0x61, 0x6c, 0x20, 0x65, 0x20, 0x3d, 0x20, 0x65, 0x20, 0x2e, 0x2e, 0x20, 0x22, 0x20, 
+	0x22, 0x20, 0x2e, 0x2e, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x69, 
+	0x6e, 0x6b, 0x2e, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x2e, 0x2e, 
+	0x20, 0x22, 0x20, 0x22, 0x20, 0x2e, 0x2e, 0x20, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x54, 0x6f, 0x53, 
+	0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x73, 0x2c, 0x20, 0x27, 0x27, 
+	0x2c, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x65, 
+	0x20, 0x3d, 0x20, 0x65, 0x20, 0x2e, 0x2e, 0x20, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x54, 0x6f, 0x53, 
+	0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 
+	0x69, 0x6e, 0x6b, 0x2e, 0x65, 0x78, 0x74, 0x72, 0x61, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x2c, 0x20, 
+	0x27, 0x27, 0x2c, 0x20, 0x27, 0x20, 0x27, 0x29, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 
+	0x65, 0x20, 0x3d, 0x20, 0x65, 0x20, 0x2e, 0x2e, 0x20, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x54, 0x6f, 
+	0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 
+	0x6c, 0x69, 0x6e, 0x6b, 0x2e, 0x6c, 0x69, 0x62, 0x70, 0x61, 0x74, 0x68, 0x2c, 0x20, 0x27, 0x2d, 
+	0x4c, 0x27, 0x2c, 0x20, 0x27, 0x20, 0x27, 0x29, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 
+	0x65, 0x20, 0x3d, 0x20, 0x65, 0x20, 0x2e, 0x2e, 0x20, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x54, 0x6f, 
+	0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 
+	0x6c, 0x69, 0x6e, 0x6b, 0x2e, 0x6c, 0x69, 0x62, 0x73, 0x2c, 0x20, 0x27, 0x2d, 0x6c, 0x27, 0x2c, 
+	0x20, 0x27, 0x20, 0x27, 0x29, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x65, 0x20, 0x3d, 
+	0x20, 0x65, 0x20, 0x2e, 0x2e, 0x20, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x54, 0x6f, 0x53, 0x74, 0x72, 
+	0x69, 0x6e, 0x67, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x69, 0x6e, 
+	0x6b, 0x2e, 0x66, 0x72, 0x61, 0x6d, 0x65, 0x77, 0x6f, 0x72, 0x6b, 0x70, 0x61, 0x74, 0x68, 0x2c, 
+	0x20, 0x27, 0x2d, 0x46, 0x27, 0x2c, 0x20, 0x27, 0x20, 0x27, 0x29, 0xa, 0x9, 0x6c, 0x6f, 0x63, 
+	0x61, 0x6c, 0x20, 0x65, 0x20, 0x3d, 0x20, 0x65, 0x20, 0x2e, 0x2e, 0x20, 0x54, 0x61, 0x62, 0x6c, 
+	0x65, 0x54, 0x6f, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 
+	0x67, 0x73, 0x2e, 0x6c, 0x69, 0x6e, 0x6b, 0x2e, 0x66, 0x72, 0x61, 0x6d, 0x65, 0x77, 0x6f, 0x72, 
+	0x6b, 0x73, 0x2c, 0x20, 0x27, 0x2d, 0x66, 0x72, 0x61, 0x6d, 0x65, 0x77, 0x6f, 0x72, 0x6b, 0x20, 
+	0x27, 0x2c, 0x20, 0x27, 0x20, 0x27, 0x29, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x65, 
+	0x20, 0x3d, 0x20, 0x65, 0x20, 0x2e, 0x2e, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 
+	0x2e, 0x6c, 0x69, 0x6e, 0x6b, 0x2e, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x3a, 0x54, 0x6f, 0x53, 0x74, 
+	0x72, 0x69, 0x6e, 0x67, 0x28, 0x29, 0xa, 0x9, 0x41, 0x64, 0x64, 0x4a, 0x6f, 0x62, 0x28, 0x6f, 
+	0x75, 0x74, 0x70, 0x75, 0x74, 0x2c, 0x20, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x2c, 0x20, 0x65, 0x29, 
+	0xa, 0x65, 0x6e, 0x64, 0xa, 0xa, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+	0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x20, 0x4c, 
+	0x49, 0x42, 0x20, 0x47, 0x43, 0x43, 0x20, 0x44, 0x52, 0x49, 0x56, 0x45, 0x52, 0x20, 0x2d, 0x2d, 
+	0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+	0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0xa, 0xa, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 
+	0x20, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x47, 0x43, 0x43, 0x5f, 0x4c, 0x69, 0x62, 0x28, 0x6f, 
+	0x75, 0x74, 0x70, 0x75, 0x74, 0x2c, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x73, 0x2c, 0x20, 0x73, 
+	0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x29, 0xa, 0x9, 0x2d, 0x2d, 0x20, 0x6f, 0x75, 0x74, 
+	0x70, 0x75, 0x74, 0x20, 0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65, 0x20, 0x6d, 0x75, 0x73, 0x74, 
+	0x20, 0x62, 0x65, 0x20, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x64, 0x20, 0x62, 0x65, 0x63, 0x61, 
+	0x75, 0x73, 0x65, 0x20, 0x61, 0x72, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x75, 0x70, 0x64, 0x61, 
+	0x74, 0x65, 0x20, 0x65, 0x78, 0x69, 0x73, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x72, 0x63, 0x68, 
+	0x69, 0x76, 0x65, 0x73, 0x2c, 0x20, 0x70, 0x6f, 0x73, 0x73, 0x69, 0x62, 0x6c, 0x79, 0x20, 0x6c, 
+	0x65, 0x61, 0x76, 0x69, 0x6e, 0x67, 0x20, 0x73, 0x74, 0x72, 0x61, 0x79, 0x20, 0x6f, 0x62, 0x6a, 
+	0x65, 0x63, 0x74, 0x73, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x65, 0x20, 0x3d, 0x20, 
+	0x22, 0x72, 0x6d, 0x20, 0x2d, 0x66, 0x20, 0x22, 0x20, 0x2e, 0x2e, 0x20, 0x6f, 0x75, 0x74, 0x70, 
+	0x75, 0x74, 0x20, 0x2e, 0x2e, 0x20, 0x22, 0x20, 0x32, 0x3e, 0x20, 0x2f, 0x64, 0x65, 0x76, 0x2f, 
+	0x6e, 0x75, 0x6c, 0x6c, 0x3b, 0x20, 0x22, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x65, 
+	0x20, 0x3d, 0x20, 0x65, 0x20, 0x2e, 0x2e, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 
+	0x2e, 0x6c, 0x69, 0x62, 0x2e, 0x65, 0x78, 0x65, 0x20, 0x2e, 0x2e, 0x20, 0x22, 0x20, 0x72, 0x63, 
+	0x75, 0x20, 0x22, 0x20, 0x2e, 0x2e, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0xa, 0x9, 0x6c, 
+	0x6f, 0x63, 0x61, 0x6c, 0x20, 0x65, 0x20, 0x3d, 0x20, 0x65, 0x20, 0x2e, 0x2e, 0x20, 0x22, 0x20, 
+	0x22, 0x20, 0x2e, 0x2e, 0x20, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x54, 0x6f, 0x53, 0x74, 0x72, 0x69, 
+	0x6e, 0x67, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x73, 0x2c, 0x20, 0x27, 0x27, 0x2c, 0x20, 0x27, 
+	0x20, 0x27, 0x29, 0x20, 0x2e, 0x2e, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 
+	0x6c, 0x69, 0x62, 0x2e, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x3a, 0x54, 0x6f, 0x53, 0x74, 0x72, 0x69, 
+	0x6e, 0x67, 0x28, 0x29, 0xa, 0x9, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x65, 0xa, 0x65, 
+	0x6e, 0x64, 0xa, 0xa, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+	0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x20, 0x44, 0x4c, 0x4c, 
+	0x20, 0x47, 0x43, 0x43, 0x20, 0x44, 0x52, 0x49, 0x56, 0x45, 0x52, 0x20, 0x2d, 0x2d, 0x2d, 0x2d, 
+	0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+	0x2d, 0x2d, 0x2d, 0x2d, 0xa, 0xa, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x44, 
+	0x72, 0x69, 0x76, 0x65, 0x72, 0x47, 0x43, 0x43, 0x5f, 0x44, 0x4c, 0x4c, 0x28, 0x6c, 0x61, 0x62, 
+	0x65, 0x6c, 0x2c, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2c, 0x20, 0x69, 0x6e, 0x70, 0x75, 
+	0x74, 0x73, 0x2c, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x29, 0xa, 0x9, 0x6c, 
+	0x6f, 0x63, 0x61, 0x6c, 0x20, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x5f, 0x66, 0x6c, 0x61, 0x67, 
+	0x73, 0x20, 0x3d, 0x20, 0x22, 0x22, 0xa, 0xa, 0x9, 0x69, 0x66, 0x20, 0x70, 0x6c, 0x61, 0x74, 
+	0x66, 0x6f, 0x72, 0x6d, 0x20, 0x3d, 0x3d, 0x20, 0x22, 0x6d, 0x61, 0x63, 0x6f, 0x73, 0x78, 0x22, 
+	0x20, 0x74, 0x68, 0x65, 0x6e, 0xa, 0x9, 0x9, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x5f, 0x66, 
+	0x6c, 0x61, 0x67, 0x73, 0x20, 0x3d, 0x20, 0x22, 0x20, 0x2d, 0x64, 0x79, 0x6e, 0x61, 0x6d, 0x69, 
+	0x63, 0x6c, 0x69, 0x62, 0x22, 0xa, 0x9, 0x65, 0x6c, 0x73, 0x65, 0xa, 0x9, 0x9, 0x73, 0x68, 
+	0x61, 0x72, 0x65, 0x64, 0x5f, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x3d, 0x20, 0x22, 0x20, 0x2d, 
+	0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x22, 0xa, 0x9, 0x65, 0x6e, 0x64, 0xa, 0xa, 0x9, 0x6c, 
+	0x6f, 0x63, 0x61, 0x6c, 0x20, 0x65, 0x20, 0x3d, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 
+	0x73, 0x2e, 0x64, 0x6c, 0x6c, 0x2e, 0x65, 0x78, 0x65, 0x20, 0x2e, 0x2e, 0x20, 0x73, 0x68, 0x61, 
+	0x72, 0x65, 0x64, 0x5f, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x2e, 0x2e, 0x20, 0x22, 0x20, 0x2d, 
+	0x6f, 0x20, 0x22, 0x20, 0x2e, 0x2e, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0xa, 0x9, 0x6c, 
+	0x6f, 0x63, 0x61, 0x6c, 0x20, 0x65, 0x20, 0x3d, 0x20, 0x65, 0x20, 0x2e, 0x2e, 0x20, 0x22, 0x20, 
+	0x22, 0x20, 0x2e, 0x2e, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x64, 0x6c, 
+	0x6c, 0x2e, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x2e, 0x2e, 0x20, 
+	0x22, 0x20, 0x22, 0x20, 0x2e, 0x2e, 0x20, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x54, 0x6f, 0x53, 0x74, 
+	0x72, 0x69, 0x6e, 0x67, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x73, 0x2c, 0x20, 0x27, 0x27, 0x2c, 
+	0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x65, 0x20, 
+	0x3d, 0x20, 0x65, 0x20, 0x2e, 0x2e, 0x20, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x54, 0x6f, 0x53, 0x74, 
+	0x72, 0x69, 0x6e, 0x67, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x64, 0x6c, 
+	0x6c, 0x2e, 0x65, 0x78, 0x74, 0x72, 0x61, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x2c, 0x20, 0x27, 0x27, 
+	0x2c, 0x20, 0x27, 0x20, 0x27, 0x29, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x65, 0x20, 
+	0x3d, 0x20, 0x65, 0x20, 0x2e, 0x2e, 0x20, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x54, 0x6f, 0x53, 0x74, 
+	0x72, 0x69, 0x6e, 0x67, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x64, 0x6c, 
+	0x6c, 0x2e, 0x6c, 0x69, 0x62, 0x70, 0x61, 0x74, 0x68, 0x2c, 0x20, 0x27, 0x2d, 0x4c, 0x27, 0x2c, 
+	0x20, 0x27, 0x20, 0x27, 0x29, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x65, 0x20, 0x3d, 
+	0x20, 0x65, 0x20, 0x2e, 0x2e, 0x20, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x54, 0x6f, 0x53, 0x74, 0x72, 
+	0x69, 0x6e, 0x67, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x64, 0x6c, 0x6c, 
+	0x2e, 0x6c, 0x69, 0x62, 0x73, 0x2c, 0x20, 0x27, 0x2d, 0x6c, 0x27, 0x2c, 0x20, 0x27, 0x20, 0x27, 
+	0x29, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x65, 0x20, 0x3d, 0x20, 0x65, 0x20, 0x2e, 
+	0x2e, 0x20, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x54, 0x6f, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 
+	0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x64, 0x6c, 0x6c, 0x2e, 0x66, 0x72, 0x61, 
+	0x6d, 0x65, 0x77, 0x6f, 0x72, 0x6b, 0x70, 0x61, 0x74, 0x68, 0x2c, 0x20, 0x27, 0x2d, 0x46, 0x27, 
+	0x2c, 0x20, 0x27, 0x20, 0x27, 0x29, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x65, 0x20, 
+	0x3d, 0x20, 0x65, 0x20, 0x2e, 0x2e, 0x20, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x54, 0x6f, 0x53, 0x74, 
+	0x72, 0x69, 0x6e, 0x67, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x64, 0x6c, 
+	0x6c, 0x2e, 0x66, 0x72, 0x61, 0x6d, 0x65, 0x77, 0x6f, 0x72, 0x6b, 0x73, 0x2c, 0x20, 0x27, 0x2d, 
+	0x66, 0x72, 0x61, 0x6d, 0x65, 0x77, 0x6f, 0x72, 0x6b, 0x20, 0x27, 0x2c, 0x20, 0x27, 0x20, 0x27, 
+	0x29, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x65, 0x20, 0x3d, 0x20, 0x65, 0x20, 0x2e, 
+	0x2e, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x64, 0x6c, 0x6c, 0x2e, 0x66, 
+	0x6c, 0x61, 0x67, 0x73, 0x3a, 0x54, 0x6f, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x29, 0xa, 
+	0x9, 0x41, 0x64, 0x64, 0x4a, 0x6f, 0x62, 0x28, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2c, 0x20, 
+	0x6c, 0x61, 0x62, 0x65, 0x6c, 0x2c, 0x20, 0x65, 0x29, 0xa, 0x65, 0x6e, 0x64, 0xa, 0xa, 0x66, 
+	0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x53, 0x65, 0x74, 0x44, 0x72, 0x69, 0x76, 0x65, 
+	0x72, 0x73, 0x47, 0x43, 0x43, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x29, 0xa, 
+	0x9, 0x69, 0x66, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 0x63, 0x20, 
+	0x74, 0x68, 0x65, 0x6e, 0xa, 0x9, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 
+	0x63, 0x63, 0x2e, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x3d, 0x20, 0x22, 
+	0x2e, 0x6f, 0x22, 0xa, 0x9, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 
+	0x63, 0x2e, 0x65, 0x78, 0x65, 0x5f, 0x63, 0x20, 0x3d, 0x20, 0x22, 0x67, 0x63, 0x63, 0x22, 0xa, 
+	0x9, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 0x63, 0x2e, 0x65, 0x78, 
+	0x65, 0x5f, 0x63, 0x78, 0x78, 0x20, 0x3d, 0x20, 0x22, 0x67, 0x2b, 0x2b, 0x22, 0xa, 0x9, 0x9, 
+	0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 0x63, 0x2e, 0x44, 0x72, 0x69, 0x76, 
+	0x65, 0x72, 0x43, 0x54, 0x65, 0x73, 0x74, 0x20, 0x3d, 0x20, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 
+	0x47, 0x43, 0x43, 0x5f, 0x43, 0x54, 0x65, 0x73, 0x74, 0xa, 0x9, 0x9, 0x73, 0x65, 0x74, 0x74, 
+	0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 0x63, 0x2e, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x43, 0x20, 
+	0x3d, 0x20, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x47, 0x43, 0x43, 0x5f, 0x47, 0x65, 0x74, 0x28, 
+	0x22, 0x65, 0x78, 0x65, 0x5f, 0x63, 0x22, 0x2c, 0x20, 0x22, 0x5f, 0x63, 0x5f, 0x63, 0x61, 0x63, 
+	0x68, 0x65, 0x22, 0x2c, 0x20, 0x22, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x5f, 0x63, 0x22, 0x29, 0xa, 
+	0x9, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 0x63, 0x2e, 0x44, 0x72, 
+	0x69, 0x76, 0x65, 0x72, 0x43, 0x58, 0x58, 0x20, 0x3d, 0x20, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 
+	0x47, 0x43, 0x43, 0x5f, 0x47, 0x65, 0x74, 0x28, 0x22, 0x65, 0x78, 0x65, 0x5f, 0x63, 0x78, 0x78, 
+	0x22, 0x2c, 0x20, 0x22, 0x5f, 0x63, 0x78, 0x78, 0x5f, 0x63, 0x61, 0x63, 0x68, 0x65, 0x22, 0x2c, 
+	0x20, 0x22, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x5f, 0x63, 0x78, 0x78, 0x22, 0x29, 0xa, 0x9, 0x65, 
+	0x6e, 0x64, 0xa, 0x9, 0xa, 0x9, 0x69, 0x66, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 
+	0x73, 0x2e, 0x6c, 0x69, 0x6e, 0x6b, 0x20, 0x74, 0x68, 0x65, 0x6e, 0xa, 0x9, 0x9, 0x69, 0x66, 
+	0x20, 0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79, 0x20, 0x3d, 0x3d, 0x20, 0x22, 0x77, 0x69, 0x6e, 0x64, 
+	0x6f, 0x77, 0x73, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6e, 0xa, 0x9, 0x9, 0x9, 0x73, 0x65, 0x74, 
+	0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x69, 0x6e, 0x6b, 0x2e, 0x65, 0x78, 0x74, 0x65, 0x6e, 
+	0x73, 0x69, 0x6f, 0x6e, 0x20, 0x3d, 0x20, 0x22, 0x2e, 0x65, 0x78, 0x65, 0x22, 0xa, 0x9, 0x9, 
+	0x65, 0x6c, 0x73, 0x65, 0xa, 0x9, 0x9, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 
+	0x2e, 0x6c, 0x69, 0x6e, 0x6b, 0x2e, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x73, 0x69, 0x6f, 0x6e, 0x20, 
+	0x3d, 0x20, 0x22, 0x22, 0xa, 0x9, 0x9, 0x65, 0x6e, 0x64, 0xa, 0x9, 0x9, 0x73, 0x65, 0x74, 
+	0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x69, 0x6e, 0x6b, 0x2e, 0x65, 0x78, 0x65, 0x20, 0x3d, 
+	0x20, 0x22, 0x67, 0x2b, 0x2b, 0x22, 0xa, 0x9, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 
+	0x73, 0x2e, 0x6c, 0x69, 0x6e, 0x6b, 0x2e, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x20, 0x3d, 0x20, 
+	0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x47, 0x43, 0x43, 0x5f, 0x4c, 0x69, 0x6e, 0x6b, 0xa, 0x9, 
+	0x65, 0x6e, 0x64, 0xa, 0x9, 0xa, 0x9, 0x69, 0x66, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 
+	0x67, 0x73, 0x2e, 0x6c, 0x69, 0x62, 0x20, 0x74, 0x68, 0x65, 0x6e, 0xa, 0x9, 0x9, 0x73, 0x65, 
+	0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x69, 0x62, 0x2e, 0x70, 0x72, 0x65, 0x66, 0x69, 
+	0x78, 0x20, 0x3d, 0x20, 0x22, 0x6c, 0x69, 0x62, 0x22, 0xa, 0x9, 0x9, 0x73, 0x65, 0x74, 0x74, 
+	0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x69, 0x62, 0x2e, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x73, 0x69, 
+	0x6f, 0x6e, 0x20, 0x3d, 0x20, 0x22, 0x2e, 0x61, 0x22, 0xa, 0x9, 0x9, 0x73, 0x65, 0x74, 0x74, 
+	0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x69, 0x62, 0x2e, 0x65, 0x78, 0x65, 0x20, 0x3d, 0x20, 0x22, 
+	0x61, 0x72, 0x22, 0xa, 0x9, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 
+	0x69, 0x62, 0x2e, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x20, 0x3d, 0x20, 0x44, 0x72, 0x69, 0x76, 
+	0x65, 0x72, 0x47, 0x43, 0x43, 0x5f, 0x4c, 0x69, 0x62, 0xa, 0x9, 0x65, 0x6e, 0x64, 0xa, 0x9, 
+	0xa, 0x9, 0x69, 0x66, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x64, 0x6c, 
+	0x6c, 0x20, 0x74, 0x68, 0x65, 0x6e, 0xa, 0x9, 0x9, 0x69, 0x66, 0x20, 0x70, 0x6c, 0x61, 0x74, 
+	0x66, 0x6f, 0x72, 0x6d, 0x20, 0x3d, 0x3d, 0x20, 0x22, 0x6d, 0x61, 0x63, 0x6f, 0x73, 0x78, 0x22, 
+	0x20, 0x74, 0x68, 0x65, 0x6e, 0xa, 0x9, 0x9, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 
+	0x73, 0x2e, 0x64, 0x6c, 0x6c, 0x2e, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x20, 0x3d, 0x20, 0x22, 
+	0x6c, 0x69, 0x62, 0x22, 0xa, 0x9, 0x9, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 
+	0x2e, 0x64, 0x6c, 0x6c, 0x2e, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x3d, 
+	0x20, 0x22, 0x2e, 0x64, 0x79, 0x6c, 0x69, 0x62, 0x22, 0xa, 0x9, 0x9, 0x65, 0x6c, 0x73, 0x65, 
+	0x69, 0x66, 0x20, 0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79, 0x20, 0x3d, 0x3d, 0x20, 0x22, 0x77, 0x69, 
+	0x6e, 0x64, 0x6f, 0x77, 0x73, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6e, 0xa, 0x9, 0x9, 0x9, 0x73, 
+	0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x64, 0x6c, 0x6c, 0x2e, 0x70, 0x72, 0x65, 0x66, 
+	0x69, 0x78, 0x20, 0x3d, 0x20, 0x22, 0x22, 0xa, 0x9, 0x9, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 
+	0x6e, 0x67, 0x73, 0x2e, 0x64, 0x6c, 0x6c, 0x2e, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x73, 0x69, 0x6f, 
+	0x6e, 0x20, 0x3d, 0x20, 0x22, 0x2e, 0x64, 0x6c, 0x6c, 0x22, 0xa, 0x9, 0x9, 0x65, 0x6c, 0x73, 
+	0x65, 0xa, 0x9, 0x9, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x64, 0x6c, 
+	0x6c, 0x2e, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x20, 0x3d, 0x20, 0x22, 0x22, 0xa, 0x9, 0x9, 
+	0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x64, 0x6c, 0x6c, 0x2e, 0x65, 0x78, 
+	0x74, 0x65, 0x6e, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x3d, 0x20, 0x22, 0x2e, 0x73, 0x6f, 0x22, 0xa, 
+	0x9, 0x9, 0x65, 0x6e, 0x64, 0xa, 0x9, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 
+	0x2e, 0x64, 0x6c, 0x6c, 0x2e, 0x65, 0x78, 0x65, 0x20, 0x3d, 0x20, 0x22, 0x67, 0x2b, 0x2b, 0x22, 
+	0xa, 0x9, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x64, 0x6c, 0x6c, 0x2e, 
+	0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x20, 0x3d, 0x20, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x47, 
+	0x43, 0x43, 0x5f, 0x44, 0x4c, 0x4c, 0xa, 0x9, 0x65, 0x6e, 0x64, 0xa, 0x65, 0x6e, 0x64, 0xa, 
+	0};
+const char internal_file_4[] = {0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x43, 
+	0x6c, 0x61, 0x6e, 0x67, 0x5f, 0x43, 0x54, 0x65, 0x73, 0x74, 0x28, 0x63, 0x6f, 0x64, 0x65, 0x2c, 
+	0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x29, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 
+	0x20, 0x66, 0x20, 0x3d, 0x20, 0x69, 0x6f, 0x2e, 0x6f, 0x70, 0x65, 0x6e, 0x28, 0x22, 0x5f, 0x74, 
+	0x65, 0x73, 0x74, 0x2e, 0x63, 0x22, 0x2c, 0x20, 0x22, 0x77, 0x22, 0x29, 0xa, 0x9, 0x66, 0x3a, 
+	0x77, 0x72, 0x69, 0x74, 0x65, 0x28, 0x63, 0x6f, 0x64, 0x65, 0x29, 0xa, 0x9, 0x66, 0x3a, 0x77, 
+	0x72, 0x69, 0x74, 0x65, 0x28, 0x22, 0x5c, 0x6e, 0x22, 0x29, 0xa, 0x9, 0x66, 0x3a, 0x63, 0x6c, 
+	0x6f, 0x73, 0x65, 0x28, 0x29, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x72, 0x65, 0x74, 
+	0x20, 0x3d, 0x20, 0x45, 0x78, 0x65, 0x63, 0x75, 0x74, 0x65, 0x53, 0x69, 0x6c, 0x65, 0x6e, 0x74, 
+	0x28, 0x22, 0x63, 0x6c, 0x61, 0x6e, 0x67, 0x20, 0x5f, 0x74, 0x65, 0x73, 0x74, 0x2e, 0x63, 0x20, 
+	0x2d, 0x6f, 0x20, 0x5f, 0x74, 0x65, 0x73, 0x74, 0x20, 0x22, 0x20, 0x2e, 0x2e, 0x20, 0x6f, 0x70, 
+	0x74, 0x69, 0x6f, 0x6e, 0x73, 0x29, 0xa, 0x9, 0x6f, 0x73, 0x2e, 0x72, 0x65, 0x6d, 0x6f, 0x76, 
+	0x65, 0x28, 0x22, 0x5f, 0x74, 0x65, 0x73, 0x74, 0x2e, 0x63, 0x22, 0x29, 0xa, 0x9, 0x6f, 0x73, 
+	0x2e, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x28, 0x22, 0x5f, 0x74, 0x65, 0x73, 0x74, 0x22, 0x29, 
+	0xa, 0x9, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x72, 0x65, 0x74, 0x3d, 0x3d, 0x30, 0xa, 
+	0x65, 0x6e, 0x64, 0xa, 0xa, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x53, 0x65, 
+	0x74, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x73, 0x43, 0x6c, 0x61, 0x6e, 0x67, 0x28, 0x73, 0x65, 
+	0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x29, 0xa, 0x9, 0x53, 0x65, 0x74, 0x44, 0x72, 0x69, 0x76, 
+	0x65, 0x72, 0x73, 0x47, 0x43, 0x43, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x29, 
+	0xa, 0xa, 0x9, 0x69, 0x66, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 
+	0x63, 0x20, 0x74, 0x68, 0x65, 0x6e, 0xa, 0x9, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 
+	0x73, 0x2e, 0x63, 0x63, 0x2e, 0x65, 0x78, 0x65, 0x5f, 0x63, 0x20, 0x3d, 0x20, 0x22, 0x63, 0x6c, 
+	0x61, 0x6e, 0x67, 0x22, 0xa, 0x9, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 
+	0x63, 0x63, 0x2e, 0x65, 0x78, 0x65, 0x5f, 0x63, 0x78, 0x78, 0x20, 0x3d, 0x20, 0x22, 0x63, 0x6c, 
+	0x61, 0x6e, 0x67, 0x2b, 0x2b, 0x22, 0xa, 0x9, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 
+	0x73, 0x2e, 0x63, 0x63, 0x2e, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x43, 0x54, 0x65, 0x73, 0x74, 
+	0x20, 0x3d, 0x20, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x43, 0x6c, 0x61, 0x6e, 0x67, 0x5f, 0x43, 
+	0x54, 0x65, 0x73, 0x74, 0xa, 0x9, 0x65, 0x6e, 0x64, 0xa, 0xa, 0x9, 0x69, 0x66, 0x20, 0x73, 
+	0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x69, 0x6e, 0x6b, 0x20, 0x74, 0x68, 0x65, 
+	0x6e, 0xa, 0x9, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x69, 0x6e, 
+	0x6b, 0x2e, 0x65, 0x78, 0x65, 0x20, 0x3d, 0x20, 0x22, 0x63, 0x6c, 0x61, 0x6e, 0x67, 0x2b, 0x2b, 
+	0x22, 0xa, 0x9, 0x65, 0x6e, 0x64, 0xa, 0xa, 0x9, 0x69, 0x66, 0x20, 0x73, 0x65, 0x74, 0x74, 
+	0x69, 0x6e, 0x67, 0x73, 0x2e, 0x64, 0x6c, 0x6c, 0x20, 0x74, 0x68, 0x65, 0x6e, 0xa, 0x9, 0x9, 
+	0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x64, 0x6c, 0x6c, 0x2e, 0x65, 0x78, 0x65, 
+	0x20, 0x3d, 0x20, 0x22, 0x63, 0x6c, 0x61, 0x6e, 0x67, 0x2b, 0x2b, 0x22, 0xa, 0x9, 0x65, 0x6e, 
+	0x64, 0xa, 0x65, 0x6e, 0x64, 0xa, 0};
+const char internal_file_5[] = {0xa, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x20, 0x63, 0x6c, 0x20, 
+	0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x72, 0x20, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0xa, 
+	0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x43, 
+	0x4c, 0x5f, 0x43, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x28, 0x63, 0x70, 0x70, 0x2c, 0x20, 0x73, 0x65, 
+	0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x29, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x64, 
+	0x65, 0x66, 0x73, 0x20, 0x3d, 0x20, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x54, 0x6f, 0x53, 0x74, 0x72, 
+	0x69, 0x6e, 0x67, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 0x63, 0x2e, 
+	0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x73, 0x2c, 0x20, 0x22, 0x2d, 0x44, 0x22, 0x2c, 0x20, 0x22, 
+	0x20, 0x22, 0x29, 0x20, 0x2e, 0x2e, 0x20, 0x22, 0x20, 0x22, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 
+	0x6c, 0x20, 0x69, 0x6e, 0x63, 0x73, 0x20, 0x3d, 0x20, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x54, 0x6f, 
+	0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 
+	0x63, 0x63, 0x2e, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x73, 0x2c, 0x20, 0x27, 0x2d, 0x49, 
+	0x22, 0x27, 0x2c, 0x20, 0x27, 0x22, 0x20, 0x27, 0x29, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 
+	0x20, 0x69, 0x6e, 0x63, 0x73, 0x20, 0x3d, 0x20, 0x69, 0x6e, 0x63, 0x73, 0x20, 0x2e, 0x2e, 0x20, 
+	0x54, 0x61, 0x62, 0x6c, 0x65, 0x54, 0x6f, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x73, 0x65, 
+	0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 0x63, 0x2e, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 
+	0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x73, 0x2c, 0x20, 0x27, 0x2d, 0x49, 0x22, 0x27, 0x2c, 
+	0x20, 0x27, 0x22, 0x20, 0x27, 0x29, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x66, 0x6c, 
+	0x61, 0x67, 0x73, 0x20, 0x3d, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 
+	0x63, 0x2e, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x3a, 0x54, 0x6f, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 
+	0x28, 0x29, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x65, 0x78, 0x65, 0xa, 0x9, 0x69, 
+	0x66, 0x20, 0x63, 0x70, 0x70, 0x20, 0x74, 0x68, 0x65, 0x6e, 0xa, 0x9, 0x9, 0x65, 0x78, 0x65, 
+	0x20, 0x3d, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 0x63, 0x2e, 0x65, 
+	0x78, 0x65, 0x5f, 0x63, 0x78, 0x78, 0xa, 0x9, 0x9, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x3d, 
+	0x20, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x2e, 0x2e, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 
+	0x67, 0x73, 0x2e, 0x63, 0x63, 0x2e, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x5f, 0x63, 0x78, 0x78, 0x3a, 
+	0x54, 0x6f, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x29, 0xa, 0x9, 0x65, 0x6c, 0x73, 0x65, 
+	0xa, 0x9, 0x9, 0x65, 0x78, 0x65, 0x20, 0x3d, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 
+	0x73, 0x2e, 0x63, 0x63, 0x2e, 0x65, 0x78, 0x65, 0x5f, 0x63, 0xa, 0x9, 0x9, 0x66, 0x6c, 0x61, 
+	0x67, 0x73, 0x20, 0x3d, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x2e, 0x2e, 0x20, 0x73, 0x65, 
+	0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 0x63, 0x2e, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x5f, 
+	0x63, 0x3a, 0x54, 0x6f, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x29, 0xa, 0x9, 0x65, 0x6e, 
+	0x64, 0xa, 0x9, 0xa, 0x9, 0x65, 0x78, 0x65, 0x20, 0x3d, 0x20, 0x73, 0x74, 0x72, 0x5f, 0x72, 
+	0x65, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x28, 0x65, 0x78, 0x65, 0x2c, 0x20, 0x22, 0x2f, 0x22, 0x2c, 
+	0x20, 0x22, 0x5c, 0x5c, 0x22, 0x29, 0xa, 0x9, 0x69, 0x66, 0x20, 0x70, 0x6c, 0x61, 0x74, 0x66, 
+	0x6f, 0x72, 0x6d, 0x20, 0x3d, 0x3d, 0x22, 0x77, 0x69, 0x6e, 0x33, 0x32, 0x22, 0x20, 0x74, 0x68, 
+	0x65, 0x6e, 0xa, 0x9, 0x9, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x3d, 0x20, 0x66, 0x6c, 0x61, 
+	0x67, 0x73, 0x20, 0x2e, 0x2e, 0x20, 0x22, 0x20, 0x2f, 0x44, 0x20, 0x5c, 0x22, 0x57, 0x49, 0x4e, 
+	0x33, 0x32, 0x5c, 0x22, 0x20, 0x22, 0xa, 0x9, 0x65, 0x6c, 0x73, 0x65, 0xa, 0x9, 0x9, 0x66, 
+	0x6c, 0x61, 0x67, 0x73, 0x20, 0x3d, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x2e, 0x2e, 0x20, 
+	0x22, 0x20, 0x2f, 0x44, 0x20, 0x5c, 0x22, 0x57, 0x49, 0x4e, 0x36, 0x34, 0x5c, 0x22, 0x20, 0x22, 
+	0xa, 0x9, 0x65, 0x6e, 0x64, 0xa, 0x9, 0xa, 0x9, 0x69, 0x66, 0x20, 0x73, 0x65, 0x74, 0x74, 
+	0x69, 0x6e, 0x67, 0x73, 0x2e, 0x64, 0x65, 0x62, 0x75, 0x67, 0x20, 0x3e, 0x20, 0x30, 0x20, 0x74, 
+	0x68, 0x65, 0x6e, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x3d, 0x20, 0x66, 0x6c, 0x61, 0x67, 
+	0x73, 0x20, 0x2e, 0x2e, 0x20, 0x22, 0x2f, 0x4f, 0x64, 0x20, 0x2f, 0x4d, 0x54, 0x64, 0x20, 0x2f, 
+	0x5a, 0x37, 0x20, 0x2f, 0x44, 0x20, 0x5c, 0x22, 0x5f, 0x44, 0x45, 0x42, 0x55, 0x47, 0x5c, 0x22, 
+	0x20, 0x22, 0x20, 0x65, 0x6e, 0x64, 0xa, 0x9, 0x69, 0x66, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 
+	0x6e, 0x67, 0x73, 0x2e, 0x6f, 0x70, 0x74, 0x69, 0x6d, 0x69, 0x7a, 0x65, 0x20, 0x3e, 0x20, 0x30, 
+	0x20, 0x74, 0x68, 0x65, 0x6e, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x3d, 0x20, 0x66, 0x6c, 
+	0x61, 0x67, 0x73, 0x20, 0x2e, 0x2e, 0x20, 0x22, 0x2f, 0x4f, 0x32, 0x20, 0x2f, 0x4d, 0x54, 0x20, 
+	0x2f, 0x44, 0x20, 0x5c, 0x22, 0x4e, 0x44, 0x45, 0x42, 0x55, 0x47, 0x5c, 0x22, 0x20, 0x22, 0x20, 
+	0x65, 0x6e, 0x64, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x65, 0x78, 0x65, 0x63, 0x20, 
+	0x3d, 0x20, 0x65, 0x78, 0x65, 0x20, 0x2e, 0x2e, 0x20, 0x22, 0x20, 0x2f, 0x6e, 0x6f, 0x6c, 0x6f, 
+	0x67, 0x6f, 0x20, 0x2f, 0x44, 0x5f, 0x43, 0x52, 0x54, 0x5f, 0x53, 0x45, 0x43, 0x55, 0x52, 0x45, 
+	0x5f, 0x4e, 0x4f, 0x5f, 0x44, 0x45, 0x50, 0x52, 0x45, 0x43, 0x41, 0x54, 0x45, 0x20, 0x2f, 0x63, 
+	0x20, 0x22, 0x20, 0x2e, 0x2e, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x2e, 0x2e, 0x20, 0x22, 
+	0x20, 0x22, 0x20, 0x2e, 0x2e, 0x20, 0x69, 0x6e, 0x63, 0x73, 0x20, 0x2e, 0x2e, 0x20, 0x64, 0x65, 
+	0x66, 0x73, 0x20, 0x2e, 0x2e, 0x20, 0x22, 0x20, 0x2f, 0x46, 0x6f, 0x22, 0xa, 0x9, 0x72, 0x65, 
+	0x74, 0x75, 0x72, 0x6e, 0x20, 0x65, 0x78, 0x65, 0x63, 0xa, 0x65, 0x6e, 0x64, 0xa, 0xa, 0x66, 
+	0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x43, 0x4c, 
+	0x5f, 0x43, 0x58, 0x58, 0x28, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x2c, 0x20, 0x6f, 0x75, 0x74, 0x70, 
+	0x75, 0x74, 0x2c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x2c, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 
+	0x67, 0x73, 0x29, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x63, 0x61, 0x63, 0x68, 0x65, 
+	0x20, 0x3d, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 0x63, 0x2e, 0x5f, 
+	0x63, 0x78, 0x78, 0x5f, 0x63, 0x61, 0x63, 0x68, 0x65, 0xa, 0x9, 0x69, 0x66, 0x20, 0x73, 0x65, 
+	0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x69, 0x6e, 0x76, 0x6f, 0x6b, 0x65, 0x5f, 0x63, 0x6f, 
+	0x75, 0x6e, 0x74, 0x20, 0x7e, 0x3d, 0x20, 0x63, 0x61, 0x63, 0x68, 0x65, 0x2e, 0x6e, 0x72, 0x20, 
+	0x74, 0x68, 0x65, 0x6e, 0xa, 0x9, 0x9, 0x63, 0x61, 0x63, 0x68, 0x65, 0x2e, 0x6e, 0x72, 0x20, 
+	0x3d, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x69, 0x6e, 0x76, 0x6f, 0x6b, 
+	0x65, 0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0xa, 0x9, 0x9, 0x63, 0x61, 0x63, 0x68, 0x65, 0x2e, 
+	0x73, 0x74, 0x72, 0x20, 0x3d, 0x20, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x43, 0x4c, 0x5f, 0x43, 
+	0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x28, 0x74, 0x72, 0x75, 0x65, 0x2c, 0x20, 0x73, 0x65, 0x74, 0x74, 
+	0x69, 0x6e, 0x67, 0x73, 0x29, 0xa, 0x9, 0x65, 0x6e, 0x64, 0xa, 0x9, 0xa, 0x9, 0x41, 0x64, 
+	0x64, 0x4a, 0x6f, 0x62, 0x28, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2c, 0x20, 0x6c, 0x61, 0x62, 
+	0x65, 0x6c, 0x2c, 0x20, 0x63, 0x61, 0x63, 0x68, 0x65, 0x2e, 0x73, 0x74, 0x72, 0x20, 0x2e, 0x2e, 
+	0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x20, 0x2e, 0x2e, 0x20, 0x22, 0x20, 0x22, 0x20, 0x2e, 
+	0x2e, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x29, 0xa, 0x9, 0x53, 0x65, 0x74, 0x46, 0x69, 0x6c, 
+	0x74, 0x65, 0x72, 0x28, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2c, 0x20, 0x22, 0x46, 0x22, 0x20, 
+	0x2e, 0x2e, 0x20, 0x50, 0x61, 0x74, 0x68, 0x46, 0x69, 0x6c, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x28, 
+	0x69, 0x6e, 0x70, 0x75, 0x74, 0x29, 0x29, 0xa, 0x65, 0x6e, 0x64, 0xa, 0xa, 0x66, 0x75, 0x6e, 
+	0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x43, 0x4c, 0x5f, 0x43, 
+	0x28, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x2c, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2c, 0x20, 
+	0x69, 0x6e, 0x70, 0x75, 0x74, 0x2c, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x29, 
+	0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x63, 0x61, 0x63, 0x68, 0x65, 0x20, 0x3d, 0x20, 
+	0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 0x63, 0x2e, 0x5f, 0x63, 0x5f, 0x63, 
+	0x61, 0x63, 0x68, 0x65, 0xa, 0x9, 0x69, 0x66, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 
+	0x73, 0x2e, 0x69, 0x6e, 0x76, 0x6f, 0x6b, 0x65, 0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x7e, 
+	0x3d, 0x20, 0x63, 0x61, 0x63, 0x68, 0x65, 0x2e, 0x6e, 0x72, 0x20, 0x74, 0x68, 0x65, 0x6e, 0xa, 
+	0x9, 0x9, 0x63, 0x61, 0x63, 0x68, 0x65, 0x2e, 0x6e, 0x72, 0x20, 0x3d, 0x20, 0x73, 0x65, 0x74, 
+	0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x69, 0x6e, 0x76, 0x6f, 0x6b, 0x65, 0x5f, 0x63, 0x6f, 0x75, 
+	0x6e, 0x74, 0xa, 0x9, 0x9, 0x63, 0x61, 0x63, 0x68, 0x65, 0x2e, 0x73, 0x74, 0x72, 0x20, 0x3d, 
+	0x20, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x43, 0x4c, 0x5f, 0x43, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 
+	0x28, 0x6e, 0x69, 0x6c, 0x2c, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x29, 0xa, 
+	0x9, 0x65, 0x6e, 0x64, 0xa, 0x9, 0xa, 0x9, 0x41, 0x64, 0x64, 0x4a, 0x6f, 0x62, 0x28, 0x6f, 
+	0x75, 0x74, 0x70, 0x75, 0x74, 0x2c, 0x20, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x2c, 0x20, 0x63, 0x61, 
+	0x63, 0x68, 0x65, 0x2e, 0x73, 0x74, 0x72, 0x20, 0x2e, 0x2e, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 
+	0x74, 0x20, 0x2e, 0x2e, 0x20, 0x22, 0x20, 0x22, 0x20, 0x2e, 0x2e, 0x20, 0x69, 0x6e, 0x70, 0x75, 
+	0x74, 0x29, 0xa, 0x9, 0x53, 0x65, 0x74, 0x46, 0x69, 0x6c, 0x74, 0x65, 0x72, 0x28, 0x6f, 0x75, 
+	0x74, 0x70, 0x75, 0x74, 0x2c, 0x20, 0x22, 0x46, 0x22, 0x20, 0x2e, 0x2e, 0x20, 0x50, 0x61, 0x74, 
+	0x68, 0x46, 0x69, 0x6c, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x29, 
+	0x29, 0xa, 0x65, 0x6e, 0x64, 0xa, 0xa, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 
+	0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x43, 0x4c, 0x5f, 0x43, 0x54, 0x65, 0x73, 0x74, 0x28, 0x63, 
+	0x6f, 0x64, 0x65, 0x2c, 0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x29, 0xa, 0x9, 0x6c, 
+	0x6f, 0x63, 0x61, 0x6c, 0x20, 0x66, 0x20, 0x3d, 0x20, 0x69, 0x6f, 0x2e, 0x6f, 0x70, 0x65, 0x6e, 
+	0x28, 0x22, 0x5f, 0x74, 0x65, 0x73, 0x74, 0x2e, 0x63, 0x22, 0x2c, 0x20, 0x22, 0x77, 0x22, 0x29, 
+	0xa, 0x9, 0x66, 0x3a, 0x77, 0x72, 0x69, 0x74, 0x65, 0x28, 0x63, 0x6f, 0x64, 0x65, 0x29, 0xa, 
+	0x9, 0x66, 0x3a, 0x77, 0x72, 0x69, 0x74, 0x65, 0x28, 0x22, 0x5c, 0x6e, 0x22, 0x29, 0xa, 0x9, 
+	0x66, 0x3a, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x28, 0x29, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 
+	0x20, 0x72, 0x65, 0x74, 0x20, 0x3d, 0x20, 0x45, 0x78, 0x65, 0x63, 0x75, 0x74, 0x65, 0x53, 0x69, 
+	0x6c, 0x65, 0x6e, 0x74, 0x28, 0x22, 0x63, 0x6c, 0x20, 0x5f, 0x74, 0x65, 0x73, 0x74, 0x2e, 0x63, 
+	0x20, 0x2f, 0x46, 0x65, 0x5f, 0x74, 0x65, 0x73, 0x74, 0x20, 0x22, 0x20, 0x2e, 0x2e, 0x20, 0x6f, 
+	0x70, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x29, 0xa, 0x9, 0x6f, 0x73, 0x2e, 0x72, 0x65, 0x6d, 0x6f, 
+	0x76, 0x65, 0x28, 0x22, 0x5f, 0x74, 0x65, 0x73, 0x74, 0x2e, 0x63, 0x22, 0x29, 0xa, 0x9, 0x6f, 
+	0x73, 0x2e, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x28, 0x22, 0x5f, 0x74, 0x65, 0x73, 0x74, 0x2e, 
+	0x65, 0x78, 0x65, 0x22, 0x29, 0xa, 0x9, 0x6f, 0x73, 0x2e, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x65, 
+	0x28, 0x22, 0x5f, 0x74, 0x65, 0x73, 0x74, 0x2e, 0x6f, 0x62, 0x6a, 0x22, 0x29, 0xa, 0x9, 0x72, 
+	0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x72, 0x65, 0x74, 0x3d, 0x3d, 0x30, 0xa, 0x65, 0x6e, 0x64, 
+	0xa, 0xa, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x44, 0x72, 0x69, 0x76, 0x65, 
+	0x72, 0x43, 0x4c, 0x5f, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 
+	0x65, 0x28, 0x65, 0x78, 0x65, 0x63, 0x2c, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2c, 0x20, 
+	0x69, 0x6e, 0x70, 0x75, 0x74, 0x29, 0xa, 0x9, 0x69, 0x66, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 
+	0x67, 0x2e, 0x6c, 0x65, 0x6e, 0x28, 0x65, 0x78, 0x65, 0x63, 0x29, 0x20, 0x2b, 0x20, 0x73, 0x74, 
+	0x72, 0x69, 0x6e, 0x67, 0x2e, 0x6c, 0x65, 0x6e, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x29, 0x20, 
+	0x3c, 0x20, 0x38, 0x30, 0x30, 0x30, 0x20, 0x74, 0x68, 0x65, 0x6e, 0xa, 0x9, 0x9, 0x72, 0x65, 
+	0x74, 0x75, 0x72, 0x6e, 0x20, 0x65, 0x78, 0x65, 0x63, 0x20, 0x2e, 0x2e, 0x20, 0x22, 0x20, 0x22, 
+	0x20, 0x2e, 0x2e, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0xa, 0x9, 0x65, 0x6c, 0x73, 0x65, 0xa, 
+	0x9, 0x9, 0x2d, 0x2d, 0x20, 0x75, 0x73, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x68, 0x61, 0x73, 
+	0x68, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x73, 
+	0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x20, 0x6c, 0x69, 
+	0x6e, 0x65, 0x20, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x73, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 
+	0x65, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x73, 0xa, 
+	0x9, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 
+	0x5f, 0x66, 0x69, 0x6c, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x3d, 0x20, 0x22, 0x2e, 0x62, 0x61, 
+	0x6d, 0x2f, 0x22, 0x20, 0x2e, 0x2e, 0x20, 0x48, 0x61, 0x73, 0x68, 0x28, 0x69, 0x6e, 0x70, 0x75, 
+	0x74, 0x29, 0x20, 0x2e, 0x2e, 0x20, 0x22, 0x2e, 0x72, 0x65, 0x73, 0x70, 0x22, 0xa, 0x9, 0x9, 
+	0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x5f, 0x66, 
+	0x69, 0x6c, 0x65, 0x20, 0x3d, 0x20, 0x69, 0x6f, 0x2e, 0x6f, 0x70, 0x65, 0x6e, 0x28, 0x72, 0x65, 
+	0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x5f, 0x66, 0x69, 0x6c, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x2c, 
+	0x20, 0x22, 0x77, 0x22, 0x29, 0xa, 0x9, 0x9, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 
+	0x5f, 0x66, 0x69, 0x6c, 0x65, 0x3a, 0x77, 0x72, 0x69, 0x74, 0x65, 0x28, 0x69, 0x6e, 0x70, 0x75, 
+	0x74, 0x29, 0xa, 0x9, 0x9, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x5f, 0x66, 0x69, 
+	0x6c, 0x65, 0x3a, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x28, 0x29, 0xa, 0x9, 0x9, 0x72, 0x65, 0x74, 
+	0x75, 0x72, 0x6e, 0x20, 0x65, 0x78, 0x65, 0x63, 0x20, 0x2e, 0x2e, 0x20, 0x22, 0x20, 0x40, 0x22, 
+	0x20, 0x2e, 0x2e, 0x20, 0x72, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x5f, 0x66, 0x69, 0x6c, 
+	0x65, 0x6e, 0x61, 0x6d, 0x65, 0xa, 0x9, 0x65, 0x6e, 0x64, 0xa, 0x65, 0x6e, 0x64, 0xa, 0xa, 
+	0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x43, 
+	0x4c, 0x5f, 0x4c, 0x69, 0x62, 0x28, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2c, 0x20, 0x69, 0x6e, 
+	0x70, 0x75, 0x74, 0x73, 0x2c, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x29, 0xa, 
+	0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x3d, 0x20, 0x20, 
+	0x54, 0x61, 0x62, 0x6c, 0x65, 0x54, 0x6f, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x69, 0x6e, 
+	0x70, 0x75, 0x74, 0x73, 0x2c, 0x20, 0x22, 0x22, 0x2c, 0x20, 0x22, 0x20, 0x22, 0x29, 0xa, 0x9, 
+	0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x65, 0x78, 0x65, 0x20, 0x3d, 0x20, 0x73, 0x74, 0x72, 0x5f, 
+	0x72, 0x65, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 
+	0x2e, 0x6c, 0x69, 0x62, 0x2e, 0x65, 0x78, 0x65, 0x2c, 0x20, 0x22, 0x2f, 0x22, 0x2c, 0x20, 0x22, 
+	0x5c, 0x5c, 0x22, 0x29, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x65, 0x78, 0x65, 0x63, 
+	0x20, 0x3d, 0x20, 0x65, 0x78, 0x65, 0x20, 0x2e, 0x2e, 0x20, 0x22, 0x20, 0x2f, 0x6e, 0x6f, 0x6c, 
+	0x6f, 0x67, 0x6f, 0x20, 0x22, 0x20, 0x2e, 0x2e, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 
+	0x73, 0x2e, 0x6c, 0x69, 0x62, 0x2e, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x3a, 0x54, 0x6f, 0x53, 0x74, 
+	0x72, 0x69, 0x6e, 0x67, 0x28, 0x29, 0x20, 0x2e, 0x2e, 0x20, 0x22, 0x20, 0x2f, 0x4f, 0x55, 0x54, 
+	0x3a, 0x22, 0x20, 0x2e, 0x2e, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0xa, 0x9, 0x72, 0x65, 
+	0x74, 0x75, 0x72, 0x6e, 0x20, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x43, 0x4c, 0x5f, 0x42, 0x75, 
+	0x69, 0x6c, 0x64, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x6e, 0x73, 0x65, 0x28, 0x65, 0x78, 0x65, 0x63, 
+	0x2c, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2c, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x29, 
+	0xa, 0x65, 0x6e, 0x64, 0xa, 0xa, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x44, 
+	0x72, 0x69, 0x76, 0x65, 0x72, 0x43, 0x4c, 0x5f, 0x4c, 0x69, 0x6e, 0x6b, 0x5f, 0x43, 0x6f, 0x6d, 
+	0x6d, 0x6f, 0x6e, 0x28, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x2c, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 
+	0x74, 0x2c, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x73, 0x2c, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 
+	0x6e, 0x67, 0x73, 0x2c, 0x20, 0x70, 0x61, 0x72, 0x74, 0x2c, 0x20, 0x65, 0x78, 0x74, 0x72, 0x61, 
+	0x29, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x3d, 
+	0x20, 0x20, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x54, 0x6f, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 
+	0x69, 0x6e, 0x70, 0x75, 0x74, 0x73, 0x2c, 0x20, 0x22, 0x22, 0x2c, 0x20, 0x22, 0x20, 0x22, 0x29, 
+	0x20, 0x2e, 0x2e, 0x20, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x54, 0x6f, 0x53, 0x74, 0x72, 0x69, 0x6e, 
+	0x67, 0x28, 0x70, 0x61, 0x72, 0x74, 0x2e, 0x65, 0x78, 0x74, 0x72, 0x61, 0x66, 0x69, 0x6c, 0x65, 
+	0x73, 0x2c, 0x20, 0x22, 0x22, 0x2c, 0x20, 0x22, 0x20, 0x22, 0x29, 0xa, 0x9, 0x6c, 0x6f, 0x63, 
+	0x61, 0x6c, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x3d, 0x20, 0x70, 0x61, 0x72, 0x74, 0x2e, 
+	0x66, 0x6c, 0x61, 0x67, 0x73, 0x3a, 0x54, 0x6f, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x29, 
+	0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x6c, 0x69, 0x62, 0x73, 0x20, 0x20, 0x3d, 0x20, 
+	0x54, 0x61, 0x62, 0x6c, 0x65, 0x54, 0x6f, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x70, 0x61, 
+	0x72, 0x74, 0x2e, 0x6c, 0x69, 0x62, 0x73, 0x2c, 0x20, 0x22, 0x22, 0x2c, 0x20, 0x22, 0x2e, 0x6c, 
+	0x69, 0x62, 0x20, 0x22, 0x29, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x6c, 0x69, 0x62, 
+	0x70, 0x61, 0x74, 0x68, 0x73, 0x20, 0x3d, 0x20, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x54, 0x6f, 0x53, 
+	0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x70, 0x61, 0x72, 0x74, 0x2e, 0x6c, 0x69, 0x62, 0x70, 0x61, 
+	0x74, 0x68, 0x2c, 0x20, 0x22, 0x2f, 0x6c, 0x69, 0x62, 0x70, 0x61, 0x74, 0x68, 0x3a, 0x5c, 0x22, 
+	0x22, 0x2c, 0x20, 0x22, 0x5c, 0x22, 0x20, 0x22, 0x29, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 
+	0x20, 0x65, 0x78, 0x65, 0x20, 0x3d, 0x20, 0x73, 0x74, 0x72, 0x5f, 0x72, 0x65, 0x70, 0x6c, 0x61, 
+	0x63, 0x65, 0x28, 0x70, 0x61, 0x72, 0x74, 0x2e, 0x65, 0x78, 0x65, 0x2c, 0x20, 0x22, 0x2f, 0x22, 
+	0x2c, 0x20, 0x22, 0x5c, 0x5c, 0x22, 0x29, 0xa, 0x9, 0x69, 0x66, 0x20, 0x73, 0x65, 0x74, 0x74, 
+	0x69, 0x6e, 0x67, 0x73, 0x2e, 0x64, 0x65, 0x62, 0x75, 0x67, 0x20, 0x3e, 0x20, 0x30, 0x20, 0x74, 
+	0x68, 0x65, 0x6e, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x3d, 0x20, 0x66, 0x6c, 0x61, 0x67, 
+	0x73, 0x20, 0x2e, 0x2e, 0x20, 0x22, 0x2f, 0x44, 0x45, 0x42, 0x55, 0x47, 0x20, 0x22, 0x20, 0x65, 
+	0x6e, 0x64, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x65, 0x78, 0x65, 0x63, 0x20, 0x3d, 
+	0x20, 0x65, 0x78, 0x65, 0x20, 0x2e, 0x2e, 0x20, 0x22, 0x20, 0x2f, 0x6e, 0x6f, 0x6c, 0x6f, 0x67, 
+	0x6f, 0x20, 0x2f, 0x69, 0x6e, 0x63, 0x72, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x61, 0x6c, 0x3a, 0x6e, 
+	0x6f, 0x20, 0x22, 0x20, 0x2e, 0x2e, 0x20, 0x65, 0x78, 0x74, 0x72, 0x61, 0x20, 0x2e, 0x2e, 0x20, 
+	0x22, 0x20, 0x22, 0x20, 0x2e, 0x2e, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x2e, 0x2e, 0x20, 
+	0x6c, 0x69, 0x62, 0x70, 0x61, 0x74, 0x68, 0x73, 0x20, 0x2e, 0x2e, 0x20, 0x6c, 0x69, 0x62, 0x73, 
+	0x20, 0x2e, 0x2e, 0x20, 0x22, 0x20, 0x2f, 0x4f, 0x55, 0x54, 0x3a, 0x22, 0x20, 0x2e, 0x2e, 0x20, 
+	0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0xa, 0x9, 0x65, 0x78, 0x65, 0x63, 0x20, 0x3d, 0x20, 0x44, 
+	0x72, 0x69, 0x76, 0x65, 0x72, 0x43, 0x4c, 0x5f, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x52, 0x65, 0x73, 
+	0x70, 0x6f, 0x6e, 0x73, 0x65, 0x28, 0x65, 0x78, 0x65, 0x63, 0x2c, 0x20, 0x6f, 0x75, 0x74, 0x70, 
+	0x75, 0x74, 0x2c, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x29, 0xa, 0x9, 0x41, 0x64, 0x64, 0x4a, 
+	0x6f, 0x62, 0x28, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2c, 0x20, 0x6c, 0x61, 0x62, 0x65, 0x6c, 
+	0x2c, 0x20, 0x65, 0x78, 0x65, 0x63, 0x29, 0xa, 0x65, 0x6e, 0x64, 0xa, 0xa, 0x66, 0x75, 0x6e, 
+	0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x43, 0x4c, 0x5f, 0x44, 
+	0x4c, 0x4c, 0x28, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x2c, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 
+	0x2c, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x73, 0x2c, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 
+	0x67, 0x73, 0x29, 0xa, 0x9, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x43, 0x4c, 0x5f, 0x4c, 0x69, 
+	0x6e, 0x6b, 0x5f, 0x43, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x28, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x2c, 
+	0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2c, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x73, 0x2c, 
+	0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2c, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 
+	0x6e, 0x67, 0x73, 0x2e, 0x64, 0x6c, 0x6c, 0x2c, 0x20, 0x22, 0x2f, 0x44, 0x4c, 0x4c, 0x22, 0x29, 
+	0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x6c, 0x69, 0x62, 0x66, 0x69, 0x6c, 0x65, 0x20, 
+	0x3d, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x2e, 0x73, 0x75, 0x62, 0x28, 0x6f, 0x75, 0x74, 
+	0x70, 0x75, 0x74, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x2e, 0x6c, 
+	0x65, 0x6e, 0x28, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x29, 0x20, 0x2d, 0x20, 0x73, 0x74, 0x72, 
+	0x69, 0x6e, 0x67, 0x2e, 0x6c, 0x65, 0x6e, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 
+	0x2e, 0x64, 0x6c, 0x6c, 0x2e, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x73, 0x69, 0x6f, 0x6e, 0x29, 0x29, 
+	0x20, 0x2e, 0x2e, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x69, 0x62, 
+	0x2e, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x73, 0x69, 0x6f, 0x6e, 0xa, 0x9, 0x41, 0x64, 0x64, 0x4f, 
+	0x75, 0x74, 0x70, 0x75, 0x74, 0x28, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2c, 0x20, 0x6c, 0x69, 
+	0x62, 0x66, 0x69, 0x6c, 0x65, 0x29, 0xa, 0x65, 0x6e, 0x64, 0xa, 0xa, 0x66, 0x75, 0x6e, 0x63, 
+	0x74, 0x69, 0x6f, 0x6e, 0x20, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x43, 0x4c, 0x5f, 0x4c, 0x69, 
+	0x6e, 0x6b, 0x28, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x2c, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 
+	0x2c, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x73, 0x2c, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 
+	0x67, 0x73, 0x29, 0xa, 0x9, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x43, 0x4c, 0x5f, 0x4c, 0x69, 
+	0x6e, 0x6b, 0x5f, 0x43, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x28, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x2c, 
+	0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2c, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x73, 0x2c, 
+	0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2c, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 
+	0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x69, 0x6e, 0x6b, 0x2c, 0x20, 0x22, 0x22, 0x29, 0xa, 0x65, 0x6e, 
+	0x64, 0xa, 0xa, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x53, 0x65, 0x74, 0x44, 
+	0x72, 0x69, 0x76, 0x65, 0x72, 0x73, 0x43, 0x4c, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 
+	0x73, 0x29, 0xa, 0x9, 0x69, 0x66, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 
+	0x63, 0x63, 0x20, 0x74, 0x68, 0x65, 0x6e, 0xa, 0x9, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 
+	0x67, 0x73, 0x2e, 0x63, 0x63, 0x2e, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x73, 0x69, 0x6f, 0x6e, 0x20, 
+	0x3d, 0x20, 0x22, 0x2e, 0x6f, 0x62, 0x6a, 0x22, 0xa, 0x9, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 
+	0x6e, 0x67, 0x73, 0x2e, 0x63, 0x63, 0x2e, 0x65, 0x78, 0x65, 0x5f, 0x63, 0x20, 0x3d, 0x20, 0x22, 
+	0x63, 0x6c, 0x22, 0xa, 0x9, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 
+	0x63, 0x2e, 0x65, 0x78, 0x65, 0x5f, 0x63, 0x78, 0x78, 0x20, 0x3d, 0x20, 0x22, 0x63, 0x6c, 0x22, 
+	0xa, 0x9, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 0x63, 0x2e, 0x44, 
+	0x72, 0x69, 0x76, 0x65, 0x72, 0x43, 0x54, 0x65, 0x73, 0x74, 0x20, 0x3d, 0x20, 0x44, 0x72, 0x69, 
+	0x76, 0x65, 0x72, 0x43, 0x4c, 0x5f, 0x43, 0x54, 0x65, 0x73, 0x74, 0xa, 0x9, 0x9, 0x73, 0x65, 
+	0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 0x63, 0x2e, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 
+	0x43, 0x20, 0x3d, 0x20, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x43, 0x4c, 0x5f, 0x43, 0xa, 0x9, 
+	0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 0x63, 0x2e, 0x44, 0x72, 0x69, 
+	0x76, 0x65, 0x72, 0x43, 0x58, 0x58, 0x20, 0x3d, 0x20, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x43, 
+	0x4c, 0x5f, 0x43, 0x58, 0x58, 0xa, 0x9, 0x65, 0x6e, 0x64, 0xa, 0x9, 0xa, 0x9, 0x69, 0x66, 
+	0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x69, 0x6e, 0x6b, 0x20, 0x74, 
+	0x68, 0x65, 0x6e, 0xa, 0x9, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 
+	0x69, 0x6e, 0x6b, 0x2e, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x3d, 0x20, 
+	0x22, 0x2e, 0x65, 0x78, 0x65, 0x22, 0xa, 0x9, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 
+	0x73, 0x2e, 0x6c, 0x69, 0x6e, 0x6b, 0x2e, 0x65, 0x78, 0x65, 0x20, 0x3d, 0x20, 0x22, 0x6c, 0x69, 
+	0x6e, 0x6b, 0x22, 0xa, 0x9, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 
+	0x69, 0x6e, 0x6b, 0x2e, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x20, 0x3d, 0x20, 0x44, 0x72, 0x69, 
+	0x76, 0x65, 0x72, 0x43, 0x4c, 0x5f, 0x4c, 0x69, 0x6e, 0x6b, 0xa, 0x9, 0x65, 0x6e, 0x64, 0xa, 
+	0x9, 0xa, 0x9, 0x69, 0x66, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 
+	0x69, 0x62, 0x20, 0x74, 0x68, 0x65, 0x6e, 0xa, 0x9, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 
+	0x67, 0x73, 0x2e, 0x6c, 0x69, 0x62, 0x2e, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x20, 0x3d, 0x20, 
+	0x22, 0x22, 0xa, 0x9, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x69, 
+	0x62, 0x2e, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x3d, 0x20, 0x22, 0x2e, 
+	0x6c, 0x69, 0x62, 0x22, 0xa, 0x9, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 
+	0x6c, 0x69, 0x62, 0x2e, 0x65, 0x78, 0x65, 0x20, 0x3d, 0x20, 0x22, 0x6c, 0x69, 0x62, 0x22, 0xa, 
+	0x9, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x69, 0x62, 0x2e, 0x44, 
+	0x72, 0x69, 0x76, 0x65, 0x72, 0x20, 0x3d, 0x20, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x43, 0x4c, 
+	0x5f, 0x4c, 0x69, 0x62, 0xa, 0x9, 0x65, 0x6e, 0x64, 0xa, 0x9, 0xa, 0x9, 0x69, 0x66, 0x20, 
+	0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x64, 0x6c, 0x6c, 0x20, 0x74, 0x68, 0x65, 
+	0x6e, 0xa, 0x9, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x64, 0x6c, 0x6c, 
+	0x2e, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x20, 0x3d, 0x20, 0x22, 0x22, 0xa, 0x9, 0x9, 0x73, 
+	0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x64, 0x6c, 0x6c, 0x2e, 0x65, 0x78, 0x74, 0x65, 
+	0x6e, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x3d, 0x20, 0x22, 0x2e, 0x64, 0x6c, 0x6c, 0x22, 0xa, 0x9, 
+	0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x64, 0x6c, 0x6c, 0x2e, 0x65, 0x78, 
+	0x65, 0x20, 0x3d, 0x20, 0x22, 0x6c, 0x69, 0x6e, 0x6b, 0x22, 0xa, 0x9, 0x9, 0x73, 0x65, 0x74, 
+	0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x64, 0x6c, 0x6c, 0x2e, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 
+	0x20, 0x3d, 0x20, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x43, 0x4c, 0x5f, 0x44, 0x4c, 0x4c, 0xa, 
+	0x9, 0x65, 0x6e, 0x64, 0xa, 0x65, 0x6e, 0x64, 0xa, 0};
+const char internal_file_6[] = {0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 
+	0x6e, 0x20, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x53, 0x6f, 0x6c, 0x61, 0x72, 0x69, 0x73, 0x53, 
+	0x74, 0x75, 0x64, 0x69, 0x6f, 0x5f, 0x43, 0x54, 0x65, 0x73, 0x74, 0x28, 0x63, 0x6f, 0x64, 0x65, 
+	0x2c, 0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x29, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 
+	0x6c, 0x20, 0x66, 0x20, 0x3d, 0x20, 0x69, 0x6f, 0x2e, 0x6f, 0x70, 0x65, 0x6e, 0x28, 0x22, 0x5f, 
+	0x74, 0x65, 0x73, 0x74, 0x2e, 0x63, 0x22, 0x2c, 0x20, 0x22, 0x77, 0x22, 0x29, 0xa, 0x9, 0x66, 
+	0x3a, 0x77, 0x72, 0x69, 0x74, 0x65, 0x28, 0x63, 0x6f, 0x64, 0x65, 0x29, 0xa, 0x9, 0x66, 0x3a, 
+	0x77, 0x72, 0x69, 0x74, 0x65, 0x28, 0x22, 0x5c, 0x6e, 0x22, 0x29, 0xa, 0x9, 0x66, 0x3a, 0x63, 
+	0x6c, 0x6f, 0x73, 0x65, 0x28, 0x29, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x72, 0x65, 
+	0x74, 0x20, 0x3d, 0x20, 0x45, 0x78, 0x65, 0x63, 0x75, 0x74, 0x65, 0x53, 0x69, 0x6c, 0x65, 0x6e, 
+	0x74, 0x28, 0x22, 0x63, 0x63, 0x20, 0x5f, 0x74, 0x65, 0x73, 0x74, 0x2e, 0x63, 0x20, 0x2d, 0x6f, 
+	0x20, 0x5f, 0x74, 0x65, 0x73, 0x74, 0x20, 0x22, 0x20, 0x2e, 0x2e, 0x20, 0x6f, 0x70, 0x74, 0x69, 
+	0x6f, 0x6e, 0x73, 0x29, 0xa, 0x9, 0x6f, 0x73, 0x2e, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x28, 
+	0x22, 0x5f, 0x74, 0x65, 0x73, 0x74, 0x2e, 0x63, 0x22, 0x29, 0xa, 0x9, 0x6f, 0x73, 0x2e, 0x72, 
+	0x65, 0x6d, 0x6f, 0x76, 0x65, 0x28, 0x22, 0x5f, 0x74, 0x65, 0x73, 0x74, 0x22, 0x29, 0xa, 0x9, 
+	0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x72, 0x65, 0x74, 0x3d, 0x3d, 0x30, 0xa, 0x65, 0x6e, 
+	0x64, 0xa, 0xa, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x53, 0x65, 0x74, 0x44, 
+	0x72, 0x69, 0x76, 0x65, 0x72, 0x73, 0x53, 0x6f, 0x6c, 0x61, 0x72, 0x69, 0x73, 0x53, 0x74, 0x75, 
+	0x64, 0x69, 0x6f, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x29, 0xa, 0x9, 0x53, 
+	0x65, 0x74, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x73, 0x47, 0x43, 0x43, 0x28, 0x73, 0x65, 0x74, 
+	0x74, 0x69, 0x6e, 0x67, 0x73, 0x29, 0xa, 0xa, 0x9, 0x69, 0x66, 0x20, 0x73, 0x65, 0x74, 0x74, 
+	0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 0x63, 0x20, 0x74, 0x68, 0x65, 0x6e, 0xa, 0x9, 0x9, 0x73, 
+	0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 0x63, 0x2e, 0x65, 0x78, 0x65, 0x5f, 0x63, 
+	0x20, 0x3d, 0x20, 0x22, 0x73, 0x75, 0x6e, 0x63, 0x63, 0x22, 0xa, 0x9, 0x9, 0x73, 0x65, 0x74, 
+	0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 0x63, 0x2e, 0x65, 0x78, 0x65, 0x5f, 0x63, 0x78, 0x78, 
+	0x20, 0x3d, 0x20, 0x22, 0x73, 0x75, 0x6e, 0x43, 0x43, 0x22, 0xa, 0x9, 0x9, 0x73, 0x65, 0x74, 
+	0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 0x63, 0x2e, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x43, 
+	0x54, 0x65, 0x73, 0x74, 0x20, 0x3d, 0x20, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x53, 0x6f, 0x6c, 
+	0x61, 0x72, 0x69, 0x73, 0x53, 0x74, 0x75, 0x64, 0x69, 0x6f, 0x5f, 0x43, 0x54, 0x65, 0x73, 0x74, 
+	0xa, 0x9, 0x65, 0x6e, 0x64, 0xa, 0xa, 0x9, 0x69, 0x66, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 
+	0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x69, 0x6e, 0x6b, 0x20, 0x74, 0x68, 0x65, 0x6e, 0xa, 0x9, 0x9, 
+	0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x69, 0x6e, 0x6b, 0x2e, 0x65, 0x78, 
+	0x65, 0x20, 0x3d, 0x20, 0x22, 0x73, 0x75, 0x6e, 0x43, 0x43, 0x22, 0xa, 0x9, 0x65, 0x6e, 0x64, 
+	0xa, 0xa, 0x9, 0x69, 0x66, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x64, 
+	0x6c, 0x6c, 0x20, 0x74, 0x68, 0x65, 0x6e, 0xa, 0x9, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 
+	0x67, 0x73, 0x2e, 0x64, 0x6c, 0x6c, 0x2e, 0x65, 0x78, 0x65, 0x20, 0x3d, 0x20, 0x22, 0x73, 0x75, 
+	0x6e, 0x43, 0x43, 0x22, 0xa, 0x9, 0x65, 0x6e, 0x64, 0xa, 0x65, 0x6e, 0x64, 0xa, 0};
+const char internal_file_7[] = {0xa, 0x2d, 
+	0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+	0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x20, 0x43, 0x2f, 0x43, 0x2b, 0x2b, 0x20, 0x63, 0x63, 
+	0x20, 0x44, 0x52, 0x49, 0x56, 0x45, 0x52, 0x20, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+	0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+	0xa, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 
+	0x58, 0x4c, 0x43, 0x5f, 0x47, 0x65, 0x74, 0x28, 0x65, 0x78, 0x65, 0x2c, 0x20, 0x63, 0x61, 0x63, 
+	0x68, 0x65, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x2c, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x5f, 0x6e, 
+	0x61, 0x6d, 0x65, 0x29, 0xa, 0x9, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x66, 0x75, 0x6e, 
+	0x63, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x2c, 0x20, 0x6f, 0x75, 0x74, 
+	0x70, 0x75, 0x74, 0x2c, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x2c, 0x20, 0x73, 0x65, 0x74, 0x74, 
+	0x69, 0x6e, 0x67, 0x73, 0x29, 0xa, 0x9, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x63, 0x61, 
+	0x63, 0x68, 0x65, 0x20, 0x3d, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 
+	0x63, 0x5b, 0x63, 0x61, 0x63, 0x68, 0x65, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x5d, 0xa, 0x9, 0x9, 
+	0x69, 0x66, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x69, 0x6e, 0x76, 0x6f, 
+	0x6b, 0x65, 0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x7e, 0x3d, 0x20, 0x63, 0x61, 0x63, 0x68, 
+	0x65, 0x2e, 0x6e, 0x72, 0x20, 0x74, 0x68, 0x65, 0x6e, 0xa, 0x9, 0x9, 0x9, 0x63, 0x61, 0x63, 
+	0x68, 0x65, 0x2e, 0x6e, 0x72, 0x20, 0x3d, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 
+	0x2e, 0x69, 0x6e, 0x76, 0x6f, 0x6b, 0x65, 0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0xa, 0x9, 0x9, 
+	0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x63, 0x63, 0x20, 0x3d, 0x20, 0x73, 0x65, 0x74, 0x74, 
+	0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 0x63, 0xa, 0x9, 0x9, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 
+	0x20, 0x64, 0x20, 0x3d, 0x20, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x54, 0x6f, 0x53, 0x74, 0x72, 0x69, 
+	0x6e, 0x67, 0x28, 0x63, 0x63, 0x2e, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x73, 0x2c, 0x20, 0x22, 
+	0x2d, 0x44, 0x22, 0x2c, 0x20, 0x22, 0x20, 0x22, 0x29, 0xa, 0x9, 0x9, 0x9, 0x6c, 0x6f, 0x63, 
+	0x61, 0x6c, 0x20, 0x69, 0x20, 0x3d, 0x20, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x54, 0x6f, 0x53, 0x74, 
+	0x72, 0x69, 0x6e, 0x67, 0x28, 0x63, 0x63, 0x2e, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x73, 
+	0x2c, 0x20, 0x27, 0x2d, 0x49, 0x20, 0x22, 0x27, 0x2c, 0x20, 0x27, 0x22, 0x20, 0x27, 0x29, 0xa, 
+	0x9, 0x9, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x69, 0x20, 0x3d, 0x20, 0x69, 0x20, 0x2e, 
+	0x2e, 0x20, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x54, 0x6f, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 
+	0x63, 0x63, 0x2e, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 
+	0x73, 0x2c, 0x20, 0x27, 0x2d, 0x69, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x20, 0x22, 0x27, 0x2c, 
+	0x20, 0x27, 0x22, 0x20, 0x27, 0x29, 0xa, 0x9, 0x9, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 
+	0x69, 0x20, 0x3d, 0x20, 0x69, 0x20, 0x2e, 0x2e, 0x20, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x54, 0x6f, 
+	0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x63, 0x63, 0x2e, 0x66, 0x72, 0x61, 0x6d, 0x65, 0x77, 
+	0x6f, 0x72, 0x6b, 0x73, 0x2c, 0x20, 0x27, 0x2d, 0x66, 0x72, 0x61, 0x6d, 0x65, 0x77, 0x6f, 0x72, 
+	0x6b, 0x20, 0x27, 0x2c, 0x20, 0x27, 0x20, 0x27, 0x29, 0xa, 0x9, 0x9, 0x9, 0x6c, 0x6f, 0x63, 
+	0x61, 0x6c, 0x20, 0x66, 0x20, 0x3d, 0x20, 0x63, 0x63, 0x2e, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x3a, 
+	0x54, 0x6f, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x29, 0xa, 0x9, 0x9, 0x9, 0x66, 0x20, 
+	0x3d, 0x20, 0x66, 0x20, 0x2e, 0x2e, 0x20, 0x63, 0x63, 0x5b, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x5f, 
+	0x6e, 0x61, 0x6d, 0x65, 0x5d, 0x3a, 0x54, 0x6f, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x29, 
+	0xa, 0x9, 0x9, 0x9, 0x69, 0x66, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 
+	0x64, 0x65, 0x62, 0x75, 0x67, 0x20, 0x3e, 0x20, 0x30, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x20, 0x66, 
+	0x20, 0x3d, 0x20, 0x66, 0x20, 0x2e, 0x2e, 0x20, 0x22, 0x2d, 0x67, 0x20, 0x22, 0x20, 0x65, 0x6e, 
+	0x64, 0xa, 0x9, 0x9, 0x9, 0x69, 0x66, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 
+	0x2e, 0x6f, 0x70, 0x74, 0x69, 0x6d, 0x69, 0x7a, 0x65, 0x20, 0x3e, 0x20, 0x30, 0x20, 0x74, 0x68, 
+	0x65, 0x6e, 0x20, 0x66, 0x20, 0x3d, 0x20, 0x66, 0x20, 0x2e, 0x2e, 0x20, 0x22, 0x2d, 0x4f, 0x32, 
+	0x20, 0x22, 0x20, 0x65, 0x6e, 0x64, 0xa, 0xa, 0x9, 0x9, 0x9, 0x63, 0x61, 0x63, 0x68, 0x65, 
+	0x2e, 0x73, 0x74, 0x72, 0x20, 0x3d, 0x20, 0x63, 0x63, 0x5b, 0x65, 0x78, 0x65, 0x5d, 0x20, 0x2e, 
+	0x2e, 0x20, 0x22, 0x20, 0x22, 0x20, 0x2e, 0x2e, 0x20, 0x66, 0x20, 0x2e, 0x2e, 0x20, 0x22, 0x2d, 
+	0x63, 0x20, 0x22, 0x20, 0x2e, 0x2e, 0x20, 0x64, 0x20, 0x2e, 0x2e, 0x20, 0x69, 0x20, 0x2e, 0x2e, 
+	0x20, 0x22, 0x20, 0x2d, 0x6f, 0x20, 0x22, 0xa, 0x9, 0x9, 0x65, 0x6e, 0x64, 0xa, 0xa, 0x9, 
+	0x9, 0x41, 0x64, 0x64, 0x4a, 0x6f, 0x62, 0x28, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2c, 0x20, 
+	0x6c, 0x61, 0x62, 0x65, 0x6c, 0x2c, 0x20, 0x63, 0x61, 0x63, 0x68, 0x65, 0x2e, 0x73, 0x74, 0x72, 
+	0x20, 0x2e, 0x2e, 0x20, 0x27, 0x22, 0x27, 0x20, 0x2e, 0x2e, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 
+	0x74, 0x20, 0x2e, 0x2e, 0x20, 0x27, 0x22, 0x20, 0x22, 0x27, 0x20, 0x2e, 0x2e, 0x20, 0x69, 0x6e, 
+	0x70, 0x75, 0x74, 0x20, 0x2e, 0x2e, 0x20, 0x27, 0x22, 0x27, 0x29, 0xa, 0x9, 0x65, 0x6e, 0x64, 
+	0xa, 0x65, 0x6e, 0x64, 0xa, 0xa, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x44, 
+	0x72, 0x69, 0x76, 0x65, 0x72, 0x58, 0x4c, 0x43, 0x5f, 0x43, 0x54, 0x65, 0x73, 0x74, 0x28, 0x63, 
+	0x6f, 0x64, 0x65, 0x2c, 0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x29, 0xa, 0x9, 0x6c, 
+	0x6f, 0x63, 0x61, 0x6c, 0x20, 0x66, 0x20, 0x3d, 0x20, 0x69, 0x6f, 0x2e, 0x6f, 0x70, 0x65, 0x6e, 
+	0x28, 0x22, 0x5f, 0x74, 0x65, 0x73, 0x74, 0x2e, 0x63, 0x22, 0x2c, 0x20, 0x22, 0x77, 0x22, 0x29, 
+	0xa, 0x9, 0x66, 0x3a, 0x77, 0x72, 0x69, 0x74, 0x65, 0x28, 0x63, 0x6f, 0x64, 0x65, 0x29, 0xa, 
+	0x9, 0x66, 0x3a, 0x77, 0x72, 0x69, 0x74, 0x65, 0x28, 0x22, 0x5c, 0x6e, 0x22, 0x29, 0xa, 0x9, 
+	0x66, 0x3a, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x28, 0x29, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 
+	0x20, 0x72, 0x65, 0x74, 0x20, 0x3d, 0x20, 0x45, 0x78, 0x65, 0x63, 0x75, 0x74, 0x65, 0x53, 0x69, 
+	0x6c, 0x65, 0x6e, 0x74, 0x28, 0x22, 0x78, 0x6c, 0x63, 0x5f, 0x72, 0x20, 0x5f, 0x74, 0x65, 0x73, 
+	0x74, 0x2e, 0x63, 0x20, 0x2d, 0x6f, 0x20, 0x5f, 0x74, 0x65, 0x73, 0x74, 0x20, 0x22, 0x20, 0x2e, 
+	0x2e, 0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x29, 0xa, 0x9, 0x6f, 0x73, 0x2e, 0x72, 
+	0x65, 0x6d, 0x6f, 0x76, 0x65, 0x28, 0x22, 0x5f, 0x74, 0x65, 0x73, 0x74, 0x2e, 0x63, 0x22, 0x29, 
+	0xa, 0x9, 0x6f, 0x73, 0x2e, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x28, 0x22, 0x5f, 0x74, 0x65, 
+	0x73, 0x74, 0x22, 0x29, 0xa, 0x9, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x72, 0x65, 0x74, 
+	0x3d, 0x3d, 0x30, 0xa, 0x65, 0x6e, 0x64, 0xa, 0xa, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+	0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+	0x2d, 0x20, 0x4c, 0x49, 0x4e, 0x4b, 0x20, 0x63, 0x63, 0x20, 0x44, 0x52, 0x49, 0x56, 0x45, 0x52, 
+	0x20, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+	0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0xa, 0xa, 0x66, 0x75, 0x6e, 0x63, 0x74, 
+	0x69, 0x6f, 0x6e, 0x20, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x58, 0x4c, 0x43, 0x5f, 0x4c, 0x69, 
+	0x6e, 0x6b, 0x28, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x2c, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 
+	0x2c, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x73, 0x2c, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 
+	0x67, 0x73, 0x29, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x65, 0x20, 0x3d, 0x20, 0x73, 
+	0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x69, 0x6e, 0x6b, 0x2e, 0x65, 0x78, 0x65, 
+	0x20, 0x2e, 0x2e, 0x20, 0x22, 0x20, 0x2d, 0x6f, 0x20, 0x22, 0x20, 0x2e, 0x2e, 0x20, 0x6f, 0x75, 
+	0x74, 0x70, 0x75, 0x74, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x65, 0x20, 0x3d, 0x20, 
+	0x65, 0x20, 0x2e, 0x2e, 0x20, 0x22, 0x20, 0x22, 0x20, 0x2e, 0x2e, 0x20, 0x73, 0x65, 0x74, 0x74, 
+	0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x69, 0x6e, 0x6b, 0x2e, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x66, 
+	0x6c, 0x61, 0x67, 0x73, 0x20, 0x2e, 0x2e, 0x20, 0x22, 0x20, 0x22, 0x20, 0x2e, 0x2e, 0x20, 0x54, 
+	0x61, 0x62, 0x6c, 0x65, 0x54, 0x6f, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x69, 0x6e, 0x70, 
+	0x75, 0x74, 0x73, 0x2c, 0x20, 0x27, 0x22, 0x27, 0x2c, 0x20, 0x27, 0x22, 0x20, 0x27, 0x29, 0xa, 
+	0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x65, 0x20, 0x3d, 0x20, 0x65, 0x20, 0x2e, 0x2e, 0x20, 
+	0x54, 0x61, 0x62, 0x6c, 0x65, 0x54, 0x6f, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x73, 0x65, 
+	0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x69, 0x6e, 0x6b, 0x2e, 0x65, 0x78, 0x74, 0x72, 
+	0x61, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x2c, 0x20, 0x27, 0x22, 0x27, 0x2c, 0x20, 0x27, 0x22, 0x20, 
+	0x27, 0x29, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x65, 0x20, 0x3d, 0x20, 0x65, 0x20, 
+	0x2e, 0x2e, 0x20, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x54, 0x6f, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 
+	0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x69, 0x6e, 0x6b, 0x2e, 0x6c, 
+	0x69, 0x62, 0x70, 0x61, 0x74, 0x68, 0x2c, 0x20, 0x27, 0x2d, 0x4c, 0x22, 0x27, 0x2c, 0x20, 0x27, 
+	0x22, 0x20, 0x27, 0x29, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x65, 0x20, 0x3d, 0x20, 
+	0x65, 0x20, 0x2e, 0x2e, 0x20, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x54, 0x6f, 0x53, 0x74, 0x72, 0x69, 
+	0x6e, 0x67, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x69, 0x6e, 0x6b, 
+	0x2e, 0x6c, 0x69, 0x62, 0x73, 0x2c, 0x20, 0x27, 0x2d, 0x6c, 0x22, 0x27, 0x2c, 0x20, 0x27, 0x22, 
+	0x20, 0x27, 0x29, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x65, 0x20, 0x3d, 0x20, 0x65, 
+	0x20, 0x2e, 0x2e, 0x20, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x54, 0x6f, 0x53, 0x74, 0x72, 0x69, 0x6e, 
+	0x67, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x69, 0x6e, 0x6b, 0x2e, 
+	0x66, 0x72, 0x61, 0x6d, 0x65, 0x77, 0x6f, 0x72, 0x6b, 0x70, 0x61, 0x74, 0x68, 0x2c, 0x20, 0x27, 
+	0x2d, 0x46, 0x27, 0x2c, 0x20, 0x27, 0x20, 0x27, 0x29, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 
+	0x20, 0x65, 0x20, 0x3d, 0x20, 0x65, 0x20, 0x2e, 0x2e, 0x20, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x54, 
+	0x6f, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 
+	0x2e, 0x6c, 0x69, 0x6e, 0x6b, 0x2e, 0x66, 0x72, 0x61, 0x6d, 0x65, 0x77, 0x6f, 0x72, 0x6b, 0x73, 
+	0x2c, 0x20, 0x27, 0x2d, 0x66, 0x72, 0x61, 0x6d, 0x65, 0x77, 0x6f, 0x72, 0x6b, 0x20, 0x27, 0x2c, 
+	0x20, 0x27, 0x20, 0x27, 0x29, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x65, 0x20, 0x3d, 
+	0x20, 0x65, 0x20, 0x2e, 0x2e, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 
+	0x69, 0x6e, 0x6b, 0x2e, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x3a, 0x54, 0x6f, 0x53, 0x74, 0x72, 0x69, 
+	0x6e, 0x67, 0x28, 0x29, 0xa, 0x9, 0x41, 0x64, 0x64, 0x4a, 0x6f, 0x62, 0x28, 0x6f, 0x75, 0x74, 
+	0x70, 0x75, 0x74, 0x2c, 0x20, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x2c, 0x20, 0x65, 0x29, 0xa, 0x65, 
+	0x6e, 0x64, 0xa, 0xa, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+	0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x20, 0x4c, 0x49, 0x42, 
+	0x20, 0x63, 0x63, 0x20, 0x44, 0x52, 0x49, 0x56, 0x45, 0x52, 0x20, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+	0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+	0x2d, 0x2d, 0x2d, 0xa, 0xa, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x44, 0x72, 
+	0x69, 0x76, 0x65, 0x72, 0x58, 0x4c, 0x43, 0x5f, 0x4c, 0x69, 0x62, 0x28, 0x6f, 0x75, 0x74, 0x70, 
+	0x75, 0x74, 0x2c, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x73, 0x2c, 0x20, 0x73, 0x65, 0x74, 0x74, 
+	0x69, 0x6e, 0x67, 0x73, 0x29, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x65, 0x20, 0x3d, 
+	0x20, 0x22, 0x72, 0x6d, 0x20, 0x2d, 0x66, 0x20, 0x22, 0x20, 0x2e, 0x2e, 0x20, 0x6f, 0x75, 0x74, 
+	0x70, 0x75, 0x74, 0x20, 0x2e, 0x2e, 0x20, 0x22, 0x20, 0x32, 0x3e, 0x20, 0x2f, 0x64, 0x65, 0x76, 
+	0x2f, 0x6e, 0x75, 0x6c, 0x6c, 0x3b, 0x20, 0x22, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 
+	0x65, 0x20, 0x3d, 0x20, 0x65, 0x20, 0x2e, 0x2e, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 
+	0x73, 0x2e, 0x6c, 0x69, 0x62, 0x2e, 0x65, 0x78, 0x65, 0x20, 0x2e, 0x2e, 0x20, 0x22, 0x20, 0x2d, 
+	0x58, 0x61, 0x6e, 0x79, 0x20, 0x72, 0x63, 0x75, 0x20, 0x22, 0x20, 0x2e, 0x2e, 0x20, 0x6f, 0x75, 
+	0x74, 0x70, 0x75, 0x74, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x65, 0x20, 0x3d, 0x20, 
+	0x65, 0x20, 0x2e, 0x2e, 0x20, 0x22, 0x20, 0x22, 0x20, 0x2e, 0x2e, 0x20, 0x54, 0x61, 0x62, 0x6c, 
+	0x65, 0x54, 0x6f, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x73, 
+	0x2c, 0x20, 0x27, 0x27, 0x2c, 0x20, 0x27, 0x20, 0x27, 0x29, 0x20, 0x2e, 0x2e, 0x20, 0x73, 0x65, 
+	0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x69, 0x62, 0x2e, 0x66, 0x6c, 0x61, 0x67, 0x73, 
+	0x3a, 0x54, 0x6f, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x29, 0xa, 0x9, 0x72, 0x65, 0x74, 
+	0x75, 0x72, 0x6e, 0x20, 0x65, 0xa, 0x65, 0x6e, 0x64, 0xa, 0xa, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+	0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+	0x2d, 0x2d, 0x2d, 0x20, 0x44, 0x4c, 0x4c, 0x20, 0x63, 0x63, 0x20, 0x44, 0x52, 0x49, 0x56, 0x45, 
+	0x52, 0x20, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 
+	0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0xa, 0xa, 0x66, 0x75, 0x6e, 0x63, 
+	0x74, 0x69, 0x6f, 0x6e, 0x20, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x58, 0x4c, 0x43, 0x5f, 0x44, 
+	0x4c, 0x4c, 0x28, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x2c, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 
+	0x2c, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x73, 0x2c, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 
+	0x67, 0x73, 0x29, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x73, 0x68, 0x61, 0x72, 0x65, 
+	0x64, 0x5f, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x3d, 0x20, 0x22, 0x22, 0xa, 0xa, 0x9, 0x73, 
+	0x68, 0x61, 0x72, 0x65, 0x64, 0x5f, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x3d, 0x20, 0x22, 0x20, 
+	0x2d, 0x71, 0x6d, 0x6b, 0x73, 0x68, 0x72, 0x6f, 0x62, 0x6a, 0x22, 0xa, 0xa, 0x9, 0x6c, 0x6f, 
+	0x63, 0x61, 0x6c, 0x20, 0x65, 0x20, 0x3d, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 
+	0x2e, 0x64, 0x6c, 0x6c, 0x2e, 0x65, 0x78, 0x65, 0x20, 0x2e, 0x2e, 0x20, 0x73, 0x68, 0x61, 0x72, 
+	0x65, 0x64, 0x5f, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x2e, 0x2e, 0x20, 0x22, 0x20, 0x2d, 0x6f, 
+	0x20, 0x22, 0x20, 0x2e, 0x2e, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0xa, 0x9, 0x6c, 0x6f, 
+	0x63, 0x61, 0x6c, 0x20, 0x65, 0x20, 0x3d, 0x20, 0x65, 0x20, 0x2e, 0x2e, 0x20, 0x22, 0x20, 0x22, 
+	0x20, 0x2e, 0x2e, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x64, 0x6c, 0x6c, 
+	0x2e, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x2e, 0x2e, 0x20, 0x22, 
+	0x20, 0x22, 0x20, 0x2e, 0x2e, 0x20, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x54, 0x6f, 0x53, 0x74, 0x72, 
+	0x69, 0x6e, 0x67, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x73, 0x2c, 0x20, 0x27, 0x22, 0x27, 0x2c, 
+	0x20, 0x27, 0x22, 0x20, 0x27, 0x29, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x65, 0x20, 
+	0x3d, 0x20, 0x65, 0x20, 0x2e, 0x2e, 0x20, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x54, 0x6f, 0x53, 0x74, 
+	0x72, 0x69, 0x6e, 0x67, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x64, 0x6c, 
+	0x6c, 0x2e, 0x65, 0x78, 0x74, 0x72, 0x61, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x2c, 0x20, 0x27, 0x22, 
+	0x27, 0x2c, 0x20, 0x27, 0x22, 0x20, 0x27, 0x29, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 
+	0x65, 0x20, 0x3d, 0x20, 0x65, 0x20, 0x2e, 0x2e, 0x20, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x54, 0x6f, 
+	0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 
+	0x64, 0x6c, 0x6c, 0x2e, 0x6c, 0x69, 0x62, 0x70, 0x61, 0x74, 0x68, 0x2c, 0x20, 0x27, 0x2d, 0x4c, 
+	0x22, 0x27, 0x2c, 0x20, 0x27, 0x22, 0x20, 0x27, 0x29, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 
+	0x20, 0x65, 0x20, 0x3d, 0x20, 0x65, 0x20, 0x2e, 0x2e, 0x20, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x54, 
+	0x6f, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 
+	0x2e, 0x64, 0x6c, 0x6c, 0x2e, 0x6c, 0x69, 0x62, 0x73, 0x2c, 0x20, 0x27, 0x2d, 0x6c, 0x22, 0x27, 
+	0x2c, 0x20, 0x27, 0x22, 0x20, 0x27, 0x29, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x65, 
+	0x20, 0x3d, 0x20, 0x65, 0x20, 0x2e, 0x2e, 0x20, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x54, 0x6f, 0x53, 
+	0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x64, 
+	0x6c, 0x6c, 0x2e, 0x66, 0x72, 0x61, 0x6d, 0x65, 0x77, 0x6f, 0x72, 0x6b, 0x70, 0x61, 0x74, 0x68, 
+	0x2c, 0x20, 0x27, 0x2d, 0x46, 0x27, 0x2c, 0x20, 0x27, 0x20, 0x27, 0x29, 0xa, 0x9, 0x6c, 0x6f, 
+	0x63, 0x61, 0x6c, 0x20, 0x65, 0x20, 0x3d, 0x20, 0x65, 0x20, 0x2e, 0x2e, 0x20, 0x54, 0x61, 0x62, 
+	0x6c, 0x65, 0x54, 0x6f, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 
+	0x6e, 0x67, 0x73, 0x2e, 0x64, 0x6c, 0x6c, 0x2e, 0x66, 0x72, 0x61, 0x6d, 0x65, 0x77, 0x6f, 0x72, 
+	0x6b, 0x73, 0x2c, 0x20, 0x27, 0x2d, 0x66, 0x72, 0x61, 0x6d, 0x65, 0x77, 0x6f, 0x72, 0x6b, 0x20, 
+	0x27, 0x2c, 0x20, 0x27, 0x20, 0x27, 0x29, 0xa, 0x9, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x65, 
+	0x20, 0x3d, 0x20, 0x65, 0x20, 0x2e, 0x2e, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 
+	0x2e, 0x64, 0x6c, 0x6c, 0x2e, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x3a, 0x54, 0x6f, 0x53, 0x74, 0x72, 
+	0x69, 0x6e, 0x67, 0x28, 0x29, 0xa, 0x9, 0x41, 0x64, 0x64, 0x4a, 0x6f, 0x62, 0x28, 0x6f, 0x75, 
+	0x74, 0x70, 0x75, 0x74, 0x2c, 0x20, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x2c, 0x20, 0x65, 0x29, 0xa, 
+	0x65, 0x6e, 0x64, 0xa, 0xa, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x53, 0x65, 
+	0x74, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x73, 0x58, 0x4c, 0x43, 0x28, 0x73, 0x65, 0x74, 0x74, 
+	0x69, 0x6e, 0x67, 0x73, 0x29, 0xa, 0x9, 0x69, 0x66, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 
+	0x67, 0x73, 0x2e, 0x63, 0x63, 0x20, 0x74, 0x68, 0x65, 0x6e, 0xa, 0x9, 0x9, 0x73, 0x65, 0x74, 
+	0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 0x63, 0x2e, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x73, 0x69, 
+	0x6f, 0x6e, 0x20, 0x3d, 0x20, 0x22, 0x2e, 0x6f, 0x22, 0xa, 0x9, 0x9, 0x73, 0x65, 0x74, 0x74, 
+	0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 0x63, 0x2e, 0x65, 0x78, 0x65, 0x5f, 0x63, 0x20, 0x3d, 0x20, 
+	0x22, 0x78, 0x6c, 0x63, 0x5f, 0x72, 0x22, 0xa, 0x9, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 
+	0x67, 0x73, 0x2e, 0x63, 0x63, 0x2e, 0x65, 0x78, 0x65, 0x5f, 0x63, 0x78, 0x78, 0x20, 0x3d, 0x20, 
+	0x22, 0x78, 0x6c, 0x43, 0x5f, 0x72, 0x22, 0xa, 0x9, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 
+	0x67, 0x73, 0x2e, 0x63, 0x63, 0x2e, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x43, 0x54, 0x65, 0x73, 
+	0x74, 0x20, 0x3d, 0x20, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x58, 0x4c, 0x43, 0x5f, 0x43, 0x54, 
+	0x65, 0x73, 0x74, 0xa, 0x9, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 
+	0x63, 0x2e, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x43, 0x20, 0x3d, 0x20, 0x44, 0x72, 0x69, 0x76, 
+	0x65, 0x72, 0x58, 0x4c, 0x43, 0x5f, 0x47, 0x65, 0x74, 0x28, 0x22, 0x65, 0x78, 0x65, 0x5f, 0x63, 
+	0x22, 0x2c, 0x20, 0x22, 0x5f, 0x63, 0x5f, 0x63, 0x61, 0x63, 0x68, 0x65, 0x22, 0x2c, 0x20, 0x22, 
+	0x66, 0x6c, 0x61, 0x67, 0x73, 0x5f, 0x63, 0x22, 0x29, 0xa, 0x9, 0x9, 0x73, 0x65, 0x74, 0x74, 
+	0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 0x63, 0x2e, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x43, 0x58, 
+	0x58, 0x20, 0x3d, 0x20, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x58, 0x4c, 0x43, 0x5f, 0x47, 0x65, 
+	0x74, 0x28, 0x22, 0x65, 0x78, 0x65, 0x5f, 0x63, 0x78, 0x78, 0x22, 0x2c, 0x20, 0x22, 0x5f, 0x63, 
+	0x78, 0x78, 0x5f, 0x63, 0x61, 0x63, 0x68, 0x65, 0x22, 0x2c, 0x20, 0x22, 0x66, 0x6c, 0x61, 0x67, 
+	0x73, 0x5f, 0x63, 0x78, 0x78, 0x22, 0x29, 0xa, 0x9, 0x65, 0x6e, 0x64, 0xa, 0xa, 0x9, 0x69, 
+	0x66, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x69, 0x6e, 0x6b, 0x20, 
+	0x74, 0x68, 0x65, 0x6e, 0xa, 0x9, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 
+	0x6c, 0x69, 0x6e, 0x6b, 0x2e, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x3d, 
+	0x20, 0x22, 0x22, 0xa, 0x9, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 
+	0x69, 0x6e, 0x6b, 0x2e, 0x65, 0x78, 0x65, 0x20, 0x3d, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 
+	0x67, 0x73, 0x2e, 0x63, 0x63, 0x2e, 0x65, 0x78, 0x65, 0x5f, 0x63, 0x78, 0x78, 0xa, 0x9, 0x9, 
+	0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x69, 0x6e, 0x6b, 0x2e, 0x44, 0x72, 
+	0x69, 0x76, 0x65, 0x72, 0x20, 0x3d, 0x20, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x58, 0x4c, 0x43, 
+	0x5f, 0x4c, 0x69, 0x6e, 0x6b, 0xa, 0x9, 0x65, 0x6e, 0x64, 0xa, 0xa, 0x9, 0x69, 0x66, 0x20, 
+	0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x69, 0x62, 0x20, 0x74, 0x68, 0x65, 
+	0x6e, 0xa, 0x9, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x69, 0x62, 
+	0x2e, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x20, 0x3d, 0x20, 0x22, 0x6c, 0x69, 0x62, 0x22, 0xa, 
+	0x9, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x69, 0x62, 0x2e, 0x65, 
+	0x78, 0x74, 0x65, 0x6e, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x3d, 0x20, 0x22, 0x2e, 0x61, 0x22, 0xa, 
+	0x9, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x69, 0x62, 0x2e, 0x65, 
+	0x78, 0x65, 0x20, 0x3d, 0x20, 0x22, 0x61, 0x72, 0x22, 0xa, 0x9, 0x9, 0x73, 0x65, 0x74, 0x74, 
+	0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x69, 0x62, 0x2e, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x20, 
+	0x3d, 0x20, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x58, 0x4c, 0x43, 0x5f, 0x4c, 0x69, 0x62, 0xa, 
+	0x9, 0x65, 0x6e, 0x64, 0xa, 0xa, 0x9, 0x69, 0x66, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 
+	0x67, 0x73, 0x2e, 0x64, 0x6c, 0x6c, 0x20, 0x74, 0x68, 0x65, 0x6e, 0xa, 0x9, 0x9, 0x73, 0x65, 
+	0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x64, 0x6c, 0x6c, 0x2e, 0x70, 0x72, 0x65, 0x66, 0x69, 
+	0x78, 0x20, 0x3d, 0x20, 0x22, 0x6c, 0x69, 0x62, 0x22, 0xa, 0x9, 0x9, 0x73, 0x65, 0x74, 0x74, 
+	0x69, 0x6e, 0x67, 0x73, 0x2e, 0x64, 0x6c, 0x6c, 0x2e, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x73, 0x69, 
+	0x6f, 0x6e, 0x20, 0x3d, 0x20, 0x22, 0x2e, 0x73, 0x6f, 0x22, 0xa, 0x9, 0x9, 0x73, 0x65, 0x74, 
+	0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x64, 0x6c, 0x6c, 0x2e, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x73, 
+	0x69, 0x6f, 0x6e, 0x20, 0x3d, 0x20, 0x22, 0x2e, 0x73, 0x6f, 0x22, 0xa, 0x9, 0x9, 0x73, 0x65, 
+	0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x64, 0x6c, 0x6c, 0x2e, 0x65, 0x78, 0x65, 0x20, 0x3d, 
+	0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x63, 0x63, 0x2e, 0x65, 0x78, 0x65, 
+	0x5f, 0x63, 0x78, 0x78, 0xa, 0x9, 0x9, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 
+	0x64, 0x6c, 0x6c, 0x2e, 0x44, 0x72, 0x69, 0x76, 0x65, 0x72, 0x20, 0x3d, 0x20, 0x44, 0x72, 0x69, 
+	0x76, 0x65, 0x72, 0x58, 0x4c, 0x43, 0x5f, 0x44, 0x4c, 0x4c, 0xa, 0x9, 0x65, 0x6e, 0x64, 0xa, 
+	0x65, 0x6e, 0x64, 0xa, 0};
+INTERNALFILE internal_files[] = {{"src/base.lua", internal_file_1 },
+{"src/tools.lua", internal_file_2 },
+{"src/driver_gcc.lua", internal_file_3 },
+{"src/driver_clang.lua", internal_file_4 },
+{"src/driver_cl.lua", internal_file_5 },
+{"src/driver_solstudio.lua", internal_file_6 },
+{"src/driver_xlc.lua", internal_file_7 },
+{0}};
@@ -455,6 +455,7 @@ int lf_update_globalstamp(lua_State *L)
 	luaL_checknumarg_eq(L, 1);
 
 	file_stamp = file_timestamp(luaL_checklstring(L,1,NULL)); /* update global timestamp */
+	context_add_scriptinput(context, luaL_checklstring(L,1,NULL));
 	
 	if(file_stamp > context->globaltimestamp)
 		context->globaltimestamp = file_stamp;
@@ -605,6 +606,7 @@ int lf_mkdirs(struct lua_State *L)
 int lf_fileexist(struct lua_State *L)
 {
 	luaL_checknumarg_eq(L, 1);
+	context_add_scriptinput(context_get_pointer(L), luaL_checklstring(L,1,NULL));
 	if(file_timestamp(luaL_checklstring(L,1,NULL)))
 		lua_pushboolean(L, 1);	
 	else
@@ -616,6 +618,7 @@ int lf_fileexist(struct lua_State *L)
 int lf_isfile(struct lua_State *L)
 {
 	luaL_checknumarg_eq(L, 1);
+	context_add_scriptinput(context_get_pointer(L), luaL_checklstring(L,1,NULL));
 	if( file_isregular(luaL_checklstring(L,1,NULL)))
 		lua_pushboolean(L, 1);
 	else
@@ -626,6 +629,7 @@ int lf_isfile(struct lua_State *L)
 int lf_isdir(struct lua_State *L)
 {
 	luaL_checknumarg_eq(L, 1);
+	context_add_scriptinput(context_get_pointer(L), luaL_checklstring(L,1,NULL));
 	if( file_isdir(luaL_checklstring(L,1,NULL)))
 		lua_pushboolean(L, 1);
 	else
@@ -968,11 +972,15 @@ int lf_listdir(lua_State *L)
 
 	/* add all the entries */
 	if(strlen(lua_tostring(L, 1)) < 1)
+	{
+		context_add_scriptinput(context_get_pointer(L), context_get_path(L));
 		file_listdirectory(context_get_path(L), listdir_callback, &info);
+	}
 	else
 	{
 		char buffer[1024];
 		path_join(context_get_path(L), -1, lua_tostring(L,1), -1, buffer, sizeof(buffer));
+		context_add_scriptinput(context_get_pointer(L), buffer);
 		file_listdirectory(buffer, listdir_callback, &info);
 	}
 
@@ -1087,6 +1095,7 @@ static void run_collect(COLLECT_CALLBACK_INFO *info, const char *input)
 	info->end_len = strlen(info->end_str);
 	
 	/* search the path */
+	context_add_scriptinput(context_get_pointer(info->lua), dir);
 	file_listdirectory(dir, collect_callback, info);	
 }
 
@@ -1323,6 +1332,7 @@ int lf_add_dependency_cpp(lua_State *L)
 	if(option_cdep2)
 	{
 		deferred->run = dep_cpp2;
+		deferred->queue = dep_cpp2_queue;
 		hashindex = deferred->depcontext&(CSCAN_HASHSIZE-1);
 
 		for(scan = context->firstcscans[hashindex]; scan; scan = scan->next) {
@@ -1343,6 +1353,7 @@ int lf_add_dependency_cpp(lua_State *L)
 		scan->first = deferred;
 	} else {
 		deferred->run = dep_cpp;
+		deferred->queue = dep_cpp_queue;
 		deferred->next = context->firstdeferred_cpp;
 		context->firstdeferred_cpp = deferred;
 	}
@@ -20,12 +20,16 @@
 #include "support.h"
 #include "context.h"
 #include "cache.h"
+#include "artifact.h"
+#include "cscan.h"
 #include "statcache.h"
 #include "luafuncs.h"
 #include "platform.h"
+#include "server.h"
 #include "session.h"
 #include "version.h"
 #include "verify.h"
+#include "watch.h"
 
 /* internal base.bam file */
 #include "internal_base.h"
@@ -64,8 +68,12 @@ struct OPTION
 static int option_force = 0;
 static int option_clean = 0;
 static int option_no_cache = 0;
+static int option_no_capture = 0;
 static int option_no_scripttimestamp = 0;
 static int option_dry = 0;
+static int option_server = 0;
+static int option_client = 0;
+static int option_watch = 0;
 static int option_dependent = 0;
 static int option_abort_on_error = 0;
 static int option_debug_nodes = 0;
@@ -84,6 +92,9 @@ static int option_debug_eventlogflush = 0;
 
 static const char *option_script = "bam.lua"; /* -f filename */
 static const char *option_threads_str = NULL;
+static const char *option_artifact_cache = NULL;
+static const char *option_artifact_cache_size_str = NULL;
+static int option_artifact_cache_size = 1024; /* in MB */
 static const char *option_report_str = DEFAULT_REPORT_STYLE;
 static const char *option_targets[128] = {0};
 static const char* option_lua_execute = NULL;
@@ -102,6 +113,12 @@ static char depcache_filename[128] = {0};
 /* filename of the scancache will be filled in at start up, ".bam/scancache_xxxxxxxxyyyyyyyyy" = 32 top */
 static char scancache_filename[128] = {0};
 
+/* filename of the resolve cache, ".bam/resolvecache_xxxxxxxxyyyyyyyyy" */
+static char resolvecache_filename[128] = {0};
+
+/* filename of the directory cache, the same for all scripts */
+static char dircache_filename[] = ".bam/dircache";
+
 /* filename of the command cache */
 static char outputcache_filename[] = ".bam/outputcache";
 
@@ -165,6 +182,64 @@ static struct OPTION options[] = {
 	@END*/
 	{OF_PRINT, 0, &option_dependent			, "-d", "build targets that is dependent given targets"},
 		
+	/*@OPTION Content Digests ( --digest )
+		Keeps a digest of the content of every input in the output cache.
+		A job with inputs that are newer than its outputs is only run if
+		the content of the inputs has changed, so touching a file or
+		generating an identical one doesn't cause a rebuild. Digests are
+		only computed again for files that have a new timestamp.
+	@END*/
+	{OF_PRINT, 0, &session.digest			, "--digest", "only rebuild when the content of the inputs has changed"},
+
+	/*@OPTION Artifact Cache ( --artifact-cache DIRECTORY )
+		Keeps the outputs of the jobs in a directory that can be shared
+		between builds and checkouts, for example ^~/.cache/bam^. Before a
+		job runs it's looked up by its command line and the content of its
+		inputs, if it's found the outputs are copied from the cache instead
+		of running the job. Implies --digest.
+
+		The cache can also be on a server, given as
+		^http://host:port/path^ or ^unix:/path/to/socket^. The jobs that
+		can be looked up before the build are looked up in batches. See
+		^scripts/cacheserver.py^ for a server.
+	@END*/
+	{OF_PRINT, &option_artifact_cache, 0	, "--artifact-cache dir|url", "copy the outputs of jobs from a shared cache when possible"},
+	{0, &option_artifact_cache, 0	, "--artifact-cache", NULL},
+
+	/*@OPTION Artifact Cache Size ( --artifact-cache-size MB )
+		Sets the size limit of the artifact cache in megabytes. The least
+		recently used outputs are removed when it grows larger.
+	@END*/
+	{OF_PRINT, &option_artifact_cache_size_str, 0	, "--artifact-cache-size mb", "size limit of the artifact cache (default: 1024)"},
+	{0, &option_artifact_cache_size_str, 0	, "--artifact-cache-size", NULL},
+
+	/*@OPTION Server ( --server )
+		Runs the script and keeps the result in memory, then waits for
+		builds to be requested with --client from the same directory. Each
+		build only has to check the timestamps of the files again, on Linux
+		the server watches the files and only checks the changed ones. The script
+		is run again when one of the script files, or a directory that it
+		listed, has changed. Options given to the server are used for all
+		the builds. Jobs are run with the environment of the server. Not
+		available on Windows.
+	@END*/
+	{OF_PRINT, 0, &option_server			, "--server", "keep the script loaded and build when a client asks"},
+
+	/*@OPTION Client ( --client )
+		Asks the server in the current directory to do the build, with the
+		rest of the arguments. Builds as usual when there is no server.
+	@END*/
+	{OF_PRINT, 0, &option_client			, "--client", "let the server in this directory do the build"},
+
+	/*@OPTION Watch ( --watch )
+		Builds the targets and then builds them again every time a file
+		that the build reads from changes. The script is only run again when
+		one of the script files, or a directory that it listed, has changed.
+		A build is started over if files change while it runs. Only
+		available on Linux.
+	@END*/
+	{OF_PRINT, 0, &option_watch			, "--watch", "build again every time an input changes"},
+
 	/*@OPTION Dry Run ( --dry )
 		Does everything that it normally would do but does not execute any
 		commands.
@@ -178,6 +253,14 @@ static struct OPTION options[] = {
 	{OF_PRINT, &option_threads_str,0		, "-j num", "sets the number of threads to use (default: auto, -v will show it)"},
 	{0, &option_threads_str, 0		, "-j", NULL},
 
+	/*@OPTION Asynchronous Jobs ( --async )
+		Runs all the jobs from a single thread that starts the commands
+		without waiting for them and collects them as they finish. -j sets
+		the number of jobs that can run at the same time instead of the
+		number of threads. Not available on Windows, threads are used there.
+	@END*/
+	{OF_PRINT, 0, &session.async			, "--async", "run jobs from a single thread, -j sets the number of jobs"},
+
 	/*@OPTION Script File ( -s FILENAME )
 		Bam file to use. In normal operation, Bam executes
 		^bam.lua^. This option allows you to specify another bam
@@ -218,6 +301,21 @@ static struct OPTION options[] = {
 		Prints all commands that are runned when building.
 	@END*/
 	{OF_PRINT, 0, &session.verbose			, "-v", "be verbose"},
+
+	/*@OPTION No Output Capture ( --no-capture )
+		The output of each job is normally captured and written in one go
+		when the job is done so the output of jobs that run at the same time
+		doesn't get mixed up. This option lets the jobs write directly to
+		the terminal instead.
+	@END*/
+	{OF_PRINT, 0, &option_no_capture		, "--no-capture", "let jobs write directly to the terminal"},
+
+	/*@OPTION Ordered Output ( --ordered-output )
+		Writes the report and output of the jobs in the order that the jobs
+		were started, regardless of the order they finish in. Useful for
+		build logs that should be easy to compare.
+	@END*/
+	{OF_PRINT, 0, &session.ordered_output	, "--ordered-output", "write job output in the order the jobs were started"},
 				
 	{OF_PRINT, 0, 0						, "\n Other:", ""},
 
@@ -534,6 +632,15 @@ int register_lua_globals(struct lua_State *lua, const char* script_directory, co
 	return error;
 }
 
+static void queue_deferred_functions(struct CONTEXT *context, struct DEFERRED *cur)
+{
+	for(; cur; cur = cur->next)
+	{
+		if(cur->queue)
+			cur->queue(context, cur);
+	}
+}
+
 static int run_deferred_functions(struct CONTEXT *context, struct DEFERRED *cur)
 {
 	for(; cur; cur = cur->next)
@@ -545,8 +652,14 @@ static int run_deferred_functions(struct CONTEXT *context, struct DEFERRED *cur)
 	return 0;
 }
 
-static int bam_setup(struct CONTEXT *context, const char *scriptfile, const char **targets, int num_targets)
+/* runs the script, the graph is complete except for the dependencies
+	that the deferred functions adds */
+static int bam_setup(struct CONTEXT *context, const char *scriptfile)
 {
+	char statinfo[64];
+	unsigned num_stated;
+	int64 stattime;
+
 	/* */	
 	if(session.verbose)
 		printf("%s: setup started\n", session.name);
@@ -556,9 +669,7 @@ static int bam_setup(struct CONTEXT *context, const char *scriptfile, const char
 	
 	/* set global timestamp to the script file */
 	context->globaltimestamp = file_timestamp(scriptfile);
-
-	/* */
-	context->forced = option_force;
+	context_add_scriptinput(context, scriptfile);
 	
 	/* fetch script directory */
 	{
@@ -621,8 +732,9 @@ static int bam_setup(struct CONTEXT *context, const char *scriptfile, const char
 	/* create the cache and tmp directory */
 	file_createdir(".bam");
 
-	/* start the background stat thread */
-	node_graph_start_statthread(context->graph);
+	/* start the background stat threads */
+	stattime = time_get();
+	node_graph_start_statthread(context->graph, session.threads);
 
 	/* call the code chunk */
 	event_begin(0, "script run", NULL);
@@ -635,15 +747,42 @@ static int bam_setup(struct CONTEXT *context, const char *scriptfile, const char
 	}
 	event_end(0, "script run", NULL);
 
-	/* stop the background stat thread */
+	/* stop the background stat threads */
 	event_begin(0, "stat", NULL);
-	node_graph_end_statthread(context->graph);
-	event_end(0, "stat", NULL);
-	
+	num_stated = node_graph_end_statthread(context->graph);
+	stattime = time_get() - stattime;
+	sprintf(statinfo, "%u files, %.0f/s", num_stated, num_stated * (double)time_freq() / (stattime ? stattime : 1));
+	event_end(0, "stat", statinfo);
+
+	return 0;
+}
+
+/* runs the deferred functions and makes the build target */
+static int bam_setup_targets(struct CONTEXT *context, const char **targets, int num_targets)
+{
+	/* */
+	context->forced = option_force;
+	context->exit_on_error = option_abort_on_error;
+
+	/* start scanning the source files on the worker threads while the
+		dependencies are walked on this one */
+	context->cscan = cscan_create(session.threads);
+	queue_deferred_functions(context, context->firstdeferred_cpp);
+	{
+		int i;
+		struct DEFERRED_CSCAN * cur;
+		for(i = 0; i < CSCAN_HASHSIZE; i++)
+			for(cur = context->firstcscans[i]; cur; cur = cur->next)
+				queue_deferred_functions(context, cur->first);
+	}
+
 	/* run deferred functions */
 	event_begin(0, "deferred cpp dependencies", NULL);
 	if(run_deferred_functions(context, context->firstdeferred_cpp) != 0)
+	{
+		cscan_destroy(context->cscan);
 		return -1;
+	}
 	event_end(0, "deferred cpp dependencies", NULL);
 
 	/* run deferred functions */
@@ -653,12 +792,17 @@ static int bam_setup(struct CONTEXT *context, const char *scriptfile, const char
 		for ( i = 0; i < CSCAN_HASHSIZE; i++ ) {
 			struct DEFERRED_CSCAN * cur = context->firstcscans[i];
 			for ( ; cur; cur = cur->next ) {
-				if(run_deferred_functions(context, cur->first) != 0)
+				if(run_deferred_functions(context, cur->first) != 0) {
+					cscan_destroy(context->cscan);
 					return -1;
+				}
 			}
 		}
 	}
 	event_end(0, "deferred cpp dependencies 2", NULL);
+
+	cscan_destroy(context->cscan);
+	context->cscan = NULL;
 		
 	event_begin(0, "deferred search dependencies", NULL);
 	if(run_deferred_functions(context, context->firstdeferred_search) != 0)
@@ -763,35 +907,47 @@ static int bam_setup(struct CONTEXT *context, const char *scriptfile, const char
 /* null verify callback, used to seed the initial state */
 static int verify_callback_null(const char *fullpath, hash_t hashid, time_t oldstamp, time_t newstamp, void *user) { return 0; }
 
-/* *** */
-static int bam(const char *scriptfile, const char **targets, int num_targets)
-{
-	struct CONTEXT context;
-	int build_error = 0;
-	int setup_error = 0;
-	int report_done = 0;
-	time_t outputcache_timestamp = 0;
+/* timestamp of the output cache when it was loaded */
+static time_t outputcache_timestamp = 0;
 
-	/* build time */
-	time_t starttime  = time(0x0);
-	
+static void bam_create(struct CONTEXT *context)
+{
 	/* zero out and create memory heap, graph */
-	memset(&context, 0, sizeof(struct CONTEXT));
-	context.graphheap = mem_create();
-	context.deferredheap = mem_create();
-	context.graph = node_graph_create(context.graphheap);
-	context.statcache = statcache_create();
-	context.exit_on_error = option_abort_on_error;
-	context.buildtime = timestamp();
+	memset(context, 0, sizeof(struct CONTEXT));
+	context->graphheap = mem_create();
+	context->deferredheap = mem_create();
+	context->graph = node_graph_create(context->graphheap);
+	context->statcache = statcache_create();
+	context->buildtime = timestamp();
 
 	/* create lua context */
 	/* HACK: Store the context pointer as the userdata pointer to the allocator to make
 		sure that we have fast access to it. This makes the context_get_pointer call very fast */
-	context.lua = lua_newstate(lua_alloctor_malloc, &context);
+	context->lua = lua_newstate(lua_alloctor_malloc, context);
 
 	/* install panic function */
-	lua_atpanic(context.lua, lf_panicfunc);
+	lua_atpanic(context->lua, lf_panicfunc);
+}
+
+static void bam_destroy(struct CONTEXT *context)
+{
+	if(context->deferredheap)
+		mem_destroy(context->deferredheap);
+	if(context->lua)
+		lua_close(context->lua);
+
+	mem_destroy(context->graphheap);
+	free(context->joblist);
+	statcache_free(context->statcache);
+
+	if(context->verifystate)
+	{
+		verify_destroy(context->verifystate);
+	}
+}
 
+static void bam_load_caches(struct CONTEXT *context)
+{
 	/* load cache (thread?) */
 	if(option_no_cache == 0)
 	{
@@ -806,126 +962,177 @@ static int bam(const char *scriptfile, const char **targets, int num_targets)
 		string_hash_tostr(cache_hash, hashstr);
 		sprintf(depcache_filename, ".bam/%s", hashstr);
 		sprintf(scancache_filename, ".bam/scancache_%s", hashstr);
+		sprintf(resolvecache_filename, ".bam/resolvecache_%s", hashstr);
 
 		event_begin(0, "depcache load", depcache_filename);
-		context.depcache = depcache_load(depcache_filename);
+		context->depcache = depcache_load(depcache_filename);
 		event_end(0, "depcache load", NULL);
 
 		event_begin(0, "scancache load", scancache_filename);
-		context.scancache = scancache_load(scancache_filename);
+		context->scancache = scancache_load(scancache_filename);
 		event_end(0, "scancache load", NULL);
 
+		event_begin(0, "resolvecache load", resolvecache_filename);
+		context->resolvecache = resolvecache_load(resolvecache_filename);
+		event_end(0, "resolvecache load", NULL);
+
+		event_begin(0, "dircache load", dircache_filename);
+		context->dircache = dircache_load(dircache_filename);
+		event_end(0, "dircache load", NULL);
+
 		event_begin(0, "outputcache load", outputcache_filename);
-		context.outputcache = outputcache_load(outputcache_filename, &outputcache_timestamp);
+		context->outputcache = outputcache_load(outputcache_filename, &outputcache_timestamp);
 		event_end(0, "outputcache load", NULL);
 	}
+}
 
-	/* do the setup */
-	setup_error = bam_setup(&context, scriptfile, targets, num_targets);
+static void bam_free_caches(struct CONTEXT *context)
+{
+	depcache_free(context->depcache);
+	scancache_free(context->scancache);
+	resolvecache_free(context->resolvecache);
+	dircache_free(context->dircache);
+	outputcache_free(context->outputcache);
+	context->depcache = NULL;
+	context->scancache = NULL;
+	context->resolvecache = NULL;
+	context->dircache = NULL;
+	context->outputcache = NULL;
+}
+
+/* builds the targets from a graph that the script has been run for */
+static int bam_build(struct CONTEXT *context, const char **targets, int num_targets, time_t starttime)
+{
+	int build_error = 0;
+	int setup_error = 0;
+	int report_done = 0;
+
+	/* do the rest of the setup */
+	setup_error = bam_setup_targets(context, targets, num_targets);
 
 	/* done with the loopup heap */
-	mem_destroy(context.deferredheap);
+	mem_destroy(context->deferredheap);
+	context->deferredheap = NULL;
 
 	/* close the lua state */
-	lua_close(context.lua);
+	lua_close(context->lua);
+	context->lua = NULL;
 	
 	/* time after script has run to completion etc */
-	context.postsetuptime = timestamp();
+	context->postsetuptime = timestamp();
+
+	/* no error message on setup error, it reports fine itself */
+	if(setup_error)
+		return setup_error;
 
 	/* do actions if we don't have any errors */
-	if(!setup_error)
+	event_begin(0, "prepare", NULL);
+	build_error = context_build_prepare(context);
+	event_end(0, "prepare", NULL);
+	
+	if(!build_error)
 	{
-		event_begin(0, "prepare", NULL);
-		build_error = context_build_prepare(&context);
-		event_end(0, "prepare", NULL);
-		
-		if(!build_error)
-		{
-			event_begin(0, "prioritize", NULL);
-			build_error = context_build_prioritize(&context);
-			event_end(0, "prioritize", NULL);
-		}
+		event_begin(0, "prioritize", NULL);
+		build_error = context_build_prioritize(context);
+		event_end(0, "prioritize", NULL);
+	}
 
-		/* start verification */
-		if(option_debug_verify)
+	/* start verification */
+	if(option_debug_verify)
+	{
+		/* special handle of . */
+		if(strcmp(option_debug_verify, ".") == 0)
+			context->verifystate = verify_create("");
+		else
+			context->verifystate = verify_create(option_debug_verify);
+		verify_update(context->verifystate, verify_callback_null, NULL);
+	}
+
+	if(!build_error)
+	{
+		if(option_debug_nodes) /* debug dump all nodes detailed */
+			node_debug_dump(context->graph, 0);
+		else if(option_debug_nodes_html) /* debug dump all nodes detailed as html*/
+			node_debug_dump(context->graph, 1);
+		else if(option_debug_joblist) /* debug dumps the joblist */
+			context_dump_joblist(context);
+		else if(option_dry)
 		{
-			/* special handle of . */
-			if(strcmp(option_debug_verify, ".") == 0)
-				context.verifystate = verify_create("");
-			else
-				context.verifystate = verify_create(option_debug_verify);
-			verify_update(context.verifystate, verify_callback_null, NULL);
 		}
-
-		if(!build_error)
+		else
 		{
-			if(option_debug_nodes) /* debug dump all nodes detailed */
-				node_debug_dump(context.graph, 0);
-			else if(option_debug_nodes_html) /* debug dump all nodes detailed as html*/
-				node_debug_dump(context.graph, 1);
-			else if(option_debug_joblist) /* debug dumps the joblist */
-				context_dump_joblist(&context);
-			else if(option_dry)
+			/* run build or clean */
+			if(option_clean)
 			{
+				event_begin(0, "clean", NULL);
+				build_error = context_build_clean(context);
+				event_end(0, "end", NULL);
 			}
 			else
 			{
-				/* run build or clean */
-				if(option_clean)
+				if(option_artifact_cache)
 				{
-					event_begin(0, "clean", NULL);
-					build_error = context_build_clean(&context);
-					event_end(0, "end", NULL);
+					int64 size = option_artifact_cache_size;
+					context->artifactcache = artifactcache_create(option_artifact_cache, size*1024*1024);
 				}
-				else
+
+				if(context->artifactcache)
 				{
-					event_begin(0, "build", NULL);
-					build_error = context_build_make(&context);
-					event_end(0, "build", NULL);
-					report_done = 1;
+					event_begin(0, "artifact lookup", NULL);
+					context_build_lookup_artifacts(context);
+					event_end(0, "artifact lookup", NULL);
 				}
 
-				/* save cache (thread?) */
-				if(option_no_cache == 0)
-				{
-					event_begin(0, "depcache save", depcache_filename);
-					depcache_save(depcache_filename, context.graph);
-					event_end(0, "depcache save", NULL);
+				event_begin(0, "build", NULL);
+				build_error = context_build_make(context);
+				event_end(0, "build", NULL);
+
+				event_begin(0, "artifact trim", NULL);
+				artifactcache_destroy(context->artifactcache);
+				context->artifactcache = NULL;
+				event_end(0, "artifact trim", NULL);
+				report_done = 1;
+			}
+
+			/* save cache (thread?) */
+			if(option_no_cache == 0)
+			{
+				event_begin(0, "depcache save", depcache_filename);
+				depcache_save(depcache_filename, context->graph);
+				event_end(0, "depcache save", NULL);
+
+				event_begin(0, "scancache save", scancache_filename);
+				scancache_save(scancache_filename, context->graph);
+				event_end(0, "scancache save", NULL);
+
+				event_begin(0, "resolvecache save", resolvecache_filename);
+				resolvecache_save(resolvecache_filename, context->resolvecache);
+				event_end(0, "resolvecache save", NULL);
 
-					event_begin(0, "scancache save", scancache_filename);
-					scancache_save(scancache_filename, context.graph);
-					event_end(0, "scancache save", NULL);
+				event_begin(0, "dircache save", dircache_filename);
+				dircache_save(dircache_filename, context->dircache);
+				event_end(0, "dircache save", NULL);
 
-					event_begin(0, "outputcache save", outputcache_filename);
-					outputcache_save(outputcache_filename, context.outputcache, context.graph, outputcache_timestamp);
-					event_end(0, "outputcache save", NULL);
+				if(session.digest)
+				{
+					event_begin(0, "digests", NULL);
+					context_build_digests(context);
+					event_end(0, "digests", NULL);
 				}
+
+				event_begin(0, "outputcache save", outputcache_filename);
+				outputcache_save(outputcache_filename, context->outputcache, context->graph, outputcache_timestamp);
+				event_end(0, "outputcache save", NULL);
 			}
 		}
-	}		
-
-	/* clean up */
-	mem_destroy(context.graphheap);
-	free(context.joblist);
-	depcache_free(context.depcache);
-	statcache_free(context.statcache);
-
-	if(context.verifystate)
-	{
-		verify_destroy(context.verifystate);
 	}
 
 	/* print final report and return */
-	if(setup_error)
-	{
-		/* no error message on setup error, it reports fine itself */
-		return setup_error;
-	}
-	else if(build_error)
+	if(build_error)
 		printf("%s: error: a build step failed\n", session.name);
 	else if(report_done)
 	{
-		if(context.num_jobs == 0)
+		if(context->num_jobs == 0)
 			printf("%s: targets are up to date already\n", session.name);
 		else
 		{
@@ -940,8 +1147,28 @@ static int bam(const char *scriptfile, const char **targets, int num_targets)
 	return build_error;
 }
 
+/* *** */
+static int bam(const char *scriptfile, const char **targets, int num_targets)
+{
+	struct CONTEXT context;
+	int error;
+
+	/* build time */
+	time_t starttime  = time(0x0);
 
+	bam_create(&context);
+	bam_load_caches(&context);
 
+	/* do the setup */
+	error = bam_setup(&context, scriptfile);
+	if(!error)
+		error = bam_build(&context, targets, num_targets, starttime);
+
+	/* clean up */
+	bam_free_caches(&context);
+	bam_destroy(&context);
+	return error;
+}
 /* signal handler */
 static void abortsignal(int i)
 {
@@ -1094,6 +1321,371 @@ static int parse_parameters_str(const char *str)
 	return parse_parameters(num_ptrs, ptrs);
 }
 
+/* sets up the session from the options */
+static int session_setup()
+{
+	int i;
+
+	/* parse the report str */
+	session.report_color = 0;
+	session.report_bar = 0;
+	session.report_steps = 0;
+	for(i = 0; option_report_str[i]; i++)
+	{
+		if(option_report_str[i] == 'c')
+			session.report_color = 1;
+		else if(option_report_str[i] == 'b')
+			session.report_bar = 1;
+		else if(option_report_str[i] == 's')
+			session.report_steps = 1;
+	}
+	
+	/* ordered output needs the output to be captured */
+	session.capture_output = !option_no_capture || session.ordered_output;
+
+	/* the artifact cache is looked up with the digests of the inputs */
+	if(option_artifact_cache)
+		session.digest = 1;
+
+	/* convert the threads string */
+	if(option_threads_str)
+	{
+		session.threads = atoi(option_threads_str);
+		if(session.threads < 0)
+		{
+			printf("%s: invalid number of threads supplied\n", session.name);
+			return -1;
+		}
+	}
+	else
+	{
+		session.threads = threads_corecount();
+		if(session.verbose)
+			printf("%s: detected %d cores\n", session.name, session.threads);
+	}
+
+	/* convert the artifact cache size */
+	if(option_artifact_cache_size_str)
+	{
+		option_artifact_cache_size = atoi(option_artifact_cache_size_str);
+		if(option_artifact_cache_size <= 0)
+		{
+			printf("%s: invalid artifact cache size supplied\n", session.name);
+			return -1;
+		}
+	}
+
+	/* turn off threading if we are running verify */
+	if(option_debug_verify)
+	{
+		session.threads = 0;
+		session.async = 0;
+		if(session.verbose)
+			printf("%s: turned of threading due to --debug-verify\n", session.name);
+	}
+
+#ifdef BAM_FAMILY_WINDOWS
+	/* there is no asynchronous process support on windows, use threads */
+	session.async = 0;
+#endif
+
+	return 0;
+}
+
+/* builds for a client with the graph that the server has in memory */
+static int bam_server_build(struct CONTEXT *context, struct SERVER_REQUEST *request, const char **scriptargs, int num_scriptargs, time_t starttime, int num_stated)
+{
+	int i;
+
+	/* the options of the server are kept, the ones from the client are
+		added to them */
+	option_num_targets = 0;
+	option_num_scriptargs = 0;
+	if(parse_parameters(request->argc, request->argv) != 0 || session_setup() != 0)
+		return 1;
+
+	/* the script could make a different graph with other arguments, do
+		the whole build then */
+	if(strcmp(option_script, context->filename) != 0 || option_num_scriptargs != num_scriptargs)
+		return bam(option_script, option_targets, option_num_targets);
+
+	for(i = 0; i < num_scriptargs; i++)
+	{
+		if(strcmp(option_scriptargs[i], scriptargs[i]) != 0)
+			return bam(option_script, option_targets, option_num_targets);
+	}
+
+	/* files may have changed since the script ran, the server has only
+		stated the ones that it knows has changed if it's watching them */
+	if(num_stated < 0)
+	{
+		event_begin(0, "stat", NULL);
+		node_graph_restat(context->graph);
+		event_end(0, "stat", NULL);
+	}
+	else if(session.verbose)
+		printf("%s: %d files changed since the last build\n", session.name, num_stated);
+
+	return bam_build(context, option_targets, option_num_targets, starttime);
+}
+
+/* runs the script and keeps the result, each build is done in a process
+	of its own that starts with a copy of it */
+static int bam_server(const char *scriptfile)
+{
+	struct CONTEXT context;
+	struct SERVER_REQUEST request;
+	struct WATCHER *watcher = NULL;
+	unsigned num_stated = 0;
+	const char *scriptargs[128];
+	int num_scriptargs = option_num_scriptargs;
+	time_t scripttime = 0;
+	time_t starttime;
+	int loaded = 0;
+	int listenfd;
+	int pid;
+
+	/* create the cache and tmp directory */
+	file_createdir(".bam");
+
+	listenfd = server_listen(SERVER_SOCKET);
+	if(listenfd < 0)
+		return 1;
+
+	memcpy(scriptargs, option_scriptargs, sizeof(scriptargs));
+	printf("%s: waiting for builds on '%s'\n", session.name, SERVER_SOCKET);
+	fflush(stdout);
+
+	while(1)
+	{
+		/* keep up with the changes while waiting */
+		while(watcher && server_poll(listenfd, watcher_fd(watcher)) == 1)
+			num_stated += watcher_update(watcher);
+
+		if(server_accept(listenfd, &request) != 0)
+			continue;
+
+		starttime = time(0x0);
+
+		/* run the script again if anything it looked at has changed */
+		if(loaded && context_scriptinputs_changed(&context, scripttime, 1))
+		{
+			watcher_destroy(watcher);
+			watcher = NULL;
+			bam_free_caches(&context);
+			bam_destroy(&context);
+			loaded = 0;
+		}
+
+		if(!loaded)
+		{
+			server_output_begin(&request);
+			scripttime = time(0x0);
+			bam_create(&context);
+			context.track_scriptinputs = 1;
+			bam_load_caches(&context);
+			if(bam_setup(&context, scriptfile) == 0)
+				loaded = 1;
+			else
+			{
+				bam_free_caches(&context);
+				bam_destroy(&context);
+			}
+			server_output_end();
+
+			if(!loaded)
+			{
+				server_finish(&request, 1);
+				continue;
+			}
+
+			watcher = watcher_create(context.graph);
+			num_stated = 0;
+		}
+
+		if(watcher)
+			num_stated += watcher_update(watcher);
+
+		pid = server_fork(listenfd, &request);
+		if(pid == 0)
+			return bam_server_build(&context, &request, scriptargs, num_scriptargs, starttime, watcher ? (int)num_stated : -1);
+
+		if(pid > 0)
+		{
+			server_started(&request, pid);
+			server_finish(&request, server_wait(pid));
+		}
+		else
+			server_finish(&request, 1);
+
+		/* the build has saved new caches */
+		bam_free_caches(&context);
+		bam_load_caches(&context);
+		num_stated = 0;
+	}
+}
+
+/* milliseconds without changes before a build is started */
+#define WATCH_DEBOUNCE 200
+
+/* reads changes until there hasn't been any for a while, returns the
+	number of changed files */
+static unsigned watch_debounce(struct WATCHER *watcher)
+{
+	unsigned num_changed = watcher_update(watcher);
+	while(!session.abort && server_poll_fd(watcher_fd(watcher), WATCH_DEBOUNCE))
+		num_changed += watcher_update(watcher);
+	return num_changed;
+}
+
+/* watches the files that the last build found with the dependency
+	scanners, they are in the dependency cache but not in the graph */
+static void watch_depcache(struct WATCHER *watcher, struct DEPCACHE *depcache)
+{
+	struct CACHEINFO_DEPS *cacheinfo;
+	unsigned i;
+
+	if(!depcache)
+		return;
+
+	for(i = 0; (cacheinfo = depcache_find_byindex(depcache, i)); i++)
+		watcher_add_file(watcher, depcache_node_filename(depcache, cacheinfo));
+}
+
+/* runs the script and builds, then builds again with the same graph every
+	time something changes */
+static int bam_watch(const char *scriptfile, const char **targets, int num_targets)
+{
+	struct CONTEXT context;
+	struct WATCHER *watcher = NULL;
+	struct SCRIPTINPUT *input;
+	time_t scripttime = 0;
+	time_t starttime;
+	int exitcode = 0;
+	int restart;
+	int changed = 0;
+	int loaded = 0;
+	int pid;
+
+	/* create the cache and tmp directory */
+	file_createdir(".bam");
+
+	install_abort_signal();
+
+	while(!session.abort)
+	{
+		starttime = time(0x0);
+
+		/* run the script again if anything it looked at has changed. the
+			directories it listed are checked by the watcher, their
+			timestamps changes with the outputs that the build writes */
+		if(loaded && (changed < 0 || context_scriptinputs_changed(&context, scripttime, 0) || watcher_listing_changed(watcher)))
+		{
+			bam_free_caches(&context);
+			bam_destroy(&context);
+			loaded = 0;
+		}
+
+		if(!loaded)
+		{
+			scripttime = time(0x0);
+			bam_create(&context);
+			context.track_scriptinputs = 1;
+			bam_load_caches(&context);
+			loaded = bam_setup(&context, scriptfile) == 0;
+
+			watcher_destroy(watcher);
+			watcher = watcher_create(loaded ? context.graph : NULL);
+			if(!watcher)
+			{
+				printf("%s: --watch is not supported on this platform\n", session.name);
+				bam_free_caches(&context);
+				bam_destroy(&context);
+				return 1;
+			}
+
+			/* a directory that changed after the script listed it but
+				before it was watched */
+			changed = 0;
+			for(input = context.firstscriptinput; input; input = input->next)
+			{
+				watcher_add_file(watcher, input->path);
+				if(input->isdir && file_timestamp(input->path) != input->timestamp)
+					changed = -1;
+			}
+
+			if(!loaded)
+			{
+				exitcode = 1;
+				bam_free_caches(&context);
+				bam_destroy(&context);
+			}
+		}
+
+		if(loaded && changed < 0)
+			continue;
+
+		restart = 0;
+		changed = 0;
+		if(loaded)
+		{
+			watcher_update(watcher);
+
+			pid = server_fork(-1, NULL);
+			if(pid == 0)
+				return bam_build(&context, targets, num_targets, starttime);
+			if(pid < 0)
+				break;
+
+			/* start over if anything changes while building */
+			while((exitcode = server_poll_build(pid)) < 0)
+			{
+				if(session.abort || (server_poll_fd(watcher_fd(watcher), WATCH_DEBOUNCE) && watch_debounce(watcher)))
+				{
+					/* the build could have finished while the changes came
+						in, then it's built again without starting over */
+					changed = !session.abort;
+					exitcode = server_poll_build(pid);
+					if(exitcode >= 0)
+						break;
+
+					restart = changed;
+					server_cancel(pid);
+					exitcode = server_wait(pid);
+					break;
+				}
+			}
+
+			/* the build has saved new caches */
+			bam_free_caches(&context);
+			bam_load_caches(&context);
+			watch_depcache(watcher, context.depcache);
+		}
+
+		if(restart)
+		{
+			printf("%s: files changed during the build, starting over\n", session.name);
+			continue;
+		}
+
+		if(changed)
+			continue;
+
+		printf("%s: waiting for changes\n", session.name);
+		fflush(stdout);
+		while(!session.abort && !(server_poll_fd(watcher_fd(watcher), -1) && watch_debounce(watcher)))
+			;
+	}
+
+	watcher_destroy(watcher);
+	if(loaded)
+	{
+		bam_free_caches(&context);
+		bam_destroy(&context);
+	}
+	return exitcode;
+}
+
 /* ********* */
 int main(int argc, char **argv)
 {
@@ -1140,34 +1732,10 @@ int main(int argc, char **argv)
 		}
 	}
 
-	/* parse the report str */
-	for(i = 0; option_report_str[i]; i++)
-	{
-		if(option_report_str[i] == 'c')
-			session.report_color = 1;
-		else if(option_report_str[i] == 'b')
-			session.report_bar = 1;
-		else if(option_report_str[i] == 's')
-			session.report_steps = 1;
-	}
-	
-	/* convert the threads string */
-	if(option_threads_str)
-	{
-		session.threads = atoi(option_threads_str);
-		if(session.threads < 0)
-		{
-			printf("%s: invalid number of threads supplied\n", session.name);
-			return 1;
-		}
-	}
-	else
-	{
-		session.threads = threads_corecount();
-		if(session.verbose)
-			printf("%s: detected %d cores\n", session.name, session.threads);
-	}
-	
+	/* set up the session from the options */
+	if(session_setup() != 0)
+		return 1;
+
 	/* check for help argument */
 	if(option_print_debughelp)
 	{
@@ -1193,14 +1761,6 @@ int main(int argc, char **argv)
 		return 0;
 	}
 
-	/* turn off threading if we are running verify */
-	if(option_debug_verify)
-	{
-		session.threads = 0;
-		if(session.verbose)
-			printf("%s: turned of threading due to --debug-verify\n", session.name);
-
-	}
 	
 	if(option_lua_execute)
 	{
@@ -1242,10 +1802,31 @@ int main(int argc, char **argv)
 		lua_close(lua);
 		error = 0;
 	}
+	else if(option_server)
+		error = bam_server(option_script);
+	else if(option_watch)
+		error = bam_watch(option_script, option_targets, option_num_targets);
 	else
 	{
+		error = -1;
+
+		/* let the server do the build if there is one */
+		if(option_client)
+		{
+			char **args = (char **)malloc(argc * sizeof(char *));
+			int num_args = 0;
+			for(i = 1; i < argc; i++)
+			{
+				if(strcmp(argv[i], "--client") != 0)
+					args[num_args++] = argv[i];
+			}
+			error = client_run(SERVER_SOCKET, num_args, args);
+			free(args);
+		}
+
 		/* init the context */
-		error = bam(option_script, option_targets, option_num_targets);
+		if(error == -1)
+			error = bam(option_script, option_targets, option_num_targets);
 	}
 	
 	platform_shutdown();
@@ -16,6 +16,26 @@
 #endif
 
 /* */
+/* allocates the arrays of the node index from the heap and moves the
+	nodes from the old arrays, if there are any. the old arrays are left
+	in the heap */
+static void node_index_create(struct GRAPH *graph, unsigned size)
+{
+	struct HASHTABLE old = graph->nodeindex;
+	hash_t *keys = (hash_t *)mem_allocate(graph->heap, size * (sizeof(hash_t) + sizeof(unsigned)));
+	unsigned i;
+
+	hashtable_init(&graph->nodeindex, keys, (unsigned *)(keys + size), size, old.zero);
+	if(!old.keys)
+		return;
+
+	for(i = 0; i <= old.mask; i++)
+	{
+		if(old.keys[i])
+			hashtable_insert(&graph->nodeindex, old.keys[i], old.values[i]);
+	}
+}
+
 struct GRAPH *node_graph_create(struct HEAP *heap)
 {
 	/* allocate graph structure */
@@ -25,6 +45,7 @@ struct GRAPH *node_graph_create(struct HEAP *heap)
 
 	/* init */
 	graph->heap = heap;
+	node_index_create(graph, NODE_INDEX_SIZE);
 	return graph; 
 }
 
@@ -39,60 +60,136 @@ static void node_stat(struct NODE *node)
 		node->dirty |= NODEDIRTY_MISSING;
 }
 
+/* nodes are handed out to the stat threads a few at the time */
+#define STAT_BATCH 16
+#define STAT_MAX_THREADS 16
+
+struct STATTHREAD
+{
+	struct STATPOOL *pool;
+	void *thread;
+	int id;
+};
+
+struct STATPOOL
+{
+	struct GRAPH *graph;
+	struct LOCK *lock;
+	struct NODE *next; /* next node that no thread has taken */
+	unsigned num_queued; /* nodes that no thread has taken */
+	int done; /* no more nodes will be added */
+	int num_waiting; /* threads that has nothing to do */
+	unsigned num_stated;
+
+	int num_threads;
+	struct STATTHREAD threads[STAT_MAX_THREADS];
+};
+
 static void stat_thread(void *user)
 {
-	struct GRAPH *graph = (struct GRAPH *)user;
-	struct NODE *node = NULL;
-	unsigned count = 0;
-	unsigned loops = 0;
+	struct STATTHREAD *info = (struct STATTHREAD *)user;
+	struct STATPOOL *pool = info->pool;
+	struct NODE *node;
+	unsigned count;
+	unsigned i;
 
+	lock_enter(pool->lock);
 	while(1)
 	{
-		/* find the next stat node */
-		struct NODE *next = NULL;
-		if(node)
-			next = node->nextstat;
-		else
-			next = graph->firststatnode;
-
-		loops++;
-
-		if(next)
+		while(!pool->next && !pool->done)
 		{
-			count++;
-			node = next;
+			pool->num_waiting++;
+			lock_wait(pool->lock);
+			pool->num_waiting--;
+		}
+		if(!pool->next)
+			break;
 
-			/* stat the node */
+		/* take a batch, the links between them are already written */
+		node = pool->next;
+		for(count = 1; count < STAT_BATCH && pool->next->nextstat; count++)
+			pool->next = pool->next->nextstat;
+		pool->next = pool->next->nextstat;
+		pool->num_queued -= count;
+		pool->num_stated += count;
+		lock_leave(pool->lock);
+
+		/* the link out of the last node isn't read, node_create can be
+			writing it under the lock */
+		for(i = 0; i < count; i++)
+		{
+			if(i)
+				node = node->nextstat;
 			node_stat(node);
-			sync_barrier();
 		}
-		else
-		{
-			/* check if we should finish */
-			if(node == graph->finalstatnode)
-				break;
 
-			/* be a little nice for now */
-			threads_yield();
-		}
+		lock_enter(pool->lock);
 	}
+	lock_leave(pool->lock);
 }
 
-void node_graph_start_statthread(struct GRAPH *graph)
+void node_graph_start_statthread(struct GRAPH *graph, int threads)
 {
-	graph->finalstatnode = (struct NODE *)0x1;
-	sync_barrier();
-	graph->statthread = threads_create(stat_thread, graph);
+	struct STATPOOL *pool;
+	int i;
+
+	/* the threads mostly waits on the filesystem, there is no need to
+		keep it down to the number of cores */
+	if(threads < 1)
+		threads = 1;
+	if(threads > STAT_MAX_THREADS)
+		threads = STAT_MAX_THREADS;
+
+	pool = (struct STATPOOL *)calloc(1, sizeof(struct STATPOOL));
+	pool->graph = graph;
+	pool->lock = lock_create();
+	pool->num_threads = threads;
+	for(i = 0; i < threads; i++)
+	{
+		pool->threads[i].pool = pool;
+		pool->threads[i].id = i+1;
+		pool->threads[i].thread = threads_create(stat_thread, &pool->threads[i]);
+	}
+
+	graph->statpool = pool;
 }
 
-void node_graph_end_statthread(struct GRAPH *graph)
+unsigned node_graph_end_statthread(struct GRAPH *graph)
 {
-	graph->finalstatnode = graph->laststatnode;
-	sync_barrier();
-	threads_join(graph->statthread);
-	graph->statthread = NULL;
+	struct STATPOOL *pool = graph->statpool;
+	unsigned num_stated;
+	int i;
+
+	if(!pool)
+		return 0;
+
+	lock_enter(pool->lock);
+	pool->done = 1;
+	lock_broadcast(pool->lock);
+	lock_leave(pool->lock);
+
+	for(i = 0; i < pool->num_threads; i++)
+		threads_join(pool->threads[i].thread);
+
+	num_stated = pool->num_stated;
+	lock_destroy(pool->lock);
+	free(pool);
+	graph->statpool = NULL;
+	return num_stated;
+}
+
+void node_restat(struct NODE *node)
+{
+	node->dirty &= ~NODEDIRTY_MISSING;
+	node_stat(node);
 }
 
+void node_graph_restat(struct GRAPH *graph)
+{
+	struct NODE *node;
+	for(node = graph->firststatnode; node; node = node->nextstat)
+		node_restat(node);
+}
 
 struct JOB *node_job_create_null(struct GRAPH *graph)
 {
@@ -121,12 +218,40 @@ struct JOB *node_job_create(struct GRAPH *graph, const char *label, const char *
 	return job;
 }
 
+/* takes the next node from the current block so the nodes are after
+	each other in memory, away from the filenames and links. the blocks
+	are kept in an array so a node can be found from its id */
+static struct NODE *node_allocate(struct GRAPH *graph)
+{
+	if(!graph->num_nodeblocks || graph->nodeblock_used == NODE_BLOCK_SIZE)
+	{
+		char *mem;
+
+		if(graph->num_nodeblocks == graph->max_nodeblocks)
+		{
+			struct NODE **blocks;
+			graph->max_nodeblocks = graph->max_nodeblocks ? graph->max_nodeblocks * 2 : 64;
+			blocks = (struct NODE **)mem_allocate(graph->heap, graph->max_nodeblocks * sizeof(struct NODE *));
+			if(graph->num_nodeblocks)
+				memcpy(blocks, graph->nodeblocks, graph->num_nodeblocks * sizeof(struct NODE *));
+			graph->nodeblocks = blocks;
+		}
+
+		mem = (char *)mem_allocate(graph->heap, NODE_BLOCK_SIZE * sizeof(struct NODE) + NODE_BLOCK_ALIGN);
+		mem += (NODE_BLOCK_ALIGN - ((size_t)mem & (NODE_BLOCK_ALIGN-1))) & (NODE_BLOCK_ALIGN-1);
+		graph->nodeblocks[graph->num_nodeblocks++] = (struct NODE *)mem;
+		graph->nodeblock_used = 0;
+	}
+
+	return &graph->nodeblocks[graph->num_nodeblocks-1][graph->nodeblock_used++];
+}
+
 /* creates a node */
 int node_create(struct NODE **nodeptr, struct GRAPH *graph, const char *filename, struct JOB *job, time_t timestamp)
 {
 	struct NODE *node;
 	struct NODELINK *link;
-	struct NODETREELINK *treelink;
+	unsigned id;
 	hash_t hashid = string_hash_path(filename);
 
 	/* check arguments */
@@ -140,19 +265,19 @@ int node_create(struct NODE **nodeptr, struct GRAPH *graph, const char *filename
 	*nodeptr = (struct NODE *)0x0;
 		
 	/* search for the node */
-	treelink = nodelinktree_find_closest(graph->nodehash[hashid&0xffff], hashid);
-	if(treelink && treelink->node->hashid == hashid)
+	id = hashtable_find(&graph->nodeindex, hashid);
+	if(id != HASHTABLE_NOTFOUND)
 	{
 		/* we are allowed to create a new node from a node that doesn't
 			have a job assigned to it*/
 		/*if(link->node->cmdline || cmdline == NULL)
 			return NODECREATE_EXISTS;*/
-		node = treelink->node;
+		node = node_byid(graph, id);
 	}
 	else
 	{
 		/* allocate and set pointers */
-		node = (struct NODE *)mem_allocate(graph->heap, sizeof(struct NODE));
+		node = node_allocate(graph);
 		
 		node->graph = graph;
 		node->id = graph->num_nodes++;
@@ -162,8 +287,10 @@ int node_create(struct NODE **nodeptr, struct GRAPH *graph, const char *filename
 		node->filename = string_duplicate(graph->heap, filename, node->filename_len);
 		node->hashid = hashid;
 		
-		/* add to hashed tree */
-		nodelinktree_insert(&graph->nodehash[node->hashid&0xffff], treelink, node);
+		/* add to the index, it's kept at most half full */
+		if((unsigned)graph->num_nodes > (graph->nodeindex.mask+1)/2)
+			node_index_create(graph, (graph->nodeindex.mask+1)*2);
+		hashtable_insert(&graph->nodeindex, node->hashid, node->id);
 
 		/* add to list */
 		if(graph->last) graph->last->next = node;
@@ -178,15 +305,22 @@ int node_create(struct NODE **nodeptr, struct GRAPH *graph, const char *filename
 		}
 		else
 		{
-			if(graph->statthread)
+			if(graph->statpool)
 			{
-				/* make sure that the node is written down before we queue it for a stat */
-				sync_barrier();
+				/* queue it and wake a thread if they are waiting */
+				struct STATPOOL *pool = graph->statpool;
+				lock_enter(pool->lock);
 				if(graph->laststatnode)
 					graph->laststatnode->nextstat = node;
 				else
 					graph->firststatnode = node;
-				graph->laststatnode = node;	
+				graph->laststatnode = node;
+				if(!pool->next)
+					pool->next = node;
+				/* waking a thread for every node costs more than the stat */
+				if(++pool->num_queued >= STAT_BATCH && pool->num_waiting)
+					lock_signal(pool->lock);
+				lock_leave(pool->lock);
 			}
 			else
 			{
@@ -226,11 +360,10 @@ int node_create(struct NODE **nodeptr, struct GRAPH *graph, const char *filename
 /* finds a node based apun the filename */
 struct NODE *node_find_byhash(struct GRAPH *graph, hash_t hashid)
 {
-	struct NODETREELINK *link;
-	link = nodelinktree_find_closest(graph->nodehash[hashid&0xffff], hashid);
-	if(link && link->node->hashid == hashid)
-		return link->node;
-	return NULL;
+	unsigned id = hashtable_find(&graph->nodeindex, hashid);
+	if(id == HASHTABLE_NOTFOUND)
+		return NULL;
+	return node_byid(graph, id);
 }
 
 struct NODE *node_find(struct GRAPH *graph, const char *filename)
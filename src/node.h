@@ -7,6 +7,7 @@
 #include <time.h>
 #include "tree.h"
 #include "support.h"
+#include "hashtable.h"
 
 /* */
 struct STRINGLINK
@@ -63,11 +64,22 @@ struct JOB
 	
 	hash_t cmdhash; /* hash of the command line for detecting changes */
 	hash_t cachehash; /* hash that should be written to the cache */
+	hash_t artifactkey; /* key in the artifact cache, 0 if the job isn't looked up there */
 
 	int64 priority; /* the priority is the priority of all jobs dependent on this job */
 
+	/* scheduling, only valid during the build */
+	struct JOB **dependents; /* jobs that has this job as a job dependency */
+	unsigned num_dependents;
+	volatile unsigned num_pending_deps; /* number of dirty job dependencies that isn't finished, updated atomically */
+	unsigned buildorder; /* index in the joblist, used to order jobs with equal priority */
+	unsigned job_num; /* the order that the job was started in, starts at 1 */
+	struct BUFFER *output; /* captured output while the job runs, NULL if it goes directly to stdout */
+
 	unsigned counted:1; /* set if we have counted this job towards the number of targets to build */
 	unsigned cleaned:1; /* set if we have cleaned this job */
+	unsigned cutoff:1; /* set if the job didn't have to run, its inputs turned out to be the same */
+	unsigned restored:1; /* set if the outputs were copied from the artifact cache instead of running the job */
 
 	volatile unsigned status; /* build status of the job, JOBSTATUS_* flags */
 };
@@ -85,16 +97,39 @@ struct CHEADERREF {
 	a node in the dependency graph
 	NOTE: when adding variables to this structure, they will all be set
 		to zero when created by node_create().
-	TODO: these should be allocated cache aligned, and padded to 128 byte?
+	the nodes are allocated after each other in the order of their ids,
+	see NODE_BLOCK_SIZE. the fields that the walks and the build reads for
+	every node comes first so they share a cache line, the rest are only
+	read for some nodes
 */
 struct NODE
 {
+	/* *** */
+	struct JOB *job; /* job that produces this node */
+	struct NODELINK *firstdep; /* list of dependencies */
+	struct NODELINK *firstparent; /* list of parents */
+
+	/* time stamps, 0 == does not exist. */
+	time_t timestamp; /* timestamp. this will be propagated from the deps of the node */
+	time_t timestamp_raw; /* raw timestamp. contains the timestamp on the disc */
+
+	hash_t hashid; /* hash of the filename/nodename */
+
+	unsigned id; /* used when doing traversal with marking (bitarray) */
+
+	/* various flags (4 bytes) */
+	unsigned dirty:8; /* non-zero if the node has to be rebuilt */
+	unsigned depchecked:1; /* set if a dependency checker have processed the file */
+	unsigned targeted:1; /* set if this node is targeted for a build */
+	unsigned cached:1; /* set if the node should be considered as cached */
+	unsigned skipverifyoutput:1; /* set if we don't want to skip the output verification for this output  */
+	unsigned headerscanned:1; /* set if a dependency checker have processed the file */
+	unsigned headerscannedsuccess:1; /* set if a dependency checker have processed the file, and it could be scanned*/
+	unsigned digestuntrusted:1; /* the file changed too recently for the digest to be kept in the cache */
+
 	/* *** */
 	struct GRAPH *graph; /* graph that the node belongs to */
 	struct NODE *next; /* next node in the graph */
-	struct NODELINK *firstparent; /* list of parents */
-	
-	struct NODELINK *firstdep; /* list of dependencies */
 	struct NODETREELINK *deproot; /* tree of dependencies */
 
 	struct NODE * volatile nextstat; /* next node to stat, written by main-thread, read by stat-thread*/
@@ -102,47 +137,42 @@ struct NODE
 	struct NODELINK *constraint_exclusive; /* list of exclusive constraints */
 	struct NODELINK *constraint_shared; /* list of shared constraints */
 	
-	struct JOB *job; /* job that produces this node */
 	const char *filename; /* this contains the filename with the FULLPATH */
-
-	hash_t hashid; /* hash of the filename/nodename */
+	unsigned short filename_len; /* length of filename including zero term */
 
 	/* dependency info */
 	struct CHEADERREF * firstcheaderref;
 	unsigned headerrun;
 	hash_t depcontext;
 
-	/* time stamps, 0 == does not exist. */
-	time_t timestamp; /* timestamp. this will be propagated from the deps of the node */
-	time_t timestamp_raw; /* raw timestamp. contains the timestamp on the disc */
-	
-	unsigned id; /* used when doing traversal with marking (bitarray) */
-	
-	unsigned short filename_len; /* length of filename including zero term */
-	
-	/* various flags (4 bytes in the end) */
-	unsigned dirty:8; /* non-zero if the node has to be rebuilt */
-	unsigned depchecked:1; /* set if a dependency checker have processed the file */
-	unsigned targeted:1; /* set if this node is targeted for a build */
-	unsigned cached:1; /* set if the node should be considered as cached */
-	unsigned skipverifyoutput:1; /* set if we don't want to skip the output verification for this output  */
-	unsigned headerscanned:1; /* set if a dependency checker have processed the file */
-	unsigned headerscannedsuccess:1; /* set if a dependency checker have processed the file, and it could be scanned*/
+	/* content digests, only used with --digest. 0 == unknown */
+	hash_t digest; /* digest of the file */
+	hash_t depdigest; /* digest of all the inputs of the job, written to the output cache */
+	unsigned digestwalk; /* last walk that visited the node when making a depdigest */
 };
 
-/* cache node */
+/* nodes are allocated this many at the time, the block is aligned to a
+	cache line */
+#define NODE_BLOCK_SIZE 1024
+#define NODE_BLOCK_ALIGN 64
+
+/* number of slots in the node index from the start, it's doubled when
+	it gets half full */
+#define NODE_INDEX_SIZE 0x1000
+
+/* the node with the id */
+#define node_byid(graph, id) (&(graph)->nodeblocks[(id)/NODE_BLOCK_SIZE][(id)%NODE_BLOCK_SIZE])
+
+/* cache node, stored as is in the dependency cache file */
 struct CACHEINFO_DEPS
 {
-	RB_ENTRY(CACHEINFO_DEPS) rbentry;
-
 	hash_t hashid;
 	time_t timestamp_raw;
-	char *filename;
 
-	unsigned cached:1;
-	
+	unsigned filename; /* offset into the string table, use depcache_node_filename */
+	unsigned deps; /* offset into the dependency table */
 	unsigned deps_num;
-	unsigned *deps; /* index id, not hashid */
+	unsigned cached;
 };
 
 /* */
@@ -151,6 +181,8 @@ struct CACHEINFO_OUTPUT
 	hash_t hashid;
 	hash_t cmdhash;
 	time_t timestamp;
+	hash_t digest; /* content digest of the file at timestamp, 0 if unknown */
+	hash_t depdigest; /* digest of the inputs that the output was built from, 0 if unknown */
 };
 
 
@@ -158,17 +190,20 @@ struct CACHEINFO_OUTPUT
 struct GRAPH
 {
 	/* nodes */
-	struct NODETREELINK *nodehash[0x10000];
+	struct HASHTABLE nodeindex; /* node ids by hash id, the arrays are in the heap */
 	struct NODE *first;
 	struct NODE *last;
+	struct NODE **nodeblocks; /* the blocks that the nodes are in, see node_byid */
+	unsigned num_nodeblocks;
+	unsigned max_nodeblocks;
+	unsigned nodeblock_used; /* nodes taken from the last block */
 
 	/* jobs */
 	struct JOB *firstjob;
 
 	/* file stating */
-	void *statthread;
-	struct NODE * volatile firststatnode; /* first node that we should stat, written by main-thread, read by stat-thread */
-	struct NODE * volatile finalstatnode; /* the very last node that we should stat, written by main-thread, read by stat-thread */
+	struct STATPOOL *statpool; /* stat threads, only set while the script runs */
+	struct NODE * volatile firststatnode; /* first node that we should stat, written by main-thread, read by stat-threads */
 	struct NODE *laststatnode; /* last node stats to, only read and written by the main-thread */
 
 	/* memory */
@@ -222,8 +257,20 @@ struct CONTEXT;
 
 /* you destroy graphs by destroying the heap */
 struct GRAPH *node_graph_create(struct HEAP *heap);
-void node_graph_start_statthread(struct GRAPH *graph);
-void node_graph_end_statthread(struct GRAPH *graph);
+
+/* starts threads that stats the nodes that are created without a
+	timestamp. the threads sleeps when there is nothing to stat */
+void node_graph_start_statthread(struct GRAPH *graph, int threads);
+
+/* waits for all the nodes to be stated and stops the threads. returns the
+	number of nodes that were stated */
+unsigned node_graph_end_statthread(struct GRAPH *graph);
+
+/* stats all the nodes that were stated when they were created again */
+void node_graph_restat(struct GRAPH *graph);
+
+/* stats a node again, the missing flag is updated */
+void node_restat(struct NODE *node);
 
 /* node jobs */
 struct JOB *node_job_create_null(struct GRAPH *graph);
@@ -0,0 +1,512 @@
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+	#define _GNU_SOURCE /* struct ucred */
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "platform.h"
+#include "server.h"
+#include "session.h"
+
+#ifdef BAM_FAMILY_WINDOWS
+
+int server_listen(const char *path)
+{
+	printf("%s: the build server is not supported on this platform\n", session.name);
+	return -1;
+}
+
+int server_poll(int listenfd, int otherfd) { return 0; }
+int server_accept(int listenfd, struct SERVER_REQUEST *request) { return -1; }
+void server_output_begin(struct SERVER_REQUEST *request) {}
+void server_output_end() {}
+int server_fork(int listenfd, struct SERVER_REQUEST *request) { return -1; }
+int server_wait(int pid) { return 1; }
+int server_poll_build(int pid) { return 1; }
+void server_cancel(int pid) {}
+int server_poll_fd(int fd, int timeout) { return 0; }
+void server_started(struct SERVER_REQUEST *request, int pid) {}
+void server_finish(struct SERVER_REQUEST *request, int exitcode) {}
+int client_run(const char *path, int argc, char **argv) { return -1; }
+
+#else
+
+#include <errno.h>
+#include <poll.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#ifdef MSG_NOSIGNAL
+	#define SEND_FLAGS MSG_NOSIGNAL
+#else
+	#define SEND_FLAGS 0
+#endif
+
+/* the request starts with the size of the arguments and the number of
+	them, the descriptors of the client are sent along with it */
+struct REQUEST_HEADER
+{
+	unsigned size;
+	unsigned argc;
+};
+
+static int write_all(int fd, const void *data, size_t size)
+{
+	const char *p = (const char *)data;
+	ssize_t bytes;
+
+	while(size)
+	{
+		bytes = send(fd, p, size, SEND_FLAGS);
+		if(bytes < 0 && errno == EINTR)
+			continue;
+		if(bytes <= 0)
+			return -1;
+		p += bytes;
+		size -= bytes;
+	}
+	return 0;
+}
+
+static int read_all(int fd, void *data, size_t size)
+{
+	char *p = (char *)data;
+	ssize_t bytes;
+
+	while(size)
+	{
+		bytes = recv(fd, p, size, 0);
+		if(bytes < 0 && errno == EINTR)
+			continue;
+		if(bytes <= 0)
+			return -1;
+		p += bytes;
+		size -= bytes;
+	}
+	return 0;
+}
+
+static int socket_address(const char *path, struct sockaddr_un *addr)
+{
+	if(strlen(path) >= sizeof(addr->sun_path))
+		return -1;
+	memset(addr, 0, sizeof(*addr));
+	addr->sun_family = AF_UNIX;
+	strcpy(addr->sun_path, path);
+	return 0;
+}
+
+static int socket_connect(const char *path)
+{
+	struct sockaddr_un addr;
+	int fd;
+
+	if(socket_address(path, &addr) != 0)
+		return -1;
+
+	fd = socket(AF_UNIX, SOCK_STREAM, 0);
+	if(fd < 0)
+		return -1;
+
+	if(connect(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0)
+	{
+		close(fd);
+		return -1;
+	}
+	return fd;
+}
+
+/* returns 1 if the process on the other end runs as the same user as
+	the server. a request runs the script, so it can do anything the user
+	of the server can */
+static int socket_peer_allowed(int fd)
+{
+#if defined(BAM_PLATFORM_LINUX) || defined(BAM_PLATFORM_CYGWIN)
+	struct ucred cred;
+	socklen_t len = sizeof(cred);
+	if(getsockopt(fd, SOL_SOCKET, SO_PEERCRED, &cred, &len) != 0)
+		return 0;
+	return cred.uid == geteuid();
+#elif defined(BAM_PLATFORM_MACOSX) || defined(BAM_PLATFORM_FREEBSD) || defined(BAM_PLATFORM_OPENBSD) || defined(BAM_PLATFORM_NETBSD)
+	uid_t uid;
+	gid_t gid;
+	if(getpeereid(fd, &uid, &gid) != 0)
+		return 0;
+	return uid == geteuid();
+#else
+	/* no way to ask, the mode of the socket keeps other users out */
+	return 1;
+#endif
+}
+
+int server_listen(const char *path)
+{
+	struct sockaddr_un addr;
+	mode_t oldmask;
+	int error;
+	int fd;
+
+	if(socket_address(path, &addr) != 0)
+	{
+		printf("%s: server socket path '%s' is too long\n", session.name, path);
+		return -1;
+	}
+
+	/* a socket that no one answers on is left from a server that is gone */
+	fd = socket_connect(path);
+	if(fd >= 0)
+	{
+		close(fd);
+		printf("%s: a server is already running in this directory\n", session.name);
+		return -1;
+	}
+	unlink(path);
+
+	/* the socket is made with mode 0600 so only the user can connect */
+	oldmask = umask(0177);
+	fd = socket(AF_UNIX, SOCK_STREAM, 0);
+	error = fd < 0 || bind(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0;
+	umask(oldmask);
+
+	if(error || listen(fd, 16) != 0)
+	{
+		printf("%s: couldn't listen on '%s': %s\n", session.name, path, strerror(errno));
+		if(fd >= 0)
+			close(fd);
+		return -1;
+	}
+
+	return fd;
+}
+
+int server_poll(int listenfd, int otherfd)
+{
+	struct pollfd fds[2];
+
+	fds[0].fd = listenfd;
+	fds[0].events = POLLIN;
+	fds[1].fd = otherfd;
+	fds[1].events = POLLIN;
+
+	while(1)
+	{
+		fds[0].revents = 0;
+		fds[1].revents = 0;
+		if(poll(fds, 2, -1) < 0 && errno != EINTR)
+			return 0;
+		if(fds[0].revents)
+			return 0;
+		if(fds[1].revents)
+			return 1;
+	}
+}
+
+int server_accept(int listenfd, struct SERVER_REQUEST *request)
+{
+	struct REQUEST_HEADER header;
+	struct msghdr msg;
+	struct iovec iov;
+	struct cmsghdr *cmsg;
+	union {
+		struct cmsghdr align;
+		char buffer[CMSG_SPACE(sizeof(int)*3)];
+	} control;
+	ssize_t bytes;
+	char *arg;
+	int i;
+
+	memset(request, 0, sizeof(*request));
+	request->fds[0] = request->fds[1] = request->fds[2] = -1;
+
+	request->fd = accept(listenfd, NULL, NULL);
+	if(request->fd < 0)
+		return -1;
+
+	if(!socket_peer_allowed(request->fd))
+	{
+		printf("%s: refused a build request from another user\n", session.name);
+		fflush(stdout);
+		server_finish(request, 1);
+		return -1;
+	}
+
+	/* the descriptors comes with the header */
+	memset(&msg, 0, sizeof(msg));
+	iov.iov_base = &header;
+	iov.iov_len = sizeof(header);
+	msg.msg_iov = &iov;
+	msg.msg_iovlen = 1;
+	msg.msg_control = control.buffer;
+	msg.msg_controllen = sizeof(control.buffer);
+
+	do
+		bytes = recvmsg(request->fd, &msg, 0);
+	while(bytes < 0 && errno == EINTR);
+
+	cmsg = CMSG_FIRSTHDR(&msg);
+	if(cmsg && cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_RIGHTS && cmsg->cmsg_len == CMSG_LEN(sizeof(int)*3))
+		memcpy(request->fds, CMSG_DATA(cmsg), sizeof(int)*3);
+
+	if(bytes <= 0 || request->fds[0] < 0 ||
+		(bytes < (ssize_t)sizeof(header) && read_all(request->fd, (char *)&header + bytes, sizeof(header) - bytes) != 0) ||
+		header.argc > 1024 || header.size > 1024*1024)
+	{
+		server_finish(request, 1);
+		return -1;
+	}
+
+	request->args = (char *)malloc(header.size + 1);
+	request->argv = (char **)malloc((header.argc + 1) * sizeof(char *));
+	if(read_all(request->fd, request->args, header.size) != 0)
+	{
+		server_finish(request, 1);
+		return -1;
+	}
+	request->args[header.size] = 0;
+
+	/* split up the arguments */
+	arg = request->args;
+	for(i = 0; i < (int)header.argc && arg < request->args + header.size; i++)
+	{
+		request->argv[i] = arg;
+		arg += strlen(arg) + 1;
+	}
+	request->argv[i] = NULL;
+	request->argc = i;
+	return 0;
+}
+
+/* stdout and stderr of the server while the output goes to a client */
+static int server_output[2] = {-1, -1};
+
+void server_output_begin(struct SERVER_REQUEST *request)
+{
+	fflush(stdout);
+	fflush(stderr);
+	server_output[0] = dup(1);
+	server_output[1] = dup(2);
+	dup2(request->fds[1], 1);
+	dup2(request->fds[2], 2);
+}
+
+void server_output_end()
+{
+	fflush(stdout);
+	fflush(stderr);
+	dup2(server_output[0], 1);
+	dup2(server_output[1], 2);
+	close(server_output[0]);
+	close(server_output[1]);
+}
+
+int server_fork(int listenfd, struct SERVER_REQUEST *request)
+{
+	pid_t pid;
+	int i;
+
+	fflush(stdout);
+	fflush(stderr);
+
+	pid = fork();
+	if(pid < 0)
+	{
+		printf("%s: couldn't start the build: %s\n", session.name, strerror(errno));
+		return -1;
+	}
+
+	/* the build and its jobs gets a process group of their own so the
+		client can signal all of them. both sides sets it to avoid a race */
+	setpgid(pid, pid);
+	if(pid != 0 || !request)
+		return (int)pid;
+
+	close(listenfd);
+	close(request->fd);
+	for(i = 0; i < 3; i++)
+	{
+		dup2(request->fds[i], i);
+		close(request->fds[i]);
+	}
+	return 0;
+}
+
+static int exitcode(int status)
+{
+	if(WIFEXITED(status))
+		return WEXITSTATUS(status);
+	return 1;
+}
+
+int server_wait(int pid)
+{
+	int status;
+
+	while(waitpid((pid_t)pid, &status, 0) < 0)
+	{
+		if(errno != EINTR)
+			return 1;
+	}
+
+	return exitcode(status);
+}
+
+int server_poll_build(int pid)
+{
+	int status;
+	pid_t ret = waitpid((pid_t)pid, &status, WNOHANG);
+	if(ret == 0 || (ret < 0 && errno == EINTR))
+		return -1;
+	if(ret < 0)
+		return 1;
+	return exitcode(status);
+}
+
+void server_cancel(int pid)
+{
+	kill(-(pid_t)pid, SIGINT);
+}
+
+int server_poll_fd(int fd, int timeout)
+{
+	struct pollfd pfd;
+	pfd.fd = fd;
+	pfd.events = POLLIN;
+	pfd.revents = 0;
+	return poll(&pfd, 1, timeout) > 0 && pfd.revents;
+}
+
+void server_started(struct SERVER_REQUEST *request, int pid)
+{
+	unsigned value = (unsigned)pid;
+	write_all(request->fd, &value, sizeof(value));
+	request->started = 1;
+}
+
+void server_finish(struct SERVER_REQUEST *request, int exitcode)
+{
+	unsigned value = (unsigned)exitcode;
+	int i;
+
+	if(request->fd >= 0)
+	{
+		/* no build was started */
+		if(!request->started)
+			server_started(request, 0);
+		write_all(request->fd, &value, sizeof(value));
+		close(request->fd);
+	}
+
+	for(i = 0; i < 3; i++)
+	{
+		if(request->fds[i] >= 0)
+			close(request->fds[i]);
+	}
+
+	free(request->args);
+	free(request->argv);
+	memset(request, 0, sizeof(*request));
+	request->fd = -1;
+}
+
+/* process group of the build, signals to the client are passed on to it */
+static volatile pid_t client_buildpid = 0;
+
+static void client_signal(int sig)
+{
+	if(client_buildpid)
+		kill(-client_buildpid, sig);
+}
+
+int client_run(const char *path, int argc, char **argv)
+{
+	struct REQUEST_HEADER header;
+	struct msghdr msg;
+	struct iovec iov;
+	struct cmsghdr *cmsg;
+	union {
+		struct cmsghdr align;
+		char buffer[CMSG_SPACE(sizeof(int)*3)];
+	} control;
+	int fds[3] = {0, 1, 2};
+	unsigned pid;
+	unsigned exitcode;
+	char *args;
+	size_t size = 0;
+	ssize_t bytes;
+	int fd;
+	int i;
+
+	fd = socket_connect(path);
+	if(fd < 0)
+		return -1;
+
+	for(i = 0; i < argc; i++)
+		size += strlen(argv[i]) + 1;
+
+	args = (char *)malloc(size + 1);
+	size = 0;
+	for(i = 0; i < argc; i++)
+	{
+		strcpy(args + size, argv[i]);
+		size += strlen(argv[i]) + 1;
+	}
+
+	header.size = (unsigned)size;
+	header.argc = (unsigned)argc;
+
+	/* send the descriptors with the header */
+	memset(&msg, 0, sizeof(msg));
+	memset(&control, 0, sizeof(control));
+	iov.iov_base = &header;
+	iov.iov_len = sizeof(header);
+	msg.msg_iov = &iov;
+	msg.msg_iovlen = 1;
+	msg.msg_control = control.buffer;
+	msg.msg_controllen = sizeof(control.buffer);
+	cmsg = CMSG_FIRSTHDR(&msg);
+	cmsg->cmsg_level = SOL_SOCKET;
+	cmsg->cmsg_type = SCM_RIGHTS;
+	cmsg->cmsg_len = CMSG_LEN(sizeof(int)*3);
+	memcpy(CMSG_DATA(cmsg), fds, sizeof(int)*3);
+
+	do
+		bytes = sendmsg(fd, &msg, SEND_FLAGS);
+	while(bytes < 0 && errno == EINTR);
+
+	if(bytes != (ssize_t)sizeof(header) || write_all(fd, args, size) != 0)
+	{
+		free(args);
+		close(fd);
+		printf("%s: couldn't send the request to the server\n", session.name);
+		return 1;
+	}
+	free(args);
+
+	/* pass on signals to the build while it runs */
+	if(read_all(fd, &pid, sizeof(pid)) == 0 && pid > 1)
+	{
+		client_buildpid = (pid_t)pid;
+		signal(SIGINT, client_signal);
+		signal(SIGTERM, client_signal);
+		signal(SIGHUP, client_signal);
+	}
+
+	if(read_all(fd, &exitcode, sizeof(exitcode)) != 0)
+	{
+		close(fd);
+		printf("%s: lost the connection to the server\n", session.name);
+		return 1;
+	}
+
+	close(fd);
+	return (int)exitcode;
+}
+
+#endif
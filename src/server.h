@@ -0,0 +1,72 @@
+#ifndef FILE_SERVER_H
+#define FILE_SERVER_H
+
+/*
+	Build server
+	With --server bam keeps the graph from the script in memory and builds
+	when a client asks it to. The client is bam started with --client in
+	the same directory, it connects to the unix socket SERVER_SOCKET and
+	sends its arguments together with its stdin, stdout and stderr so the
+	build writes directly to the terminal of the client. The server
+	answers with the process id of the build, so the client can pass on
+	signals to it, and the exit code when the build is done.
+
+	Not available on Windows.
+*/
+
+#define SERVER_SOCKET ".bam/server"
+
+struct SERVER_REQUEST
+{
+	int fd; /* connection to the client */
+	int fds[3]; /* stdin, stdout and stderr of the client */
+	char *args; /* the arguments after each other, zero terminated */
+	char **argv;
+	int argc;
+	int started; /* the client has been told about the build process */
+};
+
+/* returns the socket to accept clients on, -1 on error. an error has
+	been printed */
+int server_listen(const char *path);
+
+/* waits until a client connects or otherfd becomes readable. returns 1
+	if otherfd is readable, 0 otherwise. otherfd can be -1 */
+int server_poll(int listenfd, int otherfd);
+
+/* waits for a client, returns 0 when a request has been received */
+int server_accept(int listenfd, struct SERVER_REQUEST *request);
+
+/* lets the output go to the client until server_output_end is called */
+void server_output_begin(struct SERVER_REQUEST *request);
+void server_output_end();
+
+/* forks a process for the build with the stdin, stdout and stderr of the
+	client, or of the server if request is NULL. returns 0 in the new
+	process, the process id of it in the server and -1 on error */
+int server_fork(int listenfd, struct SERVER_REQUEST *request);
+
+/* waits for the build process and returns its exit code */
+int server_wait(int pid);
+
+/* returns the exit code of the build process if it's done, -1 if not */
+int server_poll_build(int pid);
+
+/* stops the build process and its jobs like ctrl-c does */
+void server_cancel(int pid);
+
+/* waits at most timeout milliseconds, -1 for no limit, for fd to become
+	readable. returns 1 if it is */
+int server_poll_fd(int fd, int timeout);
+
+/* tells the client which process that does the build */
+void server_started(struct SERVER_REQUEST *request, int pid);
+
+/* sends the exit code to the client and frees the request */
+void server_finish(struct SERVER_REQUEST *request, int exitcode);
+
+/* asks the server to build with the arguments and waits for it. returns
+	the exit code of the build, -1 if there is no server to ask */
+int client_run(const char *path, int argc, char **argv);
+
+#endif
@@ -6,6 +6,8 @@ struct SESSION
 	const char *exe;
 	const char *name;
 	int threads;
+	int async; /* run all jobs from one thread, session.threads sets the number of concurrent jobs */
+	int digest; /* compare the content of the inputs when they are newer than the outputs */
 	int verbose;
 	int simpleoutput;
 	
@@ -19,6 +21,8 @@ struct SESSION
 	int report_color;
 	int report_bar;
 	int report_steps;
+	int capture_output; /* keeps the output of each job together */
+	int ordered_output; /* writes the output of the jobs in the order they were started */
 
 	FILE *eventlog;
 	int eventlogflush;
@@ -5,10 +5,10 @@
 
 #include "statcache.h"
 #include "support.h"
-#include "mem.h"
 #include "path.h"
 
-#define STATCACHE_HASH_SIZE (16*1024)
+#define STATCACHE_INITIAL_SIZE (16*1024)
+#define STATCACHE_BLOCK_ENTRIES 1024
 
 struct STATCACHE_ENTRY
 {
@@ -16,58 +16,227 @@ struct STATCACHE_ENTRY
 	time_t timestamp;
 	unsigned int isregular:1;
 	unsigned int isdir:1;
-	struct STATCACHE_ENTRY* next;
+	volatile unsigned done; /* set when the stat has been done */
+};
+
+/* entries are taken from the current block by bumping a counter, a new
+	block is added under the lock when it is used up */
+struct STATCACHE_BLOCK
+{
+	struct STATCACHE_BLOCK *next;
+	volatile unsigned used;
+	struct STATCACHE_ENTRY entries[STATCACHE_BLOCK_ENTRIES];
+};
+
+/* open addressing, the slots are filled in with compare and swap. when
+	the table gets half full a larger copy replaces it. the old one is kept
+	until the cache is freed since other threads can still be using it */
+struct STATCACHE_TABLE
+{
+	struct STATCACHE_TABLE *old;
+	unsigned mask;
+	volatile unsigned count;
+	volatile unsigned moved; /* set before the copy into a larger table starts */
+	struct STATCACHE_ENTRY * volatile slots[1];
 };
 
 struct STATCACHE
 {
-	struct HEAP* heap;
-	struct STATCACHE_ENTRY* entries[STATCACHE_HASH_SIZE];
+	struct STATCACHE_TABLE * volatile table;
+	struct STATCACHE_BLOCK * volatile block;
+	struct LOCK *lock; /* taken to add a block or to grow the table */
 };
 
+static struct STATCACHE_TABLE *statcache_table_create(unsigned size)
+{
+	struct STATCACHE_TABLE *table = (struct STATCACHE_TABLE *)calloc(1, sizeof(struct STATCACHE_TABLE) + (size-1) * sizeof(struct STATCACHE_ENTRY *));
+	table->mask = size-1;
+	return table;
+}
+
 struct STATCACHE* statcache_create()
 {
 	struct STATCACHE* statcache = malloc(sizeof(struct STATCACHE));
 	memset(statcache, 0, sizeof(struct STATCACHE));
 
-	statcache->heap = mem_create();
+	statcache->table = statcache_table_create(STATCACHE_INITIAL_SIZE);
+	statcache->block = (struct STATCACHE_BLOCK *)calloc(1, sizeof(struct STATCACHE_BLOCK));
+	statcache->lock = lock_create();
 	return statcache;
 }
 
 void statcache_free(struct STATCACHE* statcache)
 {
+	struct STATCACHE_TABLE *table, *oldtable;
+	struct STATCACHE_BLOCK *block, *nextblock;
+
 	if(!statcache)
 		return;
-	mem_destroy(statcache->heap);
+
+	for(table = statcache->table; table; table = oldtable)
+	{
+		oldtable = table->old;
+		free(table);
+	}
+
+	for(block = statcache->block; block; block = nextblock)
+	{
+		nextblock = block->next;
+		free(block);
+	}
+
+	lock_destroy(statcache->lock);
 	free( statcache );
 }
 
-struct STATCACHE_ENTRY* statcache_getstat_int(struct STATCACHE* statcache, const char* filename)
+static struct STATCACHE_ENTRY *statcache_allocate(struct STATCACHE *statcache)
 {
-	hash_t namehash = string_hash_path( filename );
-	int hashindex = namehash & ( STATCACHE_HASH_SIZE - 1 );
+	struct STATCACHE_BLOCK *block;
+	unsigned index;
+
+	while(1)
+	{
+		block = statcache->block;
+		index = atomic_inc(&block->used) - 1;
+		if(index < STATCACHE_BLOCK_ENTRIES)
+			return &block->entries[index];
 
-	struct STATCACHE_ENTRY* entry = NULL;
-	for ( entry = statcache->entries[ hashindex ]; entry; entry = entry->next ) {
-		if ( entry->hashid == namehash ) {
-			break;
+		lock_enter(statcache->lock);
+		if(statcache->block == block)
+		{
+			struct STATCACHE_BLOCK *newblock = (struct STATCACHE_BLOCK *)calloc(1, sizeof(struct STATCACHE_BLOCK));
+			newblock->next = block;
+			sync_barrier();
+			statcache->block = newblock;
 		}
+		lock_leave(statcache->lock);
+	}
+}
+
+/* replaces the table with one that is four times as large. threads that
+	add to the old table while it's copied see the moved flag afterwards
+	and add their entry to the new table as well */
+static void statcache_grow(struct STATCACHE *statcache, struct STATCACHE_TABLE *table)
+{
+	struct STATCACHE_TABLE *newtable;
+	struct STATCACHE_ENTRY *entry;
+	unsigned i, k;
+
+	lock_enter(statcache->lock);
+	if(statcache->table == table)
+	{
+		table->moved = 1;
+		sync_barrier();
+
+		newtable = statcache_table_create((table->mask+1)*4);
+		newtable->old = table;
+		for(i = 0; i <= table->mask; i++)
+		{
+			entry = table->slots[i];
+			if(!entry)
+				continue;
+			for(k = (unsigned)entry->hashid & newtable->mask; newtable->slots[k]; k = (k+1) & newtable->mask)
+				;
+			newtable->slots[k] = entry;
+			newtable->count++;
+		}
+
+		sync_barrier();
+		statcache->table = newtable;
 	}
+	lock_leave(statcache->lock);
+}
+
+/* finds the entry for the file or stats it. if another thread is doing
+	the stat of it we wait for that one instead of doing it again */
+static struct STATCACHE_ENTRY* statcache_getstat_int(struct STATCACHE* statcache, const char* filename)
+{
+	hash_t namehash = string_hash_path( filename );
+	struct STATCACHE_TABLE *table = statcache->table;
+	struct STATCACHE_ENTRY *newentry = NULL;
+	struct STATCACHE_ENTRY *entry;
+	unsigned index = (unsigned)namehash & table->mask;
+	int added = 0; /* set when newentry is in a table that other threads can find it in */
 
-	if ( !entry ) {
-		entry = ( struct STATCACHE_ENTRY* )mem_allocate( statcache->heap, sizeof( struct STATCACHE_ENTRY ) );
-		entry->hashid = namehash;
-		unsigned int isregular = 0;
-		unsigned int isdir = 0;
-		if(file_stat(filename, &entry->timestamp, &isregular, &isdir) == 0)
+	while(1)
+	{
+		entry = table->slots[index];
+		if(!entry)
 		{
-			entry->isregular = isregular;
-			entry->isdir = isdir;
+			/* make sure there is room before adding to it */
+			if(table->count > (table->mask+1)/2)
+			{
+				statcache_grow(statcache, table);
+				table = statcache->table;
+				index = (unsigned)namehash & table->mask;
+				continue;
+			}
+
+			if(!newentry)
+			{
+				newentry = statcache_allocate(statcache);
+				newentry->hashid = namehash;
+			}
+
+			entry = (struct STATCACHE_ENTRY *)atomic_cas_ptr((void * volatile *)&table->slots[index], NULL, newentry);
+			if(!entry)
+			{
+				atomic_inc(&table->count);
+				added = 1;
+
+				/* the table is being copied, the copy might have missed the
+					entry so it's looked up again in the new table once the
+					copy is done */
+				if(table->moved)
+				{
+					lock_enter(statcache->lock);
+					lock_leave(statcache->lock);
+					table = statcache->table;
+					index = (unsigned)namehash & table->mask;
+					continue;
+				}
+
+				entry = newentry;
+			}
 		}
-		entry->next = statcache->entries[ hashindex ];
-		statcache->entries[ hashindex ] = entry;
+
+		if(entry == newentry)
+		{
+			unsigned int isregular = 0;
+			unsigned int isdir = 0;
+			if(file_stat(filename, &newentry->timestamp, &isregular, &isdir) == 0)
+			{
+				newentry->isregular = isregular;
+				newentry->isdir = isdir;
+			}
+			else
+				newentry->timestamp = 0;
+			sync_barrier();
+			newentry->done = 1;
+			return newentry;
+		}
+
+		if(entry->hashid == namehash)
+		{
+			while(!entry->done)
+				threads_yield();
+			sync_barrier();
+
+			/* another thread got into the new table first, threads that
+				found our entry in the old table are waiting for it */
+			if(added)
+			{
+				newentry->timestamp = entry->timestamp;
+				newentry->isregular = entry->isregular;
+				newentry->isdir = entry->isdir;
+				sync_barrier();
+				newentry->done = 1;
+			}
+			return entry;
+		}
+
+		index = (index+1) & table->mask;
 	}
-	return entry;
 }
 
 int statcache_getstat(struct STATCACHE* statcache, const char* filename, time_t* timestamp, int* isregularfile)
@@ -99,3 +268,10 @@ int statcache_getstat(struct STATCACHE* statcache, const char* filename, time_t*
 	*isregularfile = entry->isregular;
 	return 0;
 }
+
+time_t statcache_timestamp(struct STATCACHE* statcache, const char* path)
+{
+	if(!statcache)
+		return file_timestamp(path);
+	return statcache_getstat_int(statcache, path)->timestamp;
+}
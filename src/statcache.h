@@ -4,10 +4,15 @@ struct STATCACHE;
 
 /*
 	Runtime file stat cache
-	So we don't have to stat a file more than once per run.
+	So we don't have to stat a file more than once per run. It can be
+	used from several threads at once, a file that one thread is stating
+	is waited for by the others instead of being stated again.
 */
 
 struct STATCACHE* statcache_create();
 void statcache_free(struct STATCACHE* statcache);
 int statcache_getstat(struct STATCACHE* statcache, const char* filename, time_t* timestamp, int* isregularfile);
 
+/* returns the timestamp of a file or directory, 0 if it doesn't exist */
+time_t statcache_timestamp(struct STATCACHE* statcache, const char* path);
+
@@ -1,9 +1,14 @@
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+	#define _GNU_SOURCE /* pipe2 */
+#endif
+
 #include <string.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <time.h>
 #include <errno.h>
 #include <signal.h>
+#include <stdarg.h>
 
 #include "platform.h"
 #include "path.h"
@@ -16,8 +21,19 @@
     #include <sched.h>
 #endif
 
+#if defined(_MSC_VER) && _MSC_VER < 1900
+	#define vsnprintf _vsnprintf
+#endif
+
+#ifndef va_copy
+	#define va_copy(dst, src) ((dst) = (src))
+#endif
+
 #ifdef BAM_FAMILY_WINDOWS
 	/* windows code */
+	#ifndef _WIN32_WINNT
+		#define _WIN32_WINNT 0x0600 /* condition variables */
+	#endif
 	#define WIN32_LEAN_AND_MEAN
 	#define VC_EXTRALEAN
 	#include <windows.h>
@@ -114,6 +130,13 @@
 	}
 
 	static CRITICAL_SECTION criticalsection;
+	static CRITICAL_SECTION outputsection;
+
+	struct LOCK
+	{
+		CRITICAL_SECTION section;
+		CONDITION_VARIABLE cond;
+	};
 
 
 /* #define BAM_USE_JOBOBJECT */
@@ -229,6 +252,7 @@
 		}
 
 		InitializeCriticalSection(&criticalsection);
+		InitializeCriticalSection(&outputsection);
 	}
 	
 	void platform_shutdown()
@@ -241,10 +265,37 @@
 			ReleaseMutex(singleton_mutex);
 		CloseHandle(singleton_mutex);
 		DeleteCriticalSection(&criticalsection);
+		DeleteCriticalSection(&outputsection);
 	}
 
 	void criticalsection_enter() { EnterCriticalSection(&criticalsection); }
 	void criticalsection_leave() { LeaveCriticalSection(&criticalsection); }
+	void output_enter() { EnterCriticalSection(&outputsection); }
+	void output_leave() { LeaveCriticalSection(&outputsection); }
+
+	struct LOCK *lock_create()
+	{
+		struct LOCK *lock = (struct LOCK *)malloc(sizeof(struct LOCK));
+		InitializeCriticalSection(&lock->section);
+		InitializeConditionVariable(&lock->cond);
+		return lock;
+	}
+
+	void lock_destroy(struct LOCK *lock)
+	{
+		DeleteCriticalSection(&lock->section);
+		free(lock);
+	}
+
+	void lock_enter(struct LOCK *lock) { EnterCriticalSection(&lock->section); }
+	void lock_leave(struct LOCK *lock) { LeaveCriticalSection(&lock->section); }
+	void lock_wait(struct LOCK *lock) { SleepConditionVariableCS(&lock->cond, &lock->section, INFINITE); }
+	void lock_signal(struct LOCK *lock) { WakeConditionVariable(&lock->cond); }
+	void lock_broadcast(struct LOCK *lock) { WakeAllConditionVariable(&lock->cond); }
+
+	unsigned atomic_inc(volatile unsigned *value) { return (unsigned)InterlockedIncrement((volatile LONG *)value); }
+	unsigned atomic_dec(volatile unsigned *value) { return (unsigned)InterlockedDecrement((volatile LONG *)value); }
+	void *atomic_cas_ptr(void * volatile *ptr, void *oldvalue, void *newvalue) { return InterlockedCompareExchangePointer(ptr, newvalue, oldvalue); }
 
 	void *threads_create(void (*threadfunc)(void *), void *u)
 	{
@@ -308,6 +359,8 @@
 	#include <sys/types.h>
 	#include <sys/stat.h>
 	#include <sys/wait.h> 
+	#include <fcntl.h>
+	#include <poll.h>
 	#include <utime.h>
 	#include <pthread.h>
 
@@ -395,11 +448,79 @@
 	}
 
 	static pthread_mutex_t lock_mutex = PTHREAD_MUTEX_INITIALIZER;
+	static pthread_mutex_t output_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+	struct LOCK
+	{
+		pthread_mutex_t mutex;
+		pthread_cond_t cond;
+	};
 
 	void platform_init() {}
 	void platform_shutdown() {}
 	void criticalsection_enter() { pthread_mutex_lock(&lock_mutex); }
 	void criticalsection_leave() { pthread_mutex_unlock(&lock_mutex); }
+	void output_enter() { pthread_mutex_lock(&output_mutex); }
+	void output_leave() { pthread_mutex_unlock(&output_mutex); }
+
+	struct LOCK *lock_create()
+	{
+		struct LOCK *lock = (struct LOCK *)malloc(sizeof(struct LOCK));
+		pthread_mutex_init(&lock->mutex, NULL);
+		pthread_cond_init(&lock->cond, NULL);
+		return lock;
+	}
+
+	void lock_destroy(struct LOCK *lock)
+	{
+		pthread_cond_destroy(&lock->cond);
+		pthread_mutex_destroy(&lock->mutex);
+		free(lock);
+	}
+
+	void lock_enter(struct LOCK *lock) { pthread_mutex_lock(&lock->mutex); }
+	void lock_leave(struct LOCK *lock) { pthread_mutex_unlock(&lock->mutex); }
+	void lock_wait(struct LOCK *lock) { pthread_cond_wait(&lock->cond, &lock->mutex); }
+	void lock_signal(struct LOCK *lock) { pthread_cond_signal(&lock->cond); }
+	void lock_broadcast(struct LOCK *lock) { pthread_cond_broadcast(&lock->cond); }
+
+#ifdef __GNUC__
+	unsigned atomic_inc(volatile unsigned *value) { return __sync_add_and_fetch(value, 1); }
+	unsigned atomic_dec(volatile unsigned *value) { return __sync_sub_and_fetch(value, 1); }
+	void *atomic_cas_ptr(void * volatile *ptr, void *oldvalue, void *newvalue) { return __sync_val_compare_and_swap(ptr, oldvalue, newvalue); }
+#else
+	/* no atomic builtins, fall back on a mutex */
+	static pthread_mutex_t atomic_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+	unsigned atomic_inc(volatile unsigned *value)
+	{
+		unsigned result;
+		pthread_mutex_lock(&atomic_mutex);
+		result = ++(*value);
+		pthread_mutex_unlock(&atomic_mutex);
+		return result;
+	}
+
+	unsigned atomic_dec(volatile unsigned *value)
+	{
+		unsigned result;
+		pthread_mutex_lock(&atomic_mutex);
+		result = --(*value);
+		pthread_mutex_unlock(&atomic_mutex);
+		return result;
+	}
+
+	void *atomic_cas_ptr(void * volatile *ptr, void *oldvalue, void *newvalue)
+	{
+		void *result;
+		pthread_mutex_lock(&atomic_mutex);
+		result = *ptr;
+		if(result == oldvalue)
+			*ptr = newvalue;
+		pthread_mutex_unlock(&atomic_mutex);
+		return result;
+	}
+#endif
 
 	void *threads_create(void (*threadfunc)(void *), void *u)
 	{
@@ -585,6 +706,88 @@ void file_touch(const char *filename)
 #endif
 }
 
+static void buffer_reserve(struct BUFFER *buffer, size_t size)
+{
+	if(buffer->size + size <= buffer->capacity)
+		return;
+
+	if(buffer->capacity == 0)
+		buffer->capacity = 1024*4;
+	while(buffer->size + size > buffer->capacity)
+		buffer->capacity *= 2;
+	buffer->data = (char *)realloc(buffer->data, buffer->capacity);
+}
+
+void buffer_append(struct BUFFER *buffer, const char *data, size_t size)
+{
+	buffer_reserve(buffer, size);
+	memcpy(buffer->data + buffer->size, data, size);
+	buffer->size += size;
+}
+
+void buffer_vprintf(struct BUFFER *buffer, const char *format, va_list args)
+{
+	va_list copy;
+	int len;
+
+	va_copy(copy, args);
+	len = vsnprintf(NULL, 0, format, copy);
+	va_end(copy);
+	if(len < 0)
+		return;
+
+	buffer_reserve(buffer, len+1);
+	vsnprintf(buffer->data + buffer->size, len+1, format, args);
+	buffer->size += len;
+}
+
+void buffer_printf(struct BUFFER *buffer, const char *format, ...)
+{
+	va_list args;
+	va_start(args, format);
+	buffer_vprintf(buffer, format, args);
+	va_end(args);
+}
+
+void buffer_free(struct BUFFER *buffer)
+{
+	free(buffer->data);
+	buffer->data = NULL;
+	buffer->size = 0;
+	buffer->capacity = 0;
+}
+
+/*
+	applies the job filter on the output that was captured from the start
+	offset. a filter that starts with 'F' removes the text if the output
+	starts with it, together with the line ending that follows.
+*/
+static void buffer_filter(struct BUFFER *output, size_t start, const char *filter)
+{
+	char *data = output->data + start;
+	size_t size = output->size - start;
+	size_t len;
+	size_t skip;
+
+	if(!filter || *filter != 'F')
+		return;
+
+	filter++;
+	len = strlen(filter);
+	if(size < len || memcmp(data, filter, len) != 0)
+		return;
+
+	/* this can be CR, CR/LF or LF */
+	skip = len;
+	if(skip < size && data[skip] == '\r')
+		skip++;
+	if(skip < size && data[skip] == '\n')
+		skip++;
+
+	memmove(data, data + skip, size - skip);
+	output->size -= skip;
+}
+
 #ifdef BAM_FAMILY_WINDOWS
 static void passthru(FILE *fp)
 {
@@ -594,22 +797,244 @@ static void passthru(FILE *fp)
 		size_t num_bytes = fread(buffer, 1, sizeof(buffer), fp);
 		if(num_bytes <= 0)
 			break;
-		criticalsection_enter();
+		output_enter();
 		fwrite(buffer, 1, num_bytes, stdout);
-		criticalsection_leave();
+		output_leave();
 	}
 }
 #endif
 
+#ifndef BAM_FAMILY_WINDOWS
+#ifndef BAM_NO_POSIX_SPAWN
+/*
+	jobs are started with posix_spawn instead of system(). system() forks
+	the whole bam process which gets expensive when the node graph is
+	large. commands without any shell syntax are started directly, the
+	rest goes through /bin/sh like system() would do.
+*/
+#include <spawn.h>
+extern char **environ;
+
+/* returns 1 if the command uses anything that only the shell understands */
+static int command_needs_shell(const char *cmd)
+{
+	static const char *builtins[] = {
+		":", ".", "alias", "break", "cd", "command", "continue", "eval", "exec", "exit",
+		"export", "read", "readonly", "return", "set", "shift", "source", "times",
+		"trap", "type", "ulimit", "umask", "unset", "wait", NULL
+	};
+	const char *p;
+	size_t len;
+	int firstword = 1;
+	int i;
+
+	/* shell built-ins doesn't have an executable */
+	while(*cmd == ' ' || *cmd == '\t')
+		cmd++;
+	len = strcspn(cmd, " \t");
+	for(i = 0; builtins[i]; i++)
+	{
+		if(strlen(builtins[i]) == len && memcmp(builtins[i], cmd, len) == 0)
+			return 1;
+	}
+
+	for(p = cmd; *p; p++)
+	{
+		if(*p == ' ' || *p == '\t')
+			firstword = 0;
+		else if(strchr("|&;<>()$`\\\"'*?[]{}#~!%\n\r", *p))
+			return 1;
+		else if(firstword && *p == '=') /* variable assignment */
+			return 1;
+	}
+
+	return 0;
+}
+
+/*
+	starts the command and returns the process id, or -1 if it could not be
+	started. if outputfd isn't -1 it's used as stdout and stderr.
+*/
+static pid_t spawn_command(const char *cmd, int outputfd)
+{
+	char buffer[1024*4];
+	char *argv_buffer[64];
+	char *shell_argv[4];
+	char **argv = argv_buffer;
+	char *args = buffer;
+	size_t len = strlen(cmd);
+	int num_args = 0;
+	pid_t pid = -1;
+	posix_spawn_file_actions_t file_actions;
+	posix_spawn_file_actions_t *actions = NULL;
+	char *p;
+
+	if(outputfd != -1)
+	{
+		posix_spawn_file_actions_init(&file_actions);
+		posix_spawn_file_actions_adddup2(&file_actions, outputfd, 1);
+		posix_spawn_file_actions_adddup2(&file_actions, outputfd, 2);
+		actions = &file_actions;
+	}
+
+	if(!command_needs_shell(cmd))
+	{
+		if(len >= sizeof(buffer) || len/2+2 > sizeof(argv_buffer)/sizeof(char *))
+		{
+			args = (char *)malloc(len+1);
+			argv = (char **)malloc((len/2+2)*sizeof(char *));
+		}
+
+		/* split the command line on white space */
+		memcpy(args, cmd, len+1);
+		for(p = args; *p; )
+		{
+			while(*p == ' ' || *p == '\t')
+				*(p++) = 0;
+			if(*p == 0)
+				break;
+			argv[num_args++] = p;
+			while(*p && *p != ' ' && *p != '\t')
+				p++;
+		}
+		argv[num_args] = NULL;
+
+		/* if the command can't be started directly it might be a shell built-in */
+		if(num_args == 0 || posix_spawnp(&pid, argv[0], actions, NULL, argv, environ) != 0)
+			pid = -1;
+
+		if(args != buffer)
+		{
+			free(args);
+			free(argv);
+		}
+	}
+
+	if(pid == -1)
+	{
+		shell_argv[0] = "/bin/sh";
+		shell_argv[1] = "-c";
+		shell_argv[2] = (char *)cmd;
+		shell_argv[3] = NULL;
+		if(posix_spawn(&pid, shell_argv[0], actions, NULL, shell_argv, environ) != 0)
+			pid = -1;
+	}
+
+	if(actions)
+		posix_spawn_file_actions_destroy(actions);
+	return pid;
+}
+#else
+static pid_t spawn_command(const char *cmd, int outputfd)
+{
+	pid_t pid = fork();
+	if(pid == 0)
+	{
+		if(outputfd != -1)
+		{
+			dup2(outputfd, 1);
+			dup2(outputfd, 2);
+		}
+		execl("/bin/sh", "sh", "-c", cmd, (char *)NULL);
+		_exit(127);
+	}
+	return pid;
+}
+#endif
+
+/* waits for the process to finish and returns the wait status */
+static int spawn_wait(pid_t pid)
+{
+	int status;
+	while(waitpid(pid, &status, 0) == -1)
+	{
+		if(errno != EINTR)
+			return -1;
+	}
+	return status;
+}
+
+/*
+	the pipes that captures the output must be close-on-exec, or commands
+	that are started at the same time on other threads inherits the write
+	end and keeps the pipe open. without pipe2 the pipe creation and the
+	spawning has to be serialized.
+*/
+#if defined(__linux__) && defined(O_CLOEXEC)
+	static int capture_pipe(int fds[2]) { return pipe2(fds, O_CLOEXEC); }
+	static void spawn_lock() {}
+	static void spawn_unlock() {}
+#else
+	static pthread_mutex_t spawn_mutex = PTHREAD_MUTEX_INITIALIZER;
+	static void spawn_lock() { pthread_mutex_lock(&spawn_mutex); }
+	static void spawn_unlock() { pthread_mutex_unlock(&spawn_mutex); }
+
+	static int capture_pipe(int fds[2])
+	{
+		if(pipe(fds) != 0)
+			return -1;
+		fcntl(fds[0], F_SETFD, FD_CLOEXEC);
+		fcntl(fds[1], F_SETFD, FD_CLOEXEC);
+		return 0;
+	}
+#endif
+
+/* starts the command, the output is captured into a pipe if readfd is set */
+static pid_t start_command(const char *cmd, int *readfd)
+{
+	int fds[2];
+	pid_t pid;
+
+	if(!readfd)
+		return spawn_command(cmd, -1);
+
+	spawn_lock();
+	if(capture_pipe(fds) != 0)
+	{
+		spawn_unlock();
+		return -1;
+	}
+
+	pid = spawn_command(cmd, fds[1]);
+	spawn_unlock();
+
+	close(fds[1]);
+	if(pid == -1)
+		close(fds[0]);
+	else
+		*readfd = fds[0];
+	return pid;
+}
+
+/* reads what is available from the pipe, returns 0 at end of file */
+static int read_output(int fd, struct BUFFER *output)
+{
+	ssize_t num_bytes;
+
+	buffer_reserve(output, 1024*4);
+	num_bytes = read(fd, output->data + output->size, output->capacity - output->size);
+	if(num_bytes < 0)
+		return errno == EINTR || errno == EAGAIN ? 1 : 0;
+
+	output->size += num_bytes;
+	return num_bytes > 0;
+}
+#endif
+
 #if !defined(__MINGW32__) && !defined(__MINGW64__) && (defined(BAM_FAMILY_WINDOWS) || defined(BAM_PLATFORM_CYGWIN))
 /* forward declaration */
 FILE *_popen(const char *, const char *);
 int _pclose(FILE *);
 #endif
 
-int run_command(const char *cmd, const char *filter)
+int run_command(const char *cmd, const char *filter, struct BUFFER *output)
 {
+	size_t outputstart = output ? output->size : 0;
 	int ret;
+#ifndef BAM_FAMILY_WINDOWS
+	int fd = -1;
+	pid_t pid;
+#endif
 	
 #ifdef BAM_FAMILY_WINDOWS
 	/* windows has a buggy command line parser. I takes the first and
@@ -640,7 +1065,15 @@ int run_command(const char *cmd, const char *filter)
 	if(!fp)
 		return -1;
 		
-	if(filter && *filter == 'F')
+	if(output)
+	{
+		/* capture everything, the filter is applied afterwards */
+		char buffer[1024*4];
+		size_t num_bytes;
+		while((num_bytes = fread(buffer, 1, sizeof(buffer), fp)) > 0)
+			buffer_append(output, buffer, num_bytes);
+	}
+	else if(filter && *filter == 'F')
 	{
 		/* first filter match */
 		char buffer[1024];
@@ -712,15 +1145,197 @@ int run_command(const char *cmd, const char *filter)
 
 	ret = _pclose(fp);
 #else
-	ret = system(cmd);
+	pid = start_command(cmd, output ? &fd : NULL);
+	if(pid == -1)
+		return -1;
+
+	if(fd != -1)
+	{
+		while(read_output(fd, output))
+			;
+		close(fd);
+	}
+
+	ret = spawn_wait(pid);
 	if(WIFSIGNALED(ret))
 		raise(SIGINT);
 #endif
-	if(session.verbose)
-		printf("%s: ret=%d %s\n", session.name, ret, cmd);
+	if(output)
+		buffer_filter(output, outputstart, filter);
 	return ret;
 }
 
+#ifdef BAM_FAMILY_WINDOWS
+int run_command_start(struct COMMAND *command, const char *cmd, const char *filter, int capture) { return -1; }
+int run_command_wait(struct COMMAND *commands, int num_commands) { return -1; }
+void run_command_kill(struct COMMAND *commands, int num_commands) {}
+#else
+int run_command_start(struct COMMAND *command, const char *cmd, const char *filter, int capture)
+{
+	command->outputfd = -1;
+	command->filter = filter;
+	command->outputstart = command->output.size;
+	command->pid = start_command(cmd, capture ? &command->outputfd : NULL);
+	if(command->pid == -1)
+	{
+		command->pid = 0;
+		return -1;
+	}
+	return 0;
+}
+
+/* called when a command has exited */
+static void command_finished(struct COMMAND *command, int status)
+{
+	command->pid = 0;
+	command->status = status;
+	if(WIFSIGNALED(status))
+		raise(SIGINT);
+	if(command->outputfd != -1)
+	{
+		close(command->outputfd);
+		command->outputfd = -1;
+		buffer_filter(&command->output, command->outputstart, command->filter);
+	}
+}
+
+/* the handler writes to the pipe when a child exits so the wait can poll
+	for it together with the output. waitpid(-1) would reap children that
+	belong to someone else */
+static int childpipe[2] = {-1, -1};
+
+static void child_signal(int sig)
+{
+	int olderrno = errno;
+	char c = 0;
+	if(write(childpipe[1], &c, 1) < 0)
+		; /* the pipe is full, the wait will wake up anyway */
+	errno = olderrno;
+}
+
+static int child_signal_install()
+{
+	struct sigaction action;
+
+	if(childpipe[0] != -1)
+		return 0;
+
+	if(capture_pipe(childpipe) != 0)
+		return -1;
+	fcntl(childpipe[0], F_SETFL, O_NONBLOCK);
+	fcntl(childpipe[1], F_SETFL, O_NONBLOCK);
+
+	memset(&action, 0, sizeof(action));
+	action.sa_handler = child_signal;
+	action.sa_flags = SA_RESTART;
+	sigemptyset(&action.sa_mask);
+	return sigaction(SIGCHLD, &action, NULL);
+}
+
+int run_command_wait(struct COMMAND *commands, int num_commands)
+{
+	struct pollfd *fds;
+	int *indices;
+	int num_fds;
+	int status;
+	char drain[64];
+	int i, f;
+
+	if(child_signal_install() != 0)
+		return -1;
+
+	fds = (struct pollfd *)malloc((num_commands+1) * sizeof(struct pollfd));
+	indices = (int *)malloc((num_commands+1) * sizeof(int));
+
+	while(1)
+	{
+		/* commands without captured output are done when they have exited,
+			the others when the output is closed */
+		num_fds = 0;
+		for(i = 0; i < num_commands; i++)
+		{
+			if(commands[i].pid == 0)
+				continue;
+
+			if(commands[i].outputfd == -1)
+			{
+				if(waitpid(commands[i].pid, &status, WNOHANG) == commands[i].pid)
+				{
+					command_finished(&commands[i], status);
+					free(fds);
+					free(indices);
+					return i;
+				}
+				continue;
+			}
+
+			fds[num_fds].fd = commands[i].outputfd;
+			fds[num_fds].events = POLLIN;
+			fds[num_fds].revents = 0;
+			indices[num_fds] = i;
+			num_fds++;
+		}
+
+		fds[num_fds].fd = childpipe[0];
+		fds[num_fds].events = POLLIN;
+		fds[num_fds].revents = 0;
+
+		if(poll(fds, num_fds+1, -1) < 0)
+		{
+			if(errno == EINTR)
+				continue;
+			break;
+		}
+
+		/* a child has exited, check the pids again */
+		if(fds[num_fds].revents)
+		{
+			while(read(childpipe[0], drain, sizeof(drain)) > 0)
+				;
+		}
+
+		for(f = 0; f < num_fds; f++)
+		{
+			if(fds[f].revents == 0)
+				continue;
+
+			i = indices[f];
+			if(read_output(commands[i].outputfd, &commands[i].output))
+				continue;
+
+			/* end of output, the process is done or about to be */
+			command_finished(&commands[i], spawn_wait(commands[i].pid));
+			free(fds);
+			free(indices);
+			return i;
+		}
+	}
+
+	free(fds);
+	free(indices);
+	return -1;
+}
+
+void run_command_kill(struct COMMAND *commands, int num_commands)
+{
+	int i;
+	for(i = 0; i < num_commands; i++)
+	{
+		if(commands[i].pid == 0)
+			continue;
+		kill(commands[i].pid, SIGTERM);
+		if(commands[i].outputfd != -1)
+		{
+			close(commands[i].outputfd);
+			commands[i].outputfd = -1;
+		}
+		spawn_wait(commands[i].pid);
+		commands[i].pid = 0;
+		commands[i].status = -1;
+	}
+}
+#endif
+
 /* like file_createdir, but automatically creates all top-level directories needed
 	If you feed it "output/somefiles/output.o" it will create "output/somefiles"
 */	
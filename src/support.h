@@ -2,6 +2,8 @@
 #define FILE_SUPPORT_H
 
 #include <time.h> /* time_t */
+#include <stddef.h> /* size_t */
+#include <stdarg.h> /* va_list */
 
 /* types */ 
 #ifdef __GNUC__
@@ -42,7 +44,46 @@ struct STRINGLIST
 
 /* */
 void install_signals(void (*abortsignal)(int));
-int run_command(const char *cmd, const char *filter);
+
+/* growable buffer */
+struct BUFFER
+{
+	char *data;
+	size_t size;
+	size_t capacity;
+};
+
+void buffer_append(struct BUFFER *buffer, const char *data, size_t size);
+void buffer_vprintf(struct BUFFER *buffer, const char *format, va_list args);
+void buffer_printf(struct BUFFER *buffer, const char *format, ...);
+void buffer_free(struct BUFFER *buffer);
+
+/* runs the command. if output is set, stdout and stderr are captured into it and the filter is applied */
+int run_command(const char *cmd, const char *filter, struct BUFFER *output);
+
+/* a command that is started with run_command_start */
+struct COMMAND
+{
+	int pid; /* zero when not running */
+	int outputfd;
+	int status; /* same as the return value of run_command */
+	const char *filter;
+	struct BUFFER output;
+	size_t outputstart; /* where the output of the command starts in the buffer */
+};
+
+/*
+	starts a command without waiting for it, returns 0 on success.
+	run_command_wait waits for any of the started commands to finish,
+	captures their output meanwhile and returns the index of the command
+	that finished. not available on windows.
+*/
+int run_command_start(struct COMMAND *command, const char *cmd, const char *filter, int capture);
+int run_command_wait(struct COMMAND *commands, int num_commands);
+
+/* stops the commands that are still running and waits for them, their
+	status is set to -1 */
+void run_command_kill(struct COMMAND *commands, int num_commands);
 
 void platform_init();
 void platform_shutdown();
@@ -54,9 +95,33 @@ void threads_sleep(int milliseconds);
 void threads_yield();
 int threads_corecount();
 
+/* global lock for the node graph */
 void criticalsection_enter();
 void criticalsection_leave();
 
+/* lock that serializes everything that is written to stdout during the build */
+void output_enter();
+void output_leave();
+
+/* locks with a condition variable */
+struct LOCK;
+struct LOCK *lock_create();
+void lock_destroy(struct LOCK *lock);
+void lock_enter(struct LOCK *lock);
+void lock_leave(struct LOCK *lock);
+
+/* waits for a signal, the lock must be held and is held again on return */
+void lock_wait(struct LOCK *lock);
+void lock_signal(struct LOCK *lock);
+void lock_broadcast(struct LOCK *lock);
+
+/* atomic increment and decrement, returns the new value */
+unsigned atomic_inc(volatile unsigned *value);
+unsigned atomic_dec(volatile unsigned *value);
+
+/* sets *ptr to newvalue if it is oldvalue, returns what *ptr was */
+void *atomic_cas_ptr(void * volatile *ptr, void *oldvalue, void *newvalue);
+
 /* time */
 int64 time_get();
 int64 time_freq();
@@ -0,0 +1,148 @@
+/*
+	Benchmark for the lookups done by the caches. Compares the red-black
+	tree and the sorted array with binary search that the caches used to
+	use with the hash table they use now.
+
+	Build and run:
+	cc -O2 -Isrc src/tools/bench_lookup.c src/hashtable.c -o src/tools/bench_lookup
+	src/tools/bench_lookup [entries ...]
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "tree.h"
+#include "hashtable.h"
+
+struct ENTRY
+{
+	RB_ENTRY(ENTRY) rbentry;
+	hash_t hashid;
+};
+
+static int entry_cmp(struct ENTRY *a, struct ENTRY *b)
+{
+	if(a->hashid > b->hashid) return 1;
+	if(a->hashid < b->hashid) return -1;
+	return 0;
+}
+
+static int hash_compare(const void *a, const void *b)
+{
+	hash_t hash_a = *(const hash_t *)a;
+	hash_t hash_b = *(const hash_t *)b;
+	if(hash_a > hash_b) return 1;
+	if(hash_a < hash_b) return -1;
+	return 0;
+}
+
+RB_HEAD(ENTRY_RB, ENTRY);
+RB_GENERATE_INTERNAL(ENTRY_RB, ENTRY, rbentry, entry_cmp, static)
+
+void ENTRY_FUNCTIONREMOVER() /* this is just to get it not to complain about unused static functions */
+{
+	(void)ENTRY_RB_RB_REMOVE; (void)ENTRY_RB_RB_NFIND; (void)ENTRY_RB_RB_MINMAX;
+	(void)ENTRY_RB_RB_NEXT; (void)ENTRY_RB_RB_PREV;
+}
+
+/* splitmix64, gives well distributed hashes like the real ones */
+static hash_t random_hash(hash_t *state)
+{
+	hash_t z = (*state += 0x9e3779b97f4a7c15ULL);
+	z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+	return z ^ (z >> 31);
+}
+
+static double timer()
+{
+	return clock() / (double)CLOCKS_PER_SEC;
+}
+
+static void report(const char *name, unsigned num, unsigned found, double time)
+{
+	printf("%-12s %8u entries %12.0f lookups/s (%u found)\n", name, num, num / time, found);
+}
+
+static void bench(unsigned num)
+{
+	struct ENTRY *entries = (struct ENTRY *)malloc(num * sizeof(struct ENTRY));
+	hash_t *sorted = (hash_t *)malloc(num * sizeof(hash_t));
+	hash_t *lookups = (hash_t *)malloc(num * sizeof(hash_t));
+	struct ENTRY_RB tree;
+	struct HASHTABLE table;
+	struct ENTRY tempentry;
+	hash_t state = 1;
+	unsigned found;
+	unsigned i;
+	double start;
+
+	/* every other lookup is for an entry that doesn't exist */
+	for(i = 0; i < num; i++)
+	{
+		entries[i].hashid = random_hash(&state);
+		sorted[i] = entries[i].hashid;
+	}
+	for(i = 0; i < num; i++)
+		lookups[i] = (i&1) ? random_hash(&state) : entries[(i * 7919) % num].hashid;
+
+	/* red-black tree */
+	RB_INIT(&tree);
+	for(i = 0; i < num; i++)
+		RB_INSERT(ENTRY_RB, &tree, &entries[i]);
+
+	start = timer();
+	found = 0;
+	for(i = 0; i < num; i++)
+	{
+		tempentry.hashid = lookups[i];
+		if(RB_FIND(ENTRY_RB, &tree, &tempentry))
+			found++;
+	}
+	report("rbtree", num, found, timer() - start);
+
+	/* sorted array */
+	qsort(sorted, num, sizeof(hash_t), hash_compare);
+
+	start = timer();
+	found = 0;
+	for(i = 0; i < num; i++)
+	{
+		if(bsearch(&lookups[i], sorted, num, sizeof(hash_t), hash_compare))
+			found++;
+	}
+	report("binsearch", num, found, timer() - start);
+
+	/* hash table */
+	hashtable_create(&table, num);
+	for(i = 0; i < num; i++)
+		hashtable_insert(&table, entries[i].hashid, i);
+
+	start = timer();
+	found = 0;
+	for(i = 0; i < num; i++)
+	{
+		if(hashtable_find(&table, lookups[i]) != HASHTABLE_NOTFOUND)
+			found++;
+	}
+	report("hashtable", num, found, timer() - start);
+
+	hashtable_destroy(&table);
+	free(entries);
+	free(sorted);
+	free(lookups);
+}
+
+int main(int argc, char **argv)
+{
+	int i;
+	if(argc < 2)
+	{
+		bench(100000);
+		bench(1000000);
+	}
+
+	for(i = 1; i < argc; i++)
+		bench((unsigned)atoi(argv[i]));
+	return 0;
+}
@@ -0,0 +1,145 @@
+/*
+	Stress test for the stat cache. A number of threads looks up the
+	same paths in different orders while the table grows, and the test
+	fails if a path is stated more than once or if a lookup gets the
+	wrong result.
+
+	The file system and the thread primitives that the stat cache uses
+	from support.c are replaced here. The stat only counts and returns a
+	timestamp made from the path, and the atomic increment done when an
+	entry is allocated is slowed down to make the threads add entries
+	while the table is being copied.
+
+	Build and run:
+	cc -O2 -Isrc src/tools/stress_statcache.c src/statcache.c -lpthread -o src/tools/stress_statcache
+	src/tools/stress_statcache [paths] [threads]
+*/
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "support.h"
+#include "path.h"
+#include "statcache.h"
+
+#define MAX_THREADS 64
+
+struct LOCK
+{
+	pthread_mutex_t mutex;
+};
+
+static volatile unsigned num_stats = 0;
+static unsigned num_paths = 200000;
+static int num_threads = 8;
+static volatile int failed = 0;
+static struct STATCACHE *statcache;
+
+struct LOCK *lock_create()
+{
+	struct LOCK *lock = (struct LOCK *)malloc(sizeof(struct LOCK));
+	pthread_mutex_init(&lock->mutex, NULL);
+	return lock;
+}
+
+void lock_destroy(struct LOCK *lock)
+{
+	pthread_mutex_destroy(&lock->mutex);
+	free(lock);
+}
+
+void lock_enter(struct LOCK *lock) { pthread_mutex_lock(&lock->mutex); }
+void lock_leave(struct LOCK *lock) { pthread_mutex_unlock(&lock->mutex); }
+void threads_yield() { sched_yield(); }
+
+unsigned atomic_inc(volatile unsigned *value)
+{
+	volatile int i;
+	for(i = 0; i < 200; i++)
+		;
+	return __sync_add_and_fetch(value, 1);
+}
+
+void *atomic_cas_ptr(void * volatile *ptr, void *oldvalue, void *newvalue)
+{
+	return __sync_val_compare_and_swap(ptr, oldvalue, newvalue);
+}
+
+int file_stat(const char *filename, time_t *stamp, unsigned int *isregular, unsigned int *isdir)
+{
+	__sync_add_and_fetch(&num_stats, 1);
+	*stamp = (time_t)atoi(filename + 1) + 1;
+	*isregular = 1;
+	*isdir = 0;
+	return 0;
+}
+
+time_t file_timestamp(const char *filename) { return 0; }
+
+hash_t string_hash_path(const char *str)
+{
+	hash_t h = 5381;
+	for(; *str; str++)
+		h = (h * 33) ^ (hash_t)*str;
+	return h;
+}
+
+int path_directory(const char *path, char *directory, int size)
+{
+	directory[0] = 0;
+	return 0;
+}
+
+static void *stress_thread(void *u)
+{
+	unsigned offset = (unsigned)(size_t)u;
+	unsigned i, n;
+	char path[32];
+	time_t timestamp;
+	int isregular;
+
+	for(i = 0; i < num_paths && !failed; i++)
+	{
+		n = (unsigned)(((unsigned long long)i * 7919 + offset * 104729) % num_paths);
+		sprintf(path, "f%u", n);
+		statcache_getstat(statcache, path, &timestamp, &isregular);
+		if(timestamp != (time_t)n + 1 || !isregular)
+		{
+			printf("wrong result for '%s'\n", path);
+			failed = 1;
+		}
+	}
+	return NULL;
+}
+
+int main(int argc, char **argv)
+{
+	pthread_t threads[MAX_THREADS];
+	int i;
+
+	if(argc > 1)
+		num_paths = (unsigned)atoi(argv[1]);
+	if(argc > 2)
+		num_threads = atoi(argv[2]);
+	if(num_paths == 0 || num_threads < 1 || num_threads > MAX_THREADS)
+	{
+		printf("usage: %s [paths] [threads]\n", argv[0]);
+		return 1;
+	}
+
+	statcache = statcache_create();
+	for(i = 0; i < num_threads; i++)
+		pthread_create(&threads[i], NULL, stress_thread, (void *)(size_t)i);
+	for(i = 0; i < num_threads; i++)
+		pthread_join(threads[i], NULL);
+	statcache_free(statcache);
+
+	printf("%u paths, %d threads, %u stats\n", num_paths, num_threads, num_stats);
+	if(failed || num_stats != num_paths)
+	{
+		printf("stat cache stress test failed\n");
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,425 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "platform.h"
+#include "watch.h"
+
+#ifndef BAM_PLATFORM_LINUX
+
+struct WATCHER *watcher_create(struct GRAPH *graph) { return NULL; }
+void watcher_destroy(struct WATCHER *watcher) {}
+void watcher_add_file(struct WATCHER *watcher, const char *path) {}
+int watcher_fd(struct WATCHER *watcher) { return -1; }
+unsigned watcher_update(struct WATCHER *watcher) { return 0; }
+int watcher_listing_changed(struct WATCHER *watcher) { return 0; }
+
+#else
+
+#include <errno.h>
+#include <unistd.h>
+#include <sys/inotify.h>
+
+#include "hashtable.h"
+#include "mem.h"
+#include "node.h"
+#include "path.h"
+#include "support.h"
+
+/* IN_MODIFY is left out, it comes for every write. the file is stated
+	when it's closed instead */
+#define WATCH_MASK (IN_CLOSE_WRITE|IN_ATTRIB|IN_CREATE|IN_DELETE|IN_MOVED_FROM|IN_MOVED_TO|IN_DELETE_SELF|IN_MOVE_SELF|IN_ONLYDIR)
+
+struct WATCHER
+{
+	int fd;
+	struct GRAPH *graph;
+	int listing_changed; /* see watcher_listing_changed */
+
+	/* nodes that were stated when they were created, by hash id */
+	struct NODE **nodes;
+	unsigned num_nodes;
+	struct HASHTABLE nodetable;
+
+	/* other files that are watched, by hash id */
+	struct HEAP *fileheap;
+	const char **files;
+	unsigned num_files;
+	unsigned max_files;
+	struct HASHTABLE filetable;
+
+	/* watched directories, by the hash of the path and by watch descriptor */
+	struct HEAP *heap;
+	struct HASHTABLE dirtable;
+	unsigned num_watched;
+	char **directories;
+	unsigned num_directories;
+
+	/* nodes in directories that couldn't be watched */
+	struct NODE **unwatched;
+	unsigned num_unwatched;
+};
+
+/* the directory of a file, "" is the current directory */
+static void file_directory(const char *filename, char *directory, int size)
+{
+	if(path_directory(filename, directory, size) != 0)
+		directory[0] = 0;
+}
+
+/* returns the watch descriptor of the directory, -1 if it can't be watched */
+static int watch_directory(struct WATCHER *watcher, const char *directory)
+{
+	hash_t hashid = string_hash_path(directory);
+	unsigned found = hashtable_find(&watcher->dirtable, hashid);
+	int wd;
+
+	if(found != HASHTABLE_NOTFOUND)
+		return (int)found;
+
+	if(watcher->fd < 0)
+		return -1;
+
+	wd = inotify_add_watch(watcher->fd, directory[0] ? directory : ".", WATCH_MASK);
+	if(wd < 0)
+		return -1;
+
+	/* descriptors are handed out in order so the array stays small */
+	if((unsigned)wd >= watcher->num_directories)
+	{
+		unsigned num = watcher->num_directories ? watcher->num_directories : 64;
+		while(num <= (unsigned)wd)
+			num *= 2;
+		watcher->directories = (char **)realloc(watcher->directories, num * sizeof(char *));
+		memset(watcher->directories + watcher->num_directories, 0, (num - watcher->num_directories) * sizeof(char *));
+		watcher->num_directories = num;
+	}
+
+	/* the table is made larger when it gets half full */
+	if(++watcher->num_watched > (watcher->dirtable.mask + 1) / 2)
+	{
+		struct HASHTABLE old = watcher->dirtable;
+		unsigned i;
+		hashtable_create(&watcher->dirtable, watcher->num_watched * 2);
+		for(i = 0; i <= old.mask; i++)
+		{
+			if(old.keys[i])
+				hashtable_insert(&watcher->dirtable, old.keys[i], old.values[i]);
+		}
+		if(old.zero)
+			hashtable_insert(&watcher->dirtable, 0, old.zero - 1);
+		hashtable_destroy(&old);
+	}
+
+	watcher->directories[wd] = string_duplicate(watcher->heap, directory, strlen(directory));
+	hashtable_insert(&watcher->dirtable, hashid, (unsigned)wd);
+	return wd;
+}
+
+/* watches the directory that a node is in */
+static int watch_node(struct WATCHER *watcher, struct NODE *node)
+{
+	char directory[MAX_PATH_LENGTH];
+	file_directory(node->filename, directory, sizeof(directory));
+	return watch_directory(watcher, directory);
+}
+
+/* watches the directory of a file, or the directory itself */
+static int watch_file(struct WATCHER *watcher, const char *path)
+{
+	char directory[MAX_PATH_LENGTH];
+
+	if(path[0] == 0 || file_isdir(path))
+		return watch_directory(watcher, path);
+
+	file_directory(path, directory, sizeof(directory));
+	return watch_directory(watcher, directory);
+}
+
+static void watcher_clear(struct WATCHER *watcher)
+{
+	if(watcher->fd >= 0)
+		close(watcher->fd);
+	watcher->fd = -1;
+
+	if(watcher->heap)
+		mem_destroy(watcher->heap);
+	watcher->heap = NULL;
+	free(watcher->directories);
+	watcher->directories = NULL;
+	watcher->num_directories = 0;
+	watcher->num_watched = 0;
+
+	hashtable_destroy(&watcher->dirtable);
+	watcher->num_unwatched = 0;
+}
+
+/* watches all the directories from the start */
+static int watcher_watch_all(struct WATCHER *watcher)
+{
+	unsigned i;
+
+	watcher_clear(watcher);
+	watcher->fd = inotify_init1(IN_NONBLOCK|IN_CLOEXEC);
+	if(watcher->fd < 0)
+		return -1;
+
+	watcher->heap = mem_create();
+	hashtable_create(&watcher->dirtable, 64);
+	for(i = 0; i < watcher->num_nodes; i++)
+	{
+		if(watch_node(watcher, watcher->nodes[i]) < 0)
+			watcher->unwatched[watcher->num_unwatched++] = watcher->nodes[i];
+	}
+
+	for(i = 0; i < watcher->num_files; i++)
+		watch_file(watcher, watcher->files[i]);
+
+	return 0;
+}
+
+static void watcher_restat_all(struct WATCHER *watcher)
+{
+	unsigned i;
+	for(i = 0; i < watcher->num_nodes; i++)
+		node_restat(watcher->nodes[i]);
+}
+
+struct WATCHER *watcher_create(struct GRAPH *graph)
+{
+	struct WATCHER *watcher;
+	struct NODE *node;
+	unsigned i;
+
+	watcher = (struct WATCHER *)malloc(sizeof(struct WATCHER));
+	memset(watcher, 0, sizeof(struct WATCHER));
+	watcher->fd = -1;
+	watcher->graph = graph;
+	watcher->fileheap = mem_create();
+
+	if(graph)
+	{
+		for(node = graph->firststatnode; node; node = node->nextstat)
+			watcher->num_nodes++;
+	}
+
+	watcher->nodes = (struct NODE **)malloc(watcher->num_nodes * sizeof(struct NODE *) + 1);
+	watcher->unwatched = (struct NODE **)malloc(watcher->num_nodes * sizeof(struct NODE *) + 1);
+	hashtable_create(&watcher->nodetable, watcher->num_nodes);
+	hashtable_create(&watcher->filetable, 0);
+
+	if(graph)
+	{
+		for(i = 0, node = graph->firststatnode; node; node = node->nextstat, i++)
+		{
+			watcher->nodes[i] = node;
+			hashtable_insert(&watcher->nodetable, node->hashid, i);
+		}
+	}
+
+	if(watcher_watch_all(watcher) != 0)
+	{
+		watcher_destroy(watcher);
+		return NULL;
+	}
+
+	watcher_restat_all(watcher);
+	return watcher;
+}
+
+void watcher_destroy(struct WATCHER *watcher)
+{
+	if(!watcher)
+		return;
+	watcher_clear(watcher);
+	hashtable_destroy(&watcher->nodetable);
+	hashtable_destroy(&watcher->filetable);
+	mem_destroy(watcher->fileheap);
+	free(watcher->nodes);
+	free(watcher->unwatched);
+	free(watcher->files);
+	free(watcher);
+}
+
+void watcher_add_file(struct WATCHER *watcher, const char *path)
+{
+	hash_t hashid;
+	unsigned i;
+
+	if(strcmp(path, ".") == 0)
+		path = "";
+
+	hashid = string_hash_path(path);
+	if(hashtable_find(&watcher->nodetable, hashid) != HASHTABLE_NOTFOUND)
+		return;
+	if(hashtable_find(&watcher->filetable, hashid) != HASHTABLE_NOTFOUND)
+		return;
+
+	if(watcher->num_files == watcher->max_files)
+	{
+		watcher->max_files = watcher->max_files ? watcher->max_files * 2 : 64;
+		watcher->files = (const char **)realloc(watcher->files, watcher->max_files * sizeof(const char *));
+
+		hashtable_destroy(&watcher->filetable);
+		hashtable_create(&watcher->filetable, watcher->max_files);
+		for(i = 0; i < watcher->num_files; i++)
+			hashtable_insert(&watcher->filetable, string_hash_path(watcher->files[i]), i);
+	}
+
+	watcher->files[watcher->num_files] = string_duplicate(watcher->fileheap, path, strlen(path));
+	hashtable_insert(&watcher->filetable, hashid, watcher->num_files);
+	watcher->num_files++;
+
+	watch_file(watcher, path);
+}
+
+int watcher_fd(struct WATCHER *watcher)
+{
+	return watcher->fd;
+}
+
+/* stats the node of the path if there is one, returns 1 if the path is
+	something the build reads from */
+static int watcher_changed(struct WATCHER *watcher, hash_t hashid)
+{
+	unsigned found = hashtable_find(&watcher->nodetable, hashid);
+	if(found != HASHTABLE_NOTFOUND)
+	{
+		struct NODE *node = watcher->nodes[found];
+		node_restat(node);
+		return !node->job->cmdline;
+	}
+
+	return hashtable_find(&watcher->filetable, hashid) != HASHTABLE_NOTFOUND;
+}
+
+/* returns 1 if the path is the output of a job */
+static int watcher_isoutput(struct WATCHER *watcher, hash_t hashid)
+{
+	struct NODE *node;
+	if(!watcher->graph)
+		return 0;
+	node = node_find_byhash(watcher->graph, hashid);
+	return node && node->job->cmdline;
+}
+
+/* an entry in a directory was added, removed or renamed. the build
+	writes its outputs next to the inputs so those are left out, otherwise
+	every build would start the next one */
+static unsigned watcher_entry_changed(struct WATCHER *watcher, hash_t directory, hash_t hashid)
+{
+	unsigned num_changed;
+
+	if(watcher_isoutput(watcher, hashid))
+	{
+		unsigned found = hashtable_find(&watcher->nodetable, directory);
+		if(found != HASHTABLE_NOTFOUND)
+			node_restat(watcher->nodes[found]);
+		return 0;
+	}
+
+	num_changed = watcher_changed(watcher, directory);
+	if(hashtable_find(&watcher->filetable, directory) != HASHTABLE_NOTFOUND)
+		watcher->listing_changed = 1;
+	return num_changed;
+}
+
+int watcher_listing_changed(struct WATCHER *watcher)
+{
+	int changed = watcher->listing_changed;
+	watcher->listing_changed = 0;
+	return changed;
+}
+
+unsigned watcher_update(struct WATCHER *watcher)
+{
+	union {
+		struct inotify_event align;
+		char buffer[16*1024];
+	} events;
+	char path[MAX_PATH_LENGTH];
+	struct inotify_event *event;
+	const char *directory;
+	hash_t hashid;
+	unsigned num_changed = 0;
+	int lost = 0;
+	ssize_t bytes;
+	char *p;
+	unsigned i;
+
+	while(!lost)
+	{
+		bytes = read(watcher->fd, events.buffer, sizeof(events.buffer));
+		if(bytes < 0 && errno == EINTR)
+			continue;
+		if(bytes < 0 && errno == EAGAIN)
+			break;
+		if(bytes <= 0)
+		{
+			lost = 1;
+			break;
+		}
+
+		for(p = events.buffer; p < events.buffer + bytes; p += sizeof(struct inotify_event) + event->len)
+		{
+			event = (struct inotify_event *)p;
+
+			/* the watch is gone and the changes in the directory with it */
+			if(event->mask & (IN_Q_OVERFLOW|IN_IGNORED|IN_DELETE_SELF|IN_MOVE_SELF|IN_UNMOUNT))
+			{
+				lost = 1;
+				break;
+			}
+
+			if(!event->len || event->wd < 0 || (unsigned)event->wd >= watcher->num_directories || !watcher->directories[event->wd])
+				continue;
+
+			directory = watcher->directories[event->wd];
+			if(directory[0])
+			{
+				if(path_join(directory, -1, event->name, -1, path, sizeof(path)) != 0)
+					continue;
+				hashid = string_hash_path(path);
+			}
+			else
+				hashid = string_hash_path(event->name);
+
+			/* the timestamp of the directory changes with its entries */
+			if(event->mask & (IN_CREATE|IN_DELETE|IN_MOVED_FROM|IN_MOVED_TO))
+				num_changed += watcher_entry_changed(watcher, string_hash_path(directory), hashid);
+
+			num_changed += watcher_changed(watcher, hashid);
+		}
+	}
+
+	/* without watches everything is stated every time, the watches are
+		tried again on the next update */
+	if(lost)
+	{
+		watcher_watch_all(watcher);
+		watcher_restat_all(watcher);
+		watcher->listing_changed = 1;
+		return watcher->num_nodes + watcher->num_files;
+	}
+
+	/* try to watch the directories that couldn't be watched, they could
+		have been created by the last build. the node is stated after the
+		watch is in place so no change is lost */
+	for(i = 0; i < watcher->num_unwatched;)
+	{
+		struct NODE *node = watcher->unwatched[i];
+		time_t timestamp = node->timestamp_raw;
+
+		if(watch_node(watcher, node) >= 0)
+			watcher->unwatched[i] = watcher->unwatched[--watcher->num_unwatched];
+		else
+			i++;
+
+		node_restat(node);
+		if(node->timestamp_raw != timestamp && !node->job->cmdline)
+			num_changed++;
+	}
+
+	return num_changed;
+}
+
+#endif
@@ -0,0 +1,50 @@
+#ifndef FILE_WATCH_H
+#define FILE_WATCH_H
+
+struct GRAPH;
+struct WATCHER;
+
+/*
+	File change tracking
+	Keeps track of which of the files in the graph that has changed so the
+	build server and --watch only has to stat those before a build, the
+	rest keeps the timestamps it already has. The directories of the nodes
+	that were stated when they were created are watched with inotify.
+	Nodes in directories that can't be watched, for example output
+	directories that doesn't exist yet, are stated every time until their
+	directory can be watched.
+
+	Entries that are added to, removed from or renamed in a directory only
+	count as a change of the directory when they aren't outputs, the build
+	writes its outputs next to the inputs.
+
+	If changes are lost, because the event queue overflowed or a watched
+	directory was removed, everything is watched and stated again.
+
+	Only available on Linux, watcher_create returns NULL elsewhere.
+*/
+
+/* watches the directories of the graph and stats all the nodes again so
+	nothing that changed before the watches were in place is missed. graph
+	can be NULL when only files are watched */
+struct WATCHER *watcher_create(struct GRAPH *graph);
+void watcher_destroy(struct WATCHER *watcher);
+
+/* watches a file, or a directory, that isn't in the graph, for example a
+	script file or a header that the dependency scanners found */
+void watcher_add_file(struct WATCHER *watcher, const char *path);
+
+/* descriptor that becomes readable when something has changed */
+int watcher_fd(struct WATCHER *watcher);
+
+/* stats the nodes that has changed, returns the number of changes to
+	files that the build reads. changes to the outputs of jobs are not
+	counted */
+unsigned watcher_update(struct WATCHER *watcher);
+
+/* returns 1 if a file that isn't an output has been added to, removed
+	from or renamed in a directory that was added with watcher_add_file
+	since the last call. --watch runs the script again when it has */
+int watcher_listing_changed(struct WATCHER *watcher);
+
+#endif
@@ -0,0 +1,13 @@
+-- output.txt is a copy of input.txt. scripts/test.py builds it with an
+-- artifact cache in the cache directory, removes the output so it's
+-- restored from the cache, changes the input so the job runs again and
+-- then changes it back so the first output is restored again
+
+if family == "windows" then
+	copy = "copy /Y"
+else
+	copy = "cp"
+end
+
+AddJob("output.txt", "copy input.txt", copy .. " input.txt output.txt", "input.txt")
+DefaultTarget("output.txt")
@@ -0,0 +1,11 @@
+#include <iostream> 
+ 
+using namespace std; 
+
+extern int recurse_test();
+ 
+int main() 
+{ 
+        cout << "Hello world!" << recurse_test() << endl;
+        return 0; 
+} 
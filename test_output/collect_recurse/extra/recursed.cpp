@@ -0,0 +1 @@
+int recurse_test() { return 1337; }
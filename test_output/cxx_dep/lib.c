@@ -0,0 +1,7 @@
+#include <stdio.h>
+
+extern int hello()
+{
+	printf("hello world\n");
+	return 0;
+}
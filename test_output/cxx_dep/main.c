@@ -0,0 +1,11 @@
+#include <system_header.h>
+#include <genereted_header.h>
+#include "local_header.h"
+
+extern int hello();
+
+int main()
+{
+	return hello();
+}
+
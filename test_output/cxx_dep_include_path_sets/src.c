@@ -0,0 +1,7 @@
+#include <system_header.h>
+//#include <genereted_header.h>
+#include "local_header.h"
+
+
+
+
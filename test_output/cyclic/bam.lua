@@ -0,0 +1,2 @@
+s = NewSettings()
+Link(s, "cyclic", Compile(s, Collect("*.c")))
@@ -0,0 +1,8 @@
+#include "header1.h"
+#include "header2.h"
+
+int main()
+{
+	return 0;
+}
+
@@ -0,0 +1,5 @@
+#ifndef HEADER1_H
+#define HEADER1_H
+#include "header2.h"
+#endif
+
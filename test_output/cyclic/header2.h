@@ -0,0 +1,5 @@
+#ifndef HEADER2_H
+#define HEADER2_H
+#include "header1.h"
+#endif
+
@@ -0,0 +1,5 @@
+#ifndef HEADER1
+#define HEADER1
+#include "header2.h"
+#include "header_gen.h"
+#endif
@@ -0,0 +1,5 @@
+#ifndef HEADER2
+#define HEADER2
+#include "header1.h"
+#include "header_gen.h"
+#endif
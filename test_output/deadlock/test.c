@@ -0,0 +1,7 @@
+#include "header1.h"
+#include "header2.h"
+
+int main()
+{
+	return 0;
+}
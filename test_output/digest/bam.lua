@@ -0,0 +1,14 @@
+-- mid.txt is generated from input.txt but always gets the same content and
+-- output.txt is a copy of mid.txt. scripts/test.py touches input.txt and
+-- then changes it. with --digest touching it shouldn't run anything and
+-- changing it should only generate mid.txt again, the copy is cut off
+
+if family == "windows" then
+	copy = "copy /Y"
+else
+	copy = "cp"
+end
+
+AddJob("mid.txt", "generate mid.txt", "echo generated > mid.txt", "input.txt")
+AddJob("output.txt", "copy mid.txt", copy .. " mid.txt output.txt", "mid.txt")
+DefaultTarget("output.txt")
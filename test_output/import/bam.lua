@@ -0,0 +1,2 @@
+Import("mod1.lua")
+Import("mod2/mod2.lua")
@@ -0,0 +1 @@
+Import("mod3/mod3.lua")
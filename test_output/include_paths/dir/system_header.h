@@ -0,0 +1,6 @@
+/* UGG!!! */
+#include "../local_header.h"
+#if 0
+#include "../does_not_existing1.h"
+#include <../does_not_existing2.h>
+#endif
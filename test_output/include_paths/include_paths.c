@@ -0,0 +1,8 @@
+#include <system_header.h>
+#include "local_header.h"
+
+int main()
+{
+	return 0;
+}
+
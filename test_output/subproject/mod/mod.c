@@ -0,0 +1,2 @@
+const char *get_magic_string() { return "magic mod string!!!"; }
+
@@ -0,0 +1 @@
+extern const char *get_magic_string();
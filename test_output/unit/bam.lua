@@ -0,0 +1,2 @@
+t = NewSettings():Copy(); t.cc.DOES_NOT_EXIST = 1
+DefaultTarget(PseudoTarget("Test"))
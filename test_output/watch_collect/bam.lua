@@ -0,0 +1,9 @@
+-- every text file in src is copied next to itself. scripts/test.py runs
+-- --watch on it and checks that the copies that the build writes into the
+-- listed directory doesn't make it start over or run the script again
+
+for _, file in ipairs(Collect("src/*.txt")) do
+	local output = PathBase(file) .. ".copy"
+	AddJob(output, "copy " .. file, "cp " .. file .. " " .. output, file)
+	DefaultTarget(output)
+end
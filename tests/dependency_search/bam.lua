@@ -0,0 +1,7 @@
+-- output.txt depends on the libraries that can be found in the current
+-- directory or in p1, p2 and p3. scripts/test.py adds and removes the
+-- libraries between the runs and checks which ones that were found
+
+AddJob("output.txt", "link", "touch output.txt")
+AddDependencySearch("output.txt", {"p1", "p2", "p3"}, {"liba.a", "libb.a", "libc.a"})
+DefaultTarget("output.txt")
@@ -0,0 +1,14 @@
+-- jobs that finishes in a different order than they are started in. the
+-- outputs are never created so the jobs runs every time.
+local jobs = {}
+for i = 1, 8 do
+	local name = "job" .. i
+	if family == "windows" then
+		AddJob(name, name, "echo output " .. i)
+	else
+		AddJob(name, name, "sleep 0.0" .. i .. "; echo output " .. i)
+	end
+	SkipOutputVerification(name)
+	table.insert(jobs, name)
+end
+DefaultTarget(PseudoTarget("all", jobs))